@@ -73,6 +73,16 @@ else()
     message(STATUS "Skipping utilities (ENABLE_UTILS == OFF)")
 endif()
 
+################################
+# OpenMP Support
+################################
+if(ENABLE_OPENMP)
+    set(CONDUIT_USE_OPENMP TRUE)
+    message(STATUS "OpenMP support enabled (CONDUIT_USE_OPENMP == TRUE)")
+else()
+    message(STATUS "OpenMP support disabled (ENABLE_OPENMP == OFF)")
+endif()
+
 #######################################
 # Relay Web Server Support
 #######################################
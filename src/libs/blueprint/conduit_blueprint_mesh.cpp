@@ -19,12 +19,15 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <cmath>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <iterator>
 
 //-----------------------------------------------------------------------------
@@ -33,9 +36,11 @@
 #include "conduit_blueprint_mcarray.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
 #include "conduit_blueprint_mesh_partition.hpp"
 #include "conduit_blueprint_mesh_flatten.hpp"
 #include "conduit_blueprint_mesh.hpp"
+#include "conduit_execution.hpp"
 #include "conduit_log.hpp"
 
 using namespace conduit;
@@ -785,6 +790,29 @@ verify_multi_domain(const Node &n,
         {
             log::info(info, protocol, "is an empty mesh");
         }
+        else if(n.dtype().is_object())
+        {
+            // domains are independent, verify them concurrently
+            // (info children are created up front, outside the loop)
+            const index_t num_domains = n.number_of_children();
+            std::vector<Node*> dom_infos((size_t)num_domains);
+            for(index_t d = 0; d < num_domains; d++)
+            {
+                dom_infos[(size_t)d] = &info[n.child(d).name()];
+            }
+
+            std::vector<int> dom_res((size_t)num_domains, 1);
+            execution::for_all(0, num_domains, [&](index_t d)
+            {
+                dom_res[(size_t)d] = verify_single_domain(n.child(d),
+                                                          *dom_infos[(size_t)d]) ? 1 : 0;
+            });
+
+            for(index_t d = 0; d < num_domains; d++)
+            {
+                res &= (dom_res[(size_t)d] == 1);
+            }
+        }
         else
         {
             NodeConstIterator itr = n.children();
@@ -804,6 +832,208 @@ verify_multi_domain(const Node &n,
     return res;
 }
 
+//-------------------------------------------------------------------------
+// Fingerprint of everything single domain verify inspects: the tree
+// structure (names, dtypes, and lengths) plus the contents of string and
+// scalar leaves (protocol types, references, dims, etc). The values of
+// array leaves are not part of the fingerprint.
+//-------------------------------------------------------------------------
+uint64
+verify_fingerprint(const Node &n)
+{
+    const DataType &dtype = n.dtype();
+    index_t dt_info[3] = { dtype.id(),
+                           dtype.number_of_elements(),
+                           dtype.is_little_endian() ? 1 : 0 };
+    uint64 res = utils::hash64(dt_info, sizeof(dt_info));
+
+    if(dtype.is_object() || dtype.is_list())
+    {
+        const bool is_obj = dtype.is_object();
+        const index_t nchild = n.number_of_children();
+        for(index_t i = 0; i < nchild; i++)
+        {
+            const Node &chld = n.child(i);
+            if(is_obj)
+            {
+                res = utils::hash64_combine(res, utils::hash64(chld.name()));
+            }
+            res = utils::hash64_combine(res, verify_fingerprint(chld));
+        }
+    }
+    else if(dtype.is_string())
+    {
+        res = utils::hash64_combine(res, utils::hash64(n.as_string()));
+    }
+    else if(dtype.number_of_elements() == 1)
+    {
+        res = utils::hash64_combine(res,
+                                    utils::hash64(n.element_ptr(0),
+                                                  dtype.element_bytes()));
+    }
+
+    return res;
+}
+
+//-------------------------------------------------------------------------
+// Cache of bool-only verify results, keyed on domain fingerprints.
+//-------------------------------------------------------------------------
+static const size_t VERIFY_CACHE_MAX_ENTRIES = 4096;
+static std::mutex verify_cache_mutex;
+static std::unordered_map<uint64, bool> verify_cache;
+
+//-------------------------------------------------------------------------
+bool
+verify_cache_lookup(uint64 key, bool &res)
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    std::unordered_map<uint64, bool>::const_iterator itr = verify_cache.find(key);
+    if(itr == verify_cache.end())
+    {
+        return false;
+    }
+    res = itr->second;
+    return true;
+}
+
+//-------------------------------------------------------------------------
+void
+verify_cache_store(uint64 key, bool res)
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    // keep the cache bounded, start over when full
+    if(verify_cache.size() >= VERIFY_CACHE_MAX_ENTRIES)
+    {
+        verify_cache.clear();
+    }
+    verify_cache[key] = res;
+}
+
+//-------------------------------------------------------------------------
+// disables log messages on the calling thread for its lifetime
+//-------------------------------------------------------------------------
+class ScopedQuietLog
+{
+public:
+    ScopedQuietLog()
+    : m_prev(log::messages_enabled())
+    {
+        log::set_messages_enabled(false);
+    }
+
+    ~ScopedQuietLog()
+    {
+        log::set_messages_enabled(m_prev);
+    }
+
+private:
+    ScopedQuietLog(const ScopedQuietLog &);
+    ScopedQuietLog &operator=(const ScopedQuietLog &);
+
+    bool m_prev;
+};
+
+//-------------------------------------------------------------------------
+bool
+verify_single_domain_cached(const Node &n)
+{
+    const uint64 key = verify_fingerprint(n);
+
+    bool res = false;
+    if(!verify_cache_lookup(key, res))
+    {
+        ScopedQuietLog quiet;
+        Node info;
+        res = verify_single_domain(n, info);
+        verify_cache_store(key, res);
+    }
+
+    return res;
+}
+
+//-------------------------------------------------------------------------
+// hash of names, dtype ids, and string contents of a tree (leaf values
+// are included when with_values is true)
+//-------------------------------------------------------------------------
+uint64
+index_fingerprint_walk(const Node &n,
+                       bool with_values)
+{
+    const DataType &dtype = n.dtype();
+    index_t dt_id = dtype.id();
+    uint64 res = utils::hash64(&dt_id, sizeof(index_t));
+
+    if(dtype.is_object() || dtype.is_list())
+    {
+        const bool is_obj = dtype.is_object();
+        const index_t nchild = n.number_of_children();
+        for(index_t i = 0; i < nchild; i++)
+        {
+            const Node &chld = n.child(i);
+            if(is_obj)
+            {
+                res = utils::hash64_combine(res, utils::hash64(chld.name()));
+            }
+            res = utils::hash64_combine(res,
+                                        index_fingerprint_walk(chld,
+                                                               with_values));
+        }
+    }
+    else if(dtype.is_string())
+    {
+        res = utils::hash64_combine(res, utils::hash64(n.as_string()));
+    }
+    else if(with_values && !dtype.is_empty())
+    {
+        Node n_compact;
+        n.compact_to(n_compact);
+        res = utils::hash64_combine(res,
+                                    utils::hash64(n_compact.data_ptr(),
+                                                  n_compact.total_bytes_compact()));
+    }
+
+    return res;
+}
+
+//-------------------------------------------------------------------------
+// Fingerprint of everything generate_index_for_single_domain reads from a
+// domain: the tree structure, string leaves, state cycle and time, and
+// material maps. Domains with the same fingerprint have the same index.
+//-------------------------------------------------------------------------
+uint64
+index_fingerprint(const Node &dom)
+{
+    uint64 res = index_fingerprint_walk(dom, false);
+
+    if(dom.has_path("state/cycle"))
+    {
+        res = utils::hash64_combine(res,
+                  index_fingerprint_walk(dom["state/cycle"], true));
+    }
+
+    if(dom.has_path("state/time"))
+    {
+        res = utils::hash64_combine(res,
+                  index_fingerprint_walk(dom["state/time"], true));
+    }
+
+    if(dom.has_child("matsets"))
+    {
+        NodeConstIterator itr = dom["matsets"].children();
+        while(itr.has_next())
+        {
+            const Node &matset = itr.next();
+            if(matset.has_child("material_map"))
+            {
+                res = utils::hash64_combine(res,
+                          index_fingerprint_walk(matset["material_map"], true));
+            }
+        }
+    }
+
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 // - end internal data function helpers -
 //-----------------------------------------------------------------------------
@@ -851,6 +1081,72 @@ convert_coordset_to_rectilinear(const std::string &/*base_type*/,
     }
 }
 
+//-------------------------------------------------------------------------
+// Returns the number of items (points or elements, each item_bytes wide)
+// handled by one task when a logically structured array is generated in
+// parallel. Blocks hold whole rows (2D) or whole k-slabs (3D).
+index_t
+structured_block_size(const index_t *dims,
+                      index_t ndims,
+                      index_t item_bytes)
+{
+    index_t unit = 1;
+    if(ndims == 2)
+    {
+        unit = dims[0];
+    }
+    else if(ndims == 3)
+    {
+        unit = dims[0] * dims[1];
+    }
+    unit = std::max(unit, (index_t)1);
+
+    const index_t target = std::max(execution::DEFAULT_BLOCK_BYTES / item_bytes,
+                                    (index_t)1);
+    return unit * std::max(target / unit, (index_t)1);
+}
+
+//-------------------------------------------------------------------------
+template<typename T>
+void
+fill_explicit_coords(const float64 *const *axis_vals,
+                     const index_t *dims,
+                     index_t ndims,
+                     T *const *dst)
+{
+    const index_t npts = dims[0] * dims[1] * dims[2];
+    const index_t block = structured_block_size(dims, ndims,
+                                                (index_t)sizeof(T) * ndims);
+    execution::for_all_blocks(npts, block, [&](index_t begin, index_t end)
+    {
+        index_t i = begin % dims[0];
+        index_t j = (begin / dims[0]) % dims[1];
+        index_t k = begin / (dims[0] * dims[1]);
+        for(index_t p = begin; p < end; p++)
+        {
+            dst[0][p] = static_cast<T>(axis_vals[0][i]);
+            if(ndims > 1)
+            {
+                dst[1][p] = static_cast<T>(axis_vals[1][j]);
+            }
+            if(ndims > 2)
+            {
+                dst[2][p] = static_cast<T>(axis_vals[2][k]);
+            }
+
+            if(++i == dims[0])
+            {
+                i = 0;
+                if(++j == dims[1])
+                {
+                    j = 0;
+                    k++;
+                }
+            }
+        }
+    });
+}
+
 //-------------------------------------------------------------------------
 void
 convert_coordset_to_explicit(const std::string &base_type,
@@ -858,7 +1154,6 @@ convert_coordset_to_explicit(const std::string &base_type,
                              conduit::Node &dest)
 {
     bool is_base_rectilinear = base_type == "rectilinear";
-    bool is_base_uniform = base_type == "uniform";
 
     dest.reset();
     dest["type"].set("explicit");
@@ -867,70 +1162,72 @@ convert_coordset_to_explicit(const std::string &base_type,
 
     const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
     const std::vector<std::string> &logical_axes = bputils::LOGICAL_AXES;
+    const index_t ndims = (index_t)csys_axes.size();
 
-    index_t dim_lens[3] = {0, 0, 0}, coords_len = 1;
-    for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
-    {
-        dim_lens[i] = is_base_rectilinear ?
-            coordset["values"][csys_axes[i]].dtype().number_of_elements() :
-            coordset["dims"][logical_axes[i]].to_int64();
-        coords_len *= dim_lens[i];
-    }
-
-    Node info;
-    for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+    // per axis values (as float64), which are expanded into the
+    // explicit coordinate arrays
+    Node axis_nodes[3];
+    const float64 *axis_vals[3] = {NULL, NULL, NULL};
+    index_t dim_lens[3] = {1, 1, 1}, coords_len = 1;
+    for(index_t i = 0; i < ndims; i++)
     {
         const std::string& csys_axis = csys_axes[i];
-
-        // NOTE: The following values are specific to the
-        // rectilinear transform case.
-        const Node &src_cvals_node = coordset.has_child("values") ?
-            coordset["values"][csys_axis] : info;
-        // NOTE: The following values are specific to the
-        // uniform transform case.
-        float64 dim_origin = coordset.has_child("origin") ?
-            coordset["origin"][csys_axis].to_float64() : 0.0;
-        float64 dim_spacing = coordset.has_child("spacing") ?
-            coordset["spacing"]["d"+csys_axis].to_float64() : 1.0;
-
-        index_t dim_block_size = 1, dim_block_count = 1;
-        for(index_t j = 0; j < (index_t)csys_axes.size(); j++)
+        if(is_base_rectilinear)
         {
-            dim_block_size *= (j < i) ? dim_lens[j] : 1;
-            dim_block_count *= (i < j) ? dim_lens[j] : 1;
+            coordset["values"][csys_axis].to_float64_array(axis_nodes[i]);
+            dim_lens[i] = axis_nodes[i].dtype().number_of_elements();
         }
-
-        Node &dst_cvals_node = dest["values"][csys_axis];
-        dst_cvals_node.set(DataType(float_dtype.id(), coords_len));
-
-        Node src_cval_node, dst_cval_node;
-        for(index_t d = 0; d < dim_lens[i]; d++)
+        else // if(is_base_uniform)
         {
-            index_t doffset = d * dim_block_size;
-            for(index_t b = 0; b < dim_block_count; b++)
-            {
-                index_t boffset = b * dim_block_size * dim_lens[i];
-                for(index_t bi = 0; bi < dim_block_size; bi++)
-                {
-                    index_t ioffset = doffset + boffset + bi;
-                    dst_cval_node.set_external(float_dtype,
-                        dst_cvals_node.element_ptr(ioffset));
-
-                    if(is_base_rectilinear)
-                    {
-                        src_cval_node.set_external(
-                            DataType(src_cvals_node.dtype().id(), 1),
-                            (void*)src_cvals_node.element_ptr(d));
-                    }
-                    else if(is_base_uniform)
-                    {
-                        src_cval_node.set(dim_origin + d * dim_spacing);
-                    }
+            float64 dim_origin = coordset.has_child("origin") ?
+                coordset["origin"][csys_axis].to_float64() : 0.0;
+            float64 dim_spacing = coordset.has_child("spacing") ?
+                coordset["spacing"]["d"+csys_axis].to_float64() : 1.0;
+            dim_lens[i] = coordset["dims"][logical_axes[i]].to_int64();
 
-                    src_cval_node.to_data_type(float_dtype.id(), dst_cval_node);
-                }
+            axis_nodes[i].set(DataType::float64(dim_lens[i]));
+            float64 *vals = axis_nodes[i].value();
+            for(index_t d = 0; d < dim_lens[i]; d++)
+            {
+                vals[d] = dim_origin + d * dim_spacing;
             }
         }
+        axis_vals[i] = (dim_lens[i] > 0) ?
+            (const float64*)axis_nodes[i].element_ptr(0) : NULL;
+        coords_len *= dim_lens[i];
+    }
+
+    void *dst_ptrs[3] = {NULL, NULL, NULL};
+    for(index_t i = 0; i < ndims; i++)
+    {
+        Node &dst_cvals_node = dest["values"][csys_axes[i]];
+        dst_cvals_node.set(DataType(float_dtype.id(), coords_len));
+        dst_ptrs[i] = dst_cvals_node.data_ptr();
+    }
+
+    if(coords_len <= 0)
+    {
+        return;
+    }
+
+    if(float_dtype.id() == DataType::FLOAT32_ID)
+    {
+        float32 *dst[3] = {(float32*)dst_ptrs[0],
+                           (float32*)dst_ptrs[1],
+                           (float32*)dst_ptrs[2]};
+        fill_explicit_coords(axis_vals, dim_lens, ndims, dst);
+    }
+    else if(float_dtype.id() == DataType::FLOAT64_ID)
+    {
+        float64 *dst[3] = {(float64*)dst_ptrs[0],
+                           (float64*)dst_ptrs[1],
+                           (float64*)dst_ptrs[2]};
+        fill_explicit_coords(axis_vals, dim_lens, ndims, dst);
+    }
+    else
+    {
+        CONDUIT_ERROR("Unsupported explicit coordinate type: "
+                      << float_dtype.name());
     }
 }
 
@@ -1012,12 +1309,65 @@ convert_topology_to_structured(const std::string &base_type,
     }
 }
 
+//-------------------------------------------------------------------------
+template<typename T>
+void
+fill_structured_connectivity(const bputils::StructuredConnectivity &sconn,
+                             T *conn)
+{
+    const index_t nverts = sconn.indices_per_element();
+    const index_t block = structured_block_size(sconn.element_dims(),
+                                                sconn.dimension(),
+                                                (index_t)sizeof(T) * nverts);
+    execution::for_all_blocks(sconn.number_of_elements(), block,
+        [&](index_t begin, index_t end)
+    {
+        sconn.elements(begin, end, conn + begin * nverts);
+    });
+}
+
+//-------------------------------------------------------------------------
+void
+fill_structured_connectivity(const bputils::StructuredConnectivity &sconn,
+                             conduit::Node &conn_node)
+{
+    if(sconn.number_of_elements() <= 0)
+    {
+        return;
+    }
+
+    void *conn_ptr = conn_node.data_ptr();
+    switch(conn_node.dtype().id())
+    {
+        case DataType::INT8_ID:
+            fill_structured_connectivity(sconn, (int8*)conn_ptr); break;
+        case DataType::INT16_ID:
+            fill_structured_connectivity(sconn, (int16*)conn_ptr); break;
+        case DataType::INT32_ID:
+            fill_structured_connectivity(sconn, (int32*)conn_ptr); break;
+        case DataType::INT64_ID:
+            fill_structured_connectivity(sconn, (int64*)conn_ptr); break;
+        case DataType::UINT8_ID:
+            fill_structured_connectivity(sconn, (uint8*)conn_ptr); break;
+        case DataType::UINT16_ID:
+            fill_structured_connectivity(sconn, (uint16*)conn_ptr); break;
+        case DataType::UINT32_ID:
+            fill_structured_connectivity(sconn, (uint32*)conn_ptr); break;
+        case DataType::UINT64_ID:
+            fill_structured_connectivity(sconn, (uint64*)conn_ptr); break;
+        default:
+            CONDUIT_ERROR("Unsupported connectivity type: "
+                          << conn_node.dtype().name());
+    }
+}
+
 //-------------------------------------------------------------------------
 void
 convert_topology_to_unstructured(const std::string &base_type,
                                  const conduit::Node &topo,
                                  conduit::Node &dest,
-                                 conduit::Node &cdest)
+                                 conduit::Node &cdest,
+                                 const conduit::Node &options)
 {
     bool is_base_structured = base_type == "structured";
     bool is_base_rectilinear = base_type == "rectilinear";
@@ -1037,109 +1387,1116 @@ convert_topology_to_unstructured(const std::string &base_type,
     }
     else if(is_base_uniform)
     {
-        blueprint::mesh::coordset::uniform::to_explicit(*coordset, cdest);
+        blueprint::mesh::coordset::uniform::to_explicit(*coordset, cdest);
+    }
+
+    dest["type"].set("unstructured");
+    dest["coordset"].set(cdest.name());
+    if(topo.has_child("origin"))
+    {
+        dest["origin"].set(topo["origin"]);
+    }
+
+    // TODO(JRC): In this case, should we reach back into the coordset
+    // and use its types to inform those of the topology?
+    DataType int_dtype = bputils::find_widest_dtype(topo, bputils::DEFAULT_INT_DTYPES);
+    if(options.has_child("index_dtype"))
+    {
+        const std::string dtype_name = options["index_dtype"].as_string();
+        int_dtype = DataType(DataType::name_to_id(dtype_name), 1);
+        if(!int_dtype.is_integer())
+        {
+            CONDUIT_ERROR("Invalid 'index_dtype' option '" << dtype_name
+                          << "' (expected an integer type name, "
+                             "for example: 'int32' or 'int64')");
+        }
+    }
+
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(*coordset);
+    const std::vector<std::string> &logical_axes = bputils::LOGICAL_AXES;
+
+    index_t edims_axes[3] = {1, 1, 1};
+    if(is_base_structured)
+    {
+        const conduit::Node &dim_node = topo["elements/dims"];
+        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+        {
+            edims_axes[i] = dim_node[logical_axes[i]].to_index_t();
+        }
+    }
+    else if(is_base_rectilinear)
+    {
+        const conduit::Node &dim_node = (*coordset)["values"];
+        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+        {
+            edims_axes[i] =
+                dim_node[csys_axes[i]].dtype().number_of_elements() - 1;
+        }
+    }
+    else if(is_base_uniform)
+    {
+        const conduit::Node &dim_node = (*coordset)["dims"];
+        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+        {
+            edims_axes[i] = dim_node[logical_axes[i]].to_index_t() - 1;
+        }
+    }
+
+    const bputils::StructuredConnectivity sconn(&edims_axes[0],
+                                                (index_t)csys_axes.size());
+    dest["elements/shape"].set(sconn.shape().type);
+
+    // make sure the largest vertex id fits in the requested index type
+    const index_t max_vert_id = sconn.number_of_points() - 1;
+    Node max_id_node, max_id_check;
+    max_id_node.set(max_vert_id);
+    max_id_node.to_data_type(int_dtype.id(), max_id_check);
+    if(max_vert_id > 0 && max_id_check.to_index_t() != max_vert_id)
+    {
+        CONDUIT_ERROR("Cannot represent vertex id " << max_vert_id
+                      << " using connectivity type " << int_dtype.name());
+    }
+
+    // NOTE: Connectivity is generated (in parallel, when enabled) directly
+    // into the output array. Vertex ordering follows the default Blueprint
+    // ordering for lines, quads, and hexes.
+    conduit::Node &conn_node = dest["elements/connectivity"];
+    conn_node.set(DataType(int_dtype.id(),
+        sconn.number_of_elements() * sconn.indices_per_element()));
+    fill_structured_connectivity(sconn, conn_node);
+}
+
+//-------------------------------------------------------------------------
+// Shape specialized geometry kernels
+//
+// The centroid of an entity is the average of its unique vertices, with
+// coordinates accumulated in increasing vertex id order. Fixed shapes
+// (compile time vertex counts, see topology::shape_traits) use fixed size
+// id buffers, poly shapes gather their ids into a per block buffer.
+//-------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------
+// sorts a short list of ids in place
+//-------------------------------------------------------------------------
+inline void
+sort_short_ids(index_t *ids,
+               index_t num_ids)
+{
+    for(index_t i = 1; i < num_ids; i++)
+    {
+        const index_t v = ids[i];
+        index_t j = i;
+        for(; j > 0 && ids[j-1] > v; j--)
+        {
+            ids[j] = ids[j-1];
+        }
+        ids[j] = v;
+    }
+}
+
+//-------------------------------------------------------------------------
+inline void
+unique_vertex_centroid(index_t *ids,
+                       index_t num_ids,
+                       const float64 *const *axes,
+                       index_t num_axes,
+                       float64 *cent)
+{
+    sort_short_ids(ids, num_ids);
+
+    index_t num_unique = 0;
+    for(index_t i = 0; i < num_ids; i++)
+    {
+        if(num_unique == 0 || ids[num_unique-1] != ids[i])
+        {
+            ids[num_unique++] = ids[i];
+        }
+    }
+
+    const float64 denom = (float64)num_unique;
+    for(index_t a = 0; a < num_axes; a++)
+    {
+        const float64 *vals = axes[a];
+        float64 res = 0.0;
+        for(index_t i = 0; i < num_unique; i++)
+        {
+            res += vals[ids[i]] / denom;
+        }
+        cent[a] = res;
+    }
+}
+
+//-------------------------------------------------------------------------
+// float64 views of the values of each axis of an explicit coordset
+// (converted once when they are not compact float64 arrays)
+//-------------------------------------------------------------------------
+void
+coordset_axes_float64(const Node &coordset,
+                      const std::vector<std::string> &csys_axes,
+                      std::vector<Node> &holders,
+                      std::vector<const float64*> &axes)
+{
+    holders.resize(csys_axes.size());
+    axes.resize(csys_axes.size());
+    for(size_t a = 0; a < csys_axes.size(); a++)
+    {
+        const Node &vals = coordset["values"][csys_axes[a]];
+        if(vals.dtype().is_float64() && vals.dtype().is_compact())
+        {
+            axes[a] = vals.as_float64_ptr();
+        }
+        else
+        {
+            vals.to_float64_array(holders[a]);
+            axes[a] = holders[a].as_float64_ptr();
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// converts float64 values into dest (with the given float dtype), starting
+// at element offset
+//-------------------------------------------------------------------------
+void
+write_float_values(const float64 *vals,
+                   index_t num_vals,
+                   const DataType &float_dtype,
+                   Node &dest,
+                   index_t offset)
+{
+    if(num_vals == 0)
+    {
+        return;
+    }
+
+    Node src_node, dst_node;
+    src_node.set_external(DataType::float64(num_vals),
+                          const_cast<float64*>(vals));
+    dst_node.set_external(DataType(float_dtype.id(), num_vals),
+                          dest.element_ptr(offset));
+    src_node.to_data_type(float_dtype.id(), dst_node);
+}
+
+//-------------------------------------------------------------------------
+// converts index_t values into dest with the given int dtype
+//-------------------------------------------------------------------------
+void
+set_int_values(const std::vector<index_t> &vals,
+               const DataType &int_dtype,
+               Node &dest)
+{
+    Node src_node;
+    src_node.set_external(DataType::index_t((index_t)vals.size()),
+                          const_cast<index_t*>(vals.data()));
+    src_node.to_data_type(int_dtype.id(), dest);
+}
+
+//-------------------------------------------------------------------------
+// Computes the centroids of the elements of one element block,
+// cents[a][eid] is the a-th coordinate of element eid's centroid.
+//-------------------------------------------------------------------------
+struct BlockCentroidsKernel
+{
+    const bputils::topology::element_block &blk;
+    const float64 *const *axes;
+    index_t num_axes;
+    float64 *const *cents;
+
+    BlockCentroidsKernel(const bputils::topology::element_block &b,
+                         const float64 *const *a,
+                         index_t na,
+                         float64 *const *c)
+    : blk(b), axes(a), num_axes(na), cents(c)
+    {}
+
+    void store(index_t i, const float64 *cent) const
+    {
+        for(index_t a = 0; a < num_axes; a++)
+        {
+            cents[a][blk.first_element_id + i] = cent[a];
+        }
+    }
+
+    // fixed shapes
+    template<bputils::topology::ShapeId S>
+    void operator()(std::integral_constant<bputils::topology::ShapeId, S>) const
+    {
+        const index_t NV = bputils::topology::shape_traits<S>::num_vertices;
+        index_t ids[NV];
+        float64 cent[3];
+        for(index_t i = 0; i < blk.num_elements; i++)
+        {
+            const index_t *conn = blk.element(i);
+            for(index_t v = 0; v < NV; v++)
+            {
+                ids[v] = conn[v];
+            }
+            unique_vertex_centroid(ids, NV, axes, num_axes, cent);
+            store(i, cent);
+        }
+    }
+
+    void operator()(std::integral_constant<bputils::topology::ShapeId,
+                                           bputils::topology::ShapeId::Polygonal>) const
+    {
+        std::vector<index_t> ids;
+        float64 cent[3];
+        for(index_t i = 0; i < blk.num_elements; i++)
+        {
+            const index_t *conn = blk.element(i);
+            ids.assign(conn, conn + blk.element_size(i));
+            unique_vertex_centroid(ids.data(), (index_t)ids.size(),
+                                   axes, num_axes, cent);
+            store(i, cent);
+        }
+    }
+
+    void operator()(std::integral_constant<bputils::topology::ShapeId,
+                                           bputils::topology::ShapeId::Polyhedral>) const
+    {
+        std::vector<index_t> ids;
+        float64 cent[3];
+        for(index_t i = 0; i < blk.num_elements; i++)
+        {
+            const index_t *faces = blk.element(i);
+            const index_t num_faces = blk.element_size(i);
+            ids.clear();
+            for(index_t f = 0; f < num_faces; f++)
+            {
+                const index_t face = faces[f];
+                const index_t *fconn = blk.subelement_connectivity +
+                                       blk.subelement_offsets[face];
+                ids.insert(ids.end(), fconn, fconn + blk.subelement_sizes[face]);
+            }
+            unique_vertex_centroid(ids.data(), (index_t)ids.size(),
+                                   axes, num_axes, cent);
+            store(i, cent);
+        }
+    }
+};
+
+//-------------------------------------------------------------------------
+// number of elements of a single shape unstructured topology
+//-------------------------------------------------------------------------
+index_t
+unstructured_number_of_elements(const Node &topo)
+{
+    const Node &elements = topo["elements"];
+    if(elements.has_child("offsets") && !elements["offsets"].dtype().is_empty())
+    {
+        return elements["offsets"].dtype().number_of_elements();
+    }
+
+    const ShapeType topo_shape(topo);
+    if(topo_shape.is_poly())
+    {
+        return elements["sizes"].dtype().number_of_elements();
+    }
+    return elements["connectivity"].dtype().number_of_elements() /
+           topo_shape.indices;
+}
+
+//-------------------------------------------------------------------------
+// Numbers num entities by the first occurrence of their (sorted) vertex
+// ids. get_key(i, key) writes the sorted key_len ids of entity i. On
+// return, gids[i] is the id of entity i and first[g] is the first entity
+// with id g.
+//-------------------------------------------------------------------------
+template<typename GetKey>
+void
+number_unique_entities(index_t num,
+                       index_t key_len,
+                       GetKey get_key,
+                       std::vector<index_t> &gids,
+                       std::vector<index_t> &first)
+{
+    gids.resize((size_t)num);
+    first.clear();
+
+    // open addressing table of first occurrences, grown to keep the load
+    // factor under 1/2
+    size_t capacity = 1024;
+    std::vector<index_t> table(capacity, -1);
+    index_t key[8], other[8];
+
+    const auto key_hash = [&](const index_t *k) -> uint64
+    {
+        return utils::hash64(k, key_len * (index_t)sizeof(index_t));
+    };
+
+    const auto insert_first = [&](index_t i, const index_t *k)
+    {
+        size_t slot = (size_t)key_hash(k) & (capacity - 1);
+        while(table[slot] != -1)
+        {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        table[slot] = i;
+    };
+
+    for(index_t i = 0; i < num; i++)
+    {
+        get_key(i, key);
+        size_t slot = (size_t)key_hash(key) & (capacity - 1);
+        bool found = false;
+        while(table[slot] != -1)
+        {
+            get_key(table[slot], other);
+            if(std::equal(key, key + key_len, other))
+            {
+                found = true;
+                break;
+            }
+            slot = (slot + 1) & (capacity - 1);
+        }
+
+        if(found)
+        {
+            gids[(size_t)i] = gids[(size_t)table[slot]];
+            continue;
+        }
+
+        gids[(size_t)i] = (index_t)first.size();
+        first.push_back(i);
+        table[slot] = i;
+
+        if(2 * first.size() > capacity)
+        {
+            capacity *= 2;
+            table.assign(capacity, -1);
+            for(size_t f = 0; f < first.size(); f++)
+            {
+                get_key(first[f], key);
+                insert_first(first[f], key);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// Entities of a single, fixed shape (tri, quad, tet, hex) topology. Faces
+// and lines are numbered in the same order TopologyMetadata numbers them
+// (by first occurrence when walking elements, then their faces in
+// embedding order, then the lines of those faces), but without building
+// the full association maps. In 2D, each element is its own (only) face.
+//
+// Local faces are indexed by (elem * elem_faces + face), local lines by
+// (local_face * face_lines + line).
+//-------------------------------------------------------------------------
+class FixedShapeCascade
+{
+public:
+    FixedShapeCascade()
+    : dim(0), num_elems(0), elem_verts(0),
+      elem_faces(0), face_verts(0), face_lines(0)
+    {}
+
+    // returns false if the topology is not a single fixed shape 2D or 3D
+    // topology with simple elements (no repeated vertices and no
+    // repeated elements)
+    bool init(const Node &topo)
+    {
+        const Node &elements = topo["elements"];
+        if(!elements.has_child("shape") || !elements["shape"].dtype().is_string() ||
+           !elements.has_child("connectivity"))
+        {
+            return false;
+        }
+
+        elem_shape = ShapeType(topo);
+        if(!elem_shape.is_valid() || elem_shape.is_poly() || elem_shape.dim < 2)
+        {
+            return false;
+        }
+
+        dim = elem_shape.dim;
+        elem_verts = elem_shape.indices;
+        face_shape = (dim == 3) ? ShapeType(elem_shape.embed_id) : elem_shape;
+        elem_faces = (dim == 3) ? elem_shape.embed_count : 1;
+        face_verts = face_shape.indices;
+        face_lines = face_shape.embed_count;
+
+        conn.set(elements["connectivity"]);
+        num_elems = conn.size() / elem_verts;
+        if(num_elems * elem_verts != conn.size())
+        {
+            return false;
+        }
+
+        // only standard offsets are supported
+        if(elements.has_child("offsets") && !elements["offsets"].dtype().is_empty())
+        {
+            const bputils::IndexSpan offsets(elements["offsets"]);
+            if(offsets.size() != num_elems)
+            {
+                return false;
+            }
+            for(index_t e = 0; e < num_elems; e++)
+            {
+                if(offsets[e] != e * elem_verts)
+                {
+                    return false;
+                }
+            }
+        }
+
+        // elements with repeated vertices are not simple
+        std::atomic<bool> simple(true);
+        execution::for_all(0, num_elems, [&](index_t e)
+        {
+            index_t ids[8];
+            std::copy(conn.data() + e * elem_verts,
+                      conn.data() + (e + 1) * elem_verts, ids);
+            sort_short_ids(ids, elem_verts);
+            for(index_t v = 1; v < elem_verts; v++)
+            {
+                if(ids[v] == ids[v-1])
+                {
+                    simple = false;
+                }
+            }
+        });
+        if(!simple)
+        {
+            return false;
+        }
+
+        // neither are repeated elements (they share ids in TopologyMetadata)
+        {
+            std::vector<index_t> elem_gids, elem_first;
+            number_unique_entities(num_elems, elem_verts,
+                [&](index_t e, index_t *key)
+                {
+                    std::copy(conn.data() + e * elem_verts,
+                              conn.data() + (e + 1) * elem_verts, key);
+                    sort_short_ids(key, elem_verts);
+                },
+                elem_gids, elem_first);
+            if((index_t)elem_first.size() != num_elems)
+            {
+                return false;
+            }
+        }
+
+        const index_t num_local_faces = num_elems * elem_faces;
+        if(dim == 3)
+        {
+            face_ids.resize((size_t)(num_local_faces * face_verts));
+            execution::for_all(0, num_elems, [&](index_t e)
+            {
+                const index_t *econn = conn.data() + e * elem_verts;
+                index_t *fids = &face_ids[(size_t)(e * elem_faces * face_verts)];
+                for(index_t i = 0; i < elem_faces * face_verts; i++)
+                {
+                    fids[i] = econn[elem_shape.embedding[i]];
+                }
+            });
+
+            number_unique_entities(num_local_faces, face_verts,
+                [&](index_t lf, index_t *key)
+                {
+                    std::copy(face(lf), face(lf) + face_verts, key);
+                    sort_short_ids(key, face_verts);
+                },
+                face_gids, face_first);
+        }
+        else
+        {
+            face_gids.resize((size_t)num_elems);
+            face_first.resize((size_t)num_elems);
+            for(index_t e = 0; e < num_elems; e++)
+            {
+                face_gids[(size_t)e] = e;
+                face_first[(size_t)e] = e;
+            }
+        }
+
+        number_unique_entities(num_local_faces * face_lines, 2,
+            [&](index_t ll, index_t *key)
+            {
+                const index_t v0 = line_vertex(ll, 0);
+                const index_t v1 = line_vertex(ll, 1);
+                key[0] = std::min(v0, v1);
+                key[1] = std::max(v0, v1);
+            },
+            line_gids, line_first);
+
+        return true;
+    }
+
+    index_t number_of_faces() const { return (index_t)face_first.size(); }
+    index_t number_of_lines() const { return (index_t)line_first.size(); }
+
+    // vertex ids of a local face
+    const index_t *face(index_t lf) const
+    {
+        return (dim == 3) ? &face_ids[(size_t)(lf * face_verts)] :
+                            conn.data() + lf * elem_verts;
+    }
+
+    // vertex k (0: start, 1: end) of a local line
+    index_t line_vertex(index_t ll, index_t k) const
+    {
+        return face(ll / face_lines)[face_shape.embedding[(ll % face_lines) * 2 + k]];
+    }
+
+    ShapeType elem_shape;
+    ShapeType face_shape;
+    index_t dim;
+    index_t num_elems;
+    index_t elem_verts;
+    index_t elem_faces;
+    index_t face_verts;
+    index_t face_lines;
+
+    bputils::IndexSpan conn;
+    std::vector<index_t> face_ids;   // vertex ids of each local face (3D)
+    std::vector<index_t> face_gids;  // id of each local face
+    std::vector<index_t> face_first; // first local face with each id
+    std::vector<index_t> line_gids;  // id of each local line
+    std::vector<index_t> line_first; // first local line with each id
+};
+
+//-------------------------------------------------------------------------
+// cents[a][i] = a-th coordinate of the centroid of the num_ids (<= 8)
+// vertices at get_ids(i), for i in [0, num)
+//-------------------------------------------------------------------------
+template<typename GetIds>
+void
+fixed_entity_centroids(index_t num,
+                       index_t num_ids,
+                       const float64 *const *axes,
+                       index_t num_axes,
+                       float64 *const *cents,
+                       GetIds get_ids)
+{
+    execution::for_all_blocks(num, bputils::topology::DEFAULT_ELEMENT_BLOCK_SIZE,
+        [&](index_t begin, index_t end)
+    {
+        index_t ids[8];
+        float64 cent[3];
+        for(index_t i = begin; i < end; i++)
+        {
+            const index_t *src = get_ids(i);
+            std::copy(src, src + num_ids, ids);
+            unique_vertex_centroid(ids, num_ids, axes, num_axes, cent);
+            for(index_t ai = 0; ai < num_axes; ai++)
+            {
+                cents[ai][i] = cent[ai];
+            }
+        }
+    });
+}
+
+//-------------------------------------------------------------------------
+// Writes the coordinates of the points of coordset followed by the
+// centroids of the lines (if with_lines), faces (3D only) and elements of
+// the given cascade into coords_dest. dim_offsets[d] receives the offset of
+// the dimension d entities (those without coordinates get the current
+// offset, like the TopologyMetadata based code).
+//-------------------------------------------------------------------------
+void
+write_fixed_shape_cascade_coords(const FixedShapeCascade &cascade,
+                                 const Node &coordset,
+                                 bool with_lines,
+                                 const DataType &float_dtype,
+                                 Node &coords_dest,
+                                 std::vector<index_t> &dim_offsets)
+{
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
+    const index_t num_axes = (index_t)csys_axes.size();
+    const index_t num_points = bputils::coordset::length(coordset);
+    const index_t num_lines = with_lines ? cascade.number_of_lines() : 0;
+    const index_t num_faces = (cascade.dim == 3) ? cascade.number_of_faces() : 0;
+    const index_t num_elems = cascade.num_elems;
+
+    dim_offsets.resize((size_t)(cascade.dim + 1));
+    dim_offsets[0] = 0;
+    dim_offsets[1] = num_points;
+    dim_offsets[2] = num_points + num_lines;
+    if(cascade.dim == 3)
+    {
+        dim_offsets[3] = num_points + num_lines + num_faces;
+    }
+
+    const index_t num_coords = num_points + num_lines + num_faces + num_elems;
+    coords_dest.reset();
+    coords_dest["type"].set("explicit");
+    for(index_t ai = 0; ai < num_axes; ai++)
+    {
+        coords_dest["values"][csys_axes[ai]].set(DataType(float_dtype.id(),
+            num_coords));
+    }
+
+    std::vector<Node> axis_holders;
+    std::vector<const float64*> axes;
+    coordset_axes_float64(coordset, csys_axes, axis_holders, axes);
+
+    // centroids of the lines, faces, and elements, by id
+    std::vector< std::vector<float64> > cents((size_t)(3 * num_axes));
+    const auto cent_ptrs = [&](index_t ci, index_t num) -> std::vector<float64*>
+    {
+        std::vector<float64*> ptrs((size_t)num_axes);
+        for(index_t ai = 0; ai < num_axes; ai++)
+        {
+            std::vector<float64> &vals = cents[(size_t)(ci * num_axes + ai)];
+            vals.resize((size_t)num);
+            ptrs[(size_t)ai] = vals.data();
+        }
+        return ptrs;
+    };
+
+    if(with_lines)
+    {
+        std::vector<index_t> line_ids((size_t)(2 * num_lines));
+        execution::for_all(0, num_lines, [&](index_t l)
+        {
+            const index_t ll = cascade.line_first[(size_t)l];
+            line_ids[(size_t)(2 * l)] = cascade.line_vertex(ll, 0);
+            line_ids[(size_t)(2 * l + 1)] = cascade.line_vertex(ll, 1);
+        });
+        fixed_entity_centroids(num_lines, 2, axes.data(), num_axes,
+            cent_ptrs(0, num_lines).data(),
+            [&](index_t l) { return &line_ids[(size_t)(2 * l)]; });
+    }
+    if(cascade.dim == 3)
+    {
+        fixed_entity_centroids(num_faces, cascade.face_verts, axes.data(), num_axes,
+            cent_ptrs(1, num_faces).data(),
+            [&](index_t f) { return cascade.face(cascade.face_first[(size_t)f]); });
+    }
+    fixed_entity_centroids(num_elems, cascade.elem_verts, axes.data(), num_axes,
+        cent_ptrs(2, num_elems).data(),
+        [&](index_t e) { return cascade.conn.data() + e * cascade.elem_verts; });
+
+    for(index_t ai = 0; ai < num_axes; ai++)
+    {
+        Node &dst_axis = coords_dest["values"][csys_axes[ai]];
+        Node dst_data;
+        const Node &src_axis = coordset["values"][csys_axes[ai]];
+        dst_data.set_external(DataType(float_dtype.id(), num_points),
+            dst_axis.element_ptr(0));
+        src_axis.to_data_type(float_dtype.id(), dst_data);
+
+        index_t offset = num_points;
+        const index_t nums[3] = {num_lines, num_faces, num_elems};
+        for(index_t ci = 0; ci < 3; ci++)
+        {
+            write_float_values(cents[(size_t)(ci * num_axes + ai)].data(),
+                               nums[ci], float_dtype, dst_axis, offset);
+            offset += nums[ci];
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// generate_sides for single fixed shape topologies, returns false if the
+// topology isn't supported (see FixedShapeCascade::init)
+//-------------------------------------------------------------------------
+bool
+generate_fixed_shape_sides(const Node &topo,
+                           const Node &coordset,
+                           Node &topo_dest,
+                           Node &coords_dest,
+                           Node &s2dmap,
+                           Node &d2smap)
+{
+    FixedShapeCascade cascade;
+    if(!cascade.init(topo))
+    {
+        return false;
+    }
+
+    const DataType int_dtype = bputils::find_widest_dtype(
+        bputils::link_nodes(topo, coordset), bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(
+        bputils::link_nodes(topo, coordset), bputils::DEFAULT_FLOAT_DTYPE);
+
+    const index_t dim = cascade.dim;
+    const ShapeType side_shape(dim == 3 ? "tet" : "tri");
+    const index_t num_elems = cascade.num_elems;
+    const index_t elem_sides = cascade.elem_faces * cascade.face_lines;
+    const index_t num_sides = num_elems * elem_sides;
+    const index_t side_degree = side_shape.indices;
+
+    topo_dest.reset();
+    topo_dest["type"].set("unstructured");
+    topo_dest["coordset"].set(coords_dest.name());
+    topo_dest["elements/shape"].set(side_shape.type);
+
+    // sides don't use line centroids
+    std::vector<index_t> dim_offsets;
+    write_fixed_shape_cascade_coords(cascade, coordset, false, float_dtype,
+                                     coords_dest, dim_offsets);
+
+    // NOTE: Side ordering retains original element orientation by
+    // creating elements as follows:
+    // - 2D: Face-Line Start => Face-Line End => Face Center
+    // - 3D: Cell-Face-Line Start => Cell-Face-Line End => Cell-Face Center => Cell Center
+    std::vector<index_t> side_conn((size_t)(num_sides * side_degree));
+    std::vector<index_t> side_elems((size_t)num_sides);
+    execution::for_all(0, num_elems, [&](index_t e)
+    {
+        for(index_t s = e * elem_sides; s < (e + 1) * elem_sides; s++)
+        {
+            index_t *sconn = &side_conn[(size_t)(s * side_degree)];
+            sconn[0] = cascade.line_vertex(s, 0);
+            sconn[1] = cascade.line_vertex(s, 1);
+            if(dim == 3)
+            {
+                const index_t lf = s / cascade.face_lines;
+                sconn[2] = dim_offsets[2] + cascade.face_gids[(size_t)lf];
+                sconn[3] = dim_offsets[3] + e;
+            }
+            else
+            {
+                sconn[2] = dim_offsets[2] + e;
+            }
+            side_elems[(size_t)s] = e;
+        }
+    });
+    set_int_values(side_conn, int_dtype, topo_dest["elements/connectivity"]);
+
+    std::vector<index_t> vals((size_t)num_sides);
+    for(index_t s = 0; s < num_sides; s++)
+    {
+        vals[(size_t)s] = s;
+    }
+
+    s2dmap.reset();
+    set_int_values(vals, int_dtype, s2dmap["values"]);
+    set_int_values(std::vector<index_t>((size_t)num_elems, elem_sides),
+                   int_dtype, s2dmap["sizes"]);
+    for(index_t e = 0; e < num_elems; e++)
+    {
+        vals[(size_t)e] = e * elem_sides;
+    }
+    vals.resize((size_t)num_elems);
+    set_int_values(vals, int_dtype, s2dmap["offsets"]);
+
+    d2smap.reset();
+    set_int_values(side_elems, int_dtype, d2smap["values"]);
+    set_int_values(std::vector<index_t>((size_t)num_sides, 1),
+                   int_dtype, d2smap["sizes"]);
+    vals.resize((size_t)num_sides);
+    for(index_t s = 0; s < num_sides; s++)
+    {
+        vals[(size_t)s] = s;
+    }
+    set_int_values(vals, int_dtype, d2smap["offsets"]);
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+// generate_corners for single fixed shape topologies, returns false if the
+// topology isn't supported (see FixedShapeCascade::init)
+//-------------------------------------------------------------------------
+bool
+generate_fixed_shape_corners(const Node &topo,
+                             const Node &coordset,
+                             Node &topo_dest,
+                             Node &coords_dest,
+                             Node &s2dmap,
+                             Node &d2smap)
+{
+    FixedShapeCascade cascade;
+    if(!cascade.init(topo))
+    {
+        return false;
+    }
+
+    const index_t dim = cascade.dim;
+    const bool is_topo_3d = (dim == 3);
+    const index_t num_elems = cascade.num_elems;
+    const index_t elem_verts = cascade.elem_verts;
+    const index_t elem_faces = cascade.elem_faces;
+    const index_t face_lines = cascade.face_lines;
+    const index_t elem_lines = elem_faces * face_lines;
+    // each corner of a (simple) tri, quad, tet, or hex touches 2 lines of
+    // each of its faces, and in 3D, 3 faces and 3 lines
+    const index_t corner_faces = is_topo_3d ? 6 : 1;
+    const index_t num_corners = num_elems * elem_verts;
+
+    // per element scratch lives on the stack, sized for hexs (6 faces of
+    // 4 lines) and their 6 corner faces
+    const index_t max_elem_lines = 24;
+    const index_t max_corner_faces = 6;
+    if(elem_lines > max_elem_lines || corner_faces > max_corner_faces)
+    {
+        return false;
+    }
+
+    // Corner ordering retains original element orientation: each corner
+    // face at point p of (oriented) face f is p => (line leaving p) =>
+    // f center => (line entering p). In 3D, each line l touching p also
+    // gets the face l => (first face) => cell center => (second face),
+    // oriented against the face corner that uses l.
+    std::vector<index_t> cfaces((size_t)(num_corners * corner_faces * 4));
+    std::vector<index_t> dim_offsets(dim + 1);
+    std::atomic<bool> simple(true);
+
+    // offsets of each dimension's coordinates (see the coordinates below)
+    const index_t num_points = bputils::coordset::length(coordset);
+    dim_offsets[0] = 0;
+    dim_offsets[1] = num_points;
+    dim_offsets[2] = num_points + cascade.number_of_lines();
+    if(is_topo_3d)
+    {
+        dim_offsets[3] = dim_offsets[2] + cascade.number_of_faces();
+    }
+    const index_t face_dim = 2;
+
+    execution::for_all(0, num_elems, [&](index_t e)
+    {
+        const index_t lf0 = e * elem_faces;
+        const index_t ll0 = lf0 * face_lines;
+
+        // element points and lines, in order of first occurrence
+        index_t epoints[2 * max_elem_lines];
+        index_t elines[max_elem_lines];
+        index_t eline_locals[max_elem_lines];
+        index_t num_epoints = 0;
+        index_t num_elines = 0;
+        for(index_t l = ll0; l < ll0 + elem_lines; l++)
+        {
+            for(index_t k = 0; k < 2; k++)
+            {
+                const index_t p = cascade.line_vertex(l, k);
+                if(std::find(epoints, epoints + num_epoints, p) == epoints + num_epoints)
+                {
+                    epoints[num_epoints++] = p;
+                }
+            }
+            const index_t lgid = cascade.line_gids[(size_t)l];
+            if(std::find(elines, elines + num_elines, lgid) == elines + num_elines)
+            {
+                elines[num_elines] = lgid;
+                eline_locals[num_elines] = l;
+                num_elines++;
+            }
+        }
+        if(num_epoints != elem_verts)
+        {
+            simple = false;
+            return;
+        }
+
+        for(index_t pi = 0; pi < elem_verts; pi++)
+        {
+            const index_t p = epoints[pi];
+            index_t *cface = &cfaces[(size_t)((e * elem_verts + pi) * corner_faces * 4)];
+            index_t num_cfaces = 0;
+
+            // (local face, line id) => line leaves p in the face
+            index_t orient_faces[2 * max_corner_faces];
+            index_t orient_lines[2 * max_corner_faces];
+            bool orient_out[2 * max_corner_faces];
+            index_t num_orient = 0;
+
+            for(index_t f = 0; f < elem_faces; f++)
+            {
+                index_t line_out = -1, line_in = -1;
+                for(index_t l = 0; l < face_lines; l++)
+                {
+                    const index_t ll = (lf0 + f) * face_lines + l;
+                    if(cascade.line_vertex(ll, 0) == p)
+                    {
+                        line_out = cascade.line_gids[(size_t)ll];
+                    }
+                    if(cascade.line_vertex(ll, 1) == p)
+                    {
+                        line_in = cascade.line_gids[(size_t)ll];
+                    }
+                }
+                if(line_out < 0 && line_in < 0)
+                {
+                    continue;
+                }
+                if(line_out < 0 || line_in < 0 || num_cfaces == corner_faces)
+                {
+                    simple = false;
+                    return;
+                }
+
+                const index_t fgid = cascade.face_gids[(size_t)(lf0 + f)];
+                index_t *cf = cface + num_cfaces * 4;
+                cf[0] = dim_offsets[0] + p;
+                cf[1] = dim_offsets[1] + line_out;
+                cf[2] = dim_offsets[face_dim] + fgid;
+                cf[3] = dim_offsets[1] + line_in;
+                num_cfaces++;
+
+                orient_faces[num_orient] = f;
+                orient_lines[num_orient] = line_out;
+                orient_out[num_orient] = true;
+                num_orient++;
+                orient_faces[num_orient] = f;
+                orient_lines[num_orient] = line_in;
+                orient_out[num_orient] = false;
+                num_orient++;
+            }
+
+            for(index_t li = 0; li < num_elines && is_topo_3d; li++)
+            {
+                const index_t lgid = elines[li];
+                const index_t ll = eline_locals[li];
+                if(cascade.line_vertex(ll, 0) != p && cascade.line_vertex(ll, 1) != p)
+                {
+                    continue;
+                }
+
+                // the faces of this element that use the line
+                index_t lfaces[2] = {-1, -1};
+                index_t num_lfaces = 0;
+                for(index_t f = 0; f < elem_faces && num_lfaces < 2; f++)
+                {
+                    for(index_t l = 0; l < face_lines; l++)
+                    {
+                        if(cascade.line_gids[(size_t)((lf0 + f) * face_lines + l)] == lgid)
+                        {
+                            lfaces[num_lfaces++] = f;
+                            break;
+                        }
+                    }
+                }
+
+                bool first_out = false;
+                bool found = false;
+                for(index_t oi = 0; oi < num_orient; oi++)
+                {
+                    if(orient_faces[oi] == lfaces[0] && orient_lines[oi] == lgid)
+                    {
+                        first_out = orient_out[oi];
+                        found = true;
+                        break;
+                    }
+                }
+                if(num_lfaces != 2 || !found || num_cfaces == corner_faces)
+                {
+                    simple = false;
+                    return;
+                }
+
+                const bool is_first_forward = !first_out;
+                const index_t f0 = cascade.face_gids[(size_t)(lf0 + lfaces[0])];
+                const index_t f1 = cascade.face_gids[(size_t)(lf0 + lfaces[1])];
+                index_t *cf = cface + num_cfaces * 4;
+                cf[0] = dim_offsets[1] + lgid;
+                cf[1] = dim_offsets[2] + (is_first_forward ? f0 : f1);
+                cf[2] = dim_offsets[3] + e;
+                cf[3] = dim_offsets[2] + (is_first_forward ? f1 : f0);
+                num_cfaces++;
+            }
+
+            if(num_cfaces != corner_faces)
+            {
+                simple = false;
+                return;
+            }
+        }
+    });
+
+    if(!simple)
+    {
+        return false;
     }
 
-    dest["type"].set("unstructured");
-    dest["coordset"].set(cdest.name());
-    if(topo.has_child("origin"))
+    const DataType int_dtype = bputils::find_widest_dtype(
+        bputils::link_nodes(topo, coordset), bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(
+        bputils::link_nodes(topo, coordset), bputils::DEFAULT_FLOAT_DTYPE);
+
+    topo_dest.reset();
+    topo_dest["type"].set("unstructured");
+    topo_dest["coordset"].set(coords_dest.name());
+    topo_dest["elements/shape"].set(is_topo_3d ? "polyhedral" : "polygonal");
+    if(is_topo_3d)
     {
-        dest["origin"].set(topo["origin"]);
+        topo_dest["subelements/shape"].set("polygonal");
     }
 
-    // TODO(JRC): In this case, should we reach back into the coordset
-    // and use its types to inform those of the topology?
-    DataType int_dtype = bputils::find_widest_dtype(topo, bputils::DEFAULT_INT_DTYPES);
+    write_fixed_shape_cascade_coords(cascade, coordset, true, float_dtype,
+                                     coords_dest, dim_offsets);
 
-    const std::vector<std::string> csys_axes = bputils::coordset::axes(*coordset);
-    dest["elements/shape"].set(
-        (csys_axes.size() == 1) ? "line" : (
-        (csys_axes.size() == 2) ? "quad" : (
-        (csys_axes.size() == 3) ? "hex"  : "")));
-    const std::vector<std::string> &logical_axes = bputils::LOGICAL_AXES;
+    s2dmap.reset();
+    d2smap.reset();
 
-    index_t edims_axes[3] = {1, 1, 1};
-    if(is_base_structured)
+    if(!is_topo_3d)
     {
-        const conduit::Node &dim_node = topo["elements/dims"];
-        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
-        {
-            edims_axes[i] = dim_node[logical_axes[i]].to_int();
-        }
+        set_int_values(cfaces, int_dtype, topo_dest["elements/connectivity"]);
+        set_int_values(std::vector<index_t>((size_t)num_corners, 4),
+                       int_dtype, topo_dest["elements/sizes"]);
     }
-    else if(is_base_rectilinear)
+    else
     {
-        const conduit::Node &dim_node = (*coordset)["values"];
-        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
-        {
-            edims_axes[i] =
-                dim_node[csys_axes[i]].dtype().number_of_elements() - 1;
-        }
+        // corner faces are shared, keep the unique ones (by vertex set)
+        const index_t num_cfaces = num_corners * corner_faces;
+        std::vector<index_t> cface_gids, cface_first;
+        number_unique_entities(num_cfaces, 4,
+            [&](index_t cf, index_t *key)
+            {
+                std::copy(&cfaces[(size_t)(cf * 4)], &cfaces[(size_t)(cf * 4)] + 4, key);
+                sort_short_ids(key, 4);
+            },
+            cface_gids, cface_first);
+
+        std::vector<index_t> subconn(cface_first.size() * 4);
+        std::vector<index_t> subsizes(cface_first.size());
+        execution::for_all(0, (index_t)cface_first.size(), [&](index_t f)
+        {
+            const index_t *src = &cfaces[(size_t)(cface_first[(size_t)f] * 4)];
+            std::copy(src, src + 4, &subconn[(size_t)(f * 4)]);
+            index_t key[4];
+            std::copy(src, src + 4, key);
+            sort_short_ids(key, 4);
+            subsizes[(size_t)f] = 1;
+            for(index_t k = 1; k < 4; k++)
+            {
+                subsizes[(size_t)f] += (key[k] != key[k-1]) ? 1 : 0;
+            }
+        });
+
+        set_int_values(cface_gids, int_dtype, topo_dest["elements/connectivity"]);
+        set_int_values(std::vector<index_t>((size_t)num_corners, corner_faces),
+                       int_dtype, topo_dest["elements/sizes"]);
+        set_int_values(subconn, int_dtype, topo_dest["subelements/connectivity"]);
+        set_int_values(subsizes, int_dtype, topo_dest["subelements/sizes"]);
     }
-    else if(is_base_uniform)
+
+    std::vector<index_t> vals((size_t)num_corners);
+    for(index_t c = 0; c < num_corners; c++)
     {
-        const conduit::Node &dim_node = (*coordset)["dims"];
-        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
-        {
-            edims_axes[i] = dim_node[logical_axes[i]].to_int() - 1;
-        }
+        vals[(size_t)c] = c;
     }
+    set_int_values(vals, int_dtype, s2dmap["values"]);
+    set_int_values(std::vector<index_t>((size_t)num_elems, elem_verts),
+                   int_dtype, s2dmap["sizes"]);
 
-    index_t vdims_axes[3] = {1, 1, 1}, num_elems = 1;
-    for(index_t d = 0; d < 3; d++)
+    for(index_t c = 0; c < num_corners; c++)
     {
-        num_elems *= edims_axes[d];
-        vdims_axes[d] = edims_axes[d] + 1;
+        vals[(size_t)c] = c / elem_verts;
     }
-    index_t indices_per_elem = (index_t) pow(2, csys_axes.size());
+    set_int_values(vals, int_dtype, d2smap["values"]);
+    set_int_values(std::vector<index_t>((size_t)num_corners, 1),
+                   int_dtype, d2smap["sizes"]);
 
-    conduit::Node &conn_node = dest["elements/connectivity"];
-    conn_node.set(DataType(int_dtype.id(), num_elems * indices_per_elem));
+    bputils::topology::unstructured::generate_offsets(topo_dest,
+                                                      topo_dest["elements/offsets"]);
 
-    Node src_idx_node, dst_idx_node;
-    index_t curr_elem[3], curr_vert[3];
+    for(index_t c = 0; c < num_corners; c++)
+    {
+        vals[(size_t)c] = c;
+    }
+    set_int_values(vals, int_dtype, d2smap["offsets"]);
+    vals.resize((size_t)num_elems);
     for(index_t e = 0; e < num_elems; e++)
     {
-        grid_id_to_ijk(e, &edims_axes[0], &curr_elem[0]);
-
-        // NOTE(JRC): In order to get all adjacent vertices for the
-        // element, we use the bitwise interpretation of each index
-        // per element to inform the direction (e.g. 5, which is
-        // 101 bitwise, means (z+1, y+0, x+1)).
-        for(index_t i = 0, v = 0; i < indices_per_elem; i++)
-        {
-            memcpy(&curr_vert[0], &curr_elem[0], 3 * sizeof(index_t));
-            for(index_t d = 0; d < (index_t)csys_axes.size(); d++)
-            {
-                curr_vert[d] += (i & (index_t)pow(2, d)) >> d;
-            }
-            grid_ijk_to_id(&curr_vert[0], &vdims_axes[0], v);
-
-            src_idx_node.set(v);
-            dst_idx_node.set_external(int_dtype,
-                conn_node.element_ptr(e * indices_per_elem + i));
-            src_idx_node.to_data_type(int_dtype.id(), dst_idx_node);
-        }
-
-        // TODO(JRC): This loop inverts quads/hexes to conform to
-        // the default Blueprint ordering. Once the ordering transforms
-        // are introduced, this code should be removed and replaced
-        // with initializing the ordering label value.
-        for(index_t p = 2; p < indices_per_elem; p += 4)
-        {
-            index_t p1 = e * indices_per_elem + p;
-            index_t p2 = e * indices_per_elem + p + 1;
-
-            Node t1, t2, t3;
-            t1.set(int_dtype, conn_node.element_ptr(p1));
-            t2.set(int_dtype, conn_node.element_ptr(p2));
-
-            t3.set_external(int_dtype, conn_node.element_ptr(p1));
-            t2.to_data_type(int_dtype.id(), t3);
-            t3.set_external(int_dtype, conn_node.element_ptr(p2));
-            t1.to_data_type(int_dtype.id(), t3);
-        }
+        vals[(size_t)e] = e * elem_verts;
     }
+    set_int_values(vals, int_dtype, s2dmap["offsets"]);
+
+    return true;
 }
 
 // NOTE(JRC): The following two functions need to be passed the coordinate set
@@ -1159,30 +2516,10 @@ calculate_unstructured_centroids(const conduit::Node &topo,
     // 'mesh::topology::unstructured::generate_centroids' that exists because there
     // is currently no good way in Blueprint to create mappings with sparse data.
     const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
-
-    Node topo_offsets;
-    bputils::topology::unstructured::generate_offsets(topo, topo_offsets);
-    const index_t topo_num_elems = topo_offsets.dtype().number_of_elements();
+    const index_t num_axes = (index_t)csys_axes.size();
+    const index_t topo_num_elems = unstructured_number_of_elements(topo);
 
     const ShapeCascade topo_cascade(topo);
-    const ShapeType &topo_shape = topo_cascade.get_shape();
-
-    Node topo_sizes;
-    if (topo_shape.is_poly())
-    {
-      topo_sizes = topo["elements/sizes"];
-    }
-
-    Node topo_subconn;
-    Node topo_subsizes;
-    Node topo_suboffsets;
-    if (topo_shape.is_polyhedral())
-    {
-        const Node &topo_subconn_const = topo["subelements/connectivity"];
-        topo_subconn.set_external(topo_subconn_const);
-        topo_subsizes = topo["subelements/sizes"];
-        topo_suboffsets = topo["subelements/offsets"];
-    }
 
     // Discover Data Types //
 
@@ -1195,115 +2532,66 @@ calculate_unstructured_centroids(const conduit::Node &topo,
         float_dtype = bputils::find_widest_dtype(src_node, bputils::DEFAULT_FLOAT_DTYPE);
     }
 
-    const Node &topo_conn_const = topo["elements/connectivity"];
-    Node topo_conn; topo_conn.set_external(topo_conn_const);
-    const DataType conn_dtype(topo_conn.dtype().id(), 1);
-    const DataType offset_dtype(topo_offsets.dtype().id(), 1);
-    const DataType size_dtype(topo_sizes.dtype().id(), 1);
-
-    const DataType subconn_dtype(topo_subconn.dtype().id(), 1);
-    const DataType suboffset_dtype(topo_suboffsets.dtype().id(), 1);
-    const DataType subsize_dtype(topo_subsizes.dtype().id(), 1);
-
     // Allocate Data Templates for Outputs //
 
     dest.reset();
     dest["type"].set("unstructured");
     dest["coordset"].set(cdest.name());
     dest["elements/shape"].set(topo_cascade.get_shape(0).type);
-    dest["elements/connectivity"].set(DataType(int_dtype.id(), topo_num_elems));
+    {
+        std::vector<index_t> ids((size_t)topo_num_elems);
+        for(index_t ei = 0; ei < topo_num_elems; ei++)
+        {
+            ids[(size_t)ei] = ei;
+        }
+        set_int_values(ids, int_dtype, dest["elements/connectivity"]);
+    }
 
     cdest.reset();
     cdest["type"].set("explicit");
-    for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
+    for(index_t ai = 0; ai < num_axes; ai++)
     {
         cdest["values"][csys_axes[ai]].set(DataType(float_dtype.id(), topo_num_elems));
     }
 
     // Compute Data for Centroid Topology //
 
-    Node data_node;
-    for(index_t ei = 0; ei < topo_num_elems; ei++)
-    {
-        index_t esize = 0;
-        if (topo_shape.is_polygonal())
-        {
-            data_node.set_external(size_dtype, topo_sizes.element_ptr(ei));
-            esize = data_node.to_int64();
-        }
-        data_node.set_external(offset_dtype, topo_offsets.element_ptr(ei));
-        const index_t eoffset = data_node.to_int64();
+    std::vector<Node> axis_holders;
+    std::vector<const float64*> axes;
+    coordset_axes_float64(coordset, csys_axes, axis_holders, axes);
 
-        if (topo_shape.is_polyhedral())
+    // compute in place for float64 outputs, otherwise convert afterwards
+    std::vector< std::vector<float64> > cent_holders((size_t)num_axes);
+    std::vector<float64*> cents((size_t)num_axes);
+    for(index_t ai = 0; ai < num_axes; ai++)
+    {
+        if(float_dtype.is_float64())
         {
-            data_node.set_external(size_dtype, topo_sizes.element_ptr(ei));
+            cents[(size_t)ai] = cdest["values"][csys_axes[ai]].as_float64_ptr();
         }
-        const index_t elem_num_faces = topo_shape.is_polyhedral() ?
-            data_node.to_int64() : 1;
-
-        std::set<index_t> elem_coord_indices;
-        for(index_t fi = 0, foffset = eoffset;
-            fi < elem_num_faces; fi++)
+        else
         {
-
-            index_t subelem_index = 0;
-            index_t subelem_offset = 0;
-            index_t subelem_size = 0;
-            if (topo_shape.is_polyhedral())
-            {
-                data_node.set_external(conn_dtype, topo_conn.element_ptr(foffset));
-                subelem_index = data_node.to_int64();
-                data_node.set_external(suboffset_dtype, topo_suboffsets.element_ptr(subelem_index));
-                subelem_offset = data_node.to_int64();
-                data_node.set_external(subsize_dtype, topo_subsizes.element_ptr(subelem_index));
-                subelem_size = data_node.to_int64();
-            }
-
-            const index_t face_num_coords =
-                topo_shape.is_polyhedral() ? subelem_size :
-                topo_shape.is_polygonal() ? esize :
-                topo_shape.indices;
-
-            for(index_t ci = 0; ci < face_num_coords; ci++)
-            {
-                if (topo_shape.is_polyhedral())
-                {
-                    data_node.set_external(subconn_dtype, topo_subconn.element_ptr(subelem_offset + ci));
-                }
-                else
-                {
-                    data_node.set_external(conn_dtype, topo_conn.element_ptr(foffset + ci));
-                }
-                elem_coord_indices.insert(data_node.to_int64());
-            }
-            foffset += topo_shape.is_polyhedral() ? 1 : face_num_coords;
+            cent_holders[(size_t)ai].resize((size_t)topo_num_elems);
+            cents[(size_t)ai] = cent_holders[(size_t)ai].data();
         }
+    }
 
-        float64 ecentroid[3] = {0.0, 0.0, 0.0};
-        for(std::set<index_t>::iterator elem_cindices_it = elem_coord_indices.begin();
-            elem_cindices_it != elem_coord_indices.end(); ++elem_cindices_it)
+    if(topo_num_elems > 0)
+    {
+        bputils::topology::for_all_element_blocks(topo,
+            [&](const bputils::topology::element_block &blk)
         {
-            index_t ci = *elem_cindices_it;
-            for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
-            {
-                const Node &axis_data = coordset["values"][csys_axes[ai]];
-                data_node.set_external(DataType(axis_data.dtype().id(), 1),
-                    const_cast<void*>(axis_data.element_ptr(ci)));
-                ecentroid[ai] += data_node.to_float64() / elem_coord_indices.size();
-            }
-        }
-
-        int64 ei_value = static_cast<int64>(ei);
-        Node ei_data(DataType::int64(1), &ei_value, true);
-        data_node.set_external(int_dtype, dest["elements/connectivity"].element_ptr(ei));
-        ei_data.to_data_type(int_dtype.id(), data_node);
+            bputils::topology::dispatch_shape(blk.shape,
+                BlockCentroidsKernel(blk, axes.data(), num_axes, cents.data()));
+        });
+    }
 
-        for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
+    if(!float_dtype.is_float64())
+    {
+        for(index_t ai = 0; ai < num_axes; ai++)
         {
-            data_node.set_external(float_dtype,
-                cdest["values"][csys_axes[ai]].element_ptr(ei));
-            Node center_data(DataType::float64(), &ecentroid[ai], true);
-            center_data.to_data_type(float_dtype.id(), data_node);
+            write_float_values(cents[(size_t)ai], topo_num_elems, float_dtype,
+                               cdest["values"][csys_axes[ai]], 0);
         }
     }
 }
@@ -1425,6 +2713,53 @@ mesh::verify(const Node &mesh,
 }
 
 
+//-----------------------------------------------------------------------------
+bool
+mesh::verify(const Node &mesh)
+{
+    if(mesh.has_child("coordsets"))
+    {
+        return verify_single_domain_cached(mesh);
+    }
+
+    const DataType &dtype = mesh.dtype();
+    if(!dtype.is_object() && !dtype.is_list() && !dtype.is_empty())
+    {
+        return false;
+    }
+
+    // verify domains concurrently, once one fails the rest are skipped
+    const index_t num_domains = mesh.number_of_children();
+    std::vector<int> dom_res((size_t)num_domains, 1);
+    std::atomic<bool> failed(false);
+    execution::for_all(0, num_domains, [&](index_t d)
+    {
+        if(!failed && !verify_single_domain_cached(mesh.child(d)))
+        {
+            dom_res[(size_t)d] = 0;
+            failed = true;
+        }
+    });
+
+    for(index_t d = 0; d < num_domains; d++)
+    {
+        if(dom_res[(size_t)d] == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::clear_verify_cache()
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    verify_cache.clear();
+}
+
+
 //-------------------------------------------------------------------------
 bool mesh::is_multi_domain(const conduit::Node &mesh)
 {
@@ -1596,17 +2931,69 @@ mesh::generate_index(const conduit::Node &mesh,
     }
     else if(blueprint::mesh::is_multi_domain(mesh))
     {
-        NodeConstIterator itr = mesh.children();
+        // many domains usually share the same structure, so we only
+        // generate index entries for distinct domains (by fingerprint)
+        const index_t num_doms = mesh.number_of_children();
+        std::vector<uint64> dom_keys((size_t)num_doms);
+        execution::for_all(0, num_doms, [&](index_t d)
+        {
+            dom_keys[(size_t)d] = index_fingerprint(mesh.child(d));
+        });
 
-        while(itr.has_next())
+        // distinct domains, in order of first occurrence
+        std::unordered_map<uint64, index_t> key_to_unique;
+        std::vector<index_t> unique_doms;
+        std::vector<index_t> unique_last;
+        for(index_t d = 0; d < num_doms; d++)
+        {
+            std::unordered_map<uint64, index_t>::const_iterator itr =
+                key_to_unique.find(dom_keys[(size_t)d]);
+            if(itr == key_to_unique.end())
+            {
+                key_to_unique[dom_keys[(size_t)d]] = (index_t)unique_doms.size();
+                unique_doms.push_back(d);
+                unique_last.push_back(d);
+            }
+            else
+            {
+                unique_last[(size_t)itr->second] = d;
+            }
+        }
+
+        const index_t num_unique = (index_t)unique_doms.size();
+        std::vector<Node> unique_idx((size_t)num_unique);
+        execution::for_all(0, num_unique, [&](index_t u)
         {
-            Node curr_idx;
-            const Node &cld = itr.next();
-            generate_index_for_single_domain(cld,
+            generate_index_for_single_domain(mesh.child(unique_doms[(size_t)u]),
                                              ref_path,
-                                             curr_idx);
-            // add any new entries to the running index
-            index_out.update(curr_idx);
+                                             unique_idx[(size_t)u]);
+        });
+
+        // merging in order of first occurrence creates entries in the
+        // same order as merging every domain, merging again in order of
+        // last occurrence leaves the same (last domain wins) values
+        for(index_t u = 0; u < num_unique; u++)
+        {
+            index_out.update(unique_idx[(size_t)u]);
+        }
+
+        if(num_unique > 1)
+        {
+            std::vector<index_t> last_order((size_t)num_unique);
+            for(index_t u = 0; u < num_unique; u++)
+            {
+                last_order[(size_t)u] = u;
+            }
+            std::sort(last_order.begin(), last_order.end(),
+                      [&](index_t a, index_t b)
+                      {
+                          return unique_last[(size_t)a] < unique_last[(size_t)b];
+                      });
+
+            for(index_t u = 0; u < num_unique; u++)
+            {
+                index_out.update(unique_idx[(size_t)last_order[(size_t)u]]);
+            }
         }
     }
     else
@@ -2479,7 +3866,19 @@ mesh::topology::uniform::to_unstructured(const conduit::Node &topo,
                                          conduit::Node &topo_dest,
                                          conduit::Node &coords_dest)
 {
-    convert_topology_to_unstructured("uniform", topo, topo_dest, coords_dest);
+    convert_topology_to_unstructured("uniform", topo, topo_dest, coords_dest,
+                                     Node());
+}
+
+//-------------------------------------------------------------------------
+void
+mesh::topology::uniform::to_unstructured(const conduit::Node &topo,
+                                         conduit::Node &topo_dest,
+                                         conduit::Node &coords_dest,
+                                         const conduit::Node &options)
+{
+    convert_topology_to_unstructured("uniform", topo, topo_dest, coords_dest,
+                                     options);
 }
 
 //-----------------------------------------------------------------------------
@@ -2525,7 +3924,19 @@ mesh::topology::rectilinear::to_unstructured(const conduit::Node &topo,
                                              conduit::Node &topo_dest,
                                              conduit::Node &coords_dest)
 {
-    convert_topology_to_unstructured("rectilinear", topo, topo_dest, coords_dest);
+    convert_topology_to_unstructured("rectilinear", topo, topo_dest, coords_dest,
+                                     Node());
+}
+
+//-------------------------------------------------------------------------
+void
+mesh::topology::rectilinear::to_unstructured(const conduit::Node &topo,
+                                             conduit::Node &topo_dest,
+                                             conduit::Node &coords_dest,
+                                             const conduit::Node &options)
+{
+    convert_topology_to_unstructured("rectilinear", topo, topo_dest, coords_dest,
+                                     options);
 }
 
 //-----------------------------------------------------------------------------
@@ -2578,7 +3989,19 @@ mesh::topology::structured::to_unstructured(const conduit::Node &topo,
                                             conduit::Node &topo_dest,
                                             conduit::Node &coords_dest)
 {
-    convert_topology_to_unstructured("structured", topo, topo_dest, coords_dest);
+    convert_topology_to_unstructured("structured", topo, topo_dest, coords_dest,
+                                     Node());
+}
+
+//-------------------------------------------------------------------------
+void
+mesh::topology::structured::to_unstructured(const conduit::Node &topo,
+                                            conduit::Node &topo_dest,
+                                            conduit::Node &coords_dest,
+                                            const conduit::Node &options)
+{
+    convert_topology_to_unstructured("structured", topo, topo_dest, coords_dest,
+                                     options);
 }
 
 //-----------------------------------------------------------------------------
@@ -2624,7 +4047,65 @@ mesh::topology::unstructured::verify(const Node &topo,
         // shape stream case
         else if(topo_elems.has_child("element_types"))
         {
-            // TODO
+            elems_res &= verify_object_field(protocol, topo_elems, info_elems, "element_types");
+            if(elems_res)
+            {
+                const Node &etypes = topo_elems["element_types"];
+                Node &etypes_info = info_elems["element_types"];
+                NodeConstIterator itr = etypes.children();
+                while(itr.has_next())
+                {
+                    const Node &chld  = itr.next();
+                    Node &chld_info = etypes_info[itr.name()];
+
+                    bool chld_res = verify_integer_field(protocol, chld, chld_info, "stream_id");
+                    if(verify_field_exists(protocol, chld, chld_info, "shape") &&
+                       mesh::topology::shape::verify(chld["shape"], chld_info["shape"]))
+                    {
+                        if(utils::ShapeType(chld["shape"].as_string()).is_poly())
+                        {
+                            log::error(chld_info, protocol,
+                                "polygonal and polyhedral shapes are not supported in shape streams");
+                            chld_res = false;
+                        }
+                    }
+                    else
+                    {
+                        chld_res = false;
+                    }
+
+                    log::validation(chld_info,chld_res);
+                    elems_res &= chld_res;
+                }
+            }
+
+            if(verify_object_field(protocol, topo_elems, info_elems, "element_index"))
+            {
+                const Node &eindex = topo_elems["element_index"];
+                Node &eindex_info = info_elems["element_index"];
+                bool eindex_res = verify_integer_field(protocol, eindex, eindex_info, "stream_ids");
+                if(eindex.has_child("element_counts"))
+                {
+                    eindex_res &= verify_integer_field(protocol, eindex, eindex_info, "element_counts");
+                }
+                else if(eindex.has_child("offsets"))
+                {
+                    eindex_res &= verify_integer_field(protocol, eindex, eindex_info, "offsets");
+                }
+                else
+                {
+                    log::error(eindex_info, protocol, "missing child 'element_counts' or 'offsets'");
+                    eindex_res = false;
+                }
+                log::validation(eindex_info,eindex_res);
+                elems_res &= eindex_res;
+            }
+            else
+            {
+                elems_res = false;
+            }
+
+            elems_res &= verify_integer_field(protocol, topo_elems, info_elems, "stream");
         }
         // mixed shape case
         else if(topo_elems.number_of_children() != 0)
@@ -2867,12 +4348,15 @@ mesh::topology::unstructured::generate_centroids(const Node &topo,
     const Node *coordset = bputils::find_reference_node(topo, "coordset");
     calculate_unstructured_centroids(topo, *coordset, topo_dest, coords_dest);
 
+    // NOTE: the topology length is evaluated once, it's not constant time
+    // for every topology type
+    const index_t topo_num_elems = bputils::topology::length(topo);
     Node map_node;
-    std::vector<index_t> map_vec;
-    for(index_t ei = 0; ei < bputils::topology::length(topo); ei++)
+    std::vector<index_t> map_vec((size_t)(2 * topo_num_elems));
+    for(index_t ei = 0; ei < topo_num_elems; ei++)
     {
-        map_vec.push_back(1);
-        map_vec.push_back(ei);
+        map_vec[(size_t)(2 * ei)] = 1;
+        map_vec[(size_t)(2 * ei + 1)] = ei;
     }
     map_node.set(map_vec);
 
@@ -2906,6 +4390,13 @@ mesh::topology::unstructured::generate_sides(const Node &topo,
             "input tology must be topologically 2D or 3D.");
     }
 
+    // single tri/quad/tet/hex topologies don't need the full cascade
+    if(generate_fixed_shape_sides(topo, *coordset, topo_dest, coords_dest,
+                                   s2dmap, d2smap))
+    {
+        return;
+    }
+
     // Extract Derived Coordinate/Topology Data //
 
     const TopologyMetadata topo_data(topo, *coordset);
@@ -4099,6 +5590,13 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
             "input tology must be topologically 2D or 3D.");
     }
 
+    // single tri/quad/tet/hex topologies don't need the full cascade
+    if(generate_fixed_shape_corners(topo, *coordset, topo_dest, coords_dest,
+                                     s2dmap, d2smap))
+    {
+        return;
+    }
+
     // Extract Derived Coordinate/Topology Data //
 
     const TopologyMetadata topo_data(topo, *coordset);
@@ -5204,43 +6702,62 @@ mesh::adjset::to_pairwise(const Node &adjset,
     std::vector<std::string> adjset_group_names = adjset["groups"].child_names();
     std::sort(adjset_group_names.begin(), adjset_group_names.end());
 
-    // Compile ordered lists for each neighbor containing their unique lists
-    // of 'adjset' entity indices, as compiled from all groups in the source 'adjset'.
-    std::map<index_t, std::vector<index_t>> pair_values_map;
+    std::vector<std::unique_ptr<bputils::IndexSpan>> group_values;
+    std::vector<index_t> neighbor_ids;
     for(const std::string &group_name : adjset_group_names)
     {
         const Node &group_node = adjset["groups"][group_name];
-
-        std::vector<index_t> group_neighbors;
-        {
-            const Node &group_nvals = group_node["neighbors"];
-            for(index_t ni = 0; ni < group_nvals.dtype().number_of_elements(); ++ni)
-            {
-                Node temp(DataType(group_nvals.dtype().id(), 1),
-                    (void*)group_nvals.element_ptr(ni), true);
-                group_neighbors.push_back(temp.to_index_t());
-            }
-        }
-
-        std::vector<index_t> group_values;
+        const bputils::IndexSpan group_neighbors(group_node["neighbors"]);
+        group_values.emplace_back(new bputils::IndexSpan(group_node["values"]));
+        neighbor_ids.insert(neighbor_ids.end(),
+            group_neighbors.begin(), group_neighbors.end());
+    }
+    std::sort(neighbor_ids.begin(), neighbor_ids.end());
+    neighbor_ids.erase(std::unique(neighbor_ids.begin(), neighbor_ids.end()),
+                       neighbor_ids.end());
+
+    // Each neighbor's values are the values of every group (in group name
+    // order) that lists the neighbor, stored back to back (CSR) by neighbor.
+    // Find where each (group, neighbor) copy goes, then copy in parallel.
+    std::vector<index_t> neighbor_offsets(neighbor_ids.size() + 1, 0);
+    std::vector<index_t> copy_groups, copy_neighbors;
+    for(size_t gi = 0; gi < adjset_group_names.size(); gi++)
+    {
+        const bputils::IndexSpan group_neighbors(
+            adjset["groups"][adjset_group_names[gi]]["neighbors"]);
+        for(const index_t &neighbor_id : group_neighbors)
         {
-            const Node &group_vals = group_node["values"];
-            for(index_t vi = 0; vi < group_vals.dtype().number_of_elements(); ++vi)
-            {
-                Node temp(DataType(group_vals.dtype().id(), 1),
-                    (void*)group_vals.element_ptr(vi), true);
-                group_values.push_back(temp.to_index_t());
-            }
+            const size_t ni = std::lower_bound(neighbor_ids.begin(),
+                neighbor_ids.end(), neighbor_id) - neighbor_ids.begin();
+            copy_groups.push_back((index_t)gi);
+            copy_neighbors.push_back((index_t)ni);
+            neighbor_offsets[ni + 1] += group_values[gi]->size();
         }
+    }
+    for(size_t ni = 0; ni < neighbor_ids.size(); ni++)
+    {
+        neighbor_offsets[ni + 1] += neighbor_offsets[ni];
+    }
 
-        for(const index_t &neighbor_id : group_neighbors)
+    std::vector<index_t> copy_offsets(copy_groups.size());
+    {
+        std::vector<index_t> neighbor_ends(neighbor_offsets.begin(),
+                                           neighbor_offsets.end() - 1);
+        for(size_t ci = 0; ci < copy_groups.size(); ci++)
         {
-            std::vector<index_t> &neighbor_values = pair_values_map[neighbor_id];
-            neighbor_values.insert(neighbor_values.end(),
-                group_values.begin(), group_values.end());
+            index_t &neighbor_end = neighbor_ends[(size_t)copy_neighbors[ci]];
+            copy_offsets[ci] = neighbor_end;
+            neighbor_end += group_values[(size_t)copy_groups[ci]]->size();
         }
     }
 
+    std::vector<index_t> values((size_t)neighbor_offsets.back());
+    execution::for_all(0, (index_t)copy_groups.size(), [&](index_t ci)
+    {
+        const bputils::IndexSpan &src = *group_values[(size_t)copy_groups[(size_t)ci]];
+        std::copy(src.begin(), src.end(), values.begin() + copy_offsets[(size_t)ci]);
+    });
+
     // Given ordered lists of adjset values per neighbor, generate the destination
     // adjset hierarchy.
     Node adjset_template;
@@ -5250,21 +6767,18 @@ mesh::adjset::to_pairwise(const Node &adjset,
     dest.set(adjset_template);
     dest["groups"].set(DataType::object());
 
-    for(const auto &pair_values_pair : pair_values_map)
+    for(size_t ni = 0; ni < neighbor_ids.size(); ni++)
     {
-        const index_t &neighbor_id = pair_values_pair.first;
-        const std::vector<index_t> &neighbor_values = pair_values_pair.second;
+        const index_t num_values = neighbor_offsets[ni + 1] - neighbor_offsets[ni];
 
         Node &group_node = dest["groups"][std::to_string(dest["groups"].number_of_children())];
-        group_node["neighbors"].set(DataType(int_dtype.id(), 1));
         {
-            Node temp(DataType::index_t(1), (void*)&neighbor_id, true);
+            Node temp(DataType::index_t(1), (void*)&neighbor_ids[ni], true);
             temp.to_data_type(int_dtype.id(), group_node["neighbors"]);
         }
-        group_node["values"].set(DataType(int_dtype.id(), neighbor_values.size()));
         {
-            Node temp(DataType::index_t(neighbor_values.size()),
-                (void*)neighbor_values.data(), true);
+            Node temp(DataType::index_t(num_values),
+                (void*)(values.data() + neighbor_offsets[ni]), true);
             temp.to_data_type(int_dtype.id(), group_node["values"]);
         }
     }
@@ -5286,39 +6800,51 @@ mesh::adjset::to_maxshare(const Node &adjset,
     std::vector<std::string> adjset_group_names = adjset["groups"].child_names();
     std::sort(adjset_group_names.begin(), adjset_group_names.end());
 
-    std::map<index_t, std::set<index_t>> entity_groupset_map;
+    std::vector<std::unique_ptr<bputils::IndexSpan>> group_neighbors, group_values;
+    std::vector<index_t> pair_offsets(1, 0);
     for(const std::string &group_name : adjset_group_names)
     {
         const Node &group_node = adjset["groups"][group_name];
+        group_neighbors.emplace_back(new bputils::IndexSpan(group_node["neighbors"]));
+        group_values.emplace_back(new bputils::IndexSpan(group_node["values"]));
+        pair_offsets.push_back(pair_offsets.back() +
+            group_neighbors.back()->size() * group_values.back()->size());
+    }
 
-        std::vector<index_t> group_neighbors;
-        {
-            const Node &group_nvals = group_node["neighbors"];
-            for(index_t ni = 0; ni < group_nvals.dtype().number_of_elements(); ++ni)
-            {
-                Node temp(DataType(group_nvals.dtype().id(), 1),
-                    (void*)group_nvals.element_ptr(ni), true);
-                group_neighbors.push_back(temp.to_index_t());
-            }
-        }
-
-        std::vector<index_t> group_values;
+    // Gather the (entity, neighbor) pairs from all groups, sorted by entity,
+    // which gives us the max-share neighbor set of each entity in CSR form.
+    std::vector<std::pair<index_t, index_t>> entity_neighbor_pairs(
+        (size_t)pair_offsets.back());
+    execution::for_all(0, (index_t)adjset_group_names.size(), [&](index_t gi)
+    {
+        const bputils::IndexSpan &neighbors = *group_neighbors[(size_t)gi];
+        const bputils::IndexSpan &values = *group_values[(size_t)gi];
+        std::pair<index_t, index_t> *pairs =
+            entity_neighbor_pairs.data() + pair_offsets[(size_t)gi];
+        for(const index_t &entity_id : values)
         {
-            const Node &group_vals = group_node["values"];
-            for(index_t vi = 0; vi < group_vals.dtype().number_of_elements(); ++vi)
+            for(const index_t &neighbor_id : neighbors)
             {
-                Node temp(DataType(group_vals.dtype().id(), 1),
-                    (void*)group_vals.element_ptr(vi), true);
-                group_values.push_back(temp.to_index_t());
+                *pairs++ = std::make_pair(entity_id, neighbor_id);
             }
         }
+    });
+    bputils::adjset::sort_unique_pairs(entity_neighbor_pairs);
 
-        for(const index_t &entity_id : group_values)
+    std::vector<index_t> entity_ids, entity_offsets, entity_neighbors;
+    entity_neighbors.resize(entity_neighbor_pairs.size());
+    for(size_t pi = 0; pi < entity_neighbor_pairs.size(); pi++)
+    {
+        if(pi == 0 || entity_neighbor_pairs[pi].first != entity_ids.back())
         {
-            std::set<index_t> &entity_groupset = entity_groupset_map[entity_id];
-            entity_groupset.insert(group_neighbors.begin(), group_neighbors.end());
+            entity_ids.push_back(entity_neighbor_pairs[pi].first);
+            entity_offsets.push_back((index_t)pi);
         }
+        entity_neighbors[pi] = entity_neighbor_pairs[pi].second;
     }
+    entity_offsets.push_back((index_t)entity_neighbors.size());
+    std::vector<std::pair<index_t, index_t>>().swap(entity_neighbor_pairs);
+    const index_t num_entities = (index_t)entity_ids.size();
 
     // Given ordered lists of adjset values per neighbor, generate the destination
     // adjset hierarchy.
@@ -5329,61 +6855,134 @@ mesh::adjset::to_maxshare(const Node &adjset,
     dest.set(adjset_template);
     dest["groups"].set(DataType::object());
 
-    std::map<std::set<index_t>, Node *> groupset_groupnode_map;
-    for(const auto &entity_groupset_pair : entity_groupset_map)
+    // Find the max-share group (unique neighbor set) of each entity. Groups
+    // are created in order of the first (smallest) entity that uses them.
+    // Neighbor sets are hashed (in parallel), then matched to groups with an
+    // open addressing table of each group's first entity.
+    std::vector<uint64> entity_hashes((size_t)num_entities);
+    execution::for_all(0, num_entities, [&](index_t ei)
+    {
+        entity_hashes[(size_t)ei] = conduit::utils::hash64(
+            entity_neighbors.data() + entity_offsets[(size_t)ei],
+            (entity_offsets[(size_t)ei + 1] - entity_offsets[(size_t)ei]) *
+            (index_t)sizeof(index_t));
+    });
+
+    const auto same_neighbors = [&](index_t ei, index_t ej) -> bool
+    {
+        const index_t *ni = entity_neighbors.data() + entity_offsets[(size_t)ei];
+        const index_t *nj = entity_neighbors.data() + entity_offsets[(size_t)ej];
+        const index_t size_i = entity_offsets[(size_t)ei + 1] - entity_offsets[(size_t)ei];
+        const index_t size_j = entity_offsets[(size_t)ej + 1] - entity_offsets[(size_t)ej];
+        return size_i == size_j && std::equal(ni, ni + size_i, nj);
+    };
+
+    std::vector<index_t> groupset_entities;
+    std::vector<index_t> entity_groupsets((size_t)num_entities);
     {
-        const std::set<index_t> &groupset = entity_groupset_pair.second;
-        if(groupset_groupnode_map.find(groupset) == groupset_groupnode_map.end())
+        size_t table_size = 64;
+        std::vector<index_t> table(table_size, -1);
+        for(index_t ei = 0; ei < num_entities; ei++)
         {
-            Node &group_node = dest["groups"][std::to_string(dest["groups"].number_of_children())];
-            group_node["neighbors"].set(DataType(int_dtype.id(), groupset.size()));
+            size_t slot = (size_t)entity_hashes[(size_t)ei] & (table_size - 1);
+            while(table[slot] != -1 &&
+                  !same_neighbors(groupset_entities[(size_t)table[slot]], ei))
             {
-                const std::vector<index_t> grouplist(groupset.begin(), groupset.end());
-                Node temp(DataType::index_t(grouplist.size()), (void*)grouplist.data(), true);
-                temp.to_data_type(int_dtype.id(), group_node["neighbors"]);
+                slot = (slot + 1) & (table_size - 1);
             }
 
-            groupset_groupnode_map[groupset] = &group_node;
+            if(table[slot] == -1)
+            {
+                table[slot] = (index_t)groupset_entities.size();
+                groupset_entities.push_back(ei);
+
+                if(2 * groupset_entities.size() > table_size)
+                {
+                    table_size *= 2;
+                    table.assign(table_size, -1);
+                    for(size_t gi = 0; gi < groupset_entities.size(); gi++)
+                    {
+                        size_t gslot = (size_t)entity_hashes[(size_t)groupset_entities[gi]] &
+                                       (table_size - 1);
+                        while(table[gslot] != -1)
+                        {
+                            gslot = (gslot + 1) & (table_size - 1);
+                        }
+                        table[gslot] = (index_t)gi;
+                    }
+                    continue;
+                }
+            }
+            entity_groupsets[(size_t)ei] = table[slot];
         }
     }
+    // entities that created their group (and possibly grew the table)
+    for(size_t gi = 0; gi < groupset_entities.size(); gi++)
+    {
+        entity_groupsets[(size_t)groupset_entities[gi]] = (index_t)gi;
+    }
+
+    std::vector<Node *> groupset_nodes;
+    for(size_t gi = 0; gi < groupset_entities.size(); gi++)
+    {
+        const index_t ei = groupset_entities[gi];
+        Node &group_node = dest["groups"][std::to_string(dest["groups"].number_of_children())];
+        Node temp(DataType::index_t(entity_offsets[(size_t)ei + 1] - entity_offsets[(size_t)ei]),
+            (void*)(entity_neighbors.data() + entity_offsets[(size_t)ei]), true);
+        temp.to_data_type(int_dtype.id(), group_node["neighbors"]);
+        groupset_nodes.push_back(&group_node);
+    }
 
     // Now that the groundwork for each unique max-share group has been set,
     // we populate the 'values' content of each group in order based on
-    // lexicographically sorted group names
-    std::map<std::set<index_t>, std::pair<std::vector<index_t>, std::set<index_t>>> groupset_values_map;
-    for(const std::string &group_name : adjset_group_names)
+    // lexicographically sorted group names. Entities are looked up with a
+    // dense table when their ids are compact, otherwise by binary search.
+    std::vector<index_t> dense_entities;
+    const index_t min_entity = entity_ids.empty() ? 0 : entity_ids.front();
+    const uint64 entity_range = entity_ids.empty() ? 0 :
+        (uint64)entity_ids.back() - (uint64)min_entity + 1;
+    if(entity_range <= 4 * (uint64)num_entities + 1024)
     {
-        const Node &group_node = adjset["groups"][group_name];
-        const Node &group_vals = group_node["values"];
-        for(index_t vi = 0; vi < group_vals.dtype().number_of_elements(); ++vi)
+        dense_entities.assign((size_t)entity_range, -1);
+        execution::for_all(0, num_entities, [&](index_t ei)
+        {
+            dense_entities[(size_t)(entity_ids[(size_t)ei] - min_entity)] = ei;
+        });
+    }
+    const auto find_entity = [&](index_t entity_id) -> index_t
+    {
+        if(!dense_entities.empty() || entity_ids.empty())
         {
-            Node temp(DataType(group_vals.dtype().id(), 1),
-                (void*)group_vals.element_ptr(vi), true);
-            const index_t group_entity = temp.to_index_t();
+            const uint64 di = (uint64)entity_id - (uint64)min_entity;
+            return (di < dense_entities.size()) ? dense_entities[(size_t)di] : -1;
+        }
+        const size_t ei = std::lower_bound(entity_ids.begin(), entity_ids.end(),
+            entity_id) - entity_ids.begin();
+        return (ei < entity_ids.size() && entity_ids[ei] == entity_id) ?
+            (index_t)ei : -1;
+    };
 
-            auto &groupset_pair = groupset_values_map[entity_groupset_map[group_entity]];
-            std::vector<index_t> &groupset_valuelist = groupset_pair.first;
-            std::set<index_t> &groupset_valueset = groupset_pair.second;
-            if(groupset_valueset.find(group_entity) == groupset_valueset.end())
+    std::vector<std::vector<index_t>> groupset_values(groupset_nodes.size());
+    std::vector<unsigned char> entity_added((size_t)num_entities, 0);
+    for(size_t gi = 0; gi < group_values.size(); gi++)
+    {
+        for(const index_t &group_entity : *group_values[gi])
+        {
+            const index_t ei = find_entity(group_entity);
+            if(ei >= 0 && !entity_added[(size_t)ei])
             {
-                groupset_valuelist.push_back(group_entity);
-                groupset_valueset.insert(group_entity);
+                groupset_values[(size_t)entity_groupsets[(size_t)ei]].push_back(group_entity);
+                entity_added[(size_t)ei] = 1;
             }
         }
     }
 
-    for(const auto &groupset_values_pair : groupset_values_map)
+    for(size_t gi = 0; gi < groupset_nodes.size(); gi++)
     {
-        const std::set<index_t> &groupset = groupset_values_pair.first;
-        const std::vector<index_t> &groupset_values = groupset_values_pair.second.first;
-
-        Node &group_node = *groupset_groupnode_map[groupset];
-        group_node["values"].set(DataType(int_dtype.id(), groupset_values.size()));
-        {
-            Node temp(DataType::index_t(groupset_values.size()),
-                (void*)groupset_values.data(), true);
-            temp.to_data_type(int_dtype.id(), group_node["values"]);
-        }
+        Node &group_node = *groupset_nodes[gi];
+        Node temp(DataType::index_t(groupset_values[gi].size()),
+            (void*)groupset_values[gi].data(), true);
+        temp.to_data_type(int_dtype.id(), group_node["values"]);
     }
 
     bputils::adjset::canonicalize(dest);
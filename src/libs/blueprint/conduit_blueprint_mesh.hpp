@@ -59,6 +59,25 @@ bool CONDUIT_BLUEPRINT_API verify(const std::string &protocol,
 bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh,
                                   conduit::Node &info);
 
+//-----------------------------------------------------------------------------
+/// Bool only mesh verify.
+///
+/// Does not build an info tree, and verifies the domains of multi domain
+/// meshes concurrently (when OpenMP support is enabled).
+///
+/// Results are cached per domain, keyed on a fingerprint of the domain's
+/// structure (names, dtypes, and lengths) plus the contents of its string
+/// and scalar leaves. Domains whose fingerprint is unchanged since a prior
+/// call are not verified again. Array values are not part of the
+/// fingerprint, use verify(mesh, info) to force a full verify.
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh);
+
+//-----------------------------------------------------------------------------
+/// Clears the cached results of bool only mesh verify.
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API clear_verify_cache();
+
 
 //-----------------------------------------------------------------------------
 /// blueprint mesh property and transform methods
@@ -325,6 +344,17 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
                                                    conduit::Node &topo_dest,
                                                    conduit::Node &coords_dest);
+
+        //-------------------------------------------------------------------------
+        // Supported options:
+        //  index_dtype: name of the integer type used for the generated
+        //               connectivity (for example: "int32" or "int64").
+        //               By default, the widest integer type of the input
+        //               topology is used.
+        void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
+                                                   conduit::Node &topo_dest,
+                                                   conduit::Node &coords_dest,
+                                                   const conduit::Node &options);
     }
 
     //-------------------------------------------------------------------------
@@ -345,6 +375,17 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
                                                    conduit::Node &topo_dest,
                                                    conduit::Node &coords_dest);
+
+        //-------------------------------------------------------------------------
+        // Supported options:
+        //  index_dtype: name of the integer type used for the generated
+        //               connectivity (for example: "int32" or "int64").
+        //               By default, the widest integer type of the input
+        //               topology is used.
+        void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
+                                                   conduit::Node &topo_dest,
+                                                   conduit::Node &coords_dest,
+                                                   const conduit::Node &options);
     }
 
     //-------------------------------------------------------------------------
@@ -360,6 +401,17 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
                                                    conduit::Node &topo_dest,
                                                    conduit::Node &coords_dest);
+
+        //-------------------------------------------------------------------------
+        // Supported options:
+        //  index_dtype: name of the integer type used for the generated
+        //               connectivity (for example: "int32" or "int64").
+        //               By default, the widest integer type of the input
+        //               topology is used.
+        void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
+                                                   conduit::Node &topo_dest,
+                                                   conduit::Node &coords_dest,
+                                                   const conduit::Node &options);
     }
 
     //-------------------------------------------------------------------------
@@ -522,6 +574,33 @@ namespace matset
                                        conduit::Node &dest,
                                        const float64 epsilon = CONDUIT_EPSILON);
 
+    //-------------------------------------------------------------------------
+    // Converts a silo style sparse mixed slot matset (as created by
+    // 'to_silo') to a uni-buffer, element-dominant blueprint matset.
+    //
+    // If the silo matset has no material_map, materials are named
+    // "mat_<id>".
+    void CONDUIT_BLUEPRINT_API from_silo(const conduit::Node &silo_matset,
+                                         conduit::Node &dest);
+
+    //-------------------------------------------------------------------------
+    // Converts any blueprint matset to a sparse, uni-buffer,
+    // element-dominant matset (material_ids, volume_fractions, sizes, and
+    // offsets). The materials of each element are sorted by material id,
+    // and volume fractions <= epsilon are dropped.
+    void CONDUIT_BLUEPRINT_API to_element_dominant(const conduit::Node &matset,
+                                                   conduit::Node &dest,
+                                                   const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    // Converts any blueprint matset to a sparse, multi-buffer,
+    // material-dominant matset (volume_fractions and element_ids per
+    // material). Element ids are sorted per material, and volume
+    // fractions <= epsilon are dropped.
+    void CONDUIT_BLUEPRINT_API to_material_dominant(const conduit::Node &matset,
+                                                    conduit::Node &dest,
+                                                    const float64 epsilon = CONDUIT_EPSILON);
+
     //-------------------------------------------------------------------------
     // blueprint::mesh::matset::index protocol interface
     //-------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 //-----------------------------------------------------------------------------
 // std lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <set>
@@ -290,20 +291,42 @@ generate_element_centers_impl(const Node &topo, const index_t dimension,
     const DataArray<CsetType> *cset_values, DataArray<OutputType> *output_values,
     const index_t offset)
 {
-    using conduit::blueprint::mesh::utils::topology::entity;
-    index_t output_idx = offset;
-    utils::topology::iterate_elements(topo, [&](const entity &e) {
-        const index_t nids = static_cast<index_t>(e.element_ids.size());
-        for(index_t d = 0; d < dimension; d++)
+    using conduit::blueprint::mesh::utils::topology::element_block;
+    // Element blocks are independent, each writes its own output rows.
+    utils::topology::for_all_element_blocks(topo, [&](const element_block &b) {
+        std::vector<index_t> ids;
+        for(index_t ei = 0; ei < b.num_elements; ei++)
         {
-            OutputType sum = 0;
-            for(index_t i = 0; i < nids; i++)
+            const index_t *eids = b.element(ei);
+            index_t nids = b.element_size(ei);
+            if(b.shape.is_polyhedral())
             {
-                sum += static_cast<OutputType>(cset_values[d][e.element_ids[i]]);
+                // Average the unique vertices of the faces
+                ids.clear();
+                for(index_t fi = 0; fi < nids; fi++)
+                {
+                    const index_t face = eids[fi];
+                    const index_t *fids = b.subelement_connectivity +
+                                          b.subelement_offsets[face];
+                    ids.insert(ids.end(), fids, fids + b.subelement_sizes[face]);
+                }
+                std::sort(ids.begin(), ids.end());
+                ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+                eids = ids.data();
+                nids = static_cast<index_t>(ids.size());
+            }
+
+            const index_t output_idx = offset + b.first_element_id + ei;
+            for(index_t d = 0; d < dimension; d++)
+            {
+                OutputType sum = 0;
+                for(index_t i = 0; i < nids; i++)
+                {
+                    sum += static_cast<OutputType>(cset_values[d][eids[i]]);
+                }
+                output_values[d][output_idx] = sum / static_cast<OutputType>(nids);
             }
-            output_values[d][output_idx] = sum / static_cast<OutputType>(nids);
         }
-        output_idx++;
     });
 }
 
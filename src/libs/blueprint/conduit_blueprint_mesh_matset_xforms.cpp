@@ -14,6 +14,8 @@
 #include <cmath>
 #include <string>
 #include <map>
+#include <memory>
+#include <set>
 #include <vector>
 
 //-----------------------------------------------------------------------------
@@ -23,6 +25,7 @@
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
+#include "conduit_execution.hpp"
 
 using namespace conduit;
 // access conduit blueprint mesh utilities
@@ -63,437 +66,914 @@ namespace detail
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// Single implementation that supports the case where just matset
-// is passed, and the case where the field is passed.
-//
-// This is in the detail name space b/c the calling convention is a little
-// strange:
-//   empty field  node -- first arg, triggers one path, non empty another
-//
-// We smooth this out for the API by providing the non detail variants,
-// which error when passed empty nodes.
+// number of elements processed by one task in the parallel passes below
+static const index_t MATSET_BLOCK_SIZE = 4096;
+
 //-----------------------------------------------------------------------------
-void
-to_silo(const conduit::Node &field,
-        const conduit::Node &matset,
-        conduit::Node &dest,
-        const float64 epsilon)
+// Views a numeric leaf as a contiguous float64 array. Compact float64
+// leaves are viewed in place, other leaves are converted once.
+//-----------------------------------------------------------------------------
+const float64 *
+float64_values(const Node &values, Node &converted)
 {
-    Node temp, data;
-    const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
-    const DataType float_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_FLOAT_DTYPE);
-    // if matset_values is not empty, we will
-    // apply the same xform to it as we do to the volume fractions.
-    const bool xform_matset_values = field.has_child("matset_values");
+    if(values.dtype().number_of_elements() <= 0)
+    {
+        return NULL;
+    }
 
-    // NOTE: matset values are always treated as a float64.
-    // we could map to the widest int or float type in the future.
+    if(values.dtype().is_float64() && values.dtype().is_compact())
+    {
+        return (const float64*)values.element_ptr(0);
+    }
 
-    // Extract Material Set Metadata //
-    const bool mset_is_unibuffer = blueprint::mesh::matset::is_uni_buffer(matset);
-    const bool mset_is_matdom = blueprint::mesh::matset::is_material_dominant(matset);
+    values.to_float64_array(converted);
+    return (const float64*)converted.element_ptr(0);
+}
 
-    // setup the material map, which provides a map from material names
-    // to to material numbers
-    Node matset_mat_map;
+//-----------------------------------------------------------------------------
+// Flattened form of an o2mrelation (or of a raw data array): the data index
+// of each entry, in the order an O2MIterator visits them, and the range of
+// entries that belong to each "one". Relations without sizes, offsets, and
+// indices are the identity and are not materialized.
+//-----------------------------------------------------------------------------
+class O2MEntries
+{
+public:
+    O2MEntries()
+    : m_data(NULL), m_identity(true), m_num_ones(0)
+    {}
 
-    // mset_is_unibuffer will always have the material_map, other cases
-    // it is optional. If not given, the map from material names to ids
-    // is implied by the order the materials are presented in the matset node
-    if(matset.has_child("material_map") )
+    void set(const Node &o2m)
     {
-        // uni-buffer case provides the map we are looking for
-        matset_mat_map.set_external(matset["material_map"]);
+        if(o2m.dtype().is_number())
+        {
+            m_data = &o2m;
+        }
+        else
+        {
+            m_data = &o2m[o2mrelation::data_paths(o2m).front()];
+        }
+        set(o2m, *m_data);
     }
-    else // if(!mset_is_unibuffer)
+
+    // uses the given data array (rather than the first data path)
+    void set(const Node &o2m, const Node &data)
     {
-        // material_map is implied, construct it here for use and output
-        NodeConstIterator vf_itr = matset["volume_fractions"].children();
-        while(vf_itr.has_next())
+        m_data = &data;
+        const bool has_sizes = o2m.dtype().is_object() && o2m.has_child("sizes");
+        const bool has_offsets = o2m.dtype().is_object() && o2m.has_child("offsets");
+        const bool has_indices = o2m.dtype().is_object() && o2m.has_child("indices");
+
+        m_identity = !has_sizes && !has_offsets && !has_indices;
+        m_one_offsets.clear();
+        m_data_ids.clear();
+
+        if(has_sizes)
         {
-            vf_itr.next();
-            std::string curr_mat_name = vf_itr.name();
-            temp.reset();
-            temp.set(vf_itr.index());
-            temp.to_data_type(int_dtype.id(), matset_mat_map[curr_mat_name]);
+            m_num_ones = o2m["sizes"].dtype().number_of_elements();
+        }
+        else if(has_indices)
+        {
+            m_num_ones = o2m["indices"].dtype().number_of_elements();
+        }
+        else
+        {
+            m_num_ones = data.dtype().number_of_elements();
         }
-    }
 
-    const Node mset_mat_map(matset_mat_map);
+        if(m_identity)
+        {
+            return;
+        }
 
-    // find the number of elements in the matset
-    index_t matset_num_elems = 0;
-    if(mset_is_matdom)
-    {
-        NodeConstIterator eids_iter = matset["element_ids"].children();
-        while(eids_iter.has_next())
+        bputils::IndexSpan sizes, offsets, indices;
+        if(has_sizes)
+        {
+            sizes.set(o2m["sizes"]);
+        }
+        if(has_offsets)
+        {
+            offsets.set(o2m["offsets"]);
+        }
+        if(has_indices)
+        {
+            indices.set(o2m["indices"]);
+        }
+
+        m_one_offsets.resize((size_t)(m_num_ones + 1));
+        m_one_offsets[0] = 0;
+        for(index_t oi = 0; oi < m_num_ones; oi++)
+        {
+            m_one_offsets[(size_t)oi + 1] = m_one_offsets[(size_t)oi] +
+                (has_sizes ? sizes[oi] : 1);
+        }
+
+        m_data_ids.resize((size_t)m_one_offsets.back());
+        execution::for_all_blocks(m_num_ones, MATSET_BLOCK_SIZE,
+            [&](index_t o_begin, index_t o_end)
         {
-            const Node &eids_node = eids_iter.next();
-            const DataType eids_dtype(eids_node.dtype().id(), 1);
-            for(index_t ei = 0; ei < eids_node.dtype().number_of_elements(); ei++)
+            for(index_t oi = o_begin; oi < o_end; oi++)
             {
-                temp.set_external(eids_dtype, (void*)eids_node.element_ptr(ei));
-                const index_t elem_index = temp.to_int();
-                matset_num_elems = std::max(matset_num_elems, elem_index + 1);
+                // NOTE: matches O2MIterator, which uses the one index as
+                // the offset when offsets are not given
+                const index_t offset = has_offsets ? offsets[oi] : oi;
+                const index_t base = has_indices ? indices[offset] : offset;
+                const index_t e_begin = m_one_offsets[(size_t)oi];
+                const index_t e_end = m_one_offsets[(size_t)oi + 1];
+                for(index_t ei = e_begin; ei < e_end; ei++)
+                {
+                    m_data_ids[(size_t)ei] = base + (ei - e_begin);
+                }
             }
-        }
+        });
+    }
+
+    const Node &data() const { return *m_data; }
+    index_t number_of_ones() const { return m_num_ones; }
+    index_t number_of_entries() const
+        { return m_identity ? m_num_ones : (index_t)m_data_ids.size(); }
+
+    index_t one_begin(index_t one) const
+        { return m_identity ? one : m_one_offsets[(size_t)one]; }
+    index_t one_end(index_t one) const
+        { return m_identity ? one + 1 : m_one_offsets[(size_t)one + 1]; }
+    index_t data_index(index_t entry) const
+        { return m_identity ? entry : m_data_ids[(size_t)entry]; }
+
+private:
+    O2MEntries(const O2MEntries &);
+    O2MEntries &operator=(const O2MEntries &);
+
+    const Node *m_data;
+    bool m_identity;
+    index_t m_num_ones;
+    std::vector<index_t> m_one_offsets;
+    std::vector<index_t> m_data_ids;
+};
+
+//-----------------------------------------------------------------------------
+// Material entries from one buffer of a matset: the whole matset for
+// uni-buffer matsets, or one material for multi-buffer matsets.
+//
+// The buffer is split into units that map to one element each: the "ones"
+// of the uni-buffer o2mrelation, or each entry of a multi-buffer material.
+//-----------------------------------------------------------------------------
+struct MatsetBuffer
+{
+    MatsetBuffer()
+    : mat_id(-1), vfs(NULL), values(NULL), uni_buffer(false), mat_dom(false)
+    {}
+
+    index_t num_units() const
+    {
+        return uni_buffer ? entries.number_of_ones() :
+                            entries.number_of_entries();
+    }
+
+    index_t unit_element(index_t unit) const
+    {
+        return mat_dom ? elem_ids[unit] : unit;
     }
-    else // if(!mset_is_matdom)
+
+    index_t unit_begin(index_t unit) const
+        { return uni_buffer ? entries.one_begin(unit) : unit; }
+    index_t unit_end(index_t unit) const
+        { return uni_buffer ? entries.one_end(unit) : unit + 1; }
+
+    O2MEntries entries;
+    // uni-buffer: material id of each data entry
+    bputils::IndexSpan mat_ids;
+    // multi-buffer: material id of all entries
+    index_t mat_id;
+    // volume fraction of each data entry
+    const float64 *vfs;
+    Node vfs_data;
+    // material dominant: element id of each unit
+    bputils::IndexSpan elem_ids;
+    // optional matset values (uni-buffer: one per data entry, multi-buffer:
+    // one per unit, through the value o2mrelation)
+    O2MEntries value_entries;
+    const float64 *values;
+    Node values_data;
+
+    bool uni_buffer;
+    bool mat_dom;
+
+private:
+    MatsetBuffer(const MatsetBuffer &);
+    MatsetBuffer &operator=(const MatsetBuffer &);
+};
+
+//-----------------------------------------------------------------------------
+// Sparse element-dominant (CSR) form of a matset. The materials of each
+// element are sorted by material id and only hold volume fractions above
+// epsilon.
+//-----------------------------------------------------------------------------
+struct MatsetCSR
+{
+    MatsetCSR()
+    : num_elems(0), has_values(false)
+    {}
+
+    index_t num_elems;
+    std::vector<index_t> offsets;
+    std::vector<index_t> mat_ids;
+    std::vector<float64> vfs;
+    bool has_values;
+    std::vector<float64> values;
+};
+
+//-----------------------------------------------------------------------------
+struct MatsetCandidate
+{
+    index_t mat_id;
+    float64 vf;
+    float64 value;
+    bool has_value;
+};
+
+//-----------------------------------------------------------------------------
+// Sorts (stable, insertion sort: element lists are short) the candidates
+// of an element by material id and merges duplicate materials in place.
+// The last entry above epsilon wins, like repeated std::map inserts.
+// Returns the number of unique materials.
+//-----------------------------------------------------------------------------
+index_t
+reduce_candidates(std::vector<MatsetCandidate> &cands,
+                  float64 epsilon,
+                  bool values_follow_vfs)
+{
+    const index_t ncands = (index_t)cands.size();
+    for(index_t ci = 1; ci < ncands; ci++)
     {
-        // may need to do a bit of sculpting here; embed the base array into
-        // something w/ "values" child, as below
-        Node mat_vfs;
-        if(mset_is_unibuffer)
+        const MatsetCandidate cand = cands[(size_t)ci];
+        index_t cj = ci;
+        while(cj > 0 && cands[(size_t)cj - 1].mat_id > cand.mat_id)
         {
-            mat_vfs.set_external(matset);
+            cands[(size_t)cj] = cands[(size_t)cj - 1];
+            cj--;
         }
-        else
+        cands[(size_t)cj] = cand;
+    }
+
+    index_t nout = 0;
+    for(index_t run_begin = 0; run_begin < ncands;)
+    {
+        const index_t run_mat = cands[(size_t)run_begin].mat_id;
+        index_t run_end = run_begin;
+        bool found = false;
+        MatsetCandidate res = cands[(size_t)run_begin];
+        res.value = 0.0;
+        res.has_value = false;
+        for(; run_end < ncands && cands[(size_t)run_end].mat_id == run_mat; run_end++)
         {
-            const Node &temp_vfs = matset["volume_fractions"].child(0);
-            if(temp_vfs.dtype().is_object())
+            const MatsetCandidate &cand = cands[(size_t)run_end];
+            if(cand.vf > epsilon)
             {
-                mat_vfs.set_external(temp_vfs);
+                found = true;
+                res.vf = cand.vf;
+                if(values_follow_vfs)
+                {
+                    res.value = cand.value;
+                    res.has_value = cand.has_value;
+                }
             }
-            else // if(temp_vfs.dtype().is_number())
+            if(!values_follow_vfs && cand.has_value)
             {
-                mat_vfs["values"].set_external(temp_vfs);
+                res.value = cand.value;
+                res.has_value = true;
             }
         }
 
-        blueprint::o2mrelation::O2MIterator mat_iter(mat_vfs);
-        matset_num_elems = mat_iter.elements(O2MIndex::ONE);
+        if(found)
+        {
+            cands[(size_t)nout++] = res;
+        }
+        run_begin = run_end;
     }
-    const index_t mset_num_elems = matset_num_elems;
 
-    // Organize Per-Zone Material Data //
+    cands.resize((size_t)nout);
+    return nout;
+}
+
+//-----------------------------------------------------------------------------
+// Builds the sparse element-dominant (CSR) form of any flavor of matset (and
+// optionally of the matset_values of a field).
+//
+// This is a two pass (count, prefix sum, fill) algorithm. The passes are
+// executed in parallel over blocks of elements when OpenMP support is
+// enabled. Material dominant matsets are first grouped by element with a
+// counting sort.
+//-----------------------------------------------------------------------------
+void
+build_matset_csr(const conduit::Node &field,
+                 const conduit::Node &matset,
+                 const conduit::Node &mat_map,
+                 const float64 epsilon,
+                 MatsetCSR &csr)
+{
+    const bool xform_matset_values = field.has_child("matset_values");
+    const bool mset_is_unibuffer = blueprint::mesh::matset::is_uni_buffer(matset);
+    const bool mset_is_matdom = blueprint::mesh::matset::is_material_dominant(matset);
 
-    // create a sparse map from each zone, to each material and its value.
-    std::vector< std::map<index_t, float64> > elem_mat_maps(mset_num_elems);
-    std::vector< std::map<index_t, float64> > elem_matset_values_maps(mset_num_elems);
+    // -- gather the matset buffers -- //
+    std::vector< std::unique_ptr<MatsetBuffer> > buffers;
     if(mset_is_unibuffer)
     {
-        const Node &mat_vfs = matset["volume_fractions"];
-        const Node &mat_mids = matset["material_ids"];
-
-        Node mat_eids;
+        buffers.push_back(std::unique_ptr<MatsetBuffer>(new MatsetBuffer()));
+        MatsetBuffer &buf = *buffers.back();
+        buf.uni_buffer = true;
+        buf.mat_dom = mset_is_matdom;
+        buf.entries.set(matset, matset["volume_fractions"]);
+        buf.vfs = float64_values(matset["volume_fractions"], buf.vfs_data);
+        buf.mat_ids.set(matset["material_ids"]);
         if(mset_is_matdom)
         {
-            mat_eids.set_external(matset["element_ids"]);
+            buf.elem_ids.set(matset["element_ids"]);
         }
-
-        blueprint::o2mrelation::O2MIterator mat_iter(matset);
-        while(mat_iter.has_next(O2MIndex::DATA))
+        if(xform_matset_values)
         {
-            const index_t elem_ind_index = mat_iter.next(O2MIndex::ONE);
-
-            // -- get element id -- //
-            // this is either "elem_ind_index" from the o2m, or
-            // this index applied to the material-to-elements map
+            buf.values = float64_values(field["matset_values"], buf.values_data);
+        }
+    }
+    else
+    {
+        NodeConstIterator mats_iter = matset["volume_fractions"].children();
+        while(mats_iter.has_next())
+        {
+            const Node &mat_node = mats_iter.next();
+            const std::string &mat_name = mats_iter.name();
+
+            buffers.push_back(std::unique_ptr<MatsetBuffer>(new MatsetBuffer()));
+            MatsetBuffer &buf = *buffers.back();
+            buf.mat_dom = mset_is_matdom;
+            buf.mat_id = mat_map[mat_name].to_index_t();
+            buf.entries.set(mat_node);
+            buf.vfs = float64_values(buf.entries.data(), buf.vfs_data);
             if(mset_is_matdom)
             {
-                temp.set_external(
-                    DataType(mat_eids.dtype().id(), 1),
-                    (void*)mat_eids.element_ptr(elem_ind_index));
+                buf.elem_ids.set(matset["element_ids"][mat_name]);
             }
-
-            const index_t elem_index = mset_is_matdom ? temp.to_index_t() : elem_ind_index;
-
-            // we now have the element index, find all material indicies
-            // using the o2m-many iter
-            mat_iter.to_front(O2MIndex::MANY);
-            while(mat_iter.has_next(O2MIndex::MANY))
+            if(xform_matset_values && field["matset_values"].has_child(mat_name))
             {
-                mat_iter.next(O2MIndex::MANY);
-                const index_t mat_ind_index = mat_iter.index(O2MIndex::DATA);
-
-                // this index now allows us to fetch the
-                //  vol frac
-                //  matset value
-                //  material id
-
-                // get the vf and convert it to a float64
-                temp.set_external(
-                    DataType(mat_vfs.dtype().id(), 1),
-                    (void*)mat_vfs.element_ptr(mat_ind_index));
-                const float64 mat_vf = temp.to_float64();
-
-                float64 curr_matset_value = 0;
-                // process matset values if passed and convert it to a float64
-                if(xform_matset_values)
-                {
-                    const Node matset_values = field["matset_values"];
-                    temp.set_external(
-                        DataType(matset_values.dtype().id(), 1),
-                        (void*)matset_values.element_ptr(mat_ind_index));
-                        curr_matset_value = temp.to_float64();
-                }
-
-                // get the material id as an index_t
-                temp.set_external(
-                    DataType(mat_mids.dtype().id(), 1),
-                    (void*)mat_mids.element_ptr(mat_ind_index));
-                const index_t mat_id = temp.to_index_t();
+                buf.value_entries.set(field["matset_values"][mat_name]);
+                buf.values = float64_values(buf.value_entries.data(),
+                                            buf.values_data);
+            }
+        }
+    }
 
-                // if this elem has a non-zero (or non-trivial) volume fraction for this
-                // material, add it do the map
-                if(mat_vf > epsilon)
-                {
-                    elem_mat_maps[elem_index][mat_id] = mat_vf;
+    const index_t num_buffers = (index_t)buffers.size();
 
-                    // process matset values if passed
-                    if(xform_matset_values)
-                    {
-                        elem_matset_values_maps[elem_index][mat_id] = curr_matset_value;
-                    }
-                }
+    // -- find the number of elements -- //
+    index_t num_elems = 0;
+    if(mset_is_matdom)
+    {
+        for(index_t bi = 0; bi < num_buffers; bi++)
+        {
+            const bputils::IndexSpan &elem_ids = buffers[(size_t)bi]->elem_ids;
+            for(index_t ui = 0; ui < elem_ids.size(); ui++)
+            {
+                num_elems = std::max(num_elems, elem_ids[ui] + 1);
             }
         }
     }
-    else // if(!mset_is_unibuffer)
+    else if(num_buffers > 0)
     {
-        NodeConstIterator mats_iter = matset["volume_fractions"].children();
-        while(mats_iter.has_next())
-        {
-            const Node& mat_node = mats_iter.next();
-            const std::string& mat_name = mats_iter.name();
-            const index_t mat_id = mset_mat_map[mat_name].to_index_t();
+        // element dominant: the first buffer defines the elements
+        num_elems = buffers[0]->entries.number_of_ones();
+    }
+
+    // -- group the units of each element -- //
+    // element dominant: element e is unit e of each buffer
+    // material dominant: counting sort of (buffer, unit) by element
+    std::vector<index_t> unit_bases((size_t)num_buffers + 1, 0);
+    for(index_t bi = 0; bi < num_buffers; bi++)
+    {
+        unit_bases[(size_t)bi + 1] = unit_bases[(size_t)bi] +
+                                     buffers[(size_t)bi]->num_units();
+    }
 
-            // NOTE(JRC): This is required because per-material subtrees aren't
-            // necessarily 'o2mrelation'-compliant; they can just be raw arrays.
-            // To make subsequent processing uniform, we make raw arrays 'o2mrelation's.
-            Node mat_vfs;
-            if(mat_node.dtype().is_number())
+    std::vector<index_t> elem_unit_offsets, elem_units;
+    if(mset_is_matdom)
+    {
+        elem_unit_offsets.assign((size_t)num_elems + 1, 0);
+        for(index_t bi = 0; bi < num_buffers; bi++)
+        {
+            const bputils::IndexSpan &elem_ids = buffers[(size_t)bi]->elem_ids;
+            const index_t nunits = std::min(elem_ids.size(),
+                                            buffers[(size_t)bi]->num_units());
+            for(index_t ui = 0; ui < nunits; ui++)
             {
-                mat_vfs["values"].set_external(mat_node);
+                elem_unit_offsets[(size_t)elem_ids[ui] + 1]++;
             }
-            else
+        }
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            elem_unit_offsets[(size_t)ei + 1] += elem_unit_offsets[(size_t)ei];
+        }
+
+        elem_units.resize((size_t)elem_unit_offsets.back());
+        std::vector<index_t> elem_fill(elem_unit_offsets.begin(),
+                                       elem_unit_offsets.end() - 1);
+        for(index_t bi = 0; bi < num_buffers; bi++)
+        {
+            const bputils::IndexSpan &elem_ids = buffers[(size_t)bi]->elem_ids;
+            const index_t nunits = std::min(elem_ids.size(),
+                                            buffers[(size_t)bi]->num_units());
+            for(index_t ui = 0; ui < nunits; ui++)
             {
-                mat_vfs.set_external(mat_node);
+                elem_units[(size_t)elem_fill[(size_t)elem_ids[ui]]++] =
+                    unit_bases[(size_t)bi] + ui;
             }
+        }
+    }
+
+    // gathers the candidate materials of an element, in matset order
+    const auto gather = [&](index_t elem, std::vector<MatsetCandidate> &cands)
+    {
+        cands.clear();
+
+        index_t nunits = num_buffers;
+        if(mset_is_matdom)
+        {
+            nunits = elem_unit_offsets[(size_t)elem + 1] -
+                     elem_unit_offsets[(size_t)elem];
+        }
 
-            Node mat_eids;
+        for(index_t ui = 0; ui < nunits; ui++)
+        {
+            index_t bi = ui, unit = elem;
             if(mset_is_matdom)
             {
-                mat_eids.set_external(matset["element_ids"][mat_name]);
+                const index_t gunit = elem_units[
+                    (size_t)(elem_unit_offsets[(size_t)elem] + ui)];
+                bi = (index_t)(std::upper_bound(unit_bases.begin(),
+                                                unit_bases.end(),
+                                                gunit) -
+                               unit_bases.begin()) - 1;
+                unit = gunit - unit_bases[(size_t)bi];
             }
 
-            // this is a multi-buffer case, make sure we are pointing
-            // to the correct values for this pass
-            Node mat_data;
+            const MatsetBuffer &buf = *buffers[(size_t)bi];
+            if(unit >= buf.num_units())
             {
-                const std::string vf_path =
-                    blueprint::o2mrelation::data_paths(mat_vfs).front();
-                mat_data.set_external(mat_vfs[vf_path]);
+                continue;
             }
 
-            blueprint::o2mrelation::O2MIterator mat_iter(mat_vfs);
-            for(index_t mat_index = 0; mat_iter.has_next(); mat_index++)
+            for(index_t ei = buf.unit_begin(unit); ei < buf.unit_end(unit); ei++)
             {
-                const index_t mat_itr_index = mat_iter.next();
-
-                // get the current vf value as a float64
-                temp.set_external(
-                    DataType(mat_data.dtype().id(), 1),
-                    (void*)mat_data.element_ptr(mat_itr_index));
-                const float64 mat_vf = temp.to_float64();
-
-                // if material dominant:
-                //  we use indirection array to find the element index.
-                //
-                // if element dominant:
-                //  the o2m_index is the element index
-
-                if(mset_is_matdom)
+                const index_t di = buf.entries.data_index(ei);
+
+                MatsetCandidate cand;
+                cand.mat_id = buf.uni_buffer ? buf.mat_ids[di] : buf.mat_id;
+                cand.vf = buf.vfs[di];
+                cand.value = 0.0;
+                cand.has_value = false;
+                if(buf.values != NULL)
                 {
-                    temp.set_external(
-                        DataType(mat_eids.dtype().id(), 1),
-                        (void*)mat_eids.element_ptr(mat_index));
+                    if(buf.uni_buffer)
+                    {
+                        cand.value = buf.values[di];
+                        cand.has_value = true;
+                    }
+                    else if(unit < buf.value_entries.number_of_entries())
+                    {
+                        cand.value = buf.values[buf.value_entries.data_index(unit)];
+                        cand.has_value = true;
+                    }
                 }
-                const index_t mat_elem = mset_is_matdom ? temp.to_index_t() : mat_index;
+                cands.push_back(cand);
+            }
+        }
+    };
+
+    // NOTE: uni-buffer matset values are taken from the same entry as the
+    // volume fraction, multi-buffer values from the last matching entry
+    const bool values_follow_vfs = mset_is_unibuffer;
+
+    // -- pass 1: count the materials of each element -- //
+    csr.num_elems = num_elems;
+    csr.has_values = xform_matset_values;
+    csr.offsets.assign((size_t)num_elems + 1, 0);
+    execution::for_all_blocks(num_elems, MATSET_BLOCK_SIZE,
+        [&](index_t e_begin, index_t e_end)
+    {
+        std::vector<MatsetCandidate> cands;
+        for(index_t ei = e_begin; ei < e_end; ei++)
+        {
+            gather(ei, cands);
+            csr.offsets[(size_t)ei + 1] =
+                reduce_candidates(cands, epsilon, values_follow_vfs);
+        }
+    });
+
+    // -- prefix sum -- //
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        csr.offsets[(size_t)ei + 1] += csr.offsets[(size_t)ei];
+    }
 
-                // we now have both the element and material index.
+    // -- pass 2: fill -- //
+    const size_t num_entries = (size_t)csr.offsets.back();
+    csr.mat_ids.resize(num_entries);
+    csr.vfs.resize(num_entries);
+    csr.values.resize(xform_matset_values ? num_entries : 0);
+    execution::for_all_blocks(num_elems, MATSET_BLOCK_SIZE,
+        [&](index_t e_begin, index_t e_end)
+    {
+        std::vector<MatsetCandidate> cands;
+        for(index_t ei = e_begin; ei < e_end; ei++)
+        {
+            gather(ei, cands);
+            reduce_candidates(cands, epsilon, values_follow_vfs);
 
-                // if this elem has a non-zero (or non-trivial) volume fraction for this
-                // material, add it do the map
-                if(mat_vf > epsilon)
+            size_t oi = (size_t)csr.offsets[(size_t)ei];
+            for(const MatsetCandidate &cand : cands)
+            {
+                csr.mat_ids[oi] = cand.mat_id;
+                csr.vfs[oi] = cand.vf;
+                if(xform_matset_values)
                 {
-                    elem_mat_maps[mat_elem][mat_id] = mat_vf;
+                    csr.values[oi] = cand.value;
                 }
+                oi++;
             }
         }
+    });
+}
 
-        /// handle case where matset_values was passed
-        /// this requires another o2m traversal
-        if(xform_matset_values)
+//-----------------------------------------------------------------------------
+// Builds the sparse element-dominant (CSR) form of a silo style matset
+// (the inverse of the 'to_silo' conversion).
+//-----------------------------------------------------------------------------
+void
+build_matset_csr_from_silo(const conduit::Node &silo_mset,
+                           MatsetCSR &csr)
+{
+    const bputils::IndexSpan matlist(silo_mset["matlist"]);
+    const bputils::IndexSpan mix_next(silo_mset["mix_next"]);
+    const bputils::IndexSpan mix_mat(silo_mset["mix_mat"]);
+    Node mix_vf_data;
+    const float64 *mix_vf = float64_values(silo_mset["mix_vf"], mix_vf_data);
+
+    const index_t num_elems = matlist.size();
+    const index_t num_slots = mix_mat.size();
+
+    // returns the number of materials of the given element, and (optionally)
+    // writes them to the csr starting at the given offset
+    const auto walk = [&](index_t elem, bool fill, index_t offset) -> index_t
+    {
+        const index_t mat = matlist[elem];
+        if(mat == 0)
+        {
+            return 0;
+        }
+        else if(mat > 0)
         {
-            NodeConstIterator matset_values_iter = field["matset_values"].children();
-            while(matset_values_iter.has_next())
+            if(fill)
             {
-                const Node& curr_node = matset_values_iter.next();
-                const std::string& mat_name = matset_values_iter.name();
-                const index_t mat_id = mset_mat_map[mat_name].to_index_t();
+                csr.mat_ids[(size_t)offset] = mat - 1;
+                csr.vfs[(size_t)offset] = 1.0;
+            }
+            return 1;
+        }
 
-                // NOTE(JRC): This is required because per-material subtrees aren't
-                // necessarily 'o2mrelation'-compliant; they can just be raw arrays.
-                // To make subsequent processing uniform, we make raw arrays 'o2mrelation's.
+        index_t count = 0;
+        for(index_t slot = ~mat; slot >= 0; count++)
+        {
+            if(slot >= num_slots || count >= num_slots)
+            {
+                CONDUIT_ERROR("blueprint::mesh::matset::from_silo: invalid "
+                              "mixed slot chain for element " << elem);
+            }
 
-                Node o2m;
-                if(curr_node.dtype().is_number())
-                {
-                    o2m["values"].set_external(curr_node);
-                }
-                else
-                {
-                    o2m.set_external(curr_node);
-                }
+            if(fill)
+            {
+                csr.mat_ids[(size_t)(offset + count)] = mix_mat[slot];
+                csr.vfs[(size_t)(offset + count)] = mix_vf[slot];
+            }
+            slot = mix_next[slot] - 1;
+        }
+        return count;
+    };
+
+    csr.num_elems = num_elems;
+    csr.has_values = false;
+    csr.offsets.assign((size_t)num_elems + 1, 0);
+    execution::for_all_blocks(num_elems, MATSET_BLOCK_SIZE,
+        [&](index_t e_begin, index_t e_end)
+    {
+        for(index_t ei = e_begin; ei < e_end; ei++)
+        {
+            csr.offsets[(size_t)ei + 1] = walk(ei, false, 0);
+        }
+    });
 
-                Node mat_eids;
-                if(mset_is_matdom)
-                {
-                    mat_eids.set_external(matset["element_ids"][mat_name]);
-                }
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        csr.offsets[(size_t)ei + 1] += csr.offsets[(size_t)ei];
+    }
 
-                // this is a multi-buffer case, make sure we are pointing
-                // to the correct values for this pass
-                Node matset_values_data;
-                {
-                    const std::string path =
-                        blueprint::o2mrelation::data_paths(o2m).front();
-                    matset_values_data.set_external(o2m[path]);
-                }
+    const size_t num_entries = (size_t)csr.offsets.back();
+    csr.mat_ids.resize(num_entries);
+    csr.vfs.resize(num_entries);
+    execution::for_all_blocks(num_elems, MATSET_BLOCK_SIZE,
+        [&](index_t e_begin, index_t e_end)
+    {
+        for(index_t ei = e_begin; ei < e_end; ei++)
+        {
+            walk(ei, true, csr.offsets[(size_t)ei]);
+        }
+    });
+}
 
-                blueprint::o2mrelation::O2MIterator o2m_iter(o2m);
-                for(index_t o2m_index = 0; o2m_iter.has_next(); o2m_index++)
-                {
-                    const index_t o2m_access_index = o2m_iter.next();
-
-                    // if material dominant:
-                    //  we use indirection array to find the element index.
-                    //
-                    // if element dominant:
-                    //  the o2m_index is the element index
-                    if(mset_is_matdom)
-                    {
-                        temp.set_external(
-                            DataType(mat_eids.dtype().id(), 1),
-                            (void*)mat_eids.element_ptr(o2m_index));
-                    }
+//-----------------------------------------------------------------------------
+// Sets dest to the given values, converted to the given data type.
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+set_converted(const std::vector<T> &values,
+              const DataType &dtype,
+              conduit::Node &dest)
+{
+    Node values_node;
+    values_node.set_external(const_cast<T*>(values.data()),
+                             (index_t)values.size());
+    values_node.to_data_type(dtype.id(), dest);
+}
+
+//-----------------------------------------------------------------------------
+// Sets up the material map used by the conversions: the given map, or the
+// one implied by the order of the materials of a multi-buffer matset.
+//-----------------------------------------------------------------------------
+void
+matset_material_map(const conduit::Node &matset,
+                    const DataType &int_dtype,
+                    conduit::Node &mat_map)
+{
+    mat_map.reset();
 
+    // uni-buffer matsets always have the material_map, other cases
+    // it is optional. If not given, the map from material names to ids
+    // is implied by the order the materials are presented in the matset node
+    if(matset.has_child("material_map"))
+    {
+        mat_map.set_external(matset["material_map"]);
+    }
+    else
+    {
+        Node temp;
+        NodeConstIterator vf_itr = matset["volume_fractions"].children();
+        while(vf_itr.has_next())
+        {
+            vf_itr.next();
+            temp.set(vf_itr.index());
+            temp.to_data_type(int_dtype.id(), mat_map[vf_itr.name()]);
+        }
+    }
+}
 
-                    const index_t mat_elem = mset_is_matdom ? temp.to_index_t() : o2m_index;
+//-----------------------------------------------------------------------------
+// Writes the silo style sparse mixed slot representation of a matset csr.
+//-----------------------------------------------------------------------------
+void
+write_silo(const MatsetCSR &csr,
+           const DataType &int_dtype,
+           const DataType &float_dtype,
+           conduit::Node &dest)
+{
+    const index_t num_elems = csr.num_elems;
 
-                    // we now have both the element and material index.
-                    // check if the volume fractions have an entry for this case,
-                    // if so we will add the corresponding mixvar to its map
+    // mixed elements (more than one material) use one slot per material
+    std::vector<index_t> slot_offsets((size_t)num_elems + 1, 0);
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        const index_t nmats = csr.offsets[(size_t)ei + 1] - csr.offsets[(size_t)ei];
+        slot_offsets[(size_t)ei + 1] = slot_offsets[(size_t)ei] +
+                                       ((nmats > 1) ? nmats : 0);
+    }
+    const size_t num_slots = (size_t)slot_offsets.back();
 
-                    // if elem_mat_maps[mat_elem] has entry mat_id, add entry to
-                    // elem_matset_values_maps
-                    if( elem_mat_maps[mat_elem].find(mat_id) != elem_mat_maps[mat_elem].end())
+    std::vector<index_t> matlist((size_t)num_elems);
+    std::vector<index_t> mix_next(num_slots), mix_mat(num_slots);
+    std::vector<float64> mix_vf(num_slots), mixvar(csr.has_values ? num_slots : 0);
+    execution::for_all_blocks(num_elems, MATSET_BLOCK_SIZE,
+        [&](index_t e_begin, index_t e_end)
+    {
+        for(index_t ei = e_begin; ei < e_end; ei++)
+        {
+            const index_t m_begin = csr.offsets[(size_t)ei];
+            const index_t nmats = csr.offsets[(size_t)ei + 1] - m_begin;
+            if(nmats == 0)
+            {
+                matlist[(size_t)ei] = 0;
+            }
+            else if(nmats == 1)
+            {
+                matlist[(size_t)ei] = csr.mat_ids[(size_t)m_begin] + 1;
+            }
+            else
+            {
+                const index_t slot_begin = slot_offsets[(size_t)ei];
+                for(index_t mi = 0; mi < nmats; mi++)
+                {
+                    const size_t si = (size_t)(slot_begin + mi);
+                    const size_t ci = (size_t)(m_begin + mi);
+                    mix_mat[si] = csr.mat_ids[ci];
+                    mix_vf[si] = csr.vfs[ci];
+                    if(csr.has_values)
                     {
-                        temp.set_external(
-                          DataType(matset_values_data.dtype().id(), 1),
-                          (void*)matset_values_data.element_ptr(o2m_access_index));
-                        const float64 curr_matset_value  = temp.to_float64();
-                        elem_matset_values_maps[mat_elem][mat_id] = curr_matset_value;
+                        mixvar[si] = csr.values[ci];
                     }
+                    // 1-based index of the next slot, 0 ends the chain
+                    mix_next[si] = (mi + 1 < nmats) ? (index_t)si + 2 : 0;
                 }
+                matlist[(size_t)ei] = ~slot_begin;
             }
         }
+    });
+
+    set_converted(matlist, int_dtype, dest["matlist"]);
+    set_converted(mix_next, int_dtype, dest["mix_next"]);
+    set_converted(mix_mat, int_dtype, dest["mix_mat"]);
+    set_converted(mix_vf, float_dtype, dest["mix_vf"]);
+    if(csr.has_values)
+    {
+        set_converted(mixvar, float_dtype, dest["field_mixvar_values"]);
     }
+}
 
-    index_t matset_num_slots = 0;
-    for(const std::map<index_t, float64> &elem_mat_map: elem_mat_maps)
+//-----------------------------------------------------------------------------
+// Writes a uni-buffer element-dominant matset from a matset csr.
+//-----------------------------------------------------------------------------
+void
+write_element_dominant(const MatsetCSR &csr,
+                       const DataType &int_dtype,
+                       const DataType &float_dtype,
+                       conduit::Node &dest)
+{
+    std::vector<index_t> sizes((size_t)csr.num_elems);
+    for(index_t ei = 0; ei < csr.num_elems; ei++)
     {
-        matset_num_slots += (elem_mat_map.size() > 1) ? elem_mat_map.size() : 0;
+        sizes[(size_t)ei] = csr.offsets[(size_t)ei + 1] - csr.offsets[(size_t)ei];
     }
-    const index_t mset_num_slots = matset_num_slots;
+    const std::vector<index_t> offsets(csr.offsets.begin(),
+                                       csr.offsets.end() - 1);
 
-    // Generate Silo Data Structures //
+    set_converted(csr.vfs, float_dtype, dest["volume_fractions"]);
+    set_converted(csr.mat_ids, int_dtype, dest["material_ids"]);
+    set_converted(sizes, int_dtype, dest["sizes"]);
+    set_converted(offsets, int_dtype, dest["offsets"]);
+}
 
-    dest.reset();
-    dest["topology"].set(matset["topology"]);
-    // in some cases, this method will sort the material names
-    // so always include the material map
-    dest["material_map"].set(matset_mat_map);
-    dest["matlist"].set(DataType(int_dtype.id(), mset_num_elems));
-    dest["mix_next"].set(DataType(int_dtype.id(), mset_num_slots));
-    dest["mix_mat"].set(DataType(int_dtype.id(), mset_num_slots));
-    dest["mix_vf"].set(DataType(float_dtype.id(), mset_num_slots));
+//-----------------------------------------------------------------------------
+// Writes a multi-buffer material-dominant matset from a matset csr.
+//-----------------------------------------------------------------------------
+void
+write_material_dominant(const MatsetCSR &csr,
+                        const conduit::Node &mat_map,
+                        const DataType &int_dtype,
+                        const DataType &float_dtype,
+                        conduit::Node &dest)
+{
+    // material ids to (dense) material indices
+    std::vector<std::string> mat_names;
+    std::vector<index_t> mat_ids;
+    NodeConstIterator map_itr = mat_map.children();
+    while(map_itr.has_next())
+    {
+        const Node &id_node = map_itr.next();
+        mat_names.push_back(map_itr.name());
+        mat_ids.push_back(id_node.to_index_t());
+    }
+    const index_t num_mats = (index_t)mat_ids.size();
+    const index_t max_mat_id = mat_ids.empty() ? -1 :
+        *std::max_element(mat_ids.begin(), mat_ids.end());
+    std::vector<index_t> mat_index((size_t)(max_mat_id + 1), -1);
+    for(index_t mi = 0; mi < num_mats; mi++)
+    {
+        mat_index[(size_t)mat_ids[(size_t)mi]] = mi;
+    }
 
-    if(xform_matset_values)
+    for(size_t ci = 0; ci < csr.mat_ids.size(); ci++)
     {
-        dest["field_mixvar_values"].set(DataType(float_dtype.id(), mset_num_slots));
-        if(field.has_child("values"))
+        const index_t mat_id = csr.mat_ids[ci];
+        if(mat_id < 0 || mat_id > max_mat_id || mat_index[(size_t)mat_id] < 0)
         {
-            dest["field_values"].set(field["values"]);
+            CONDUIT_ERROR("blueprint::mesh::matset::to_material_dominant: "
+                          "material id " << mat_id << " is not in the "
+                          "material map");
         }
     }
 
-    for(index_t elem_index = 0, slot_index = 0; elem_index < mset_num_elems; elem_index++)
+    // count the entries of each material in each block of elements, so
+    // each block can write its entries in parallel (in element order)
+    const index_t num_elems = csr.num_elems;
+    const index_t num_blocks = (num_elems + MATSET_BLOCK_SIZE - 1) / MATSET_BLOCK_SIZE;
+    std::vector<index_t> block_counts((size_t)(num_blocks * num_mats + num_mats), 0);
+    execution::for_all(0, num_blocks, [&](index_t bi)
     {
-        const std::map<index_t, float64>& elem_mat_map = elem_mat_maps[elem_index];
-        if(elem_mat_map.size() == 0)
+        const index_t e_begin = bi * MATSET_BLOCK_SIZE;
+        const index_t e_end = std::min(e_begin + MATSET_BLOCK_SIZE, num_elems);
+        index_t *counts = &block_counts[(size_t)(bi * num_mats)];
+        for(index_t ci = csr.offsets[(size_t)e_begin]; ci < csr.offsets[(size_t)e_end]; ci++)
         {
-            temp.reset();
-            temp.set(0);
-            data.set_external(int_dtype, dest["matlist"].element_ptr(elem_index));
-            temp.to_data_type(int_dtype.id(), data);
+            counts[mat_index[(size_t)csr.mat_ids[(size_t)ci]]]++;
         }
-        else if(elem_mat_map.size() == 1)
+    });
+
+    // exclusive scan over blocks (per material), totals in the last row
+    std::vector<index_t> mat_counts((size_t)num_mats, 0);
+    for(index_t bi = 0; bi < num_blocks; bi++)
+    {
+        for(index_t mi = 0; mi < num_mats; mi++)
         {
-            temp.reset();
-            temp.set(elem_mat_map.begin()->first + 1);
-            data.set_external(int_dtype, dest["matlist"].element_ptr(elem_index));
-            temp.to_data_type(int_dtype.id(), data);
+            index_t &count = block_counts[(size_t)(bi * num_mats + mi)];
+            const index_t block_count = count;
+            count = mat_counts[(size_t)mi];
+            mat_counts[(size_t)mi] += block_count;
         }
-        else
+    }
+
+    std::vector< std::vector<index_t> > mat_eids((size_t)num_mats);
+    std::vector< std::vector<float64> > mat_vfs((size_t)num_mats);
+    for(index_t mi = 0; mi < num_mats; mi++)
+    {
+        mat_eids[(size_t)mi].resize((size_t)mat_counts[(size_t)mi]);
+        mat_vfs[(size_t)mi].resize((size_t)mat_counts[(size_t)mi]);
+    }
+
+    execution::for_all(0, num_blocks, [&](index_t bi)
+    {
+        const index_t e_begin = bi * MATSET_BLOCK_SIZE;
+        const index_t e_end = std::min(e_begin + MATSET_BLOCK_SIZE, num_elems);
+        index_t *fill = &block_counts[(size_t)(bi * num_mats)];
+        for(index_t ei = e_begin; ei < e_end; ei++)
         {
-            index_t next_slot_index = slot_index;
-            for(const auto& zone_mix_mat : elem_mat_map)
+            for(index_t ci = csr.offsets[(size_t)ei]; ci < csr.offsets[(size_t)ei + 1]; ci++)
             {
-                temp.reset();
-                temp.set(zone_mix_mat.first);
-                data.set_external(int_dtype, dest["mix_mat"].element_ptr(next_slot_index));
-                temp.to_data_type(int_dtype.id(), data);
-
-                // also do matset_values if passed
-                // elem_index ==> element index
-                // zone_mix_mat.first ==> material index
-                // process matset values if passed
-                if(xform_matset_values)
-                {
-                    temp.reset();
-                    temp.set(elem_matset_values_maps[elem_index][zone_mix_mat.first]);
-                    data.set_external(float_dtype, dest["field_mixvar_values"].element_ptr(next_slot_index));
-                    temp.to_data_type(float_dtype.id(), data);
-                }
+                const index_t mi = mat_index[(size_t)csr.mat_ids[(size_t)ci]];
+                const size_t oi = (size_t)fill[mi]++;
+                mat_eids[(size_t)mi][oi] = ei;
+                mat_vfs[(size_t)mi][oi] = csr.vfs[(size_t)ci];
+            }
+        }
+    });
 
-                temp.reset();
-                temp.set(zone_mix_mat.second);
-                data.set_external(float_dtype, dest["mix_vf"].element_ptr(next_slot_index));
-                temp.to_data_type(float_dtype.id(), data);
+    for(index_t mi = 0; mi < num_mats; mi++)
+    {
+        const std::string &mat_name = mat_names[(size_t)mi];
+        set_converted(mat_vfs[(size_t)mi], float_dtype,
+                      dest["volume_fractions"][mat_name]);
+        set_converted(mat_eids[(size_t)mi], int_dtype,
+                      dest["element_ids"][mat_name]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Single implementation that supports the case where just matset
+// is passed, and the case where the field is passed.
+//
+// This is in the detail name space b/c the calling convention is a little
+// strange:
+//   empty field  node -- first arg, triggers one path, non empty another
+//
+// We smooth this out for the API by providing the non detail variants,
+// which error when passed empty nodes.
+//-----------------------------------------------------------------------------
+void
+to_silo(const conduit::Node &field,
+        const conduit::Node &matset,
+        conduit::Node &dest,
+        const float64 epsilon)
+{
+    const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_FLOAT_DTYPE);
 
-                temp.reset();
-                temp.set(next_slot_index + 1 + 1);
-                data.set_external(int_dtype, dest["mix_next"].element_ptr(next_slot_index));
-                temp.to_data_type(int_dtype.id(), data);
+    // NOTE: matset values are always treated as a float64.
+    // we could map to the widest int or float type in the future.
 
-                ++next_slot_index;
-            }
+    // setup the material map, which provides a map from material names
+    // to to material numbers
+    Node matset_mat_map;
+    matset_material_map(matset, int_dtype, matset_mat_map);
 
-            temp.reset();
-            temp.set(0);
-            data.set_external(int_dtype, dest["mix_next"].element_ptr(next_slot_index - 1));
-            temp.to_data_type(int_dtype.id(), data);
+    MatsetCSR csr;
+    build_matset_csr(field, matset, matset_mat_map, epsilon, csr);
 
+    // Generate Silo Data Structures //
 
-            temp.reset();
-            temp.set(~slot_index);
-            data.set_external(int_dtype, dest["matlist"].element_ptr(elem_index));
-            temp.to_data_type(int_dtype.id(), data);
+    dest.reset();
+    dest["topology"].set(matset["topology"]);
+    // in some cases, this method will sort the material names
+    // so always include the material map
+    dest["material_map"].set(matset_mat_map);
+    write_silo(csr, int_dtype, float_dtype, dest);
 
-            slot_index += elem_mat_map.size();
-        }
+    if(field.has_child("matset_values") && field.has_child("values"))
+    {
+        dest["field_values"].set(field["values"]);
     }
 }
 
@@ -526,6 +1006,108 @@ to_silo(const conduit::Node &matset,
                     epsilon);
 }
 
+//-----------------------------------------------------------------------------
+void
+from_silo(const conduit::Node &silo_mset,
+          conduit::Node &dest)
+{
+    if(!silo_mset.dtype().is_object() ||
+       !silo_mset.has_child("matlist") ||
+       !silo_mset.has_child("mix_next") ||
+       !silo_mset.has_child("mix_mat") ||
+       !silo_mset.has_child("mix_vf"))
+    {
+        CONDUIT_ERROR("blueprint::mesh::matset::from_silo passed node"
+                      " must be a silo style matset (with matlist,"
+                      " mix_next, mix_mat, and mix_vf).");
+    }
+
+    const DataType int_dtype = bputils::find_widest_dtype(silo_mset, bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(silo_mset, bputils::DEFAULT_FLOAT_DTYPE);
+
+    detail::MatsetCSR csr;
+    detail::build_matset_csr_from_silo(silo_mset, csr);
+
+    dest.reset();
+    if(silo_mset.has_child("topology"))
+    {
+        dest["topology"].set(silo_mset["topology"]);
+    }
+
+    if(silo_mset.has_child("material_map"))
+    {
+        dest["material_map"].set(silo_mset["material_map"]);
+    }
+    else
+    {
+        // name materials by id
+        std::set<index_t> mat_ids(csr.mat_ids.begin(), csr.mat_ids.end());
+        Node temp;
+        for(const index_t mat_id : mat_ids)
+        {
+            temp.set(mat_id);
+            temp.to_data_type(int_dtype.id(),
+                dest["material_map"]["mat_" + std::to_string(mat_id)]);
+        }
+    }
+
+    detail::write_element_dominant(csr, int_dtype, float_dtype, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_element_dominant(const conduit::Node &matset,
+                    conduit::Node &dest,
+                    const float64 epsilon)
+{
+    if(!matset.dtype().is_object() )
+    {
+        CONDUIT_ERROR("blueprint::mesh::matset::to_element_dominant passed"
+                      " matset node must be a valid matset tree.");
+    }
+
+    const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_FLOAT_DTYPE);
+
+    Node mat_map;
+    detail::matset_material_map(matset, int_dtype, mat_map);
+
+    detail::MatsetCSR csr;
+    detail::build_matset_csr(Node(), matset, mat_map, epsilon, csr);
+
+    dest.reset();
+    dest["topology"].set(matset["topology"]);
+    dest["material_map"].set(mat_map);
+    detail::write_element_dominant(csr, int_dtype, float_dtype, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_material_dominant(const conduit::Node &matset,
+                     conduit::Node &dest,
+                     const float64 epsilon)
+{
+    if(!matset.dtype().is_object() )
+    {
+        CONDUIT_ERROR("blueprint::mesh::matset::to_material_dominant passed"
+                      " matset node must be a valid matset tree.");
+    }
+
+    const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_FLOAT_DTYPE);
+
+    Node mat_map;
+    detail::matset_material_map(matset, int_dtype, mat_map);
+
+    detail::MatsetCSR csr;
+    detail::build_matset_csr(Node(), matset, mat_map, epsilon, csr);
+
+    dest.reset();
+    dest["topology"].set(matset["topology"]);
+    dest["material_map"].set(mat_map);
+    detail::write_material_dominant(csr, mat_map, int_dtype, float_dtype, dest);
+}
+
 
 //-----------------------------------------------------------------------------
 
@@ -41,6 +41,7 @@
 #include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_log.hpp"
+#include "conduit_execution.hpp"
 
 // Uncomment to enable some debugging output from partitioner.
 // #define CONDUIT_DEBUG_PARTITIONER
@@ -1608,7 +1609,8 @@ Partitioner::Partitioner()
   selections(),
   selected_fields(),
   mapping(true),
-  merge_tolerance(1.e-8)
+  merge_tolerance(1.e-8),
+  merge_method("spatial_hash")
 {
 }
 
@@ -1906,6 +1908,19 @@ Partitioner::initialize(const conduit::Node &n_mesh,
     if(options.has_child("merge_tolerance"))
         merge_tolerance = options["merge_tolerance"].to_double();
 
+    // Get the algorithm used to merge points within merge_tolerance.
+    if(options.has_child("merge_method"))
+    {
+        merge_method = options["merge_method"].as_string();
+        if(merge_method != "spatial_hash" &&
+           merge_method != "kdtree" &&
+           merge_method != "simple")
+        {
+            CONDUIT_ERROR("Unknown merge_method \"" << merge_method << "\"."
+                          " Supported methods are: spatial_hash, kdtree, simple");
+        }
+    }
+
 #ifdef CONDUIT_DEBUG_PARTITIONER
     cout << rank << ": Partitioner::initialize" << endl;
     cout << "\ttarget=" << target << endl;
@@ -2424,57 +2439,29 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
         else if(n_topo.has_path("elements/element_types"))
         {
             // It looks like the topology is unstructured but contains multiple
-            // element types.
+            // element types. Walk the shape stream in same-shaped blocks and
+            // insert the vertices of the selected elements.
+            using conduit::blueprint::mesh::utils::topology::element_block;
+            index_t nselected = 0;
+            for(size_t i = 0; i < element_ids.size(); i++)
+                nselected = std::max(nselected, element_ids[i] + 1);
+            std::vector<char> selected(nselected, 0);
+            for(size_t i = 0; i < element_ids.size(); i++)
+                selected[element_ids[i]] = 1;
 
-            // Determine the number of points for each stream id and shape.
-            std::map<int,int> stream_id_npts;
-            const conduit::Node &n_element_types = n_topo["elements/element_types"];
-            for(index_t i = 0; i < n_element_types.number_of_children(); i++)
+            utils::topology::iterate_element_blocks(n_topo, [&](const element_block &b)
             {
-                const conduit::Node &n = n_element_types[i];
-                auto stream_id = n["stream_id"].to_int();
-                std::string shape_str(n["shape"].as_string());
-                for(size_t j = 0; j < utils::TOPO_SHAPES.size(); j++)
+                const index_t nblock = std::min(b.num_elements,
+                    nselected - b.first_element_id);
+                for(index_t ei = 0; ei < nblock; ei++)
                 {
-                    if(shape_str == utils::TOPO_SHAPES[j])
+                    if(selected[b.first_element_id + ei])
                     {
-                        stream_id_npts[stream_id] = utils::TOPO_SHAPE_INDEX_COUNTS[j];
-                        break;
+                        const index_t *eids = b.element(ei);
+                        vertex_ids.insert(eids, eids + b.element_size(ei));
                     }
                 }
-            }
-
-            conduit::Node n_stream_ids, n_element_counts, n_stream;
-            as_index_t(n_topo["elements/element_index/stream_ids"], n_stream_ids);
-            as_index_t(n_topo["elements/element_index/element_counts"], n_element_counts);
-            as_index_t(n_topo["elements/stream"], n_stream);
-            auto stream_ids = as_index_t_array(n_stream_ids);
-            auto element_counts = as_index_t_array(n_element_counts);
-            auto stream = as_index_t_array(n_stream);
-
-            // Compute some size,offsets into the stream to help
-            std::vector<index_t> sizes, offsets;
-            index_t offset = 0, elemid = 0;
-            for(index_t j = 0; j < stream_ids.number_of_elements(); j++)
-            {
-                auto n = static_cast<index_t>(element_counts[j]);
-                auto npts = stream_id_npts[stream_ids[j]];
-                for(index_t i = 0; i < n; i++)
-                {
-                    sizes.push_back(npts);
-                    offsets.push_back(offset);
-                    offset += npts;
-                    elemid++;
-                }
-            }
-
-            // Now, for each element, insert its vertices.
-            for(size_t i = 0; i < element_ids.size(); i++)
-            {
-                auto npts = sizes[element_ids[i]];
-                for(index_t j = 0; j < npts; j++)
-                    vertex_ids.insert(stream[offsets[element_ids[i]] + j]);
-            }
+            });
         }
         else
         {
@@ -3531,6 +3518,43 @@ Partitioner::build_interdomain_adjsets(const std::vector<int>& chunk_offsets,
     }
 }
 
+//---------------------------------------------------------------------------
+/**
+ @brief Returns true if all of the data in the node lives in buffers that
+        were allocated by the node or its descendants (no external data).
+ */
+static bool
+owns_all_data(const conduit::Node &n,
+              const uint8 *buf_begin = nullptr,
+              const uint8 *buf_end = nullptr)
+{
+    if(n.allocated_bytes() > 0)
+    {
+        buf_begin = static_cast<const uint8 *>(n.data_ptr());
+        buf_end = buf_begin + n.allocated_bytes();
+    }
+
+    const DataType &dt = n.dtype();
+    if(dt.is_object() || dt.is_list())
+    {
+        for(index_t i = 0; i < n.number_of_children(); i++)
+        {
+            if(!owns_all_data(n.child(i), buf_begin, buf_end))
+                return false;
+        }
+        return true;
+    }
+    else if(dt.is_empty() || dt.number_of_elements() == 0)
+    {
+        return true;
+    }
+
+    const uint8 *first = static_cast<const uint8 *>(n.element_ptr(0));
+    const uint8 *last = static_cast<const uint8 *>(
+        n.element_ptr(dt.number_of_elements() - 1)) + dt.element_bytes();
+    return buf_begin != nullptr && first >= buf_begin && last <= buf_end;
+}
+
 //---------------------------------------------------------------------------
 static void
 attach_chunk_adjset_to_single_dom(conduit::Node& dom, index_t src_chunk, const conduit::Node* chunk_adjs = nullptr)
@@ -3542,7 +3566,7 @@ attach_chunk_adjset_to_single_dom(conduit::Node& dom, index_t src_chunk, const c
         {
             return;
         }
-        tmp_node = dom.fetch("adjsets");
+        tmp_node.steal(dom["adjsets"]);
         dom.remove("adjsets");
         chunk_adjs = &tmp_node;
     }
@@ -3679,12 +3703,41 @@ Partitioner::execute(conduit::Node &output)
     // make chunks.
     std::vector<Chunk> chunks;
     std::vector<conduit::Node*> adjset_data;
+    // Chunks we created (as opposed to input meshes), which can be moved
+    // rather than copied into the output if they own all of their data.
+    std::set<const conduit::Node*> stealable_chunks;
 
     // Maps each pre-load balance mesh domain to a set of vertex lists for each chunk.
     // This is used in constructing the intermediate chunk adjsets within a domain.
     DomainToChunkMap domain_to_chunk_map;
     std::map<index_t, const conduit::Node*> domain_id_to_node;
 
+    // Wrap or extract the selections. The selections are independent so
+    // they are processed concurrently (when OpenMP support is enabled).
+    // All MPI communication happens later, on the calling thread.
+    const index_t nsel = (index_t)selections.size();
+    std::vector<conduit::Node *> sel_nodes(selections.size(), nullptr);
+    std::vector<char> sel_whole(selections.size(), 0);
+    std::vector<std::vector<index_t>> sel_vert_ids(selections.size());
+    execution::for_all(0, nsel, [&](index_t si)
+    {
+        size_t i = (size_t)si;
+        if(selections[i]->get_whole(*meshes[i]))
+        {
+            // We had a selection that spanned the entire mesh so we'll take
+            // the whole mesh rather than extracting. If we are using "mapping"
+            // then we will be wrapping the mesh so we can add vertex and element
+            // maps to it without changing the input mesh.
+            sel_whole[i] = 1;
+            if(mapping || meshes[i]->has_child("adjsets"))
+                sel_nodes[i] = wrap(i, *meshes[i]);
+        }
+        else
+        {
+            sel_nodes[i] = extract(i, *meshes[i], sel_vert_ids[i]);
+        }
+    });
+
     for(size_t i = 0; i < selections.size(); i++)
     {
         // Get destination rank, domain if the selection has any. If not, it
@@ -3695,17 +3748,12 @@ Partitioner::execute(conduit::Node &output)
         index_t sr = selections[i]->get_domain();
 
         domain_id_to_node[sr] = meshes[i];
-        if(selections[i]->get_whole(*meshes[i]))
+        conduit::Node *c = sel_nodes[i];
+        if(sel_whole[i])
         {
-            // We had a selection that spanned the entire mesh so we'll take
-            // the whole mesh rather than extracting. If we are using "mapping"
-            // then we will be wrapping the mesh so we can add vertex and element
-            // maps to it without changing the input mesh.
             conduit::Node* wrapped_adjset = nullptr;
-            if(mapping || meshes[i]->has_child("adjsets"))
+            if(c != nullptr)
             {
-                conduit::Node *c = wrap(i, *meshes[i]);
-
                 chunks.push_back(Chunk(c, true, dr, dd));
                 if (meshes[i]->has_child("adjsets"))
                 {
@@ -3721,9 +3769,8 @@ Partitioner::execute(conduit::Node &output)
         }
         else
         {
-            std::vector<index_t> vert_ids;
-            conduit::Node *c = extract(i, *meshes[i], vert_ids);
             chunks.push_back(Chunk(c, true, dr, dd));
+            stealable_chunks.insert(c);
             if (meshes[i]->has_child("adjsets"))
             {
                 adjset_data.push_back(c->fetch_ptr("adjsets"));
@@ -3732,7 +3779,7 @@ Partitioner::execute(conduit::Node &output)
             {
                 adjset_data.push_back(nullptr);
             }
-            domain_to_chunk_map[meshes[i]][i] = std::move(vert_ids);
+            domain_to_chunk_map[meshes[i]][i] = std::move(sel_vert_ids[i]);
         }
     }
 
@@ -3753,6 +3800,14 @@ Partitioner::execute(conduit::Node &output)
         chunks_to_assemble_domains,
         chunks_to_assemble_gids);
 
+    // Received chunks are ours too, but they may wrap data that belongs to
+    // other chunks or to the input (see owns_all_data below).
+    for(size_t i = 0; i < chunks_to_assemble.size(); i++)
+    {
+        if(chunks_to_assemble[i].owns)
+            stealable_chunks.insert(chunks_to_assemble[i].mesh);
+    }
+
     // Now that we have all the parts we need in chunks_to_assemble, combine
     // the chunks.
     std::set<int> unique_doms;
@@ -3770,48 +3825,64 @@ Partitioner::execute(conduit::Node &output)
 
     if(!chunks_to_assemble.empty())
     {
+        // Create the output domains up front, then assemble them
+        // concurrently (when OpenMP support is enabled). Each task only
+        // touches its own output domain and chunks.
         output.reset();
-        for(auto dom = unique_doms.begin(); dom != unique_doms.end(); dom++)
+        const std::vector<int> doms(unique_doms.begin(), unique_doms.end());
+        std::vector<conduit::Node *> new_doms(doms.size(), &output);
+        if(doms.size() > 1)
         {
+            for(size_t di = 0; di < doms.size(); di++)
+                new_doms[di] = &(output.append());
+        }
+
+        execution::for_all(0, (index_t)doms.size(), [&](index_t di)
+        {
+            const int dom = doms[(size_t)di];
+            conduit::Node *new_dom = new_doms[(size_t)di];
+
             // Get the chunks for this output domain.
             std::vector<const Node *> this_dom_chunks;
             std::vector<index_t> this_dom_cnkid;
             for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
             {
-                if(chunks_to_assemble_domains[i] == *dom)
+                if(chunks_to_assemble_domains[i] == dom)
                 {
                     this_dom_chunks.push_back(chunks_to_assemble[i].mesh);
                     this_dom_cnkid.push_back(chunks_to_assemble_gids[i]);
                 }
             }
 
-            conduit::Node* new_dom;
-            if (unique_doms.size() > 1)
-            {
-                new_dom = &(output.append());
-            }
-            else
-            {
-                new_dom = &output;
-            }
             if(this_dom_chunks.size() == 1)
             {
-                new_dom->set(*this_dom_chunks[0]); // Could we transfer ownership if we own the chunk?
-                new_dom->set_path("state/domain_id", (int)*dom);
+                if(stealable_chunks.find(this_dom_chunks[0]) != stealable_chunks.end() &&
+                   owns_all_data(*this_dom_chunks[0]))
+                {
+                    // We own the chunk's data so we can transfer it to
+                    // the output instead of copying it. The emptied chunk
+                    // is still freed below.
+                    new_dom->steal(*const_cast<Node *>(this_dom_chunks[0]));
+                }
+                else
+                {
+                    new_dom->set(*this_dom_chunks[0]);
+                }
+                new_dom->set_path("state/domain_id", dom);
 
                 attach_chunk_adjset_to_single_dom(*new_dom, this_dom_cnkid[0]);
             }
             else if(this_dom_chunks.size() > 1)
             {
                 // Combine the chunks for this domain and add to a list in output.
-                combine(*dom, this_dom_chunks, this_dom_cnkid, *new_dom);
+                combine(dom, this_dom_chunks, this_dom_cnkid, *new_dom);
             }
 
             if (new_dom->has_child("adjsets"))
             {
                 merge_chunked_adjsets((*new_dom)["adjsets"], dest_domain);
             }
-        }
+        });
     }
 
     // Clean up
@@ -4047,10 +4118,31 @@ namespace coordset
 class point_merge
 {
 public:
+    /**
+    @brief The algorithms that can be used to merge points.
+    */
+    enum class merge_method
+    {
+        spatial_hash,
+        kdtree,
+        simple
+    };
+
+    /**
+    @brief Returns the merge method for the given name
+           ("spatial_hash", "kdtree", or "simple").
+    */
+    static merge_method method_from_name(const std::string &name);
+
     void execute(const std::vector<const conduit::Node *> &coordsets, 
                  double tolerance,
                  Node &output);
 
+    void execute(const std::vector<const conduit::Node *> &coordsets,
+                 double tolerance,
+                 merge_method method,
+                 Node &output);
+
 private:
     enum class coord_system
     {
@@ -4060,7 +4152,12 @@ private:
         logical
     };
 
-    int examine_extents(std::vector<std::vector<float64>> &extents) const;
+    /**
+    @brief Returns the number of overlapping pairs of extents. Extents that
+        are within tolerance of each other are considered to overlap.
+    */
+    int examine_extents(std::vector<std::vector<float64>> &extents,
+                        double tolerance) const;
 
     /**
     @brief Useful when none of the coordsets overlap. Combines all coordinates
@@ -4074,7 +4171,8 @@ private:
         one array; merging points within tolerance.
     */
     void merge_data(const std::vector<Node> &coordsets,
-        const std::vector<coord_system> &systems, index_t, double tolerance);
+        const std::vector<coord_system> &systems, index_t, double tolerance,
+        merge_method method);
 
     void create_output(index_t dimension, Node &output) const;
 
@@ -4096,6 +4194,11 @@ private:
     */
     index_t reserve_vectors(const std::vector<Node> &coordsets, index_t dimension);
 
+    /**
+    @brief Returns the number of points in the given explicit coordset.
+    */
+    static index_t number_of_points(const Node &coordset);
+
     /**
     @brief The simple (slow) approach to merging the data based off distance.
     */
@@ -4107,6 +4210,16 @@ private:
         const std::vector<coord_system> &systems, index_t dimension,
         double tolerance);
 
+    /**
+    @brief Merges points using a uniform grid of tolerance sized cells that
+        are hashed into flat bucket arrays. Point gathering and the neighbor
+        searches run in parallel (when OpenMP support is enabled), which
+        makes the cost linear in the number of points.
+    */
+    void spatial_hash_merge(const std::vector<Node> &coordsets,
+        const std::vector<coord_system> &systems, index_t dimension,
+        double tolerance);
+
     void truncate_merge(const std::vector<Node> &coordsets,
         const std::vector<coord_system> &systems, index_t dimension, double tolerance);
 
@@ -4899,16 +5012,201 @@ find_rectilinear_offset(const DataArray_t &da, T val, double tolerance = CONDUIT
     return retval;
 }
 
+//-----------------------------------------------------------------------------
+/**
+ @brief A uniform grid of cell_size cells, hashed into a power of two number
+        of buckets and stored in flat (CSR) arrays. Each bucket holds the ids
+        of the points whose cells hash to it, in increasing order.
+*/
+class point_hash_grid
+{
+public:
+    void build(const float64 *points, index_t npts, index_t dimension,
+               const float64 *origin, float64 cell_size)
+    {
+        m_points = points;
+        m_dimension = dimension;
+        m_inv_cell_size = 1. / cell_size;
+        for(index_t d = 0; d < 3; d++)
+        {
+            m_origin[d] = origin[d];
+        }
+
+        index_t nbuckets = 1;
+        while(nbuckets < npts)
+        {
+            nbuckets <<= 1;
+        }
+        m_mask = (uint64)(nbuckets - 1);
+
+        std::vector<index_t> point_buckets((size_t)npts);
+        execution::for_all_blocks(npts, 1 << 16, [&](index_t b_begin, index_t b_end)
+        {
+            int64 cell[3];
+            for(index_t i = b_begin; i < b_end; i++)
+            {
+                cell_coords(m_points + 3 * i, cell);
+                point_buckets[(size_t)i] = (index_t)(hash(cell) & m_mask);
+            }
+        });
+
+        m_offsets.assign((size_t)nbuckets + 1, 0);
+        for(index_t i = 0; i < npts; i++)
+        {
+            m_offsets[(size_t)point_buckets[(size_t)i] + 1]++;
+        }
+        for(index_t b = 0; b < nbuckets; b++)
+        {
+            m_offsets[(size_t)b + 1] += m_offsets[(size_t)b];
+        }
+
+        std::vector<index_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+        m_ids.resize((size_t)npts);
+        for(index_t i = 0; i < npts; i++)
+        {
+            m_ids[(size_t)fill[(size_t)point_buckets[(size_t)i]]++] = i;
+        }
+    }
+
+    /**
+     @brief Returns the smallest point id < limit, within sqrt(tolerance2) of
+            point p, for which accept(id) is true (or -1 if there is none).
+    */
+    template<typename Pred>
+    index_t find_first(const float64 *p, index_t limit, float64 tolerance2,
+                       const Pred &accept) const
+    {
+        int64 cell[3];
+        cell_coords(p, cell);
+
+        const int64 di = 1;
+        const int64 dj = (m_dimension > 1) ? 1 : 0;
+        const int64 dk = (m_dimension > 2) ? 1 : 0;
+
+        index_t retval = -1;
+        int64 ncell[3];
+        for(int64 k = -dk; k <= dk; k++)
+        for(int64 j = -dj; j <= dj; j++)
+        for(int64 i = -di; i <= di; i++)
+        {
+            ncell[0] = cell[0] + i;
+            ncell[1] = cell[1] + j;
+            ncell[2] = cell[2] + k;
+            const size_t b = (size_t)(hash(ncell) & m_mask);
+            for(index_t idx = m_offsets[b]; idx < m_offsets[b + 1]; idx++)
+            {
+                const index_t id = m_ids[(size_t)idx];
+                // bucket ids are sorted, so we can stop early
+                if(id >= limit || (retval >= 0 && id >= retval))
+                {
+                    break;
+                }
+
+                const float64 *q = m_points + 3 * id;
+                float64 dist2 = 0.;
+                for(index_t d = 0; d < m_dimension; d++)
+                {
+                    const float64 diff = p[d] - q[d];
+                    dist2 += diff * diff;
+                }
+
+                if(dist2 <= tolerance2 && accept(id))
+                {
+                    retval = id;
+                    break;
+                }
+            }
+        }
+        return retval;
+    }
+
+private:
+    void cell_coords(const float64 *p, int64 cell[3]) const
+    {
+        // Clamp so neighbor cell arithmetic can't overflow. Clamping only
+        // makes cells coarser, which keeps the search correct.
+        static const float64 max_cell = 4503599627370496.; // 2^52
+        for(index_t d = 0; d < 3; d++)
+        {
+            float64 c = 0.;
+            if(d < m_dimension)
+            {
+                c = std::floor((p[d] - m_origin[d]) * m_inv_cell_size);
+                if(!(c > -max_cell)) // also catches NaN
+                {
+                    c = -max_cell;
+                }
+                else if(c > max_cell)
+                {
+                    c = max_cell;
+                }
+            }
+            cell[d] = (int64)c;
+        }
+    }
+
+    static uint64 hash(const int64 cell[3])
+    {
+        uint64 h = (uint64)cell[0] * 0x9E3779B97F4A7C15ull;
+        h ^= (uint64)cell[1] * 0xC2B2AE3D27D4EB4Full;
+        h ^= (uint64)cell[2] * 0x165667B19E3779F9ull;
+        h ^= h >> 29;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 32;
+        return h;
+    }
+
+    const float64        *m_points = nullptr;
+    index_t               m_dimension = 3;
+    float64               m_origin[3] = {0., 0., 0.};
+    float64               m_inv_cell_size = 1.;
+    uint64                m_mask = 0;
+    std::vector<index_t>  m_offsets;
+    std::vector<index_t>  m_ids;
+};
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::coordset::utils --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+point_merge::merge_method
+point_merge::method_from_name(const std::string &name)
+{
+    if(name == "spatial_hash")
+    {
+        return merge_method::spatial_hash;
+    }
+    else if(name == "kdtree")
+    {
+        return merge_method::kdtree;
+    }
+    else if(name == "simple")
+    {
+        return merge_method::simple;
+    }
+
+    CONDUIT_ERROR("Unknown point merge method \"" << name << "\"."
+                  " Supported methods are: spatial_hash, kdtree, simple");
+    return merge_method::spatial_hash;
+}
+
 //-----------------------------------------------------------------------------
 void
 point_merge::execute(const std::vector<const Node *> &coordsets,
                      double tolerance,
                      Node &output)
+{
+    execute(coordsets, tolerance, merge_method::spatial_hash, output);
+}
+
+//-----------------------------------------------------------------------------
+void
+point_merge::execute(const std::vector<const Node *> &coordsets,
+                     double tolerance,
+                     merge_method method,
+                     Node &output)
 {
     if(coordsets.empty())
         return;
@@ -5012,7 +5310,7 @@ point_merge::execute(const std::vector<const Node *> &coordsets,
         return;
     }
 
-    int noverlapping_sets = examine_extents(extents);
+    int noverlapping_sets = examine_extents(extents, tolerance);
     PM_DEBUG_PRINT("I was given " << coordsets.size() << " I am combining " << working_sets.size() << std::endl);
     PM_DEBUG_PRINT("noverlapping sets: " << noverlapping_sets << std::endl);
     if(noverlapping_sets == 0)
@@ -5022,7 +5320,7 @@ point_merge::execute(const std::vector<const Node *> &coordsets,
     }
     else
     {
-        merge_data(working_sets, systems, dimension, tolerance);
+        merge_data(working_sets, systems, dimension, tolerance, method);
     }
 
     create_output(dimension, output);
@@ -5030,9 +5328,11 @@ point_merge::execute(const std::vector<const Node *> &coordsets,
 
 //-----------------------------------------------------------------------------
 int
-point_merge::examine_extents(std::vector<std::vector<float64>> &extents) const
+point_merge::examine_extents(std::vector<std::vector<float64>> &extents,
+                             double tolerance) const
 {
-    const auto overlap = [](const float64 box1[6], const float64 box2[6]) -> bool {
+    const float64 tol = std::max(tolerance, 0.);
+    const auto overlap = [tol](const float64 box1[6], const float64 box2[6]) -> bool {
         bool retval = true;
         for(auto i = 0u; i < 3u; i++)
         {
@@ -5041,7 +5341,7 @@ point_merge::examine_extents(std::vector<std::vector<float64>> &extents) const
             const auto max1 = box1[idx+1];
             const auto min2 = box2[idx];
             const auto max2 = box2[idx+1];
-            retval &= (max1 >= min2 && max2 >= min1);
+            retval &= (max1 + tol >= min2 && max2 + tol >= min1);
         }
         return retval;
     };
@@ -5115,17 +5415,27 @@ point_merge::append_data(const std::vector<Node> &coordsets,
 //-----------------------------------------------------------------------------
 void
 point_merge::merge_data(const std::vector<Node> &coordsets,
-        const std::vector<coord_system> &systems, index_t dimension, double tolerance)
+        const std::vector<coord_system> &systems, index_t dimension, double tolerance,
+        merge_method method)
 {
-#define USE_SPATIAL_SEARCH_MERGE
-#if   defined(USE_TRUNCATE_PRECISION_MERGE)
+#if defined(USE_TRUNCATE_PRECISION_MERGE)
+    (void)method;
     truncate_merge(coordsets, systems, dimension, tolerance);
-#elif defined(USE_SPATIAL_SEARCH_MERGE)
-    spatial_search_merge(coordsets, systems, dimension, tolerance);
 #else
-    simple_merge_data(coordsets, systems, dimension, tolerance);
+    switch(method)
+    {
+    case merge_method::kdtree:
+        spatial_search_merge(coordsets, systems, dimension, tolerance);
+        break;
+    case merge_method::simple:
+        simple_merge_data(coordsets, systems, dimension, tolerance);
+        break;
+    case merge_method::spatial_hash:
+    default:
+        spatial_hash_merge(coordsets, systems, dimension, tolerance);
+        break;
+    }
 #endif
-#undef USE_SPATIAL_SEARCH_MERGE
 }
 
 //-----------------------------------------------------------------------------
@@ -5298,6 +5608,32 @@ point_merge::iterate_coordinates(const Node &coordset, Func &&func)
     }
 }
 
+//-----------------------------------------------------------------------------
+index_t
+point_merge::number_of_points(const Node &coordset)
+{
+    index_t npts = 0;
+    const Node *values = coordset.fetch_ptr("values");
+    if(values)
+    {
+        const Node *xnode = values->fetch_ptr("x");
+        if(!xnode)
+        {
+            xnode = values->fetch_ptr("r");
+        }
+        if(!xnode)
+        {
+            xnode = values->fetch_ptr("i");
+        }
+
+        if(xnode)
+        {
+            npts = xnode->dtype().number_of_elements();
+        }
+    }
+    return npts;
+}
+
 //-----------------------------------------------------------------------------
 index_t
 point_merge::reserve_vectors(const std::vector<Node> &coordsets, index_t dimension)
@@ -5306,30 +5642,12 @@ point_merge::reserve_vectors(const std::vector<Node> &coordsets, index_t dimensi
     index_t new_size = 0;
     for(size_t i = 0u; i < coordsets.size(); i++)
     {
-        const Node *values = coordsets[i].fetch_ptr("values");
-        index_t npts = 0;
-        if(values)
-        {
-            const Node *xnode = values->fetch_ptr("x");
-            if(!xnode)
-            {
-                xnode = values->fetch_ptr("r");
-            }
-            if(!xnode)
-            {
-                xnode = values->fetch_ptr("i");
-            }
-
-            if(xnode)
-            {
-                npts = xnode->dtype().number_of_elements();
-            }
-        #ifdef DEBUG_POINT_MERGE
-            std::cout << "coordset " << i << " ";
-            std::cout << npts << std::endl;
-            coordsets[i].print();
-        #endif
-        }
+        const index_t npts = number_of_points(coordsets[i]);
+    #ifdef DEBUG_POINT_MERGE
+        std::cout << "coordset " << i << " ";
+        std::cout << npts << std::endl;
+        coordsets[i].print();
+    #endif
 
         old_to_new_ids.push_back({});
         old_to_new_ids.back().reserve(npts);
@@ -5465,6 +5783,121 @@ point_merge::spatial_search_merge(const std::vector<Node> &coordsets,
         << ", nodes in tree " << point_records.nodes() << std::endl);
 }
 
+//-----------------------------------------------------------------------------
+void
+point_merge::spatial_hash_merge(const std::vector<Node> &coordsets,
+        const std::vector<coord_system> &systems, index_t dimension,
+        double tolerance)
+{
+    PM_DEBUG_PRINT("Spatial hash merging!" << std::endl);
+    reserve_vectors(coordsets, dimension);
+
+    // Gather all of the points into one flat (x,y,z) array.
+    const index_t ncoordsets = (index_t)coordsets.size();
+    std::vector<index_t> cset_offsets((size_t)ncoordsets + 1, 0);
+    for(index_t i = 0; i < ncoordsets; i++)
+    {
+        cset_offsets[(size_t)i + 1] = cset_offsets[(size_t)i] +
+                                      number_of_points(coordsets[(size_t)i]);
+    }
+    const index_t npts = cset_offsets.back();
+
+    std::vector<float64> points((size_t)(3 * npts), 0.);
+    execution::for_all(0, ncoordsets, [&](index_t i)
+    {
+        float64 *dest = points.data() + 3 * cset_offsets[(size_t)i];
+        const bool translate = systems[(size_t)i] != coord_system::cartesian
+                            && systems[(size_t)i] != coord_system::logical;
+        const auto gather = [&](float64 *p, index_t)
+        {
+            if(translate)
+            {
+                translate_system(systems[(size_t)i], coord_system::cartesian,
+                    p[0], p[1], p[2], p[0], p[1], p[2]);
+            }
+            dest[0] = p[0]; dest[1] = p[1]; dest[2] = p[2];
+            dest += 3;
+        };
+        iterate_coordinates(coordsets[(size_t)i], gather);
+    });
+
+    float64 origin[3] = {0., 0., 0.};
+    if(npts > 0)
+    {
+        for(index_t d = 0; d < 3; d++)
+        {
+            origin[d] = points[(size_t)d];
+        }
+        for(index_t i = 1; i < npts; i++)
+        {
+            for(index_t d = 0; d < 3; d++)
+            {
+                origin[d] = std::min(origin[d], points[(size_t)(3 * i + d)]);
+            }
+        }
+    }
+
+    // Hash the points into tolerance sized cells. Points within tolerance
+    // of each other are always in the same or in neighboring cells.
+    const float64 t2 = (tolerance > 0.) ? (tolerance * tolerance) : 0.;
+    utils::point_hash_grid grid;
+    grid.build(points.data(), npts, dimension, origin,
+               (tolerance > 0.) ? tolerance : 1.);
+
+    // Find the first earlier point within tolerance of each point.
+    const auto any_point = [](index_t) { return true; };
+    std::vector<index_t> first_match((size_t)npts);
+    execution::for_all_blocks(npts, 1 << 14, [&](index_t b_begin, index_t b_end)
+    {
+        for(index_t i = b_begin; i < b_end; i++)
+        {
+            first_match[(size_t)i] = grid.find_first(points.data() + 3 * i,
+                                                     i, t2, any_point);
+        }
+    });
+
+    // Assign new ids in point order. A point maps to the earlier point it
+    // matched, unless that point was itself merged away (a chain of points
+    // that are each within tolerance of the next). In that rare case we
+    // search again for the first earlier unique point.
+    std::vector<index_t> unique_ids((size_t)npts, -1);
+    const auto is_unique = [&unique_ids](index_t id)
+    {
+        return unique_ids[(size_t)id] >= 0;
+    };
+    index_t nunique = 0;
+    for(index_t i = 0; i < ncoordsets; i++)
+    {
+        auto &idmap = old_to_new_ids[(size_t)i];
+        for(index_t pi = cset_offsets[(size_t)i]; pi < cset_offsets[(size_t)i + 1]; pi++)
+        {
+            index_t match = first_match[(size_t)pi];
+            if(match >= 0 && !is_unique(match))
+            {
+                match = grid.find_first(points.data() + 3 * pi, pi, t2, is_unique);
+            }
+
+            if(match >= 0)
+            {
+                idmap.push_back(unique_ids[(size_t)match]);
+            }
+            else
+            {
+                unique_ids[(size_t)pi] = nunique;
+                idmap.push_back(nunique);
+                for(index_t d = 0; d < dimension; d++)
+                {
+                    new_coords.push_back(points[(size_t)(3 * pi + d)]);
+                }
+                nunique++;
+            }
+        }
+    }
+
+    PM_DEBUG_PRINT("Number of points " << npts << ", unique points "
+        << nunique << std::endl);
+}
+
 //-----------------------------------------------------------------------------
 void
 point_merge::truncate_merge(const std::vector<Node> &coordsets,
@@ -8976,7 +9409,9 @@ Partitioner::combine_as_unstructured(const std::string &topo_name,
     Node &output_coordsets = output.add_child("coordsets");
     {
         coordset::point_merge pm;
-        pm.execute(cg_itr->second, merge_tolerance, output_coordsets.add_child(cset_name));
+        pm.execute(cg_itr->second, merge_tolerance,
+                   coordset::point_merge::method_from_name(merge_method),
+                   output_coordsets.add_child(cset_name));
     }
     const Node &pointmaps = output_coordsets[cset_name]["pointmaps"];
 
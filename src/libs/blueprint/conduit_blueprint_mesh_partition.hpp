@@ -681,6 +681,7 @@ protected:
     std::vector<std::string>                 selected_fields;
     bool                                     mapping;
     double                                   merge_tolerance;
+    std::string                              merge_method;
 };
 
 }
@@ -27,6 +27,7 @@
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_execution.hpp"
 
 // access one-to-many index types
 namespace O2MIndex = conduit::blueprint::o2mrelation;
@@ -697,6 +698,149 @@ TopologyMetadata::to_json() const
     return mesh.to_json();
 }
 
+//---------------------------------------------------------------------------//
+IndexSpan::IndexSpan()
+: m_data(NULL),
+  m_size(0),
+  m_converted()
+{
+}
+
+//---------------------------------------------------------------------------//
+IndexSpan::IndexSpan(const conduit::Node &values)
+: m_data(NULL),
+  m_size(0),
+  m_converted()
+{
+    set(values);
+}
+
+//---------------------------------------------------------------------------//
+void
+IndexSpan::set(const conduit::Node &values)
+{
+    m_converted.reset();
+    m_data = NULL;
+    m_size = values.dtype().number_of_elements();
+
+    if(m_size <= 0)
+    {
+        m_size = 0;
+    }
+    else if(values.dtype().id() == DataType::index_t().id() &&
+            values.dtype().is_compact())
+    {
+        m_data = (const index_t*)values.element_ptr(0);
+    }
+    else
+    {
+        values.to_index_t_array(m_converted);
+        m_data = (const index_t*)m_converted.element_ptr(0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+StructuredConnectivity::StructuredConnectivity()
+: m_dim(0),
+  m_nverts(0),
+  m_shape()
+{
+    for(index_t d = 0; d < 3; d++)
+    {
+        m_edims[d] = 0;
+        m_vdims[d] = 0;
+    }
+}
+
+//---------------------------------------------------------------------------//
+StructuredConnectivity::StructuredConnectivity(const conduit::Node &topo)
+: m_dim(0),
+  m_nverts(0),
+  m_shape()
+{
+    set(topo);
+}
+
+//---------------------------------------------------------------------------//
+StructuredConnectivity::StructuredConnectivity(const index_t *element_dims,
+                                               index_t dimension)
+: m_dim(0),
+  m_nverts(0),
+  m_shape()
+{
+    set(element_dims, dimension);
+}
+
+//---------------------------------------------------------------------------//
+void
+StructuredConnectivity::set(const conduit::Node &topo)
+{
+    const std::string type = topo["type"].as_string();
+    if(type != "uniform" && type != "rectilinear" && type != "structured")
+    {
+        CONDUIT_ERROR("StructuredConnectivity requires a uniform, "
+                      "rectilinear, or structured topology, but topology "
+                      "type is '" << type << "'");
+    }
+
+    index_t dimension = 0;
+    index_t edims[3] = {1, 1, 1};
+    if(type == "structured")
+    {
+        // elements/dims may hold more than the logical extents
+        // (e.g. strided structured offsets and strides)
+        const Node &dims = topo["elements/dims"];
+        while(dimension < 3 && dims.has_child(LOGICAL_AXES[dimension]))
+        {
+            edims[dimension] = dims[LOGICAL_AXES[dimension]].to_index_t();
+            dimension++;
+        }
+    }
+    else
+    {
+        dimension = topology::dims(topo);
+        topology::logical_dims(topo, edims, 3);
+    }
+
+    set(edims, dimension);
+}
+
+//---------------------------------------------------------------------------//
+void
+StructuredConnectivity::set(const index_t *element_dims,
+                            index_t dimension)
+{
+    if(dimension < 1 || dimension > 3)
+    {
+        CONDUIT_ERROR("StructuredConnectivity: invalid dimension "
+                      << dimension << " (expected 1, 2, or 3)");
+    }
+
+    m_dim = dimension;
+    m_nverts = ((index_t)1) << dimension;
+    for(index_t d = 0; d < 3; d++)
+    {
+        m_edims[d] = (d < dimension) ? element_dims[d] : 1;
+        m_vdims[d] = (d < dimension) ? element_dims[d] + 1 : 1;
+    }
+    m_shape = ShapeType((dimension == 1) ? "line" :
+                        ((dimension == 2) ? "quad" : "hex"));
+}
+
+//---------------------------------------------------------------------------//
+index_t
+StructuredConnectivity::number_of_elements() const
+{
+    return (m_dim == 0) ? 0 : m_edims[0] * m_edims[1] * m_edims[2];
+}
+
+//---------------------------------------------------------------------------//
+index_t
+StructuredConnectivity::number_of_points() const
+{
+    return (m_dim == 0) ? 0 : m_vdims[0] * m_vdims[1] * m_vdims[2];
+}
+
 //-----------------------------------------------------------------------------
 /// blueprint mesh utility query functions
 //-----------------------------------------------------------------------------
@@ -2086,42 +2230,171 @@ topology::unstructured::points(const Node &n,
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-void
-adjset::canonicalize(Node &adjset)
+// Stable LSD radix sort of 64-bit keys with 8-bit digits. Each pass counts
+// digits per block of keys, then scatters the blocks (in parallel when
+// OpenMP support is enabled) to their prefix sum offsets. Passes are only
+// made for the digits that can be non-zero, and skipped when every key has
+// the same digit.
+//-----------------------------------------------------------------------------
+static void
+radix_sort_keys(std::vector<uint64> &keys)
 {
-    const index_t domain_id = find_domain_id(adjset);
+    const index_t RADIX_BITS = 8;
+    const index_t RADIX_SIZE = 1 << RADIX_BITS;
+    const index_t RADIX_BLOCK_SIZE = 1 << 16;
 
-    const std::vector<std::string> &adjset_group_names = adjset["groups"].child_names();
-    for(const std::string &old_group_name : adjset_group_names)
+    const index_t num_keys = (index_t)keys.size();
+    if(num_keys < RADIX_BLOCK_SIZE)
     {
-        const Node &group_node = adjset["groups"][old_group_name];
-        const Node &neighbors_node = group_node["neighbors"];
+        std::sort(keys.begin(), keys.end());
+        return;
+    }
 
-        std::string new_group_name;
-        {
-            std::ostringstream oss;
-            oss << "group";
+    uint64 max_key = 0;
+    for(index_t ki = 0; ki < num_keys; ki++)
+    {
+        max_key = std::max(max_key, keys[(size_t)ki]);
+    }
+    index_t key_bits = 0;
+    for(; key_bits < 64 && (max_key >> key_bits) != 0; key_bits++);
 
-            Node temp;
-            DataType temp_dtype(neighbors_node.dtype().id(), 1);
+    const index_t num_blocks = (num_keys + RADIX_BLOCK_SIZE - 1) / RADIX_BLOCK_SIZE;
+    std::vector<index_t> block_offsets((size_t)(num_blocks * RADIX_SIZE));
+    std::vector<uint64> sorted_keys((size_t)num_keys);
+    for(index_t shift = 0; shift < key_bits; shift += RADIX_BITS)
+    {
+        const uint64 *src = keys.data();
+        uint64 *dst = sorted_keys.data();
+
+        execution::for_all(0, num_blocks, [&](index_t bi)
+        {
+            index_t *counts = &block_offsets[(size_t)(bi * RADIX_SIZE)];
+            std::fill(counts, counts + RADIX_SIZE, 0);
+            const index_t kend = std::min(num_keys, (bi + 1) * RADIX_BLOCK_SIZE);
+            for(index_t ki = bi * RADIX_BLOCK_SIZE; ki < kend; ki++)
+            {
+                counts[(src[ki] >> shift) & (RADIX_SIZE - 1)]++;
+            }
+        });
 
-            // NOTE(JRC): Need to use a vector instead of direct 'Node::to_index_t'
-            // because the local node ID isn't included in the neighbor list and
-            // 'DataArray' uses a static array size.
-            std::vector<index_t> group_neighbors(1, domain_id);
-            for(index_t ni = 0; ni < neighbors_node.dtype().number_of_elements(); ni++)
+        // digit major, block minor prefix sums keep the sort stable
+        bool same_digit = false;
+        index_t offset = 0;
+        for(index_t di = 0; di < RADIX_SIZE && !same_digit; di++)
+        {
+            index_t digit_count = 0;
+            for(index_t bi = 0; bi < num_blocks; bi++)
             {
-                temp.set_external(temp_dtype, (void*)neighbors_node.element_ptr(ni));
-                group_neighbors.push_back(temp.to_index_t());
+                index_t &block_offset = block_offsets[(size_t)(bi * RADIX_SIZE + di)];
+                const index_t count = block_offset;
+                block_offset = offset;
+                offset += count;
+                digit_count += count;
             }
-            std::sort(group_neighbors.begin(), group_neighbors.end());
+            same_digit = (digit_count == num_keys);
+        }
+        if(same_digit)
+        {
+            continue;
+        }
 
-            for(const index_t &neighbor_id : group_neighbors)
+        execution::for_all(0, num_blocks, [&](index_t bi)
+        {
+            index_t *offsets = &block_offsets[(size_t)(bi * RADIX_SIZE)];
+            const index_t kend = std::min(num_keys, (bi + 1) * RADIX_BLOCK_SIZE);
+            for(index_t ki = bi * RADIX_BLOCK_SIZE; ki < kend; ki++)
             {
-                oss << "_" << neighbor_id;
+                dst[offsets[(src[ki] >> shift) & (RADIX_SIZE - 1)]++] = src[ki];
             }
+        });
+        keys.swap(sorted_keys);
+    }
+}
 
-            new_group_name = oss.str();
+//-----------------------------------------------------------------------------
+void
+adjset::sort_unique_pairs(std::vector<std::pair<index_t, index_t>> &pairs)
+{
+    const index_t num_pairs = (index_t)pairs.size();
+    if(num_pairs == 0)
+    {
+        return;
+    }
+
+    index_t min_first = pairs[0].first, max_first = pairs[0].first;
+    index_t min_second = pairs[0].second, max_second = pairs[0].second;
+    for(const std::pair<index_t, index_t> &pair : pairs)
+    {
+        min_first = std::min(min_first, pair.first);
+        max_first = std::max(max_first, pair.first);
+        min_second = std::min(min_second, pair.second);
+        max_second = std::max(max_second, pair.second);
+    }
+
+    // pack each pair into a single key (when it fits) so they can be radix
+    // sorted, pairs are ordered by (first, second) either way
+    const uint64 first_range = (uint64)max_first - (uint64)min_first;
+    const uint64 second_range = (uint64)max_second - (uint64)min_second;
+    index_t first_bits = 0, second_bits = 0;
+    for(; first_bits < 64 && (first_range >> first_bits) != 0; first_bits++);
+    for(; second_bits < 64 && (second_range >> second_bits) != 0; second_bits++);
+    if(first_bits + second_bits > 64 || second_bits == 64)
+    {
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+        return;
+    }
+
+    std::vector<uint64> keys((size_t)num_pairs);
+    execution::for_all(0, num_pairs, [&](index_t pi)
+    {
+        const std::pair<index_t, index_t> &pair = pairs[(size_t)pi];
+        keys[(size_t)pi] = (((uint64)pair.first - (uint64)min_first) << second_bits) |
+                           ((uint64)pair.second - (uint64)min_second);
+    });
+    radix_sort_keys(keys);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    const uint64 second_mask = (second_bits == 0) ? 0 :
+        (std::numeric_limits<uint64>::max() >> (64 - second_bits));
+    pairs.resize(keys.size());
+    execution::for_all(0, (index_t)keys.size(), [&](index_t pi)
+    {
+        const uint64 key = keys[(size_t)pi];
+        std::pair<index_t, index_t> &pair = pairs[(size_t)pi];
+        pair.first = (index_t)((key >> second_bits) + (uint64)min_first);
+        pair.second = (index_t)((key & second_mask) + (uint64)min_second);
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+adjset::canonicalize(Node &adjset)
+{
+    const index_t domain_id = find_domain_id(adjset);
+
+    const std::vector<std::string> &adjset_group_names = adjset["groups"].child_names();
+    std::vector<index_t> group_neighbors;
+    std::string new_group_name;
+    for(const std::string &old_group_name : adjset_group_names)
+    {
+        const Node &group_node = adjset["groups"][old_group_name];
+        const Node &neighbors_node = group_node["neighbors"];
+
+        // NOTE(JRC): Need to use a vector instead of direct 'Node::to_index_t'
+        // because the local node ID isn't included in the neighbor list and
+        // 'DataArray' uses a static array size.
+        const IndexSpan neighbor_ids(neighbors_node);
+        group_neighbors.assign(1, domain_id);
+        group_neighbors.insert(group_neighbors.end(),
+            neighbor_ids.begin(), neighbor_ids.end());
+        std::sort(group_neighbors.begin(), group_neighbors.end());
+
+        new_group_name = "group";
+        for(const index_t &neighbor_id : group_neighbors)
+        {
+            new_group_name += "_";
+            new_group_name += std::to_string(neighbor_id);
         }
 
         adjset["groups"].rename_child(old_group_name, new_group_name);
@@ -17,6 +17,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 //-----------------------------------------------------------------------------
@@ -231,6 +232,120 @@ struct CONDUIT_BLUEPRINT_API TopologyMetadata
     std::vector< std::vector<index_t> > dim_le2ge_maps;
 };
 
+//---------------------------------------------------------------------------//
+// Views an integer leaf as a contiguous array of index_t values. Compact
+// index_t leaves are viewed in place, other leaves are converted once into
+// an owned buffer. The viewed node must outlive the span.
+struct CONDUIT_BLUEPRINT_API IndexSpan
+{
+public:
+    IndexSpan();
+    IndexSpan(const conduit::Node &values);
+
+    void set(const conduit::Node &values);
+
+    const index_t *data() const { return m_data; }
+    index_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    const index_t &operator[](index_t idx) const { return m_data[idx]; }
+    const index_t *begin() const { return m_data; }
+    const index_t *end() const { return m_data + m_size; }
+
+    // true if the values were converted (rather than viewed in place)
+    bool converted() const { return !m_converted.dtype().is_empty(); }
+
+private:
+    IndexSpan(const IndexSpan &);
+    IndexSpan &operator=(const IndexSpan &);
+
+    const index_t *m_data;
+    index_t m_size;
+    conduit::Node m_converted;
+};
+
+//---------------------------------------------------------------------------//
+// Implicit connectivity of a uniform, rectilinear, or structured topology.
+// Element vertex ids are computed on the fly (in the same order used by the
+// unstructured conversions) instead of being materialized, so consumers
+// can walk the elements of a logically structured mesh without paying for
+// an explicit connectivity array.
+struct CONDUIT_BLUEPRINT_API StructuredConnectivity
+{
+public:
+    StructuredConnectivity();
+    StructuredConnectivity(const conduit::Node &topo);
+    StructuredConnectivity(const index_t *element_dims, index_t dimension);
+
+    void set(const conduit::Node &topo);
+    void set(const index_t *element_dims, index_t dimension);
+
+    index_t dimension() const { return m_dim; }
+    const ShapeType &shape() const { return m_shape; }
+    index_t indices_per_element() const { return m_nverts; }
+    index_t number_of_elements() const;
+    index_t number_of_points() const;
+
+    // element / vertex extents along i, j, k (1 for unused axes)
+    const index_t *element_dims() const { return m_edims; }
+    const index_t *vertex_dims() const { return m_vdims; }
+
+    // writes the indices_per_element() vertex ids of element eid to ids
+    void element(index_t eid, index_t *ids) const { elements(eid, eid + 1, ids); }
+
+    // writes the vertex ids of elements [begin, end) to conn, which must
+    // hold (end - begin) * indices_per_element() values
+    template<typename T>
+    void elements(index_t begin, index_t end, T *conn) const
+    {
+        if(begin >= end)
+        {
+            return;
+        }
+
+        const index_t nx = m_vdims[0];
+        const index_t nxny = m_vdims[0] * m_vdims[1];
+        index_t i = begin % m_edims[0];
+        index_t j = (begin / m_edims[0]) % m_edims[1];
+        index_t k = begin / (m_edims[0] * m_edims[1]);
+        for(index_t e = begin; e < end; e++, conn += m_nverts)
+        {
+            const index_t v0 = k * nxny + j * nx + i;
+            conn[0] = static_cast<T>(v0);
+            conn[1] = static_cast<T>(v0 + 1);
+            if(m_nverts > 2)
+            {
+                conn[2] = static_cast<T>(v0 + 1 + nx);
+                conn[3] = static_cast<T>(v0 + nx);
+            }
+            if(m_nverts > 4)
+            {
+                conn[4] = static_cast<T>(v0 + nxny);
+                conn[5] = static_cast<T>(v0 + 1 + nxny);
+                conn[6] = static_cast<T>(v0 + 1 + nx + nxny);
+                conn[7] = static_cast<T>(v0 + nx + nxny);
+            }
+
+            if(++i == m_edims[0])
+            {
+                i = 0;
+                if(++j == m_edims[1])
+                {
+                    j = 0;
+                    k++;
+                }
+            }
+        }
+    }
+
+private:
+    index_t m_dim;
+    index_t m_nverts;
+    index_t m_edims[3];
+    index_t m_vdims[3];
+    ShapeType m_shape;
+};
+
 //-----------------------------------------------------------------------------
 /// blueprint mesh utility functions
 //-----------------------------------------------------------------------------
@@ -419,6 +534,14 @@ namespace adjset
 {
     //-------------------------------------------------------------------------
     void CONDUIT_BLUEPRINT_API canonicalize(Node &adjset);
+
+    //-------------------------------------------------------------------------
+    // Sorts (entity, neighbor) style pairs and removes duplicates, the same
+    // result as std::sort followed by std::unique. Pairs are packed into
+    // 64-bit keys and radix sorted (in parallel when OpenMP support is
+    // enabled) when their value ranges fit.
+    void CONDUIT_BLUEPRINT_API sort_unique_pairs(
+        std::vector<std::pair<index_t, index_t>> &pairs);
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::adjset --
@@ -17,12 +17,16 @@
 // std includes
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 //-----------------------------------------------------------------------------
 // conduit lib includes
 //-----------------------------------------------------------------------------
 #include "conduit.hpp"
+#include "conduit_execution.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
 
 //-----------------------------------------------------------------------------
@@ -63,6 +67,46 @@ struct entity
     index_t                           entity_id; // Local entity id.
 };
 
+//-----------------------------------------------------------------------------
+// A block of consecutive, same-shaped elements handed out by
+// iterate_element_blocks and for_all_element_blocks.
+//
+// Fixed shape blocks store the vertex ids of element i (0 <= i < num_elements)
+// contiguously at connectivity + i * shape.indices. Polygonal and polyhedral
+// blocks provide per-element sizes and offsets (into connectivity). The
+// connectivity of a polyhedral element holds face ids, which index the
+// subelement arrays.
+//-----------------------------------------------------------------------------
+struct element_block
+{
+    ShapeType      shape;
+    index_t        first_element_id; // id of element 0 of this block
+    index_t        num_elements;
+    const index_t *connectivity;
+    const index_t *sizes;
+    const index_t *offsets;
+    const index_t *subelement_connectivity;
+    const index_t *subelement_sizes;
+    const index_t *subelement_offsets;
+
+    // Number of ids (vertices, or faces for polyhedra) of element i.
+    index_t element_size(index_t i) const
+    {
+        return (sizes != nullptr) ? sizes[i] : shape.indices;
+    }
+
+    // Pointer to the ids of element i.
+    const index_t *element(index_t i) const
+    {
+        return (offsets != nullptr) ? connectivity + offsets[i] :
+                                      connectivity + i * shape.indices;
+    }
+};
+
+// Default number of elements in the blocks handed out by
+// iterate_element_blocks and for_all_element_blocks.
+static const index_t DEFAULT_ELEMENT_BLOCK_SIZE = 4096;
+
 // Q: Should this exist in conduit_blueprint_mesh_utils.hpp ?
 // static const std::vector<std::string> TOPO_SHAPES = {"point", "line", "tri", "quad", "tet", "hex", "polygonal", "polyhedral"};
 enum class ShapeId : index_t
@@ -77,6 +121,87 @@ enum class ShapeId : index_t
     Polyhedral = 7
 };
 
+//-----------------------------------------------------------------------------
+// Compile time properties of each shape, for kernels that are specialized per
+// ShapeId (see dispatch_shape). Poly shapes have a variable number of
+// vertices, which is marked with num_vertices = -1.
+//-----------------------------------------------------------------------------
+template<ShapeId S>
+struct shape_traits;
+
+template<>
+struct shape_traits<ShapeId::Point>
+{ static const index_t dim = 0; static const index_t num_vertices = 1; };
+
+template<>
+struct shape_traits<ShapeId::Line>
+{ static const index_t dim = 1; static const index_t num_vertices = 2; };
+
+template<>
+struct shape_traits<ShapeId::Tri>
+{ static const index_t dim = 2; static const index_t num_vertices = 3; };
+
+template<>
+struct shape_traits<ShapeId::Quad>
+{ static const index_t dim = 2; static const index_t num_vertices = 4; };
+
+template<>
+struct shape_traits<ShapeId::Tet>
+{ static const index_t dim = 3; static const index_t num_vertices = 4; };
+
+template<>
+struct shape_traits<ShapeId::Hex>
+{ static const index_t dim = 3; static const index_t num_vertices = 8; };
+
+template<>
+struct shape_traits<ShapeId::Polygonal>
+{ static const index_t dim = 2; static const index_t num_vertices = -1; };
+
+template<>
+struct shape_traits<ShapeId::Polyhedral>
+{ static const index_t dim = 3; static const index_t num_vertices = -1; };
+
+//-----------------------------------------------------------------------------
+// Calls func(std::integral_constant<ShapeId, S>()) where S is the ShapeId of
+// the given shape, so func can provide compile time specializations (or
+// overloads) per shape.
+//-----------------------------------------------------------------------------
+template<typename Func>
+inline void
+dispatch_shape(const ShapeType &shape, Func &&func)
+{
+    switch(static_cast<ShapeId>(shape.id))
+    {
+    case ShapeId::Point:
+        func(std::integral_constant<ShapeId, ShapeId::Point>());
+        break;
+    case ShapeId::Line:
+        func(std::integral_constant<ShapeId, ShapeId::Line>());
+        break;
+    case ShapeId::Tri:
+        func(std::integral_constant<ShapeId, ShapeId::Tri>());
+        break;
+    case ShapeId::Quad:
+        func(std::integral_constant<ShapeId, ShapeId::Quad>());
+        break;
+    case ShapeId::Tet:
+        func(std::integral_constant<ShapeId, ShapeId::Tet>());
+        break;
+    case ShapeId::Hex:
+        func(std::integral_constant<ShapeId, ShapeId::Hex>());
+        break;
+    case ShapeId::Polygonal:
+        func(std::integral_constant<ShapeId, ShapeId::Polygonal>());
+        break;
+    case ShapeId::Polyhedral:
+        func(std::integral_constant<ShapeId, ShapeId::Polyhedral>());
+        break;
+    default:
+        CONDUIT_ERROR("Unsupported shape passed to dispatch_shape: "
+                      << shape.type);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::blueprint::mesh::utils::topology::impl --
 //-----------------------------------------------------------------------------
@@ -389,7 +514,6 @@ traverse_stream(FuncType &&func, const Node &elements)
     const index_t_accessor stream_ids = eindex["stream_ids"].as_index_t_accessor();
     const Node *p_stream_offs = eindex.fetch_ptr("offsets");
     const Node *p_stream_counts = eindex.fetch_ptr("element_counts");
-    const index_t nstream = stream_ids.number_of_elements();
     index_t ent_id = 0;
     // For count based this number just keeps rising, for offset based it gets overwritten
     //   by what is stored in the offsets node.
@@ -409,13 +533,13 @@ traverse_stream(FuncType &&func, const Node &elements)
         {
             index_t_accessor stream_offs = p_stream_offs->as_index_t_accessor();
             start = stream_offs[i];
-            if(i == nstream - 1)
+            if(i + 1 < stream_offs.number_of_elements())
             {
-                end = stream_offs.number_of_elements();
+                end = stream_offs[i+1];
             }
             else
             {
-                end = stream_offs[i+1];
+                end = stream.number_of_elements();
             }
         }
         else if(p_stream_counts)
@@ -562,6 +686,441 @@ traverse_structured(FuncType &&func, const Node &topo)
     }
 }
 
+
+//-----------------------------------------------------------------------------
+// One run of same-shaped elements of a topology, used by the blocked element
+// iterators. Explicit buckets point at (index_t) connectivity arrays, points
+// and structured buckets have implicit connectivity that is generated for
+// each block.
+//-----------------------------------------------------------------------------
+struct element_bucket
+{
+    enum Kind
+    {
+        EXPLICIT,
+        POINTS,
+        STRUCTURED
+    };
+
+    element_bucket()
+    : kind(EXPLICIT), shape(), first_element_id(0), num_elements(0),
+      connectivity(nullptr), sizes(nullptr), offsets(nullptr),
+      subelement_connectivity(nullptr), subelement_sizes(nullptr),
+      subelement_offsets(nullptr), structured()
+    {
+    }
+
+    Kind           kind;
+    ShapeType      shape;
+    index_t        first_element_id;
+    index_t        num_elements;
+    const index_t *connectivity;
+    const index_t *sizes;
+    const index_t *offsets;
+    const index_t *subelement_connectivity;
+    const index_t *subelement_sizes;
+    const index_t *subelement_offsets;
+    // implicit connectivity (structured only)
+    StructuredConnectivity structured;
+};
+
+//-----------------------------------------------------------------------------
+// Splits a topology into element buckets. Integer arrays are used in place
+// when they are compact index_t arrays, otherwise they are converted once and
+// held by this object. Missing poly offsets are computed from the sizes.
+//-----------------------------------------------------------------------------
+class element_buckets
+{
+public:
+    element_buckets(const Node &topo)
+    : m_buckets(), m_spans(), m_computed(), m_num_elements(0)
+    {
+        const int case_num = determine_case_number(topo);
+        switch(case_num)
+        {
+        case 0:
+        {
+            const Node *subelements = topo.fetch_ptr("subelements");
+            add_explicit(topo["elements"], subelements, ShapeType(topo));
+            break;
+        }
+        case 1: /* Fallthrough */
+        case 2:
+        {
+            const Node &elements = topo["elements"];
+            const Node *subelements = topo.fetch_ptr("subelements");
+            for(index_t i = 0; i < elements.number_of_children(); i++)
+            {
+                const Node &bucket = elements[i];
+                const ShapeType shape(bucket["shape"].as_string());
+                const Node *subbucket = nullptr;
+                if(shape.is_polyhedral())
+                {
+                    if(subelements == nullptr)
+                    {
+                        CONDUIT_ERROR("Invalid toplogy, shape == polyhedral but no subelements node present.");
+                    }
+                    if(elements.dtype().is_object())
+                    {
+                        subbucket = subelements->fetch_ptr(bucket.name());
+                    }
+                    else if(i < subelements->number_of_children())
+                    {
+                        subbucket = &subelements->child(i);
+                    }
+                    if(subbucket == nullptr)
+                    {
+                        CONDUIT_ERROR("Invalid toplogy, shape == polyhedral but no matching subelements node present.");
+                    }
+                }
+                add_explicit(bucket, subbucket, shape);
+            }
+            break;
+        }
+        case 3: /* Fallthrough */
+        case 4:
+        {
+            add_stream(topo["elements"]);
+            break;
+        }
+        case 5:
+        {
+            element_bucket b;
+            b.kind = element_bucket::POINTS;
+            b.shape = ShapeType((index_t)ShapeId::Point);
+            b.num_elements = 1;
+            index_t dims[3] = {1, 1, 1};
+            topology::logical_dims(topo, dims, 3);
+            for(index_t d = 0; d < 3; d++)
+            {
+                if(dims[d] > 0)
+                {
+                    b.num_elements *= dims[d];
+                }
+            }
+            add_bucket(b);
+            break;
+        }
+        case 6: /* Fallthrough */
+        case 7: /* Fallthrough */
+        case 8:
+        {
+            element_bucket b;
+            b.kind = element_bucket::STRUCTURED;
+            index_t dims[3] = {1, 1, 1};
+            topology::logical_dims(topo, dims, 3);
+            const index_t dimension = topology::dims(topo);
+            if(dimension < 1 || dimension > 3)
+            {
+                CONDUIT_ERROR("Unsupported dimension given to iterate_element_blocks "
+                    << dimension << ".");
+            }
+            b.structured.set(dims, dimension);
+            b.shape = b.structured.shape();
+            b.num_elements = b.structured.number_of_elements();
+            add_bucket(b);
+            break;
+        }
+        default:
+            CONDUIT_ERROR("Could not figure out the type of toplogy passed to iterate_element_blocks.");
+        }
+    }
+
+    const std::vector<element_bucket> &buckets() const
+    {
+        return m_buckets;
+    }
+
+    index_t number_of_elements() const
+    {
+        return m_num_elements;
+    }
+
+private:
+    element_buckets(const element_buckets &);
+    element_buckets &operator=(const element_buckets &);
+
+    const index_t *view(const Node &values, index_t &size)
+    {
+        m_spans.push_back(std::unique_ptr<IndexSpan>(new IndexSpan(values)));
+        size = m_spans.back()->size();
+        return m_spans.back()->data();
+    }
+
+    const index_t *view(const Node &values)
+    {
+        index_t size = 0;
+        return view(values, size);
+    }
+
+    // offsets from the sizes when they are not given
+    const index_t *view_offsets(const Node &n, const index_t *sizes, index_t nsizes)
+    {
+        if(n.has_child("offsets") && !n["offsets"].dtype().is_empty())
+        {
+            return view(n["offsets"]);
+        }
+
+        m_computed.push_back(std::unique_ptr<std::vector<index_t>>(
+            new std::vector<index_t>((size_t)nsizes)));
+        std::vector<index_t> &offsets = *m_computed.back();
+        index_t offset = 0;
+        for(index_t i = 0; i < nsizes; i++)
+        {
+            offsets[(size_t)i] = offset;
+            offset += sizes[i];
+        }
+        return offsets.data();
+    }
+
+    void add_bucket(element_bucket &b)
+    {
+        b.first_element_id = m_num_elements;
+        m_num_elements += b.num_elements;
+        if(b.num_elements > 0)
+        {
+            m_buckets.push_back(b);
+        }
+    }
+
+    void add_explicit(const Node &eles, const Node *subeles, const ShapeType &shape)
+    {
+        element_bucket b;
+        b.shape = shape;
+        index_t conn_size = 0;
+        b.connectivity = view(eles["connectivity"], conn_size);
+        if(shape.is_poly())
+        {
+            b.sizes = view(eles["sizes"], b.num_elements);
+            b.offsets = view_offsets(eles, b.sizes, b.num_elements);
+            if(shape.is_polyhedral())
+            {
+                if(subeles == nullptr)
+                {
+                    CONDUIT_ERROR("Invalid toplogy, shape == polyhedral but no subelements node present.");
+                }
+                index_t nfaces = 0;
+                b.subelement_connectivity = view((*subeles)["connectivity"]);
+                b.subelement_sizes = view((*subeles)["sizes"], nfaces);
+                b.subelement_offsets = view_offsets(*subeles, b.subelement_sizes, nfaces);
+            }
+        }
+        else if(eles.has_child("offsets") && !eles["offsets"].dtype().is_empty())
+        {
+            // fixed size elements, possibly stored out of order
+            b.offsets = view(eles["offsets"], b.num_elements);
+        }
+        else
+        {
+            b.num_elements = conn_size / shape.indices;
+        }
+        add_bucket(b);
+    }
+
+    void add_stream(const Node &elements)
+    {
+        // stream id -> shape
+        std::vector<std::pair<index_t, ShapeType>> etypes;
+        const Node &element_types = elements["element_types"];
+        for(index_t i = 0; i < element_types.number_of_children(); i++)
+        {
+            const Node &n = element_types[i];
+            const ShapeType shape(n["shape"].as_string());
+            if(shape.is_poly())
+            {
+                CONDUIT_ERROR("I cannot handle a stream of polygonal/polyhedral elements!");
+            }
+            etypes.push_back(std::make_pair(n["stream_id"].to_index_t(), shape));
+        }
+
+        const Node &eindex = elements["element_index"];
+        index_t nstream = 0, nsections = 0, nsection_offsets = 0;
+        const index_t *stream = view(elements["stream"], nstream);
+        const index_t *stream_ids = view(eindex["stream_ids"], nsections);
+        const index_t *section_counts = nullptr;
+        const index_t *section_offsets = nullptr;
+        if(eindex.has_child("element_counts"))
+        {
+            section_counts = view(eindex["element_counts"]);
+        }
+        else
+        {
+            section_offsets = view(eindex["offsets"], nsection_offsets);
+        }
+
+        element_bucket b;
+        index_t start = 0;
+        for(index_t i = 0; i < nsections; i++)
+        {
+            const index_t stream_id = stream_ids[i];
+            auto itr = std::find_if(etypes.begin(), etypes.end(),
+                [=](const std::pair<index_t, ShapeType> &p){
+                    return p.first == stream_id;
+                });
+            if(itr == etypes.end())
+            {
+                CONDUIT_ERROR("Unknown stream id " << stream_id
+                    << " in shape stream topology.");
+            }
+            const ShapeType &shape = itr->second;
+
+            // Determine the elements in this section of the stream
+            index_t nelems = 0;
+            if(section_counts != nullptr)
+            {
+                nelems = section_counts[i];
+            }
+            else
+            {
+                start = section_offsets[i];
+                const index_t end = (i + 1 < nsection_offsets) ?
+                    section_offsets[i + 1] : nstream;
+                nelems = (end - start) / shape.indices;
+            }
+
+            // Grow the current bucket if this section continues it
+            const index_t *conn = stream + start;
+            if(b.num_elements > 0 && b.shape.id == shape.id &&
+               b.connectivity + b.num_elements * b.shape.indices == conn)
+            {
+                b.num_elements += nelems;
+            }
+            else
+            {
+                if(b.num_elements > 0)
+                {
+                    add_bucket(b);
+                }
+                b = element_bucket();
+                b.shape = shape;
+                b.connectivity = conn;
+                b.num_elements = nelems;
+            }
+            start += nelems * shape.indices;
+        }
+
+        if(b.num_elements > 0)
+        {
+            add_bucket(b);
+        }
+    }
+
+    std::vector<element_bucket>                        m_buckets;
+    std::vector<std::unique_ptr<IndexSpan>>            m_spans;
+    std::vector<std::unique_ptr<std::vector<index_t>>> m_computed;
+    index_t                                            m_num_elements;
+};
+
+//-----------------------------------------------------------------------------
+// Generates the connectivity of elements [begin, end) of a points or
+// structured bucket (same vertex order as traverse_structured).
+inline void
+implicit_connectivity(const element_bucket &b, index_t begin, index_t end,
+                      std::vector<index_t> &conn)
+{
+    conn.resize((size_t)((end - begin) * b.shape.indices));
+    if(b.kind == element_bucket::POINTS)
+    {
+        index_t *c = conn.data();
+        for(index_t e = begin; e < end; e++)
+        {
+            *c++ = e;
+        }
+    }
+    else
+    {
+        b.structured.elements(begin, end, conn.data());
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<typename FuncType>
+inline void
+execute_element_block(FuncType &&func, const element_bucket &b,
+                      index_t begin, index_t end,
+                      std::vector<index_t> &scratch)
+{
+    element_block blk;
+    blk.shape = b.shape;
+    blk.first_element_id = b.first_element_id + begin;
+    blk.num_elements = end - begin;
+    blk.sizes = nullptr;
+    blk.offsets = nullptr;
+    blk.subelement_connectivity = b.subelement_connectivity;
+    blk.subelement_sizes = b.subelement_sizes;
+    blk.subelement_offsets = b.subelement_offsets;
+    if(b.kind != element_bucket::EXPLICIT)
+    {
+        implicit_connectivity(b, begin, end, scratch);
+        blk.connectivity = scratch.data();
+    }
+    else if(b.shape.is_poly())
+    {
+        blk.connectivity = b.connectivity;
+        blk.sizes = b.sizes + begin;
+        blk.offsets = b.offsets + begin;
+    }
+    else if(b.offsets != nullptr)
+    {
+        blk.connectivity = b.connectivity;
+        blk.offsets = b.offsets + begin;
+    }
+    else
+    {
+        blk.connectivity = b.connectivity + begin * b.shape.indices;
+    }
+    func(blk);
+}
+
+//-----------------------------------------------------------------------------
+template<typename FuncType>
+inline void
+traverse_element_blocks(FuncType &&func, const Node &topo, index_t block_size,
+                        bool parallel)
+{
+    const element_buckets ebuckets(topo);
+    const std::vector<element_bucket> &buckets = ebuckets.buckets();
+    if(block_size <= 0)
+    {
+        block_size = DEFAULT_ELEMENT_BLOCK_SIZE;
+    }
+
+    // (bucket, first element in bucket) for each block
+    std::vector<std::pair<index_t, index_t>> blocks;
+    for(size_t bi = 0; bi < buckets.size(); bi++)
+    {
+        for(index_t e = 0; e < buckets[bi].num_elements; e += block_size)
+        {
+            blocks.push_back(std::make_pair((index_t)bi, e));
+        }
+    }
+
+    const auto exec_block = [&](index_t i, std::vector<index_t> &scratch)
+    {
+        const element_bucket &b = buckets[(size_t)blocks[(size_t)i].first];
+        const index_t begin = blocks[(size_t)i].second;
+        const index_t end = std::min(begin + block_size, b.num_elements);
+        execute_element_block(func, b, begin, end, scratch);
+    };
+
+    const index_t nblocks = (index_t)blocks.size();
+    if(parallel)
+    {
+        execution::for_all(0, nblocks, [&](index_t i)
+        {
+            std::vector<index_t> scratch;
+            exec_block(i, scratch);
+        });
+    }
+    else
+    {
+        std::vector<index_t> scratch;
+        for(index_t i = 0; i < nblocks; i++)
+        {
+            exec_block(i, scratch);
+        }
+    }
+}
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::topology::impl --
@@ -671,6 +1230,32 @@ iterate_elements(const Node &topo, Func &&func)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Calls func(const element_block &) for blocks of (at most block_size)
+// consecutive, same-shaped elements of the given topology, in element order.
+// Supports the same topologies as iterate_elements.
+//-----------------------------------------------------------------------------
+template<typename Func>
+inline void
+iterate_element_blocks(const Node &topo, Func &&func,
+                       index_t block_size = DEFAULT_ELEMENT_BLOCK_SIZE)
+{
+    impl::traverse_element_blocks(func, topo, block_size, false);
+}
+
+//-----------------------------------------------------------------------------
+// Same as iterate_element_blocks, but blocks are processed concurrently (when
+// OpenMP support is enabled), so func must be thread safe. Use the block's
+// first_element_id to find where per-element results belong.
+//-----------------------------------------------------------------------------
+template<typename Func>
+inline void
+for_all_element_blocks(const Node &topo, Func &&func,
+                       index_t block_size = DEFAULT_ELEMENT_BLOCK_SIZE)
+{
+    impl::traverse_element_blocks(func, topo, block_size, true);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::topology --
@@ -12,6 +12,7 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <iterator>
 #include <tuple>
 #include <vector>
 #include <cmath>
@@ -27,6 +28,7 @@
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
+#include "conduit_execution.hpp"
 #include "conduit_relay_mpi.hpp"
 #include <assert.h>
 #include <cmath>
@@ -162,9 +164,11 @@ generate_index(const conduit::Node &mesh,
     //
     // across ranks, domains may be sparse
     //  for example: a topo may only exist in one domain
-    // so we union all local mesh indices, and then 
-    // se an all gather and union the results together
-    // to create an accurate global index. 
+    // so we union all local mesh indices. Each rank's local index is
+    // already a compact summary of its domains (domains that share a
+    // structure contribute one entry), and we merge these summaries with
+    // a binomial tree reduction to rank 0 and broadcast the result, instead
+    // of gathering every rank's index on every rank.
 
     index_t local_num_domains = blueprint::mesh::number_of_domains(mesh);
     // note: 
@@ -181,28 +185,58 @@ generate_index(const conduit::Node &mesh,
 
     index_out.reset();
 
-    Node local_idx, gather_idx;
+    // no rank has domains, nothing to index
+    if(global_num_domains == 0)
+    {
+        return;
+    }
 
     if(local_num_domains > 0)
     {
         ::conduit::blueprint::mesh::generate_index(mesh,
                                                    ref_path,
                                                    global_num_domains,
-                                                   local_idx);
+                                                   index_out);
+    }
+    else
+    {
+        index_out.set(DataType::object());
     }
 
-    relay::mpi::all_gather_using_schema(local_idx,
-                                        gather_idx,
-                                        comm);
+    // at each step, ranks that are a multiple of 2*step merge the summary
+    // of the ranks in [rank + step, rank + 2*step) into their own. Merging
+    // higher ranks into lower ranks preserves the union (in rank order)
+    // that a gather would produce.
+    const int par_rank = relay::mpi::rank(comm);
+    const int par_size = relay::mpi::size(comm);
+    const int tag = 4242;
 
-    // union all entries into final index that reps
-    // all domains
-    NodeConstIterator itr = gather_idx.children();
-    while(itr.has_next())
+    for(int step = 1; step < par_size; step *= 2)
     {
-        const Node &curr = itr.next();
-        index_out.update(curr);
+        if(par_rank % (2 * step) == 0)
+        {
+            if(par_rank + step < par_size)
+            {
+                Node recv_idx;
+                relay::mpi::recv_using_schema(recv_idx,
+                                              par_rank + step,
+                                              tag,
+                                              comm);
+                index_out.update(recv_idx);
+            }
+        }
+        else
+        {
+            // this rank's summary is merged, it is done until the bcast
+            relay::mpi::send_using_schema(index_out,
+                                          par_rank - step,
+                                          tag,
+                                          comm);
+            break;
+        }
     }
+
+    relay::mpi::broadcast_using_schema(index_out, 0, comm);
 }
 
 
@@ -1166,11 +1200,45 @@ void to_polyhedral(const Node &n,
     std::map<index_t, std::vector<index_t> > subelem_sizes;
     std::map<index_t, std::vector<index_t> > subelem_offsets;
 
+    // Local work for each domain is done concurrently (when OpenMP support
+    // is enabled) outside of the communication phases below, which stay on
+    // the calling thread. The output domains and the per-domain map entries
+    // are created up front, and the tasks reach them only through the
+    // per-domain pointers gathered here: std::map::operator[] may insert
+    // (and rebalance the tree), so it must not be called inside the tasks.
+    std::vector<const Node*> local_doms;
+    std::vector<Node*> local_dest_doms;
+    std::vector<std::map<index_t, bputils::connectivity::ElemType>*> local_poly_elems;
+    std::vector<bputils::connectivity::SubelemMap*> local_allfaces;
+    std::vector<std::vector<index_t>*> local_elem_connect;
+    std::vector<std::vector<index_t>*> local_elem_sizes;
+    std::vector<std::vector<index_t>*> local_elem_offsets;
+    std::vector<std::vector<index_t>*> local_subelem_connect;
+    std::vector<std::vector<index_t>*> local_subelem_sizes;
+    std::vector<std::vector<index_t>*> local_subelem_offsets;
     while(itr.has_next())
     {
         const Node& chld = itr.next();
-        std::string domain_name = itr.name();
-        dest[domain_name]["state"] = chld["state"];
+        const index_t domain_id = chld["state/domain_id"].to_index_t();
+        Node &dest_dom = dest[itr.name()];
+        dest_dom["state"] = chld["state"];
+
+        local_doms.push_back(&chld);
+        local_dest_doms.push_back(&dest_dom);
+        local_poly_elems.push_back(&poly_elems_map[domain_id]);
+        local_allfaces.push_back(&allfaces_map[domain_id]);
+        local_elem_connect.push_back(&elem_connect[domain_id]);
+        local_elem_sizes.push_back(&elem_sizes[domain_id]);
+        local_elem_offsets.push_back(&elem_offsets[domain_id]);
+        local_subelem_connect.push_back(&subelem_connect[domain_id]);
+        local_subelem_sizes.push_back(&subelem_sizes[domain_id]);
+        local_subelem_offsets.push_back(&subelem_offsets[domain_id]);
+    }
+    const index_t num_local_doms = (index_t)local_doms.size();
+
+    execution::for_all(0, num_local_doms, [&](index_t ldi)
+    {
+        const Node& chld = *local_doms[ldi];
         const Node& in_coords = chld["coordsets/coords"];
         const Node& in_topo = chld["topologies"][name];
 
@@ -1178,9 +1246,8 @@ void to_polyhedral(const Node &n,
         index_t jwidth = in_topo["elements/dims/j"].to_index_t();
         index_t kwidth = in_topo["elements/dims/k"].to_index_t();
 
-        Node& out_coords = dest[domain_name]["coordsets/coords"];
+        Node& out_coords = (*local_dest_doms[ldi])["coordsets/coords"];
 
-        index_t domain_id = chld["state/domain_id"].to_index_t();
         Node& out_values = out_coords["values"];
         if (in_coords["type"].as_string() == "uniform")
         {
@@ -1193,8 +1260,8 @@ void to_polyhedral(const Node &n,
             out_values = in_values;
         }
 
-        auto& poly_elems = poly_elems_map[domain_id];
-        auto& allfaces = allfaces_map[domain_id];
+        auto& poly_elems = *local_poly_elems[ldi];
+        auto& allfaces = *local_allfaces[ldi];
 
         index_t elemsize = iwidth*jwidth*kwidth;
 
@@ -1207,7 +1274,7 @@ void to_polyhedral(const Node &n,
                                                    kwidth,
                                                    allfaces);
         }
-    }
+    });
 
     itr = n.children();
     while(itr.has_next())
@@ -2503,13 +2570,9 @@ void to_polyhedral(const Node &n,
         }
     }
 
-    itr = n.children();
-    while(itr.has_next())
+    execution::for_all(0, num_local_doms, [&](index_t ldi)
     {
-        const Node& chld = itr.next();
-        std::string domain_name = itr.name();
-
-        index_t domain_id = chld["state/domain_id"].to_index_t();
+        const Node& chld = *local_doms[ldi];
 
         const Node& in_topo = chld["topologies"][name];
 
@@ -2517,17 +2580,17 @@ void to_polyhedral(const Node &n,
         index_t jwidth = in_topo["elements/dims/j"].to_index_t();
         index_t kwidth = in_topo["elements/dims/k"].to_index_t();
 
-        auto& poly_elems = poly_elems_map[domain_id];
-        auto& allfaces = allfaces_map[domain_id];
+        auto& poly_elems = *local_poly_elems[ldi];
+        auto& allfaces = *local_allfaces[ldi];
 
         index_t elemsize = iwidth*jwidth*kwidth;
 
-        std::vector<index_t>& e_connect = elem_connect[domain_id];
-        std::vector<index_t>& e_sizes = elem_sizes[domain_id];
-        std::vector<index_t>& e_offsets = elem_offsets[domain_id];
-        std::vector<index_t>& sub_connect = subelem_connect[domain_id];
-        std::vector<index_t>& sub_sizes = subelem_sizes[domain_id];
-        std::vector<index_t>& sub_offsets = subelem_offsets[domain_id];
+        std::vector<index_t>& e_connect = *local_elem_connect[ldi];
+        std::vector<index_t>& e_sizes = *local_elem_sizes[ldi];
+        std::vector<index_t>& e_offsets = *local_elem_offsets[ldi];
+        std::vector<index_t>& sub_connect = *local_subelem_connect[ldi];
+        std::vector<index_t>& sub_sizes = *local_subelem_sizes[ldi];
+        std::vector<index_t>& sub_offsets = *local_subelem_offsets[ldi];
         index_t elem_offset_sum = 0;
         index_t subelem_offset_sum = 0;
         for (index_t elem = 0; elem < elemsize; ++elem)
@@ -2546,25 +2609,8 @@ void to_polyhedral(const Node &n,
             sub_offsets.push_back(subelem_offset_sum);
             subelem_offset_sum += sub_sizes.back();
         }
-    }
 
-    itr = n.children();
-    while(itr.has_next())
-    {
-        const Node& chld = itr.next();
-        std::string domain_name = itr.name();
-
-        index_t domain_id = chld["state/domain_id"].to_index_t();
-
-        std::vector<index_t>& e_connect = elem_connect[domain_id];
-        std::vector<index_t>& e_sizes = elem_sizes[domain_id];
-        std::vector<index_t>& e_offsets = elem_offsets[domain_id];
-        std::vector<index_t>& sub_connect = subelem_connect[domain_id];
-        std::vector<index_t>& sub_sizes = subelem_sizes[domain_id];
-        std::vector<index_t>& sub_offsets = subelem_offsets[domain_id];
-
-        Node& topo = dest[domain_name]["topologies"][name];
-        const Node& in_topo = chld["topologies"][name];
+        Node& topo = (*local_dest_doms[ldi])["topologies"][name];
 
         topo["coordset"] = in_topo["coordset"];
 
@@ -2578,8 +2624,7 @@ void to_polyhedral(const Node &n,
         topo["subelements/connectivity"].set(sub_connect);
         topo["subelements/sizes"].set(sub_sizes);
         topo["subelements/offsets"].set(sub_offsets);
-
-    }
+    });
 }
 
 //
@@ -2701,6 +2746,187 @@ verify_generate_mesh(const conduit::Node &mesh,
 }
 
 
+//-----------------------------------------------------------------------------
+// Maps each point in a (vertex) adjset to the sorted list of neighbor domains
+// that share it. The map is stored in CSR form indexed by point id.
+//
+struct AdjsetPointNeighbors
+{
+    std::vector<index_t> offsets;
+    std::vector<index_t> neighbors;
+    std::vector<index_t> all_neighbors;
+
+    void build(const conduit::Node &adjset_groups)
+    {
+        // (point id, neighbor domain id) pairs for all groups
+        std::vector<std::pair<index_t, index_t>> point_neighbor_pairs;
+        for(index_t gi = 0; gi < adjset_groups.number_of_children(); gi++)
+        {
+            const conduit::Node &group = adjset_groups.child(gi);
+            const bputils::IndexSpan group_neighbors(group["neighbors"]);
+            const bputils::IndexSpan group_values(group["values"]);
+            for(const index_t &neighbor_id : group_neighbors)
+            {
+                all_neighbors.push_back(neighbor_id);
+                for(const index_t &point_id : group_values)
+                {
+                    if(point_id >= 0)
+                    {
+                        point_neighbor_pairs.emplace_back(point_id, neighbor_id);
+                    }
+                }
+            }
+        }
+
+        std::sort(all_neighbors.begin(), all_neighbors.end());
+        all_neighbors.erase(std::unique(all_neighbors.begin(), all_neighbors.end()),
+                            all_neighbors.end());
+
+        bputils::adjset::sort_unique_pairs(point_neighbor_pairs);
+
+        const index_t num_points = point_neighbor_pairs.empty() ? 0 :
+            point_neighbor_pairs.back().first + 1;
+        offsets.assign(num_points + 1, 0);
+        neighbors.resize(point_neighbor_pairs.size());
+        for(size_t pi = 0; pi < point_neighbor_pairs.size(); pi++)
+        {
+            offsets[point_neighbor_pairs[pi].first + 1]++;
+            neighbors[pi] = point_neighbor_pairs[pi].second;
+        }
+        for(index_t pi = 0; pi < num_points; pi++)
+        {
+            offsets[pi + 1] += offsets[pi];
+        }
+    }
+
+    // Finds the neighbors that share all of the given points.
+    void shared_neighbors(const std::vector<index_t> &point_ids,
+                          std::vector<index_t> &res,
+                          std::vector<index_t> &temp) const
+    {
+        res.clear();
+        if(point_ids.empty())
+        {
+            res = all_neighbors;
+            return;
+        }
+
+        for(size_t pi = 0; pi < point_ids.size(); pi++)
+        {
+            const index_t point_id = point_ids[pi];
+            if(point_id < 0 || point_id + 1 >= (index_t)offsets.size())
+            {
+                res.clear();
+                return;
+            }
+
+            const index_t *pbegin = neighbors.data() + offsets[point_id];
+            const index_t *pend = neighbors.data() + offsets[point_id + 1];
+            if(pi == 0)
+            {
+                res.assign(pbegin, pend);
+            }
+            else
+            {
+                temp.clear();
+                std::set_intersection(res.begin(), res.end(), pbegin, pend,
+                                      std::back_inserter(temp));
+                res.swap(temp);
+            }
+
+            if(res.empty())
+            {
+                return;
+            }
+        }
+    }
+};
+
+// an adjset entity, identified by its (sorted) points and its id
+typedef std::tuple<std::vector<PointTuple>, index_t> EntityTuple;
+
+//-----------------------------------------------------------------------------
+void
+sort_entity_points(std::vector<PointTuple> &entity_points)
+{
+    std::sort(entity_points.begin(), entity_points.end());
+    entity_points.erase(std::unique(entity_points.begin(), entity_points.end(),
+        [](const PointTuple &p0, const PointTuple &p1)
+        {
+            return !(p0 < p1) && !(p1 < p0);
+        }),
+        entity_points.end());
+}
+
+//-----------------------------------------------------------------------------
+// Writes the groups of entities shared with each set of neighbors into the
+// destination adjset.
+//
+void
+write_entity_groups(std::map<std::vector<index_t>, std::vector<EntityTuple>> &group_entity_map,
+                    const index_t domain_id,
+                    const conduit::Node &src_adjset_groups,
+                    conduit::Node &dst_adjset_groups)
+{
+    std::vector<index_t> group_values;
+    for(auto &group_pair : group_entity_map)
+    {
+        // NOTE(JRC): It's possible for the 'src_adjset_groups' node to be empty,
+        // so we only want to query child data types if we know there is at least
+        // 1 non-empty group.
+        const conduit::DataType src_neighbors_dtype = src_adjset_groups.child(0)["neighbors"].dtype();
+        const conduit::DataType src_values_dtype = src_adjset_groups.child(0)["values"].dtype();
+
+        const std::vector<index_t> &group_nidxs = group_pair.first;
+        std::vector<EntityTuple> &group_entities = group_pair.second;
+        // NOTE: Entities are sorted by their points so that they are in the
+        // same order across all domains and processors.
+        std::sort(group_entities.begin(), group_entities.end());
+
+        std::string group_name;
+        {
+            // NOTE(JRC): The current domain is included in the domain name so that
+            // it matches across all domains and processors (also, using sorted
+            // ids ensures that the order is the same across ranks).
+            std::vector<index_t> group_all_nidxs = group_nidxs;
+            group_all_nidxs.insert(std::upper_bound(group_all_nidxs.begin(),
+                                                    group_all_nidxs.end(),
+                                                    domain_id),
+                                   domain_id);
+
+            std::ostringstream oss;
+            oss << "group";
+            for(size_t ni = 0; ni < group_all_nidxs.size(); ni++)
+            {
+                if(ni > 0 && group_all_nidxs[ni] == group_all_nidxs[ni - 1])
+                {
+                    continue;
+                }
+                oss << "_" << group_all_nidxs[ni];
+            }
+            group_name = oss.str();
+        }
+
+        conduit::Node &dst_group = dst_adjset_groups[group_name];
+        {
+            Node temp(DataType::index_t(group_nidxs.size()),
+                (void*)group_nidxs.data(), true);
+            temp.to_data_type(src_neighbors_dtype.id(), dst_group["neighbors"]);
+        }
+
+        group_values.resize(group_entities.size());
+        for(size_t ei = 0; ei < group_entities.size(); ei++)
+        {
+            group_values[ei] = std::get<1>(group_entities[ei]);
+        }
+        {
+            Node temp(DataType::index_t(group_values.size()),
+                (void*)group_values.data(), true);
+            temp.to_data_type(src_values_dtype.id(), dst_group["values"]);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 generate_derived_entities(conduit::Node &mesh,
@@ -2712,8 +2938,12 @@ generate_derived_entities(conduit::Node &mesh,
                           MPI_Comm /*comm*/,
                           GenDerivedFun generate_derived)
 {
+    // NOTE: Local domains are processed concurrently (when OpenMP support is
+    // enabled). Each task only modifies its own domain and map nodes, which
+    // are all created up front by group_domains_and_maps.
     const std::vector<DomMapsTuple> doms_and_maps = group_domains_and_maps(mesh, s2dmap, d2smap);
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    const index_t num_doms = (index_t)doms_and_maps.size();
+    execution::for_all(0, num_doms, [&](index_t di)
     {
         conduit::Node &domain = *std::get<0>(doms_and_maps[di]);
         conduit::Node &domain_s2dmap = *std::get<1>(doms_and_maps[di]);
@@ -2730,10 +2960,9 @@ generate_derived_entities(conduit::Node &mesh,
         dst_adjset.reset();
         dst_adjset["association"].set("element");
         dst_adjset["topology"].set(dst_topo_name);
-    }
+    });
 
-    Node src_data, dst_data;
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    execution::for_all(0, num_doms, [&](index_t di)
     {
         conduit::Node &domain = *std::get<0>(doms_and_maps[di]);
         const index_t domain_id = domain["state/domain_id"].to_index_t();
@@ -2751,139 +2980,44 @@ generate_derived_entities(conduit::Node &mesh,
 
         // Organize Adjset Points into Interfaces (Pair-Wise Groups) //
 
-        // {(neighbor domain id): <(participating points for domain interface)>}
-        std::map<index_t, std::set<index_t>> neighbor_pidxs_map;
-        for(const std::string &group_name : src_adjset_groups.child_names())
-        {
-            const conduit::Node &src_group = src_adjset_groups[group_name];
-            const conduit::Node &src_neighbors = src_group["neighbors"];
-            const conduit::Node &src_values = src_group["values"];
-
-            for(index_t ni = 0; ni < src_neighbors.dtype().number_of_elements(); ni++)
-            {
-                src_data.set_external(DataType(src_neighbors.dtype().id(), 1),
-                    (void*)src_neighbors.element_ptr(ni));
-                std::set<index_t> &neighbor_pidxs = neighbor_pidxs_map[src_data.to_index_t()];
-                for(index_t pi = 0; pi < src_values.dtype().number_of_elements(); pi++)
-                {
-                    src_data.set_external(DataType(src_values.dtype().id(), 1),
-                        (void*)src_values.element_ptr(pi));
-                    neighbor_pidxs.insert(src_data.to_index_t());
-                }
-            }
-        }
+        AdjsetPointNeighbors point_neighbors;
+        point_neighbors.build(src_adjset_groups);
 
-        // Collect Viable Entities for All Interfaces //
+        // Collect Viable Entities for All Interfaces and Use Them to //
+        // Construct Group Entity Lists //
 
-        // {(entity id in topology): <(neighbor domain ids that contain this entity)>}
-        std::map<index_t, std::set<index_t>> entity_neighbor_map;
+        // {(neighbor domain ids): <(entities shared with these neighbors)>}
+        std::map<std::vector<index_t>, std::vector<EntityTuple>> group_entity_map;
+        std::vector<index_t> entity_neighbors, temp;
         for(index_t ei = 0; ei < dst_topo_len; ei++)
         {
-            std::vector<index_t> entity_pidxs = bputils::topology::unstructured::points(dst_topo, ei);
-            for(const auto &neighbor_pair : neighbor_pidxs_map)
+            const std::vector<index_t> entity_pidxs = bputils::topology::unstructured::points(dst_topo, ei);
+            point_neighbors.shared_neighbors(entity_pidxs, entity_neighbors, temp);
+            if(entity_neighbors.empty())
             {
-                const index_t &ni = neighbor_pair.first;
-                const std::set<index_t> &neighbor_pidxs = neighbor_pair.second;
-
-                bool entity_in_neighbor = true;
-                for(index_t pi = 0; pi < (index_t)entity_pidxs.size() && entity_in_neighbor; pi++)
-                {
-                    entity_in_neighbor &= neighbor_pidxs.find(entity_pidxs[pi]) != neighbor_pidxs.end();
-                }
-
-                if(entity_in_neighbor)
-                {
-                    entity_neighbor_map[ei].insert(ni);
-                }
+                continue;
             }
-        }
-
-        // Use Entity Interfaces to Construct Group Entity Lists //
-
-        std::map<std::set<index_t>, std::vector<std::tuple<std::set<PointTuple>, index_t>>> group_entity_map;
-        for(const auto &entity_neighbor_pair : entity_neighbor_map)
-        {
-            const index_t &ei = entity_neighbor_pair.first;
-            const std::set<index_t> &entity_neighbors = entity_neighbor_pair.second;
-            std::tuple<std::set<PointTuple>, index_t> entity;
 
-            std::vector<index_t> entity_pidxs = bputils::topology::unstructured::points(dst_topo, ei);
-            std::set<PointTuple> &entity_points = std::get<0>(entity);
+            EntityTuple entity;
+            std::vector<PointTuple> &entity_points = std::get<0>(entity);
             for(const index_t &entity_pidx : entity_pidxs)
             {
                 const std::vector<float64> point_coords = bputils::coordset::_explicit::coords(
                     src_cset, entity_pidx);
-                entity_points.emplace(
+                entity_points.emplace_back(
                     point_coords[0],
                     (point_coords.size() > 1) ? point_coords[1] : 0.0,
                     (point_coords.size() > 2) ? point_coords[2] : 0.0);
             }
+            sort_entity_points(entity_points);
+            std::get<1>(entity) = ei;
 
-            index_t &entity_id = std::get<1>(entity);
-            entity_id = ei;
-
-            // NOTE(JRC): Inserting with this method allows this algorithm to sort new
-            // elements as they're generated, rather than as a separate process at the
-            // end (slight optimization overall).
-            std::vector<std::tuple<std::set<PointTuple>, index_t>> &group_entities =
-                group_entity_map[entity_neighbors];
-            auto entity_itr = std::upper_bound(group_entities.begin(), group_entities.end(), entity);
-            group_entities.insert(entity_itr, entity);
+            group_entity_map[entity_neighbors].push_back(std::move(entity));
         }
 
-        for(const auto &group_pair : group_entity_map)
-        {
-            // NOTE(JRC): It's possible for the 'src_adjset_groups' node to be empty,
-            // so we only want to query child data types if we know there is at least
-            // 1 non-empty group.
-            const conduit::DataType src_neighbors_dtype = src_adjset_groups.child(0)["neighbors"].dtype();
-            const conduit::DataType src_values_dtype = src_adjset_groups.child(0)["values"].dtype();
-
-            const std::set<index_t> &group_nidxs = group_pair.first;
-            const std::vector<std::tuple<std::set<PointTuple>, index_t>> &group_entities = group_pair.second;
-            std::string group_name;
-            {
-                // NOTE(JRC): The current domain is included in the domain name so that
-                // it matches across all domains and processors (also, using std::set
-                // ensures that items are sorted and the order is the same across ranks).
-                std::set<index_t> group_all_nidxs = group_nidxs;
-                group_all_nidxs.insert(domain_id);
-
-                std::ostringstream oss;
-                oss << "group";
-                for(const index_t &group_nidx : group_all_nidxs)
-                {
-                    oss << "_" << group_nidx;
-                }
-                group_name = oss.str();
-            }
-
-            conduit::Node &dst_group = dst_adjset_groups[group_name];
-            conduit::Node &dst_neighbors = dst_group["neighbors"];
-            conduit::Node &dst_values = dst_group["values"];
-
-            dst_neighbors.set(DataType(src_neighbors_dtype.id(), group_nidxs.size()));
-            index_t ni = 0;
-            for(auto nitr = group_nidxs.begin(); nitr != group_nidxs.end(); ++nitr)
-            {
-                src_data.set_external(DataType::index_t(1),
-                    (void*)&(*nitr));
-                dst_data.set_external(DataType(src_neighbors_dtype.id(), 1),
-                    (void*)dst_neighbors.element_ptr(ni++));
-                src_data.to_data_type(dst_data.dtype().id(), dst_data);
-            }
-
-            dst_values.set(DataType(src_values_dtype.id(), group_entities.size()));
-            for(index_t ei = 0; ei < (index_t)group_entities.size(); ei++)
-            {
-                src_data.set_external(DataType::index_t(1),
-                    (void*)&std::get<1>(group_entities[ei]));
-                dst_data.set_external(DataType(src_values_dtype.id(), 1),
-                    (void*)dst_values.element_ptr(ei));
-                src_data.to_data_type(dst_data.dtype().id(), dst_data);
-            }
-        }
-    }
+        write_entity_groups(group_entity_map, domain_id,
+                            src_adjset_groups, dst_adjset_groups);
+    });
 
     // TODO(JRC): Waitall?
 }
@@ -2903,8 +3037,11 @@ generate_decomposed_entities(conduit::Node &mesh,
                              IdDecomposedFun identify_decomposed,
                              const std::vector<index_t> &decomposed_centroid_dims)
 {
+    // NOTE: Local domains are processed concurrently, as in
+    // generate_derived_entities.
     const std::vector<DomMapsTuple> doms_and_maps = group_domains_and_maps(mesh, s2dmap, d2smap);
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    const index_t num_doms = (index_t)doms_and_maps.size();
+    execution::for_all(0, num_doms, [&](index_t di)
     {
         Node &domain = *std::get<0>(doms_and_maps[di]);
         Node &domain_s2dmap = *std::get<1>(doms_and_maps[di]);
@@ -2924,14 +3061,11 @@ generate_decomposed_entities(conduit::Node &mesh,
         // NOTE(JRC): Diff- different association (decomposed entity -> assoc: vertex)
         dst_adjset["association"].set("vertex");
         dst_adjset["topology"].set(dst_topo_name);
-    }
+    });
 
-    Node src_data, dst_data;
-    src_data.reset();
-    dst_data.reset();
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    execution::for_all(0, num_doms, [&](index_t dmi)
     {
-        Node &domain = *std::get<0>(doms_and_maps[di]);
+        Node &domain = *std::get<0>(doms_and_maps[dmi]);
         const index_t domain_id = domain["state/domain_id"].to_index_t();
 
         const Node *src_topo_ptr = bputils::find_reference_node(domain["adjsets"][src_adjset_name], "topology");
@@ -2950,32 +3084,14 @@ generate_decomposed_entities(conduit::Node &mesh,
 
         // Organize Adjset Points into Interfaces (Pair-Wise Groups) //
 
-        // {(neighbor domain id): <(participating points for domain interface)>}
-        std::map<index_t, std::set<index_t>> neighbor_pidxs_map;
-        for(const std::string &group_name : src_adjset_groups.child_names())
-        {
-            const Node &src_group = src_adjset_groups[group_name];
-            const Node &src_neighbors = src_group["neighbors"];
-            const Node &src_values = src_group["values"];
-
-            for(index_t ni = 0; ni < src_neighbors.dtype().number_of_elements(); ni++)
-            {
-                src_data.set_external(DataType(src_neighbors.dtype().id(), 1),
-                    (void*)src_neighbors.element_ptr(ni));
-                std::set<index_t> &neighbor_pidxs = neighbor_pidxs_map[src_data.to_index_t()];
-                for(index_t pi = 0; pi < src_values.dtype().number_of_elements(); pi++)
-                {
-                    src_data.set_external(DataType(src_values.dtype().id(), 1),
-                        (void*)src_values.element_ptr(pi));
-                    neighbor_pidxs.insert(src_data.to_index_t());
-                }
-            }
-        }
+        AdjsetPointNeighbors point_neighbors;
+        point_neighbors.build(src_adjset_groups);
 
         // Collect Viable Entities for All Interfaces //
 
-        // {(entity centroid id): <(neighbor domain ids that contain this entity)>}
-        std::map<index_t, std::set<index_t>> entity_neighbor_map;
+        // (entity centroid id, neighbor domain id that contains this entity) pairs
+        std::vector<std::pair<index_t, index_t>> entity_neighbor_pairs;
+        std::vector<index_t> entity_neighbors, temp;
         // NOTE(JRC): Diff, entirely different iteration strategy for finding entities
         // to consider on individual adjset interfaces.
         for(const index_t &di : decomposed_centroid_dims)
@@ -2983,110 +3099,50 @@ generate_decomposed_entities(conduit::Node &mesh,
             const Node &dim_topo = src_topo_data.dim_topos[di];
             for(index_t ei = 0; ei < src_topo_data.get_length(di); ei++)
             {
-                std::vector<index_t> entity_pidxs = bputils::topology::unstructured::points(dim_topo, ei);
-                for(const auto &neighbor_pair : neighbor_pidxs_map)
+                const std::vector<index_t> entity_pidxs = bputils::topology::unstructured::points(dim_topo, ei);
+                point_neighbors.shared_neighbors(entity_pidxs, entity_neighbors, temp);
+                if(!entity_neighbors.empty())
                 {
-                    const index_t &ni = neighbor_pair.first;
-                    const std::set<index_t> &neighbor_pidxs = neighbor_pair.second;
-
-                    bool entity_in_neighbor = true;
-                    for(index_t pi = 0; pi < (index_t)entity_pidxs.size() && entity_in_neighbor; pi++)
-                    {
-                        entity_in_neighbor &= neighbor_pidxs.find(entity_pidxs[pi]) != neighbor_pidxs.end();
-                    }
-
-                    if(entity_in_neighbor)
+                    const index_t entity_cidx = identify_decomposed(src_topo_data, ei, di);
+                    for(const index_t &ni : entity_neighbors)
                     {
-                        const index_t entity_cidx = identify_decomposed(src_topo_data, ei, di);
-                        entity_neighbor_map[entity_cidx].insert(ni);
+                        entity_neighbor_pairs.emplace_back(entity_cidx, ni);
                     }
                 }
             }
         }
+        bputils::adjset::sort_unique_pairs(entity_neighbor_pairs);
 
         // Use Entity Interfaces to Construct Group Entity Lists //
 
-        std::map<std::set<index_t>, std::vector<std::tuple<std::set<PointTuple>, index_t>>> group_entity_map;
-        for(const auto &entity_neighbor_pair : entity_neighbor_map)
+        std::map<std::vector<index_t>, std::vector<EntityTuple>> group_entity_map;
+        for(size_t pi = 0; pi < entity_neighbor_pairs.size();)
         {
-            const index_t &entity_cidx = entity_neighbor_pair.first;
-            const std::set<index_t> &entity_neighbors = entity_neighbor_pair.second;
-            std::tuple<std::set<PointTuple>, index_t> entity;
+            const index_t entity_cidx = entity_neighbor_pairs[pi].first;
+            entity_neighbors.clear();
+            for(; pi < entity_neighbor_pairs.size() &&
+                  entity_neighbor_pairs[pi].first == entity_cidx; pi++)
+            {
+                entity_neighbors.push_back(entity_neighbor_pairs[pi].second);
+            }
 
-            std::set<PointTuple> &entity_points = std::get<0>(entity);
+            EntityTuple entity;
+            std::vector<PointTuple> &entity_points = std::get<0>(entity);
             // NOTE(JRC): Diff: Substitute entity for centroid point at the end here.
             const std::vector<float64> point_coords = bputils::coordset::_explicit::coords(
                 dst_cset, entity_cidx);
-            entity_points.emplace(
+            entity_points.emplace_back(
                 point_coords[0],
                 (point_coords.size() > 1) ? point_coords[1] : 0.0,
                 (point_coords.size() > 2) ? point_coords[2] : 0.0);
+            std::get<1>(entity) = entity_cidx;
 
-            index_t &entity_id = std::get<1>(entity);
-            entity_id = entity_cidx;
-
-            // NOTE(JRC): Inserting with this method allows this algorithm to sort new
-            // elements as they're generated, rather than as a separate process at the
-            // end (slight optimization overall).
-            std::vector<std::tuple<std::set<PointTuple>, index_t>> &group_entities =
-                group_entity_map[entity_neighbors];
-            auto entity_itr = std::upper_bound(group_entities.begin(), group_entities.end(), entity);
-            group_entities.insert(entity_itr, entity);
+            group_entity_map[entity_neighbors].push_back(std::move(entity));
         }
 
-        for(const auto &group_pair : group_entity_map)
-        {
-            // NOTE(JRC): It's possible for the 'src_adjset_groups' node to be empty,
-            // so we only want to query child data types if we know there is at least
-            // 1 non-empty group.
-            const DataType src_neighbors_dtype = src_adjset_groups.child(0)["neighbors"].dtype();
-            const DataType src_values_dtype = src_adjset_groups.child(0)["values"].dtype();
-
-            const std::set<index_t> &group_nidxs = group_pair.first;
-            const std::vector<std::tuple<std::set<PointTuple>, index_t>> &group_entities = group_pair.second;
-            std::string group_name;
-            {
-                // NOTE(JRC): The current domain is included in the domain name so that
-                // it matches across all domains and processors (also, using std::set
-                // ensures that items are sorted and the order is the same across ranks).
-                std::set<index_t> group_all_nidxs = group_nidxs;
-                group_all_nidxs.insert(domain_id);
-
-                std::ostringstream oss;
-                oss << "group";
-                for(const index_t &group_nidx : group_all_nidxs)
-                {
-                    oss << "_" << group_nidx;
-                }
-                group_name = oss.str();
-            }
-
-            Node &dst_group = dst_adjset_groups[group_name];
-            Node &dst_neighbors = dst_group["neighbors"];
-            Node &dst_values = dst_group["values"];
-
-            dst_neighbors.set(DataType(src_neighbors_dtype.id(), group_nidxs.size()));
-            index_t ni = 0;
-            for(auto nitr = group_nidxs.begin(); nitr != group_nidxs.end(); ++nitr)
-            {
-                src_data.set_external(DataType::index_t(1),
-                    (void*)&(*nitr));
-                dst_data.set_external(DataType(src_neighbors_dtype.id(), 1),
-                    (void*)dst_neighbors.element_ptr(ni++));
-                src_data.to_data_type(dst_data.dtype().id(), dst_data);
-            }
-
-            dst_values.set(DataType(src_values_dtype.id(), group_entities.size()));
-            for(index_t ei = 0; ei < (index_t)group_entities.size(); ei++)
-            {
-                src_data.set_external(DataType::index_t(1),
-                    (void*)&std::get<1>(group_entities[ei]));
-                dst_data.set_external(DataType(src_values_dtype.id(), 1),
-                    (void*)dst_values.element_ptr(ei));
-                src_data.to_data_type(dst_data.dtype().id(), dst_data);
-            }
-        }
-    }
+        write_entity_groups(group_entity_map, domain_id,
+                            src_adjset_groups, dst_adjset_groups);
+    });
 
     // TODO(JRC): Waitall?
 }
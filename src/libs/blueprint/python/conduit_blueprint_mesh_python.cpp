@@ -103,13 +103,23 @@ PyBlueprint_mesh_verify(PyObject *, //self
     
     bool res = false;
     
-    if(protocol != NULL)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            if(protocol != NULL)
+            {
+                res = blueprint::mesh::verify(std::string(protocol), node,info);
+            }
+            else
+            {
+                res = blueprint::mesh::verify(node,info);
+            }
+        });
+
+    if(!ok)
     {
-        res = blueprint::mesh::verify(std::string(protocol), node,info);
-    }
-    else
-    {
-        res = blueprint::mesh::verify(node,info);
+        return NULL;
     }
 
     if(res)
@@ -188,10 +198,20 @@ PyBlueprint_mesh_generate_index(PyObject *, //self
     Node &dest = *PyConduit_Node_Get_Node_Ptr(py_dest);
     
 
-    blueprint::mesh::generate_index(mesh,
-                                    std::string(ref_path),
-                                    num_domains,
-                                    dest);
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            blueprint::mesh::generate_index(mesh,
+                                            std::string(ref_path),
+                                            num_domains,
+                                            dest);
+        });
+
+    if(!ok)
+    {
+        return NULL;
+    }
 
     Py_RETURN_NONE;
 }
@@ -270,9 +290,19 @@ PyBlueprint_mesh_partition(PyObject *, //self
     Node &options = *PyConduit_Node_Get_Node_Ptr(py_options);
     Node &output = *PyConduit_Node_Get_Node_Ptr(py_output);
 
-    blueprint::mesh::partition(mesh,
-                               options,
-                               output);
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            blueprint::mesh::partition(mesh,
+                                       options,
+                                       output);
+        });
+
+    if(!ok)
+    {
+        return NULL;
+    }
 
     Py_RETURN_NONE;
 }
@@ -345,7 +375,17 @@ PyBlueprint_mesh_flatten(PyObject *, //self
     const Node &options = *PyConduit_Node_Get_Node_Ptr(py_options);
     Node &output = *PyConduit_Node_Get_Node_Ptr(py_output);
 
-    blueprint::mesh::flatten(mesh, options, output);
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            blueprint::mesh::flatten(mesh, options, output);
+        });
+
+    if(!ok)
+    {
+        return NULL;
+    }
 
     Py_RETURN_NONE;
 }
@@ -26,6 +26,8 @@
 #include "conduit_generator.hpp"
 #include "conduit_utils.hpp"
 #include "conduit_data_accessor.hpp"
+#include "conduit_execution.hpp"
+#include "conduit_layout_plan.hpp"
 
 #endif
 
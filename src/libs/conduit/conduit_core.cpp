@@ -80,6 +80,11 @@ about(Node &n)
 #endif
     
     n["system"] = CONDUIT_SYSTEM_TYPE;
+#ifdef CONDUIT_USE_OPENMP
+    n["openmp"] = "enabled";
+#else
+    n["openmp"] = "disabled";
+#endif
     n["install_prefix"] = CONDUIT_INSTALL_PREFIX;
     n["license"] = CONDUIT_LICENSE_TEXT;
     
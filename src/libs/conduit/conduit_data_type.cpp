@@ -24,6 +24,7 @@
 // Checked here to avoid header dep of C++11 in client code
 //-----------------------------------------------------------------------------
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 
 // signed integers
@@ -493,7 +494,8 @@ DataType::DataType(const DataType& value)
   m_offset(value.m_offset),
   m_stride(value.m_stride),
   m_ele_bytes(value.m_ele_bytes),
-  m_endianness(value.m_endianness)
+  m_endianness(value.m_endianness),
+  m_shape(value.m_shape)
 {}
 
 
@@ -506,6 +508,7 @@ DataType& DataType::operator=(const DataType& value)
   m_stride = value.m_stride;
   m_ele_bytes = value.m_ele_bytes;
   m_endianness = value.m_endianness;
+  m_shape = value.m_shape;
 
   return *this;
 }
@@ -567,7 +570,7 @@ DataType::reset()
     m_stride = 0;
     m_ele_bytes = 0;
     m_endianness = Endianness::DEFAULT_ID;
-    
+    m_shape.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -584,6 +587,7 @@ DataType::set(const DataType& dtype)
     m_stride = dtype.m_stride;
     m_ele_bytes = dtype.m_ele_bytes;
     m_endianness = dtype.m_endianness;
+    m_shape = dtype.m_shape;
 }
 
 
@@ -602,6 +606,7 @@ DataType::set(const std::string &dtype_name,
     m_stride = stride;
     m_ele_bytes = element_bytes;
     m_endianness = endianness;
+    m_shape.clear();
 }
 
 //---------------------------------------------------------------------------// 
@@ -619,12 +624,107 @@ DataType::set(conduit::index_t dtype_id,
     m_stride = stride;
     m_ele_bytes = element_bytes;
     m_endianness = endianness;
+    m_shape.clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+DataType::set_shape(const std::vector<conduit::index_t> &shape)
+{
+    if(shape.empty())
+    {
+        m_shape.clear();
+        return;
+    }
+    set_shape(&shape[0],(conduit::index_t)shape.size());
+}
+
+//---------------------------------------------------------------------------//
+void
+DataType::set_shape(const conduit::index_t *shape,
+                    conduit::index_t num_dims)
+{
+    if(num_dims == 0)
+    {
+        m_shape.clear();
+        return;
+    }
+
+    conduit::index_t num_eles = 1;
+    for(conduit::index_t i=0; i < num_dims; i++)
+    {
+        if(shape[i] < 0)
+        {
+            CONDUIT_ERROR("DataType::set_shape: invalid extent "
+                          << shape[i] << " for dimension " << i);
+        }
+        if(shape[i] != 0 &&
+           num_eles > std::numeric_limits<conduit::index_t>::max() / shape[i])
+        {
+            CONDUIT_ERROR("DataType::set_shape: the number of elements in "
+                          "the shape overflows index_t at dimension " << i);
+        }
+        num_eles *= shape[i];
+    }
+
+    if(num_eles != m_num_ele)
+    {
+        CONDUIT_ERROR("DataType::set_shape: the shape holds "
+                      << num_eles << " elements, the data type holds "
+                      << m_num_ele << " elements");
+    }
+
+    m_shape.assign(shape,shape + num_dims);
 }
 
 //-----------------------------------------------------------------------------
 // Getters and info methods.
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+conduit::index_t
+DataType::number_of_dimensions() const
+{
+    if(m_shape.empty())
+    {
+        return 1;
+    }
+    return (conduit::index_t)m_shape.size();
+}
+
+//---------------------------------------------------------------------------//
+conduit::index_t
+DataType::dimension(conduit::index_t dim) const
+{
+    if(dim < 0 || dim >= number_of_dimensions())
+    {
+        CONDUIT_ERROR("DataType::dimension: invalid dimension " << dim
+                      << " (number of dimensions: "
+                      << number_of_dimensions() << ")");
+    }
+
+    if(m_shape.empty())
+    {
+        return m_num_ele;
+    }
+    return m_shape[dim];
+}
+
+//---------------------------------------------------------------------------//
+conduit::index_t
+DataType::dimension_stride(conduit::index_t dim) const
+{
+    // checks dim
+    dimension(dim);
+
+    conduit::index_t res = m_stride;
+    for(conduit::index_t i = number_of_dimensions() - 1; i > dim; i--)
+    {
+        res *= m_shape[i];
+    }
+    return res;
+}
+
 //---------------------------------------------------------------------------// 
 conduit::index_t
 DataType::strided_bytes() const
@@ -665,7 +765,8 @@ DataType::equals(const DataType& dtype) const
              (m_num_ele   == dtype.m_num_ele) &&
              (m_offset    == dtype.m_offset) &&
              (m_ele_bytes == dtype.m_ele_bytes) &&
-             (m_endianness == dtype.m_endianness));
+             (m_endianness == dtype.m_endianness) &&
+             (m_shape == dtype.m_shape));
 }
 
 
@@ -1354,6 +1455,22 @@ DataType::to_json_stream(std::ostream &os,
         utils::indent(os,indent,depth+1,pad);
         os << "\"element_bytes\": " << m_ele_bytes;
 
+        if(has_shape())
+        {
+            os << "," << eoe;
+            utils::indent(os,indent,depth+1,pad);
+            os << "\"shape\": [";
+            for(size_t i=0; i < m_shape.size(); i++)
+            {
+                if(i > 0)
+                {
+                    os << ", ";
+                }
+                os << m_shape[i];
+            }
+            os << "]";
+        }
+
         std::string endian_str;
         if(m_endianness == Endianness::DEFAULT_ID)
         {
@@ -1424,6 +1541,21 @@ DataType::to_yaml_stream(std::ostream &os,
         utils::indent(os,indent,depth,pad);
         os << "element_bytes: " << m_ele_bytes << eoe;
 
+        if(has_shape())
+        {
+            utils::indent(os,indent,depth,pad);
+            os << "shape: [";
+            for(size_t i=0; i < m_shape.size(); i++)
+            {
+                if(i > 0)
+                {
+                    os << ", ";
+                }
+                os << m_shape[i];
+            }
+            os << "]" << eoe;
+        }
+
         std::string endian_str;
         if(m_endianness == Endianness::DEFAULT_ID)
         {
@@ -1458,6 +1590,7 @@ DataType::compact_to(DataType &dtype) const
                ele_size,
                ele_size,
                m_endianness);
+     dtype.m_shape = m_shape;
 }
 
 //=============================================================================
@@ -368,7 +368,7 @@ public:
                     { m_id = dtype_id;}
                    
     void       set_number_of_elements(conduit::index_t v)
-                    { m_num_ele = v;}
+                    { m_num_ele = v; m_shape.clear();}
     void       set_offset(conduit::index_t v)
                     { m_offset = v;}
     void       set_stride(conduit::index_t v)
@@ -378,6 +378,23 @@ public:
     void       set_endianness(conduit::index_t v)
                     { m_endianness = v;}
 
+//-----------------------------------------------------------------------------
+// N-D shape
+//-----------------------------------------------------------------------------
+    /// Sets an optional multi-dimensional shape (row-major / C order) for
+    /// the elements. The product of the extents must equal
+    /// number_of_elements(). The shape only changes how the elements are
+    /// viewed: element addressing still uses offset() and stride().
+    ///
+    /// Note: set(...) with explicit details and set_number_of_elements()
+    /// clear the shape.
+    void       set_shape(const std::vector<conduit::index_t> &shape);
+    void       set_shape(const conduit::index_t *shape,
+                         conduit::index_t num_dims);
+    /// removes the shape (the data type is viewed as 1-D)
+    void       clear_shape()
+                    { m_shape.clear();}
+
 //-----------------------------------------------------------------------------
 // Getters and info methods.
 //-----------------------------------------------------------------------------
@@ -391,6 +408,18 @@ public:
     conduit::index_t     endianness()          const { return m_endianness;}
     conduit::index_t     element_index(conduit::index_t idx) const;
 
+    /// true if an N-D shape was set
+    bool                 has_shape() const { return !m_shape.empty();}
+    /// extents of the shape, empty if no shape was set
+    const std::vector<conduit::index_t> &shape() const { return m_shape;}
+    /// number of dimensions (1 if no shape was set)
+    conduit::index_t     number_of_dimensions() const;
+    /// extent of the given dimension
+    /// (number_of_elements() for dim 0 if no shape was set)
+    conduit::index_t     dimension(conduit::index_t dim) const;
+    /// bytes between consecutive entries along the given dimension
+    conduit::index_t     dimension_stride(conduit::index_t dim) const;
+
     /// strided bytes = stride() * (number_of_elements() -1) + element_bytes()
     conduit::index_t     strided_bytes() const;
     // bytes compact = number_of_elements() * element_bytes()
@@ -593,6 +622,7 @@ private:
     conduit::index_t  m_stride;     /// bytes between start of current and start of next
     conduit::index_t  m_ele_bytes;  /// bytes per element
     conduit::index_t  m_endianness; /// endianness of elements
+    std::vector<conduit::index_t> m_shape; /// optional N-D shape (C order)
 
 };
 //-----------------------------------------------------------------------------
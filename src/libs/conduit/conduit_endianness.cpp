@@ -9,12 +9,230 @@
 //-----------------------------------------------------------------------------
 #include "conduit_endianness.hpp"
 
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_execution.hpp"
+#include "conduit_utils.hpp"
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// byte swap helpers, these map to single bswap / rev instructions
+//---------------------------------------------------------------------------//
+inline uint16
+bswap(uint16 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(v);
+#elif defined(_MSC_VER)
+    return _byteswap_ushort(v);
+#else
+    return (uint16)((v >> 8) | (v << 8));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+inline uint32
+bswap(uint32 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(v);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(v);
+#else
+    return ((v & 0x000000FFu) << 24) |
+           ((v & 0x0000FF00u) <<  8) |
+           ((v & 0x00FF0000u) >>  8) |
+           ((v & 0xFF000000u) >> 24);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+inline uint64
+bswap(uint64 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(v);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(v);
+#else
+    return ((uint64)bswap((uint32)(v & 0xFFFFFFFFu)) << 32) |
+            (uint64)bswap((uint32)(v >> 32));
+#endif
+}
+
+#if defined(__SSSE3__)
+//---------------------------------------------------------------------------//
+// byte shuffle masks used to swap all of the elements in a 16 byte vector
+//---------------------------------------------------------------------------//
+inline __m128i
+bswap_mask(uint16)
+{
+    return _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+}
+
+//---------------------------------------------------------------------------//
+inline __m128i
+bswap_mask(uint32)
+{
+    return _mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+}
+
+//---------------------------------------------------------------------------//
+inline __m128i
+bswap_mask(uint64)
+{
+    return _mm_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+}
+#endif
+
+//---------------------------------------------------------------------------//
+// copies and swaps num_eles elements of type T from src to dest.
+// src and dest can be the same location (in place swap) but must not
+// otherwise overlap.
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+copy_and_swap(const uint8 *src,
+              index_t src_stride,
+              uint8 *dest,
+              index_t dest_stride,
+              index_t num_eles)
+{
+    const index_t ele_bytes = (index_t) sizeof(T);
+    index_t i = 0;
+
+    if(src_stride == ele_bytes && dest_stride == ele_bytes)
+    {
+#if defined(__SSSE3__)
+        const __m128i mask = bswap_mask(T());
+        const index_t eles_per_vec = 16 / ele_bytes;
+        for(; i + eles_per_vec <= num_eles; i += eles_per_vec)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + i * ele_bytes));
+            _mm_storeu_si128((__m128i*)(dest + i * ele_bytes),
+                             _mm_shuffle_epi8(v, mask));
+        }
+#endif
+        // memcpy keeps unaligned access well defined, compilers lower it
+        // to plain loads and stores (and vectorize this loop)
+        for(; i < num_eles; i++)
+        {
+            T v;
+            memcpy(&v, src + i * ele_bytes, sizeof(T));
+            v = bswap(v);
+            memcpy(dest + i * ele_bytes, &v, sizeof(T));
+        }
+    }
+    else
+    {
+        for(; i < num_eles; i++)
+        {
+            T v;
+            memcpy(&v, src + i * src_stride, sizeof(T));
+            v = bswap(v);
+            memcpy(dest + i * dest_stride, &v, sizeof(T));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// dispatches copy_and_swap on element size, splitting large arrays into
+// blocks that are processed in parallel
+//---------------------------------------------------------------------------//
+void
+copy_and_swap(const void *src,
+              index_t src_stride,
+              void *dest,
+              index_t dest_stride,
+              index_t num_eles,
+              index_t ele_bytes)
+{
+    if(ele_bytes != 1 && ele_bytes != 2 && ele_bytes != 4 && ele_bytes != 8)
+    {
+        CONDUIT_ERROR("<Endianness::copy_and_swap> unsupported element size "
+                      << ele_bytes << " (expected 1, 2, 4, or 8 bytes)");
+    }
+
+    if(src_stride == 0)
+    {
+        src_stride = ele_bytes;
+    }
+
+    if(dest_stride == 0)
+    {
+        dest_stride = ele_bytes;
+    }
+
+    const uint8 *src_ptr  = (const uint8*) src;
+    uint8       *dest_ptr = (uint8*) dest;
+
+    index_t block_eles = execution::DEFAULT_BLOCK_BYTES / ele_bytes;
+
+    execution::for_all_blocks(num_eles, block_eles,
+                              [&](index_t b_begin, index_t b_end)
+    {
+        const uint8 *b_src  = src_ptr  + b_begin * src_stride;
+        uint8       *b_dest = dest_ptr + b_begin * dest_stride;
+        index_t      b_eles = b_end - b_begin;
+
+        switch(ele_bytes)
+        {
+            case 2:
+                copy_and_swap<uint16>(b_src, src_stride,
+                                      b_dest, dest_stride, b_eles);
+                break;
+            case 4:
+                copy_and_swap<uint32>(b_src, src_stride,
+                                      b_dest, dest_stride, b_eles);
+                break;
+            case 8:
+                copy_and_swap<uint64>(b_src, src_stride,
+                                      b_dest, dest_stride, b_eles);
+                break;
+            default:
+                // single bytes: nothing to swap
+                if(b_src != b_dest)
+                {
+                    for(index_t i = 0; i < b_eles; i++)
+                    {
+                        b_dest[i * dest_stride] = b_src[i * src_stride];
+                    }
+                }
+                break;
+        }
+    });
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::Endianness --
 //-----------------------------------------------------------------------------
@@ -89,76 +307,89 @@ Endianness::id_to_name(index_t endianness)
 void
 Endianness::swap16(void *data)
 {
-    uint8 tmp = *((uint8*)data);
-    ((uint8*)data)[0] = ((uint8*)data)[1];
-    ((uint8*)data)[1] = tmp;
+    uint16 v;
+    memcpy(&v, data, 2);
+    v = detail::bswap(v);
+    memcpy(data, &v, 2);
 }
 
 //---------------------------------------------------------------------------//
 void             
 Endianness::swap16(void *src,void *dest)
 {
-    ((uint8*)dest)[0] = ((uint8*)src)[1];
-    ((uint8*)dest)[1] = ((uint8*)src)[0];
+    uint16 v;
+    memcpy(&v, src, 2);
+    v = detail::bswap(v);
+    memcpy(dest, &v, 2);
 }
 
 //---------------------------------------------------------------------------//
 void
 Endianness::swap32(void *data)
 {
-    union{uint8 vbytes[4]; uint32 vdata;} swp;
-    
-    swp.vbytes[3] = ((uint8*)data)[0];
-    swp.vbytes[2] = ((uint8*)data)[1];
-    swp.vbytes[1] = ((uint8*)data)[2];
-    swp.vbytes[0] = ((uint8*)data)[3];
-
-    *((uint32*)data) = swp.vdata;
+    uint32 v;
+    memcpy(&v, data, 4);
+    v = detail::bswap(v);
+    memcpy(data, &v, 4);
 }
 
 //---------------------------------------------------------------------------//
 void             
 Endianness::swap32(void *src,void *dest)
 {
-    ((uint8*)dest)[0] = ((uint8*)src)[3];
-    ((uint8*)dest)[1] = ((uint8*)src)[2];
-    ((uint8*)dest)[2] = ((uint8*)src)[1];
-    ((uint8*)dest)[3] = ((uint8*)src)[0];
+    uint32 v;
+    memcpy(&v, src, 4);
+    v = detail::bswap(v);
+    memcpy(dest, &v, 4);
 }
 
 //---------------------------------------------------------------------------//
 void
 Endianness::swap64(void *data)
 {
-    union{uint8 vbytes[8]; uint64 vdata;} swp;
-    
-    swp.vbytes[7] = ((uint8*)data)[0];
-    swp.vbytes[6] = ((uint8*)data)[1];
-    swp.vbytes[5] = ((uint8*)data)[2];
-    swp.vbytes[4] = ((uint8*)data)[3];
-    swp.vbytes[3] = ((uint8*)data)[4];
-    swp.vbytes[2] = ((uint8*)data)[5];
-    swp.vbytes[1] = ((uint8*)data)[6];
-    swp.vbytes[0] = ((uint8*)data)[7];
-
-    *((uint64*)data) = swp.vdata;
+    uint64 v;
+    memcpy(&v, data, 8);
+    v = detail::bswap(v);
+    memcpy(data, &v, 8);
 }
 
 //---------------------------------------------------------------------------//
 void
 Endianness::swap64(void *src,void *dest)
 {
-    ((uint8*)dest)[0] = ((uint8*)src)[7];
-    ((uint8*)dest)[1] = ((uint8*)src)[6];
-    ((uint8*)dest)[2] = ((uint8*)src)[5];
-    ((uint8*)dest)[3] = ((uint8*)src)[4];
-    ((uint8*)dest)[4] = ((uint8*)src)[3];
-    ((uint8*)dest)[5] = ((uint8*)src)[2];
-    ((uint8*)dest)[6] = ((uint8*)src)[1];
-    ((uint8*)dest)[7] = ((uint8*)src)[0];
+    uint64 v;
+    memcpy(&v, src, 8);
+    v = detail::bswap(v);
+    memcpy(dest, &v, 8);
+}
 
+//---------------------------------------------------------------------------//
+void
+Endianness::swap(void *data,
+                 index_t num_elements,
+                 index_t element_bytes,
+                 index_t stride)
+{
+    detail::copy_and_swap(data, stride,
+                          data, stride,
+                          num_elements,
+                          element_bytes);
 }
 
+//---------------------------------------------------------------------------//
+void
+Endianness::copy_and_swap(const void *src,
+                          void *dest,
+                          index_t num_elements,
+                          index_t element_bytes,
+                          index_t src_stride,
+                          index_t dest_stride)
+{
+    detail::copy_and_swap(src, src_stride,
+                          dest, dest_stride,
+                          num_elements,
+                          element_bytes);
+}
 
 }
 //-----------------------------------------------------------------------------
@@ -103,6 +103,33 @@ public:
     /// src and dest must not be the same location.
     static void             swap64(void *src, void *dest);
 
+//-----------------------------------------------------------------------------
+/// Array endianness transforms
+///
+/// These use byte swap intrinsics (and SSSE3 shuffles when conduit is
+/// compiled with SSSE3 support). Arrays larger than
+/// execution::DEFAULT_BLOCK_BYTES are processed in parallel when conduit
+/// is built with OpenMP support.
+///
+/// element_bytes must be 1, 2, 4, or 8. A stride of 0 means the elements
+/// are compact (stride == element_bytes).
+//-----------------------------------------------------------------------------
+    /// swaps the bytes of each element of an array in place
+    static void             swap(void *data,
+                                 index_t num_elements,
+                                 index_t element_bytes,
+                                 index_t stride = 0);
+
+    /// fused copy + swap: copies the elements of src to dest, swapping
+    /// the bytes of each element. src and dest must not overlap.
+    /// (useful to convert data while pulling it out of I/O buffers)
+    static void             copy_and_swap(const void *src,
+                                          void *dest,
+                                          index_t num_elements,
+                                          index_t element_bytes,
+                                          index_t src_stride = 0,
+                                          index_t dest_stride = 0);
+
 };
 //-----------------------------------------------------------------------------
 // -- end conduit::Endianness --
@@ -0,0 +1,94 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_execution.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_execution.hpp"
+
+#if defined(CONDUIT_USE_OPENMP)
+#include <omp.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution --
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//---------------------------------------------------------------------------//
+bool
+openmp_enabled()
+{
+#if defined(CONDUIT_USE_OPENMP)
+    return true;
+#else
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+index_t
+num_threads()
+{
+#if defined(CONDUIT_USE_OPENMP)
+    return (index_t) omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+set_num_threads(index_t nthreads)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    if(nthreads > 0)
+    {
+        omp_set_num_threads((int)nthreads);
+    }
+#else
+    (void) nthreads;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+index_t
+thread_id()
+{
+#if defined(CONDUIT_USE_OPENMP)
+    return (index_t) omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+bool
+in_parallel()
+{
+#if defined(CONDUIT_USE_OPENMP)
+    return omp_in_parallel() != 0;
+#else
+    return false;
+#endif
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
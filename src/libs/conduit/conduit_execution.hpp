@@ -0,0 +1,172 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_execution.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_EXECUTION_HPP
+#define CONDUIT_EXECUTION_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <exception>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution --
+//-----------------------------------------------------------------------------
+///
+/// Simple loop execution helpers used by conduit's data parallel algorithms.
+///
+/// When conduit is built with OpenMP support (CONDUIT_USE_OPENMP), loops
+/// dispatched through these helpers are executed using an OpenMP parallel
+/// for. Otherwise they execute serially.
+///
+/// Callers are responsible for picking a loop granularity that makes
+/// threading worth it (for example: loop over blocks of a large array,
+/// or over independent domains), loop bodies must be thread safe.
+///
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//-----------------------------------------------------------------------------
+/// Returns true if conduit was built with OpenMP support.
+//-----------------------------------------------------------------------------
+bool    CONDUIT_API openmp_enabled();
+
+//-----------------------------------------------------------------------------
+/// Returns the max number of threads a parallel loop will use.
+/// (always 1 if conduit was built without OpenMP support)
+//-----------------------------------------------------------------------------
+index_t CONDUIT_API num_threads();
+
+//-----------------------------------------------------------------------------
+/// Sets the max number of threads parallel loops will use.
+/// (no-op if conduit was built without OpenMP support)
+//-----------------------------------------------------------------------------
+void    CONDUIT_API set_num_threads(index_t nthreads);
+
+//-----------------------------------------------------------------------------
+/// Returns the id of the calling thread within the active parallel loop
+/// (0 when called outside of a parallel loop).
+//-----------------------------------------------------------------------------
+index_t CONDUIT_API thread_id();
+
+//-----------------------------------------------------------------------------
+/// Returns true if the calling thread is executing inside a parallel loop.
+//-----------------------------------------------------------------------------
+bool    CONDUIT_API in_parallel();
+
+//-----------------------------------------------------------------------------
+/// Default number of bytes processed by a single task when large arrays
+/// are split into blocks for parallel processing.
+//-----------------------------------------------------------------------------
+static const index_t DEFAULT_BLOCK_BYTES = 1 << 20;
+
+//-----------------------------------------------------------------------------
+/// Calls func(i) for each i in [begin, end).
+///
+/// When executed in parallel and func throws (e.g. via CONDUIT_ERROR),
+/// the first exception is captured and rethrown to the caller after the
+/// loop completes.
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+for_all(index_t begin, index_t end, const Func &func)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    if(end - begin > 1 && !in_parallel())
+    {
+        std::exception_ptr eptr;
+        #pragma omp parallel for schedule(dynamic)
+        for(index_t i = begin; i < end; i++)
+        {
+            try
+            {
+                func(i);
+            }
+            catch(...)
+            {
+                #pragma omp critical(conduit_execution_for_all)
+                {
+                    if(!eptr)
+                    {
+                        eptr = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        if(eptr)
+        {
+            std::rethrow_exception(eptr);
+        }
+        return;
+    }
+#endif
+
+    for(index_t i = begin; i < end; i++)
+    {
+        func(i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+/// Splits [0, num_items) into blocks of (at most) block_size items and calls
+/// func(block_begin, block_end) for each block.
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+for_all_blocks(index_t num_items, index_t block_size, const Func &func)
+{
+    if(num_items <= 0)
+    {
+        return;
+    }
+
+    if(block_size <= 0 || block_size >= num_items)
+    {
+        func(0, num_items);
+        return;
+    }
+
+    index_t num_blocks = (num_items + block_size - 1) / block_size;
+    for_all(0, num_blocks, [&](index_t b)
+    {
+        index_t b_begin = b * block_size;
+        index_t b_end   = b_begin + block_size;
+        if(b_end > num_items)
+        {
+            b_end = num_items;
+        }
+        func(b_begin, b_end);
+    });
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
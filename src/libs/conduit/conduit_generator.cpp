@@ -639,14 +639,14 @@ Generator::Parser::JSON::parse_leaf_dtype(const conduit_rapidjson::Value &jvalue
         if(jvalue.HasMember("number_of_elements"))
         {
             const conduit_rapidjson::Value &json_num_eles = jvalue["number_of_elements"];
-            if(json_num_eles.IsNumber())
+            if(json_num_eles.IsUint64())
             {              
                 length = json_num_eles.GetUint64();
             }
             else
             {
                 CONDUIT_ERROR("JSON Generator error:\n"
-                               << "'number_of_elements' must be a number ");
+                               << "'number_of_elements' must be a non-negative integer ");
             }
         }
         //
@@ -656,14 +656,14 @@ Generator::Parser::JSON::parse_leaf_dtype(const conduit_rapidjson::Value &jvalue
         else if(jvalue.HasMember("length"))
         {
             const conduit_rapidjson::Value &json_len = jvalue["length"];
-            if(json_len.IsNumber())
+            if(json_len.IsUint64())
             {              
                 length = json_len.GetUint64();
             }
             else
             {
                 CONDUIT_ERROR("JSON Generator error:\n"
-                               << "'length' must be a number ");
+                               << "'length' must be a non-negative integer ");
             }
         }
 
@@ -676,14 +676,14 @@ Generator::Parser::JSON::parse_leaf_dtype(const conduit_rapidjson::Value &jvalue
         {
             const conduit_rapidjson::Value &json_offset = jvalue["offset"];
             
-            if(json_offset.IsNumber())
+            if(json_offset.IsUint64())
             {
                 offset = json_offset.GetUint64();
             }
             else
             {
                 CONDUIT_ERROR("JSON Generator error:\n"
-                              << "'offset' must be a number ");
+                              << "'offset' must be a non-negative integer ");
             }
         }
 
@@ -692,14 +692,14 @@ Generator::Parser::JSON::parse_leaf_dtype(const conduit_rapidjson::Value &jvalue
         {
             const conduit_rapidjson::Value &json_stride = jvalue["stride"];
             
-            if(json_stride.IsNumber())
+            if(json_stride.IsUint64())
             {
                 stride = json_stride.GetUint64();
             }
             else
             {
                 CONDUIT_ERROR("JSON Generator error:\n"
-                              << "'stride' must be a number ");
+                              << "'stride' must be a non-negative integer ");
             }
         }
 
@@ -708,14 +708,14 @@ Generator::Parser::JSON::parse_leaf_dtype(const conduit_rapidjson::Value &jvalue
         {
             const conduit_rapidjson::Value &json_ele_bytes = jvalue["element_bytes"];
             
-            if(json_ele_bytes.IsNumber())
+            if(json_ele_bytes.IsUint64())
             {
                 ele_size = json_ele_bytes.GetUint64();
             }
             else
             {
                 CONDUIT_ERROR("JSON Generator error:\n"
-                              << "'element_bytes' must be a number ");
+                              << "'element_bytes' must be a non-negative integer ");
             }
         }
     
@@ -770,9 +770,33 @@ Generator::Parser::JSON::parse_leaf_dtype(const conduit_rapidjson::Value &jvalue
         dtype_res.set(dtype_id,
                       length,
                       offset,
-                      stride, 
+                      stride,
                       ele_size,
                       endianness);
+
+        // parse shape (optional)
+        if(jvalue.HasMember("shape"))
+        {
+            const conduit_rapidjson::Value &json_shape = jvalue["shape"];
+            if(!json_shape.IsArray())
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "'shape' must be a JSON array");
+            }
+
+            std::vector<index_t> shape;
+            for(conduit_rapidjson::SizeType i = 0; i < json_shape.Size(); i++)
+            {
+                if(!json_shape[i].IsUint64())
+                {
+                    CONDUIT_ERROR("JSON Generator error:\n"
+                                  << "'shape' entries must be non-negative"
+                                  << " integers");
+                }
+                shape.push_back((index_t)json_shape[i].GetUint64());
+            }
+            dtype_res.set_shape(shape);
+        }
     }
     else
     {
@@ -0,0 +1,333 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_layout_plan.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_layout_plan.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_execution.hpp"
+#include "conduit_node.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// leaves that hold data (we plan copies for these)
+//---------------------------------------------------------------------------//
+inline bool
+is_data_leaf(const DataType &dtype)
+{
+    return !(dtype.is_object() || dtype.is_list() || dtype.is_empty());
+}
+
+//---------------------------------------------------------------------------//
+// collects pointers to the first element of each leaf of a node, in the
+// same order as schema leaves are visited by LayoutPlan
+//---------------------------------------------------------------------------//
+void
+gather_leaf_ptrs(const Node &node,
+                 std::vector<const uint8*> &leaf_ptrs,
+                 std::vector<const DataType*> &leaf_dtypes)
+{
+    const DataType &dtype = node.dtype();
+    if(dtype.is_object() || dtype.is_list())
+    {
+        index_t nchild = node.number_of_children();
+        for(index_t i = 0; i < nchild; i++)
+        {
+            gather_leaf_ptrs(node.child(i), leaf_ptrs, leaf_dtypes);
+        }
+    }
+    else if(is_data_leaf(dtype))
+    {
+        leaf_ptrs.push_back((const uint8*)node.element_ptr(0));
+        leaf_dtypes.push_back(&dtype);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+LayoutPlan::LayoutPlan()
+: m_compact_schema(),
+  m_structure_hash(0),
+  m_total_bytes_compact(0),
+  m_leaves(),
+  m_blocks()
+{}
+
+//---------------------------------------------------------------------------//
+LayoutPlan::LayoutPlan(const Schema &schema)
+: m_compact_schema(),
+  m_structure_hash(0),
+  m_total_bytes_compact(0),
+  m_leaves(),
+  m_blocks()
+{
+    set(schema);
+}
+
+//---------------------------------------------------------------------------//
+LayoutPlan::~LayoutPlan()
+{}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::reset()
+{
+    m_compact_schema.reset();
+    m_structure_hash = 0;
+    m_total_bytes_compact = 0;
+    m_leaves.clear();
+    m_blocks.clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::set(const Schema &schema)
+{
+    reset();
+    schema.compact_to(m_compact_schema);
+    m_structure_hash = schema.structure_hash();
+    m_total_bytes_compact = m_compact_schema.total_bytes_compact();
+
+    add_leaves(schema, m_compact_schema);
+
+    // split large leaves into blocks, so we can copy them in parallel
+    for(size_t i = 0; i < m_leaves.size(); i++)
+    {
+        const Leaf &leaf = m_leaves[i];
+        index_t block_eles = execution::DEFAULT_BLOCK_BYTES / leaf.ele_bytes;
+        if(block_eles < 1)
+        {
+            block_eles = 1;
+        }
+
+        Block block;
+        block.leaf_idx = (index_t) i;
+        for(index_t e = 0; e < leaf.num_eles; e += block_eles)
+        {
+            block.ele_begin = e;
+            block.ele_end   = std::min(e + block_eles, leaf.num_eles);
+            m_blocks.push_back(block);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::add_leaves(const Schema &schema,
+                       const Schema &compact_schema)
+{
+    const DataType &dtype = schema.dtype();
+    if(dtype.is_object() || dtype.is_list())
+    {
+        index_t nchild = schema.number_of_children();
+        for(index_t i = 0; i < nchild; i++)
+        {
+            add_leaves(schema.child(i), compact_schema.child(i));
+        }
+    }
+    else if(detail::is_data_leaf(dtype))
+    {
+        const DataType &c_dtype = compact_schema.dtype();
+        Leaf leaf;
+        leaf.dtype_id    = dtype.id();
+        leaf.endianness  = dtype.endianness();
+        leaf.src_offset  = dtype.offset();
+        leaf.src_stride  = dtype.stride();
+        leaf.ele_bytes   = c_dtype.element_bytes();
+        leaf.num_eles    = dtype.number_of_elements();
+        leaf.dest_offset = c_dtype.offset();
+        m_leaves.push_back(leaf);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool
+LayoutPlan::leaves_match(const Schema &schema,
+                         index_t &leaf_idx) const
+{
+    const DataType &dtype = schema.dtype();
+    if(dtype.is_object() || dtype.is_list())
+    {
+        index_t nchild = schema.number_of_children();
+        for(index_t i = 0; i < nchild; i++)
+        {
+            if(!leaves_match(schema.child(i), leaf_idx))
+            {
+                return false;
+            }
+        }
+    }
+    else if(detail::is_data_leaf(dtype))
+    {
+        if(leaf_idx >= (index_t) m_leaves.size())
+        {
+            return false;
+        }
+
+        const Leaf &leaf = m_leaves[(size_t)leaf_idx];
+        if(leaf.src_offset != dtype.offset() ||
+           !leaf_matches(leaf, dtype))
+        {
+            return false;
+        }
+        leaf_idx++;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+LayoutPlan::leaf_matches(const Leaf &leaf,
+                         const DataType &dtype)
+{
+    // the full dtype (not just the shape) must match, since the plan
+    // copies leaf.ele_bytes per element
+    return leaf.dtype_id   == dtype.id() &&
+           leaf.endianness == dtype.endianness() &&
+           leaf.ele_bytes  == dtype.element_bytes() &&
+           leaf.src_stride == dtype.stride() &&
+           leaf.num_eles   == dtype.number_of_elements();
+}
+
+//---------------------------------------------------------------------------//
+bool
+LayoutPlan::compatible(const Schema &schema) const
+{
+    if(schema.structure_hash() != m_structure_hash)
+    {
+        return false;
+    }
+
+    index_t leaf_idx = 0;
+    return leaves_match(schema, leaf_idx) &&
+           leaf_idx == (index_t) m_leaves.size();
+}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::compact(const Node &src, void *dest) const
+{
+    std::vector<const uint8*>    leaf_ptrs;
+    std::vector<const DataType*> leaf_dtypes;
+    leaf_ptrs.reserve(m_leaves.size());
+    leaf_dtypes.reserve(m_leaves.size());
+    detail::gather_leaf_ptrs(src, leaf_ptrs, leaf_dtypes);
+
+    if(leaf_ptrs.size() != m_leaves.size())
+    {
+        CONDUIT_ERROR("<LayoutPlan::compact> Node has " << leaf_ptrs.size()
+                      << " leaves, but the plan expects "
+                      << m_leaves.size() << " leaves");
+    }
+
+    for(size_t i = 0; i < m_leaves.size(); i++)
+    {
+        const DataType &dtype = *leaf_dtypes[i];
+        const Leaf &leaf = m_leaves[i];
+        if(!leaf_matches(leaf, dtype))
+        {
+            CONDUIT_ERROR("<LayoutPlan::compact> Node leaf " << i
+                          << " does not match the plan (dtype "
+                          << DataType::id_to_name(dtype.id()) << " vs "
+                          << DataType::id_to_name(leaf.dtype_id)
+                          << ", element bytes "
+                          << dtype.element_bytes() << " vs "
+                          << leaf.ele_bytes << ", endianness "
+                          << Endianness::id_to_name(dtype.endianness())
+                          << " vs "
+                          << Endianness::id_to_name(leaf.endianness)
+                          << ", number of elements "
+                          << dtype.number_of_elements() << " vs "
+                          << leaf.num_eles << ", stride "
+                          << dtype.stride() << " vs "
+                          << leaf.src_stride << ")");
+        }
+    }
+
+    execute(leaf_ptrs, (uint8*)dest);
+}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::compact(const void *src, void *dest) const
+{
+    std::vector<const uint8*> leaf_ptrs(m_leaves.size());
+    for(size_t i = 0; i < m_leaves.size(); i++)
+    {
+        leaf_ptrs[i] = ((const uint8*)src) + m_leaves[i].src_offset;
+    }
+    execute(leaf_ptrs, (uint8*)dest);
+}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::compact_to(const Node &src, Node &n_dest) const
+{
+    n_dest.set(m_compact_schema);
+    if(m_total_bytes_compact > 0)
+    {
+        compact(src, n_dest.data_ptr());
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+LayoutPlan::execute(const std::vector<const uint8*> &leaf_ptrs,
+                    uint8 *dest) const
+{
+    const std::vector<Leaf>  &leaves = m_leaves;
+    const std::vector<Block> &blocks = m_blocks;
+
+    execution::for_all(0, (index_t) blocks.size(), [&](index_t i)
+    {
+        const Block &block = blocks[(size_t)i];
+        const Leaf  &leaf  = leaves[(size_t)block.leaf_idx];
+
+        const uint8 *b_src  = leaf_ptrs[(size_t)block.leaf_idx] +
+                              block.ele_begin * leaf.src_stride;
+        uint8       *b_dest = dest + leaf.dest_offset +
+                              block.ele_begin * leaf.ele_bytes;
+
+        // Note: conduit_memcpy_strided_elements will use a single
+        // memcpy when src and dest are compactly strided
+        utils::conduit_memcpy_strided_elements(b_dest,
+                                    (size_t)(block.ele_end - block.ele_begin),
+                                    (size_t)leaf.ele_bytes,
+                                    (size_t)leaf.ele_bytes,
+                                    b_src,
+                                    (size_t)leaf.src_stride);
+    });
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
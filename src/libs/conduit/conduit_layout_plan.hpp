@@ -0,0 +1,145 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_layout_plan.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_LAYOUT_PLAN_HPP
+#define CONDUIT_LAYOUT_PLAN_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+#include "conduit_schema.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+// forward declare Node
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::LayoutPlan --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::LayoutPlan
+///
+/// description:
+///  Precomputed plan for copying the leaves of a tree described by a Schema
+///  into the compact form of that Schema.
+///
+///  The plan holds the source offset and stride and the compact destination
+///  offset of every leaf, with large leaves split into blocks. Executing a
+///  plan is a (parallel, when OpenMP support is enabled) series of memcpys.
+///
+///  A plan can be reused for any tree with the same schema, which avoids
+///  recomputing the layout when same-shaped trees are compacted or
+///  serialized repeatedly (for example: MPI sends or checkpoints).
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API LayoutPlan
+{
+public:
+//-----------------------------------------------------------------------------
+// -- construction and destruction --
+//-----------------------------------------------------------------------------
+    /// create an empty plan
+    LayoutPlan();
+    /// create a plan for the given schema
+    explicit LayoutPlan(const Schema &schema);
+    ~LayoutPlan();
+
+    /// (re)computes the plan for the given schema
+    void            set(const Schema &schema);
+    /// returns the plan to the empty state
+    void            reset();
+
+//-----------------------------------------------------------------------------
+// -- plan info --
+//-----------------------------------------------------------------------------
+    /// the compact form of the planned schema (the destination layout)
+    const Schema   &compact_schema() const
+                        { return m_compact_schema; }
+    /// number of bytes needed to hold the compacted data
+    index_t         total_bytes_compact() const
+                        { return m_total_bytes_compact; }
+    /// number of leaves in the plan
+    index_t         number_of_leaves() const
+                        { return (index_t) m_leaves.size(); }
+    /// true if this plan can be used for data described by the given schema
+    bool            compatible(const Schema &schema) const;
+
+//-----------------------------------------------------------------------------
+// -- plan execution --
+//-----------------------------------------------------------------------------
+    /// compacts the leaves of the given node into dest, which must hold at
+    /// least total_bytes_compact() bytes.
+    /// The node's leaves must match the plan (number of leaves, number of
+    /// elements, and strides), otherwise an error is thrown.
+    void            compact(const Node &src, void *dest) const;
+
+    /// compacts data described by the planned schema (offsets are relative
+    /// to src) into dest, which must hold at least total_bytes_compact()
+    /// bytes.
+    void            compact(const void *src, void *dest) const;
+
+    /// compacts the given node into n_dest (same as Node::compact_to)
+    void            compact_to(const Node &src, Node &n_dest) const;
+
+private:
+    struct Leaf
+    {
+        index_t dtype_id;
+        index_t endianness;
+        index_t src_offset;
+        index_t src_stride;
+        index_t ele_bytes;
+        index_t num_eles;
+        index_t dest_offset;
+    };
+
+    struct Block
+    {
+        index_t leaf_idx;
+        index_t ele_begin;
+        index_t ele_end;
+    };
+
+    void            add_leaves(const Schema &schema,
+                               const Schema &compact_schema);
+    bool            leaves_match(const Schema &schema,
+                                 index_t &leaf_idx) const;
+    static bool     leaf_matches(const Leaf &leaf,
+                                 const DataType &dtype);
+    void            execute(const std::vector<const uint8*> &leaf_ptrs,
+                            uint8 *dest) const;
+
+    Schema              m_compact_schema;
+    uint64              m_structure_hash;
+    index_t             m_total_bytes_compact;
+    std::vector<Leaf>   m_leaves;
+    std::vector<Block>  m_blocks;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::LayoutPlan --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -35,13 +35,35 @@ namespace utils
 namespace log
 {
 
+//-----------------------------------------------------------------------------
+// per thread switch for message recording
+//-----------------------------------------------------------------------------
+static thread_local bool record_messages = true;
+
+//-----------------------------------------------------------------------------
+void
+set_messages_enabled(bool value)
+{
+    record_messages = value;
+}
+
+//-----------------------------------------------------------------------------
+bool
+messages_enabled()
+{
+    return record_messages;
+}
+
 //-----------------------------------------------------------------------------
 void
 info(Node &info,
      const std::string &proto_name,
      const std::string &msg)
 {
-    info["info"].append().set(proto_name + ": " + msg);
+    if(record_messages)
+    {
+        info["info"].append().set(proto_name + ": " + msg);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -50,7 +72,10 @@ optional(Node &info,
          const std::string &proto_name,
          const std::string &msg)
 {
-    info["optional"].append().set(proto_name + ": " + msg);
+    if(record_messages)
+    {
+        info["optional"].append().set(proto_name + ": " + msg);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -59,7 +84,10 @@ error(Node &info,
       const std::string &proto_name,
       const std::string &msg)
 {
-    info["errors"].append().set(proto_name + ": " + msg);
+    if(record_messages)
+    {
+        info["errors"].append().set(proto_name + ": " + msg);
+    }
 }
 
 
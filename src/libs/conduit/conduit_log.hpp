@@ -54,6 +54,19 @@ void CONDUIT_API validation(conduit::Node &info,
                             bool res);
 
 
+//-----------------------------------------------------------------------------
+/// Enables or disables recording of info, optional, and error messages
+/// on the calling thread (messages are enabled by default).
+///
+/// Validation results are always recorded, since verify routines consult
+/// them (for example, to check references between protocols). Disabling
+/// messages is useful when only the bool result of a verify is needed.
+//-----------------------------------------------------------------------------
+void CONDUIT_API set_messages_enabled(bool value);
+
+//-----------------------------------------------------------------------------
+bool CONDUIT_API messages_enabled();
+
 //-----------------------------------------------------------------------------
 void CONDUIT_API remove_valid(conduit::Node &info);
 //-----------------------------------------------------------------------------
@@ -27,8 +27,10 @@
 // -- standard cpp lib includes --
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <map>
+#include <type_traits>
 
 //-----------------------------------------------------------------------------
 // -- standard c lib includes --
@@ -45,6 +47,8 @@
 // -- conduit includes --
 //-----------------------------------------------------------------------------
 #include "conduit_error.hpp"
+#include "conduit_execution.hpp"
+#include "conduit_layout_plan.hpp"
 #include "conduit_utils.hpp"
 
 // Easier access to the Conduit logging functions
@@ -78,6 +82,637 @@ using namespace conduit::utils;
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// reads the options accepted by the options variants of
+// Node::diff and Node::diff_compatible
+//---------------------------------------------------------------------------//
+void
+parse_diff_options(const Node &opts,
+                   float64 &epsilon,
+                   bool &relaxint,
+                   index_t &max_diffs)
+{
+    if(opts.has_child("epsilon") &&
+       opts["epsilon"].dtype().is_number())
+    {
+        epsilon = opts["epsilon"].to_float64();
+    }
+
+    if(opts.has_child("relaxint"))
+    {
+        const Node &n_relaxint = opts["relaxint"];
+        if(n_relaxint.dtype().is_string())
+        {
+            relaxint = n_relaxint.as_string() == "true";
+        }
+        else if(n_relaxint.dtype().is_number())
+        {
+            relaxint = n_relaxint.to_int() != 0;
+        }
+    }
+
+    if(opts.has_child("max_diffs") &&
+       opts["max_diffs"].dtype().is_number())
+    {
+        max_diffs = opts["max_diffs"].to_index_t();
+    }
+
+    // zero or negative values mean no limit
+    if(max_diffs <= 0)
+    {
+        max_diffs = -1;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+log_diff_stopped(Node &info,
+                 const std::string &protocol,
+                 index_t max_diffs)
+{
+    std::ostringstream oss;
+    oss << "comparison stopped after finding max_diffs ("
+        << max_diffs << ") differences";
+    log::info(info, protocol, oss.str());
+}
+
+//---------------------------------------------------------------------------//
+// compares two arrays of values of type T in the element range
+// [ele_begin, ele_end). floating point values are considered equal if their
+// difference is within epsilon (matching the DataArray::diff rules).
+//---------------------------------------------------------------------------//
+template <typename T>
+bool
+leaf_values_equal(const uint8 *t_ptr,
+                  index_t t_stride,
+                  const uint8 *n_ptr,
+                  index_t n_stride,
+                  index_t ele_begin,
+                  index_t ele_end,
+                  float64 epsilon)
+{
+    const index_t ele_bytes = (index_t) sizeof(T);
+    const index_t num_eles  = ele_end - ele_begin;
+    const bool    is_float  = std::is_floating_point<T>::value;
+
+    const uint8 *t_start = t_ptr + ele_begin * t_stride;
+    const uint8 *n_start = n_ptr + ele_begin * n_stride;
+
+    if(t_stride == ele_bytes && n_stride == ele_bytes)
+    {
+        // bitwise identical values are always equal
+        if(memcmp(t_start, n_start, (size_t)(num_eles * ele_bytes)) == 0)
+        {
+            return true;
+        }
+
+        if(!is_float)
+        {
+            return false;
+        }
+
+        // epsilon aware compare, done in fixed size chunks w/o early exit
+        // so the inner loop can be vectorized by the compiler
+        const T *t_vals = (const T*) t_start;
+        const T *n_vals = (const T*) n_start;
+        const index_t chunk_size = 256;
+
+        for(index_t i = 0; i < num_eles; i += chunk_size)
+        {
+            index_t i_end = std::min(i + chunk_size, num_eles);
+            bool chunk_diff = false;
+            for(index_t j = i; j < i_end; j++)
+            {
+                T d = t_vals[j] - n_vals[j];
+                chunk_diff = chunk_diff | (d > epsilon) | (d < -epsilon);
+            }
+
+            if(chunk_diff)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // strided case
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        T t_val = *(const T*)(t_start + i * t_stride);
+        T n_val = *(const T*)(n_start + i * n_stride);
+
+        if(is_float)
+        {
+            T d = t_val - n_val;
+            if(d > epsilon || d < -epsilon)
+            {
+                return false;
+            }
+        }
+        else if(t_val != n_val)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Implements Node::equals and Node::equals_compatible.
+//
+// The comparison happens in two phases:
+//  1) the hierarchies are walked and compared (names, dtypes, number of
+//     elements, strings) and the leaf data comparisons are recorded as
+//     tasks, leaves with lots of data are split into several tasks.
+//  2) the tasks are executed (in parallel if OpenMP support is enabled).
+//
+// Both phases stop as soon as a difference is found.
+//---------------------------------------------------------------------------//
+class NodeEquals
+{
+public:
+    NodeEquals(float64 epsilon, bool relaxint, bool compatible)
+    : m_epsilon(epsilon),
+      m_relaxint(relaxint),
+      m_compatible(compatible)
+    {}
+
+    bool execute(const Node &t, const Node &n)
+    {
+        m_tasks.clear();
+        if(!compare_structure(t,n))
+        {
+            return false;
+        }
+        return compare_leaf_data();
+    }
+
+private:
+    struct LeafTask
+    {
+        const uint8 *t_ptr;
+        const uint8 *n_ptr;
+        index_t      t_stride;
+        index_t      n_stride;
+        index_t      dtype_id;
+        index_t      ele_begin;
+        index_t      ele_end;
+    };
+
+    //-------------------------------------------------------------------------
+    bool compare_structure(const Node &t, const Node &n)
+    {
+        const DataType &t_dtype = t.dtype();
+        const DataType &n_dtype = n.dtype();
+        index_t t_dtid = t_dtype.id();
+        index_t n_dtid = n_dtype.id();
+
+        if(t_dtid != n_dtid)
+        {
+            if(!m_relaxint)
+            {
+                return false;
+            }
+
+            // match diff's rules for integers of different sizes
+            if(t_dtype.is_signed_integer() && n_dtype.is_signed_integer())
+                return t.to_int64() == n.to_int64();
+            else if(t_dtype.is_unsigned_integer() && n_dtype.is_unsigned_integer())
+                return t.to_uint64() == n.to_uint64();
+            else if(t_dtype.is_integer() && n_dtype.is_integer())
+                return t.to_int64() == n.to_int64();
+
+            return false;
+        }
+        else if(t_dtid == DataType::EMPTY_ID)
+        {
+            return true;
+        }
+        else if(t_dtid == DataType::OBJECT_ID)
+        {
+            index_t t_nchild = t.number_of_children();
+            if(!m_compatible && t_nchild != n.number_of_children())
+            {
+                return false;
+            }
+
+            // names are unique, so if the number of children matches
+            // and all of our children exist in n, the name sets match
+            NodeConstIterator itr = t.children();
+            while(itr.has_next())
+            {
+                const Node &t_child = itr.next();
+                const std::string &name = itr.name();
+                if(!n.has_child(name) ||
+                   !compare_structure(t_child, n.child(name)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        else if(t_dtid == DataType::LIST_ID)
+        {
+            index_t t_nchild = t.number_of_children();
+            index_t n_nchild = n.number_of_children();
+
+            if( (m_compatible && t_nchild > n_nchild) ||
+                (!m_compatible && t_nchild != n_nchild) )
+            {
+                return false;
+            }
+
+            for(index_t i = 0; i < t_nchild; i++)
+            {
+                if(!compare_structure(t.child(i), n.child(i)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        else if(t_dtype.is_char8_str())
+        {
+            return compare_strings(t,n);
+        }
+        else if(t_dtype.is_number())
+        {
+            index_t t_nele = t_dtype.number_of_elements();
+            index_t n_nele = n_dtype.number_of_elements();
+
+            if( (m_compatible && t_nele > n_nele) ||
+                (!m_compatible && t_nele != n_nele) )
+            {
+                return false;
+            }
+
+            add_leaf_tasks(t, n, t_nele);
+            return true;
+        }
+
+        CONDUIT_ERROR("<Node::equals> unrecognized data type");
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    // strings follow the diff rules: the null terminator is not considered
+    bool compare_strings(const Node &t, const Node &n)
+    {
+        index_t t_len = t.dtype().number_of_elements();
+        index_t n_len = n.dtype().number_of_elements();
+
+        if(t_len > 1)
+        {
+            t_len--;
+        }
+
+        if(n_len > 1)
+        {
+            n_len--;
+        }
+
+        if(t_len != n_len)
+        {
+            return false;
+        }
+
+        for(index_t i = 0; i < t_len; i++)
+        {
+            if( *(const char*)t.element_ptr(i) !=
+                *(const char*)n.element_ptr(i) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    void add_leaf_tasks(const Node &t, const Node &n, index_t num_eles)
+    {
+        if(num_eles == 0)
+        {
+            return;
+        }
+
+        LeafTask task;
+        task.t_ptr    = (const uint8*) t.element_ptr(0);
+        task.n_ptr    = (const uint8*) n.element_ptr(0);
+        task.t_stride = t.dtype().stride();
+        task.n_stride = n.dtype().stride();
+        task.dtype_id = t.dtype().id();
+
+        index_t block_eles = execution::DEFAULT_BLOCK_BYTES /
+                             t.dtype().element_bytes();
+        if(block_eles < 1)
+        {
+            block_eles = 1;
+        }
+
+        for(index_t i = 0; i < num_eles; i += block_eles)
+        {
+            task.ele_begin = i;
+            task.ele_end   = std::min(i + block_eles, num_eles);
+            m_tasks.push_back(task);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    bool compare_leaf_data()
+    {
+        std::atomic<bool> found_diff(false);
+        const float64 epsilon = m_epsilon;
+        const std::vector<LeafTask> &tasks = m_tasks;
+
+        execution::for_all(0, (index_t)tasks.size(), [&](index_t i)
+        {
+            if(found_diff.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            if(!execute_task(tasks[(size_t)i], epsilon))
+            {
+                found_diff.store(true, std::memory_order_relaxed);
+            }
+        });
+
+        return !found_diff.load();
+    }
+
+    //-------------------------------------------------------------------------
+    static bool execute_task(const LeafTask &task, float64 epsilon)
+    {
+        switch(task.dtype_id)
+        {
+            case DataType::INT8_ID:
+                return leaf_values_equal<int8>(task.t_ptr, task.t_stride,
+                                               task.n_ptr, task.n_stride,
+                                               task.ele_begin, task.ele_end,
+                                               epsilon);
+            case DataType::INT16_ID:
+                return leaf_values_equal<int16>(task.t_ptr, task.t_stride,
+                                                task.n_ptr, task.n_stride,
+                                                task.ele_begin, task.ele_end,
+                                                epsilon);
+            case DataType::INT32_ID:
+                return leaf_values_equal<int32>(task.t_ptr, task.t_stride,
+                                                task.n_ptr, task.n_stride,
+                                                task.ele_begin, task.ele_end,
+                                                epsilon);
+            case DataType::INT64_ID:
+                return leaf_values_equal<int64>(task.t_ptr, task.t_stride,
+                                                task.n_ptr, task.n_stride,
+                                                task.ele_begin, task.ele_end,
+                                                epsilon);
+            case DataType::UINT8_ID:
+                return leaf_values_equal<uint8>(task.t_ptr, task.t_stride,
+                                                task.n_ptr, task.n_stride,
+                                                task.ele_begin, task.ele_end,
+                                                epsilon);
+            case DataType::UINT16_ID:
+                return leaf_values_equal<uint16>(task.t_ptr, task.t_stride,
+                                                 task.n_ptr, task.n_stride,
+                                                 task.ele_begin, task.ele_end,
+                                                 epsilon);
+            case DataType::UINT32_ID:
+                return leaf_values_equal<uint32>(task.t_ptr, task.t_stride,
+                                                 task.n_ptr, task.n_stride,
+                                                 task.ele_begin, task.ele_end,
+                                                 epsilon);
+            case DataType::UINT64_ID:
+                return leaf_values_equal<uint64>(task.t_ptr, task.t_stride,
+                                                 task.n_ptr, task.n_stride,
+                                                 task.ele_begin, task.ele_end,
+                                                 epsilon);
+            case DataType::FLOAT32_ID:
+                return leaf_values_equal<float32>(task.t_ptr, task.t_stride,
+                                                  task.n_ptr, task.n_stride,
+                                                  task.ele_begin, task.ele_end,
+                                                  epsilon);
+            case DataType::FLOAT64_ID:
+                return leaf_values_equal<float64>(task.t_ptr, task.t_stride,
+                                                  task.n_ptr, task.n_stride,
+                                                  task.ele_begin, task.ele_end,
+                                                  epsilon);
+            default:
+                break;
+        }
+        return false;
+    }
+
+    float64               m_epsilon;
+    bool                  m_relaxint;
+    bool                  m_compatible;
+    std::vector<LeafTask> m_tasks;
+};
+
+//---------------------------------------------------------------------------//
+// Implements Node::content_hash.
+//
+// Like NodeEquals, the hash is computed in two phases:
+//  1) the hierarchy is walked and the leaf data is split into fixed size
+//     blocks (recorded as tasks).
+//  2) the block hashes are computed (in parallel if OpenMP support is
+//     enabled).
+//
+// The hash of a leaf combines its structure hash with the hashes of its
+// blocks, the hash of an object or list combines the hashes (and names)
+// of its children, in order. Strided leaves are compacted block by block
+// before hashing, so the result does not depend on the memory layout.
+//---------------------------------------------------------------------------//
+class NodeContentHash
+{
+public:
+    NodeContentHash()
+    {}
+
+    uint64 execute(const Node &node, Node *hashes)
+    {
+        m_tasks.clear();
+        m_block_hashes.clear();
+
+        collect_tasks(node);
+        hash_blocks();
+
+        index_t task_idx = 0;
+        return combine(node, task_idx, hashes, "");
+    }
+
+private:
+    struct BlockTask
+    {
+        const uint8 *ptr;
+        index_t      stride;
+        index_t      ele_bytes;
+        index_t      ele_begin;
+        index_t      ele_end;
+    };
+
+    //-------------------------------------------------------------------------
+    void collect_tasks(const Node &node)
+    {
+        const DataType &dtype = node.dtype();
+        index_t dt_id = dtype.id();
+
+        if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+        {
+            index_t nchild = node.number_of_children();
+            for(index_t i = 0; i < nchild; i++)
+            {
+                collect_tasks(node.child(i));
+            }
+        }
+        else if(dt_id != DataType::EMPTY_ID)
+        {
+            index_t num_eles = dtype.number_of_elements();
+            if(num_eles == 0)
+            {
+                return;
+            }
+
+            BlockTask task;
+            task.ptr       = (const uint8*) node.element_ptr(0);
+            task.stride    = dtype.stride();
+            task.ele_bytes = dtype.element_bytes();
+
+            index_t block_eles = execution::DEFAULT_BLOCK_BYTES /
+                                 task.ele_bytes;
+            if(block_eles < 1)
+            {
+                block_eles = 1;
+            }
+
+            for(index_t i = 0; i < num_eles; i += block_eles)
+            {
+                task.ele_begin = i;
+                task.ele_end   = std::min(i + block_eles, num_eles);
+                m_tasks.push_back(task);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void hash_blocks()
+    {
+        const std::vector<BlockTask> &tasks = m_tasks;
+        m_block_hashes.resize(tasks.size());
+        uint64 *block_hashes = m_block_hashes.empty() ? NULL
+                                                      : &m_block_hashes[0];
+
+        execution::for_all(0, (index_t)tasks.size(), [&](index_t i)
+        {
+            const BlockTask &task = tasks[(size_t)i];
+            index_t num_eles  = task.ele_end - task.ele_begin;
+            index_t num_bytes = num_eles * task.ele_bytes;
+            const uint8 *start = task.ptr + task.ele_begin * task.stride;
+
+            if(task.stride == task.ele_bytes)
+            {
+                block_hashes[i] = utils::hash64(start, num_bytes);
+            }
+            else
+            {
+                std::vector<uint8> compact((size_t)num_bytes);
+                utils::conduit_memcpy_strided_elements(&compact[0],
+                                                       (size_t)num_eles,
+                                                       (size_t)task.ele_bytes,
+                                                       (size_t)task.ele_bytes,
+                                                       start,
+                                                       (size_t)task.stride);
+                block_hashes[i] = utils::hash64(&compact[0], num_bytes);
+            }
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    // combines the block hashes into the tree hash, visiting the nodes
+    // in the same order as collect_tasks
+    uint64 combine(const Node &node,
+                   index_t &task_idx,
+                   Node *hashes,
+                   const std::string &path)
+    {
+        const DataType &dtype = node.dtype();
+        index_t dt_id = dtype.id();
+        uint64 res = 0;
+
+        if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+        {
+            res = utils::hash64(&dt_id, sizeof(index_t));
+            index_t nchild = node.number_of_children();
+            std::vector<std::string> names;
+            if(dt_id == DataType::OBJECT_ID)
+            {
+                names = node.child_names();
+            }
+
+            for(index_t i = 0; i < nchild; i++)
+            {
+                std::ostringstream oss;
+                if(dt_id == DataType::OBJECT_ID)
+                {
+                    const std::string &name = names[(size_t)i];
+                    res = utils::hash64_combine(res, utils::hash64(name));
+                    oss << name;
+                }
+                else
+                {
+                    oss << i;
+                }
+
+                std::string child_path = path.empty() ? oss.str()
+                                                      : path + "/" + oss.str();
+                res = utils::hash64_combine(res,
+                                            combine(node.child(i),
+                                                    task_idx,
+                                                    hashes,
+                                                    child_path));
+            }
+        }
+        else
+        {
+            res = node.schema().structure_hash();
+            if(dt_id != DataType::EMPTY_ID)
+            {
+                index_t num_eles = dtype.number_of_elements();
+                index_t num_tasks = (index_t) m_tasks.size();
+                index_t eles_done = 0;
+                while(eles_done < num_eles && task_idx < num_tasks)
+                {
+                    res = utils::hash64_combine(res,
+                                    m_block_hashes[(size_t)task_idx]);
+                    eles_done = m_tasks[(size_t)task_idx].ele_end;
+                    task_idx++;
+                }
+            }
+        }
+
+        if(hashes != NULL && !path.empty())
+        {
+            hashes->add_child(path).set_uint64(res);
+        }
+
+        return res;
+    }
+
+    std::vector<BlockTask> m_tasks;
+    std::vector<uint64>    m_block_hashes;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -112,6 +747,16 @@ Node::Node(const Node &node)
     set(node);
 }
 
+//---------------------------------------------------------------------------//
+Node::Node(Node &&node)
+{
+    init_defaults();
+    index_t src_allocator_id = node.m_allocator_id;
+    swap(node);
+    // the moved from node keeps its allocator selection
+    node.m_allocator_id = src_allocator_id;
+}
+
 //---------------------------------------------------------------------------//
 Node::~Node()
 {
@@ -126,6 +771,116 @@ Node::reset()
     m_schema->set(DataType::EMPTY_ID);
 }
 
+//-----------------------------------------------------------------------------
+// -- ownership transfer --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::swap(Node &node)
+{
+    if(this == &node)
+    {
+        return;
+    }
+
+    for(const Node *p = m_parent; p != NULL; p = p->m_parent)
+    {
+        if(p == &node)
+        {
+            CONDUIT_ERROR("<Node::swap> Cannot swap Node("
+                          << path() << ") with its ancestor Node("
+                          << node.path() << ")");
+        }
+    }
+
+    for(const Node *p = node.m_parent; p != NULL; p = p->m_parent)
+    {
+        if(p == this)
+        {
+            CONDUIT_ERROR("<Node::swap> Cannot swap Node("
+                          << path() << ") with its descendant Node("
+                          << node.path() << ")");
+        }
+    }
+
+    // our schema pointers may be owned by our parents, so we exchange
+    // the schema contents instead of the schema pointers
+    m_schema->swap(*node.m_schema);
+
+    std::swap(m_children, node.m_children);
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->m_parent = this;
+    }
+
+    for(size_t i = 0; i < node.m_children.size(); i++)
+    {
+        node.m_children[i]->m_parent = &node;
+    }
+
+    std::swap(m_data, node.m_data);
+    std::swap(m_data_size, node.m_data_size);
+    std::swap(m_alloced, node.m_alloced);
+    std::swap(m_mmaped, node.m_mmaped);
+    std::swap(m_mmap, node.m_mmap);
+    std::swap(m_allocator_id, node.m_allocator_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::steal(Node &node)
+{
+    if(this == &node)
+    {
+        return;
+    }
+
+    for(const Node *p = m_parent; p != NULL; p = p->m_parent)
+    {
+        if(p == &node)
+        {
+            CONDUIT_ERROR("<Node::steal> Node(" << path() << ") cannot"
+                          " steal the contents of its ancestor Node("
+                          << node.path() << ")");
+        }
+    }
+
+    index_t src_allocator_id = node.m_allocator_id;
+
+    // detach the contents of the given node first, which also supports
+    // stealing from one of our descendants
+    Node contents;
+    contents.swap(node);
+    node.m_allocator_id = src_allocator_id;
+
+    // our old contents are released when `contents` goes out of scope
+    swap(contents);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::adopt(const Schema &schema,
+            void *data,
+            index_t allocator_id)
+{
+    reset();
+    m_allocator_id = allocator_id;
+    m_schema->set(schema);
+    walk_schema(this,m_schema,data,m_allocator_id);
+    m_data_size = m_schema->spanned_bytes();
+    m_alloced   = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::adopt(const DataType &dtype,
+            void *data,
+            index_t allocator_id)
+{
+    adopt(Schema(dtype),data,allocator_id);
+}
+
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
 //-----------------------------------------------------------------------------
@@ -7386,6 +8141,43 @@ Node::operator=(const Node &node)
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(Node &&node)
+{
+    if(this == &node)
+    {
+        return *this;
+    }
+
+    if(m_allocator_id == node.m_allocator_id)
+    {
+        steal(node);
+    }
+    else
+    {
+        for(const Node *p = m_parent; p != NULL; p = p->m_parent)
+        {
+            if(p == &node)
+            {
+                CONDUIT_ERROR("<Node::operator=> Cannot move assign Node("
+                              << node.path() << ") into its descendant Node("
+                              << path() << ")");
+            }
+        }
+
+        // keep our allocator selection: detach the given node's contents
+        // first (the given node may be one of our descendants, which the
+        // copy below destroys), then copy into memory from our allocator
+        index_t src_allocator_id = node.m_allocator_id;
+        Node contents;
+        contents.swap(node);
+        node.m_allocator_id = src_allocator_id;
+        set(contents);
+    }
+    return *this;
+}
+
 //---------------------------------------------------------------------------//
 Node &
 Node::operator=(const DataType &dtype)
@@ -8422,8 +9214,12 @@ Node::operator=(const std::initializer_list<double> &data);
 void
 Node::serialize(std::vector<uint8> &data) const
 {
-    data = std::vector<uint8>((size_t)total_bytes_compact(),0);
-    serialize(&data[0],0);
+    LayoutPlan plan(*m_schema);
+    data = std::vector<uint8>((size_t)plan.total_bytes_compact(),0);
+    if(!data.empty())
+    {
+        plan.compact(*this,&data[0]);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -8478,13 +9274,37 @@ Node::serialize(std::ofstream &ofs) const
     }
 }
 
-//-----------------------------------------------------------------------------
-// -- compaction methods ---
-//-----------------------------------------------------------------------------
-
+//-----------------------------------------------------------------------------
+// -- compaction methods ---
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::compact_to(Node &n_dest) const
+{
+    n_dest.reset();
+    LayoutPlan plan(*m_schema);
+    index_t c_size = plan.total_bytes_compact();
+
+    // avoid allocation for zero-bytes cases
+    if(c_size > 0)
+    {
+        n_dest.allocate(c_size);
+    }
+
+    n_dest.schema_ptr()->set(plan.compact_schema());
+    uint8 *n_dest_data = (uint8*)n_dest.m_data;
+    if(c_size > 0)
+    {
+        plan.compact(*this,n_dest_data);
+    }
+    // need node structure
+    walk_schema(&n_dest,n_dest.m_schema,n_dest_data,m_allocator_id);
+}
+
 //---------------------------------------------------------------------------//
 void
-Node::compact_to(Node &n_dest) const
+Node::compact_to(Node &n_dest, index_t endianness) const
 {
     n_dest.reset();
     index_t c_size = total_bytes_compact();
@@ -8497,9 +9317,15 @@ Node::compact_to(Node &n_dest) const
 
     m_schema->compact_to(*n_dest.schema_ptr());
     uint8 *n_dest_data = (uint8*)n_dest.m_data;
-    compact_to(n_dest_data,0);
     // need node structure
     walk_schema(&n_dest,n_dest.m_schema,n_dest_data,m_allocator_id);
+
+    if(endianness == Endianness::DEFAULT_ID)
+    {
+        endianness = Endianness::machine_default();
+    }
+
+    compact_elements_to(n_dest, endianness);
 }
 
 //-----------------------------------------------------------------------------
@@ -8737,23 +9563,14 @@ Node::endian_swap(index_t endianness)
             dest_endian = Endianness::machine_default();
         }
 
-        if(src_endian != dest_endian)
+        if(src_endian != dest_endian &&
+           num_ele > 0 &&
+           (ele_bytes == 2 || ele_bytes == 4 || ele_bytes == 8))
         {
-            if(ele_bytes == 2)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap16(element_ptr(i));
-            }
-            else if(ele_bytes == 4)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap32(element_ptr(i));
-            }
-            else if(ele_bytes == 8)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap64(element_ptr(i));
-            }
+            Endianness::swap(element_ptr(0),
+                             num_ele,
+                             ele_bytes,
+                             dtype().stride());
         }
 
         m_schema->dtype().set_endianness(dest_endian);
@@ -13696,6 +14513,96 @@ Node::describe(const Node &opts, Node &res) const
 
 // NOTE: several other Node information methods are inlined in Node.h
 
+//---------------------------------------------------------------------------//
+bool
+Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) const
+{
+    index_t diffs_left = -1;
+    return diff(n, info, epsilon, relaxint, false, diffs_left);
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::diff(const Node &n, Node &info, const Node &opts) const
+{
+    float64 epsilon   = CONDUIT_EPSILON;
+    bool    relaxint  = false;
+    index_t max_diffs = -1;
+    detail::parse_diff_options(opts, epsilon, relaxint, max_diffs);
+
+    index_t diffs_left = max_diffs;
+    bool res = diff(n, info, epsilon, relaxint, false, diffs_left);
+
+    if(diffs_left == 0)
+    {
+        detail::log_diff_stopped(info, "node::diff", max_diffs);
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::diff_compatible(const Node &n,
+                      Node &info,
+                      const float64 epsilon,
+                      bool relaxint) const
+{
+    index_t diffs_left = -1;
+    return diff(n, info, epsilon, relaxint, true, diffs_left);
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::diff_compatible(const Node &n, Node &info, const Node &opts) const
+{
+    float64 epsilon   = CONDUIT_EPSILON;
+    bool    relaxint  = false;
+    index_t max_diffs = -1;
+    detail::parse_diff_options(opts, epsilon, relaxint, max_diffs);
+
+    index_t diffs_left = max_diffs;
+    bool res = diff(n, info, epsilon, relaxint, true, diffs_left);
+
+    if(diffs_left == 0)
+    {
+        detail::log_diff_stopped(info, "node::diff_compatible", max_diffs);
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::equals(const Node &n, const float64 epsilon, bool relaxint) const
+{
+    return detail::NodeEquals(epsilon, relaxint, false).execute(*this, n);
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::equals_compatible(const Node &n,
+                        const float64 epsilon,
+                        bool relaxint) const
+{
+    return detail::NodeEquals(epsilon, relaxint, true).execute(*this, n);
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Node::content_hash() const
+{
+    return detail::NodeContentHash().execute(*this, NULL);
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Node::content_hash(Node &hashes) const
+{
+    hashes.reset();
+    return detail::NodeContentHash().execute(*this, &hashes);
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::info(Node &res) const
@@ -17088,6 +17995,52 @@ Node::compact_elements_to(uint8 *data) const
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::compact_elements_to(Node &n_dest, index_t endianness) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        for(size_t i = 0; i < m_children.size(); i++)
+        {
+            m_children[i]->compact_elements_to(*n_dest.m_children[i],
+                                               endianness);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        index_t num_ele   = dtype().number_of_elements();
+        index_t ele_bytes = DataType::default_bytes(dtype_id);
+        index_t src_endian = dtype().endianness();
+
+        if(src_endian == Endianness::DEFAULT_ID)
+        {
+            src_endian = Endianness::machine_default();
+        }
+
+        if(src_endian != endianness &&
+           num_ele > 0 &&
+           (ele_bytes == 2 || ele_bytes == 4 || ele_bytes == 8))
+        {
+            // single pass copy + swap
+            Endianness::copy_and_swap(element_ptr(0),
+                                      n_dest.element_ptr(0),
+                                      num_ele,
+                                      ele_bytes,
+                                      dtype().stride(),
+                                      ele_bytes);
+        }
+        else
+        {
+            compact_elements_to((uint8*)n_dest.element_ptr(0));
+        }
+
+        n_dest.m_schema->dtype().set_endianness(endianness);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::serialize(uint8 *data,index_t curr_offset) const
@@ -17318,9 +18271,15 @@ Node::find_first_data_ptr() const
 
 //---------------------------------------------------------------------------//
 bool
-Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) const
-{
-    const std::string protocol = "node::diff";
+Node::diff(const Node &n,
+           Node &info,
+           const float64 epsilon,
+           bool relaxint,
+           bool compatible,
+           index_t &diffs_left) const
+{
+    const std::string protocol = compatible ? "node::diff_compatible" :
+                                              "node::diff";
     bool res = false;
     info.reset();
 
@@ -17347,12 +18306,14 @@ Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) cons
         if(res)
         {
             std::ostringstream oss;
-            oss << "data type mismatch ("
+            oss << (compatible ? "data type incompatibility ("
+                               : "data type mismatch (")
                 << dtype().name()
                 << " vs "
                 << n.dtype().name()
                 << ")";
             log::error(info, protocol, oss.str());
+            diffs_left--;
         }
     }
     else if(t_dtid == DataType::EMPTY_ID)
@@ -17365,7 +18326,7 @@ Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) cons
 
         NodeConstIterator child_itr;
         child_itr = children();
-        while(child_itr.has_next())
+        while(child_itr.has_next() && diffs_left != 0)
         {
             const conduit::Node &t_child = child_itr.next();
             const std::string child_path = child_itr.name();
@@ -17374,29 +18335,35 @@ Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) cons
             {
                 info_children["extra"].append().set(child_path);
                 res = true;
+                diffs_left--;
             }
             else
             {
                 Node &info_child = info_children["diff"].add_child(child_path);
-                res |= t_child.diff(n.child(child_path), info_child, epsilon, relaxint);
+                res |= t_child.diff(n.child(child_path),
+                                    info_child,
+                                    epsilon,
+                                    relaxint,
+                                    compatible,
+                                    diffs_left);
             }
         }
 
-        child_itr = n.children();
-        while(child_itr.has_next())
+        if(!compatible)
         {
-            const conduit::Node &n_child = child_itr.next();
-            const std::string child_path = child_itr.name();
-
-            if(!has_child(child_path))
-            {
-                info_children["missing"].append().set(child_path);
-                res = true;
-            }
-            else
+            child_itr = n.children();
+            while(child_itr.has_next() && diffs_left != 0)
             {
-                Node &info_child = info_children["diff"].add_child(child_path);
-                res |= child(child_path).diff(n_child, info_child, epsilon, relaxint);
+                child_itr.next();
+                const std::string child_path = child_itr.name();
+
+                if(!has_child(child_path))
+                {
+                    info_children["missing"].append().set(child_path);
+                    res = true;
+                    diffs_left--;
+                }
+                // children present in both were compared above
             }
         }
     }
@@ -17408,80 +18375,100 @@ Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) cons
         index_t n_nchild = n.number_of_children();
 
         index_t i = 0;
-        for(; i < std::min(t_nchild, n_nchild); i++)
+        for(; i < std::min(t_nchild, n_nchild) && diffs_left != 0; i++)
         {
             const Node &t_child = child(i);
             const Node &n_child = n.child(i);
-            res |= t_child.diff(n_child, info_children["diff"].append(), epsilon, relaxint);
+            res |= t_child.diff(n_child,
+                                info_children["diff"].append(),
+                                epsilon,
+                                relaxint,
+                                compatible,
+                                diffs_left);
         }
-        for(; i < std::max(t_nchild, n_nchild); i++)
+
+        index_t nchild_max = compatible ? t_nchild :
+                                          std::max(t_nchild, n_nchild);
+        for(; i < nchild_max && diffs_left != 0; i++)
         {
             const std::string diff_type = (i >= t_nchild) ? "missing" : "extra";
             info_children[diff_type].append().set(i);
             res = true;
+            diffs_left--;
         }
     }
     else // leaf node
     {
+        bool leaf_res = false;
         if(dtype().is_int8())
         {
             int8_array t_array = value();
             int8_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_int16())
         {
             int16_array t_array = value();
             int16_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_int32())
         {
             int32_array t_array = value();
             int32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_int64())
         {
             int64_array t_array = value();
             int64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_uint8())
         {
             uint8_array t_array = value();
             uint8_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_uint16())
         {
             uint16_array t_array = value();
             uint16_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_uint32())
         {
             uint32_array t_array = value();
             uint32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_uint64())
         {
             uint64_array t_array = value();
             uint64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_float32())
         {
             float32_array t_array = value();
             float32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_float64())
         {
             float64_array t_array = value();
             float64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else if(dtype().is_char8_str())
         {
@@ -17489,180 +18476,20 @@ Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) cons
             // confuse the 'char' type on various platforms.
             char_array t_array((const void*)m_data, dtype());
             char_array n_array((const void*)n.m_data, n.dtype());
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else
-        {
-            CONDUIT_ERROR("<Node::diff> unrecognized data type");
-            res = true;
-        }
-    }
-
-    log::validation(info, !res);
-
-    return res;
-}
-
-//---------------------------------------------------------------------------//
-bool
-Node::diff_compatible(const Node &n, Node &info, const float64 epsilon,
-    bool relaxint) const
-{
-    const std::string protocol = "node::diff_compatible";
-    bool res = false;
-    info.reset();
-
-    index_t t_dtid  = dtype().id();
-    index_t n_dtid  = n.dtype().id();
-
-    if(t_dtid != n_dtid)
-    {
-        // We ought to be able to compare integers of different sizes.
-        if(relaxint)
-        {
-            if(dtype().is_signed_integer() && n.dtype().is_signed_integer())
-                res = to_int64() != n.to_int64();
-            else if(dtype().is_unsigned_integer() && n.dtype().is_unsigned_integer())
-                res = to_uint64() != n.to_uint64();
-            else if(dtype().is_integer() && n.dtype().is_integer())
-                res = to_int64() != n.to_int64();
-            else
-                res = true;
+            leaf_res = compatible ? t_array.diff_compatible(n_array, info, epsilon) :
+                                    t_array.diff(n_array, info, epsilon);
         }
         else
-            res = true;
-
-        if(res)
-        {
-            std::ostringstream oss;
-            oss << "data type incompatibility ("
-                << dtype().name()
-                << " vs "
-                << n.dtype().name()
-                << ")";
-            log::error(info, protocol, oss.str());
-        }
-    }
-    else if(t_dtid == DataType::EMPTY_ID)
-    {
-        // no-op; empty nodes cannot have differences
-    }
-    else if(t_dtid == DataType::OBJECT_ID)
-    {
-        Node &info_children = info["children"];
-
-        NodeConstIterator child_itr = children();
-        while(child_itr.has_next())
         {
-            const conduit::Node &t_child = child_itr.next();
-            const std::string child_path = child_itr.name();
-
-            if(!n.has_child(child_path))
-            {
-                info_children["extra"].append().set(child_path);
-                res = true;
-            }
-            else
-            {
-                Node &info_child = info_children["diff"].add_child(child_path);
-                res |= t_child.diff_compatible(n.child(child_path), info_child, epsilon, relaxint);
-            }
+            CONDUIT_ERROR("<Node::" << (compatible ? "diff_compatible" : "diff")
+                          << "> unrecognized data type");
+            leaf_res = true;
         }
-    }
-    else if(t_dtid == DataType::LIST_ID)
-    {
-        Node &info_children = info["children"];
 
-        index_t t_nchild = number_of_children();
-        index_t n_nchild = n.number_of_children();
-
-        index_t i = 0;
-        for(; i < std::min(t_nchild, n_nchild); i++)
-        {
-            const Node &t_child = child(i);
-            const Node &n_child = n.child(i);
-            res |= t_child.diff_compatible(n_child, info_children["diff"].append(), epsilon, relaxint);
-        }
-        for(; i < t_nchild; i++)
-        {
-            info_children["extra"].append().set(i);
-            res = true;
-        }
-    }
-    else // leaf node
-    {
-        if(dtype().is_int8())
-        {
-            int8_array t_array = value();
-            int8_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_int16())
-        {
-            int16_array t_array = value();
-            int16_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_int32())
-        {
-            int32_array t_array = value();
-            int32_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_int64())
-        {
-            int64_array t_array = value();
-            int64_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint8())
-        {
-            uint8_array t_array = value();
-            uint8_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint16())
-        {
-            uint16_array t_array = value();
-            uint16_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint32())
-        {
-            uint32_array t_array = value();
-            uint32_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint64())
-        {
-            uint64_array t_array = value();
-            uint64_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_float32())
-        {
-            float32_array t_array = value();
-            float32_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_float64())
-        {
-            float64_array t_array = value();
-            float64_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_char8_str())
-        {
-            // NOTE: Can't use 'value' for characters since type aliasing can
-            // confuse the 'char' type on various platforms.
-            char_array t_array((const void*)m_data, dtype());
-            char_array n_array((const void*)n.m_data, n.dtype());
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else
+        if(leaf_res)
         {
-            CONDUIT_ERROR("<Node::diff_compatible> unrecognized data type");
             res = true;
+            diffs_left--;
         }
     }
 
@@ -105,11 +105,47 @@ public:
 //-----------------------------------------------------------------------------
     Node();
     Node(const Node &node);
+    /// move constructor, takes over the contents of the passed node
+    /// (see steal()), leaving it empty
+    Node(Node &&node);
     ~Node();
 
     // returns any node to the empty state
     void reset();
 
+//-----------------------------------------------------------------------------
+// -- ownership transfer --
+//-----------------------------------------------------------------------------
+    /// exchanges the contents (hierarchy, data, ownership of allocated
+    /// buffers, and allocator ids) of this node with the given node.
+    ///
+    /// No data is copied. Either node may be a child in a tree, the
+    /// nodes stay at their positions in their parent trees.
+    /// Swapping a node with one of its ancestors or descendants
+    /// is an error.
+    void swap(Node &node);
+
+    /// takes over the contents of the given node (hierarchy, data,
+    /// ownership of allocated buffers, and allocator id) without copying
+    /// data and leaves the given node empty.
+    ///
+    /// note: external pointers in the given node stay external, steal
+    /// only transfers ownership of buffers the given node allocated.
+    void steal(Node &node);
+
+    /// takes ownership of the passed buffer, which must have been
+    /// allocated using the allocator with the given id (see
+    /// utils::conduit_allocate). The buffer is described using the given
+    /// schema or dtype and freed with the given allocator when this node
+    /// is reset or destroyed.
+    void adopt(const Schema &schema,
+               void *data,
+               index_t allocator_id = 0);
+
+    void adopt(const DataType &dtype,
+               void *data,
+               index_t allocator_id = 0);
+
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
 //-----------------------------------------------------------------------------
@@ -2799,6 +2835,10 @@ public:
 // -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
     Node &operator=(const Node &node);
+    /// move assignment uses steal() semantics when both nodes use the
+    /// same allocator, otherwise the data is copied into memory from this
+    /// node's allocator (as in set()) and the given node is reset.
+    Node &operator=(Node &&node);
     Node &operator=(const DataType &dtype);
     Node &operator=(const Schema &schema);
 
@@ -3095,6 +3135,10 @@ public:
 //-----------------------------------------------------------------------------
     /// compact into a new node
     void        compact_to(Node &n_dest) const;
+    /// compact into a new node, converting leaf data to the given
+    /// endianness. Leaves that need to be converted are copied and byte
+    /// swapped in a single pass (see Endianness::copy_and_swap).
+    void        compact_to(Node &n_dest, index_t endianness) const;
 
 //-----------------------------------------------------------------------------
 // -- update methods ---
@@ -3818,6 +3862,18 @@ public:
                           const float64 epsilon = CONDUIT_EPSILON,
                           bool relaxint = false) const;
 
+    /// diff variant that accepts options:
+    ///
+    ///  opts:
+    ///    epsilon:   (float64, default = CONDUIT_EPSILON)
+    ///    relaxint:  ("true" | "false", default = "false")
+    ///    max_diffs: (integer, default = unlimited)
+    ///      stop comparing once this many differences are found, the
+    ///      info digest will only contain the differences found so far.
+    bool             diff(const Node &n,
+                          Node &info,
+                          const Node &opts) const;
+
     /// diff this node to the given node for compatibility (i.e. validate it
     //  has everything that the instance node has), storing the results
     //  digest in the provided data node
@@ -3826,12 +3882,59 @@ public:
                                      const float64 epsilon = CONDUIT_EPSILON,
                                      bool relaxint = false) const;
 
+    /// diff_compatible variant that accepts options
+    /// (see the diff options variant for supported options)
+    bool             diff_compatible(const Node &n,
+                                     Node &info,
+                                     const Node &opts) const;
+
+    /// fast equality check, true if this node and the given node are equal
+    /// (provides the same answer as !diff(n,info,epsilon,relaxint)).
+    ///
+    /// No info digest is created, the comparison stops at the first
+    /// difference, compact leaves are compared with memcmp and leaf data
+    /// is compared in parallel when conduit is built with OpenMP support.
+    bool             equals(const Node &n,
+                            const float64 epsilon = CONDUIT_EPSILON,
+                            bool relaxint = false) const;
+
+    /// fast compatibility check, provides the same answer as
+    /// !diff_compatible(n,info,epsilon,relaxint) (see equals())
+    bool             equals_compatible(const Node &n,
+                                       const float64 epsilon = CONDUIT_EPSILON,
+                                       bool relaxint = false) const;
+
+    /// hash of this node's structure (see Schema::structure_hash())
+    uint64           structure_hash() const
+                        {return m_schema->structure_hash();}
+
+    /// hash of this node's structure and data.
+    ///
+    /// Nodes that are equal (with epsilon = 0) have the same content hash,
+    /// independent of their memory layout. Leaf data is hashed in blocks,
+    /// in parallel when conduit is built with OpenMP support.
+    ///
+    /// Useful to detect changes between two snapshots of a tree
+    /// (for example, to skip re-writing or re-sending unchanged data).
+    uint64           content_hash() const;
+
+    /// content_hash variant that also records the hash of every
+    /// descendant in the passed node, keyed by the path relative to this
+    /// node (list entries use their index as path component).
+    ///
+    /// Example: {"a": {"b": 1}, "c": [1,2]} results in entries for
+    ///  "a", "a/b", "c", "c/0", "c/1"
+    ///
+    /// The paths are used as literal child names (hashes is a flat object),
+    /// use hashes.child("a/b") to access an entry.
+    uint64           content_hash(Node &hashes) const;
+
     ///
     /// info() creates a node that contains metadata about the current
     /// node's memory properties
     void             info(Node &nres) const;
 
-    /// TODO: this is inefficient w/o move semantics, but is very
+    /// returns the info() node by value (moved, not copied),
     /// convenient for testing and example programs.
     Node             info() const;
 
@@ -4484,6 +4587,10 @@ private:
                                  index_t curr_offset) const;
     /// compact helper for leaf types
     void              compact_elements_to(uint8 *data) const;
+    // helper for compact_to(Node &, index_t endianness), n_dest must
+    // already have the compact form of our hierarchy
+    void              compact_elements_to(Node &n_dest,
+                                          index_t endianness) const;
 
 
     void              serialize(uint8 *data,
@@ -4513,6 +4620,15 @@ private:
 
     void              info(Node &res,
                            const std::string &curr_path) const;
+    /// diff work horse, implements both diff and diff_compatible.
+    /// diffs_left is decremented for each difference found, the
+    /// comparison stops when it reaches zero (pass -1 for no limit)
+    bool              diff(const Node &n,
+                           Node &info,
+                           const float64 epsilon,
+                           bool relaxint,
+                           bool compatible,
+                           index_t &diffs_left) const;
 
     /// helper that finds the first non null data pointer, used by
     /// contiguous_data_ptr()
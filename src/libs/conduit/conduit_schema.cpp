@@ -13,6 +13,7 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <utility>
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
@@ -262,6 +263,49 @@ Schema::total_bytes_compact() const
     return res;
 }
 
+//---------------------------------------------------------------------------//
+uint64
+Schema::structure_hash() const
+{
+    index_t dt_id = m_dtype.id();
+    uint64 res = utils::hash64(&dt_id, sizeof(index_t));
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        const std::vector<Schema*> &lst = children();
+        const std::vector<std::string> &names = object_order();
+        for(size_t i = 0; i < lst.size(); i++)
+        {
+            res = utils::hash64_combine(res, utils::hash64(names[i]));
+            res = utils::hash64_combine(res, lst[i]->structure_hash());
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        const std::vector<Schema*> &lst = children();
+        for(size_t i = 0; i < lst.size(); i++)
+        {
+            res = utils::hash64_combine(res, lst[i]->structure_hash());
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        index_t endianness = m_dtype.endianness();
+        if(endianness == Endianness::DEFAULT_ID)
+        {
+            endianness = Endianness::machine_default();
+        }
+
+        index_t leaf_info[2] = { m_dtype.number_of_elements(),
+                                 endianness };
+        res = utils::hash64_combine(res,
+                                    utils::hash64(leaf_info,
+                                                  sizeof(leaf_info)));
+    }
+
+    return res;
+}
+
 //---------------------------------------------------------------------------//
 bool
 Schema::is_compact() const
@@ -1419,6 +1463,29 @@ Schema::init_list()
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Schema::swap(Schema &schema)
+{
+    std::swap(m_dtype, schema.m_dtype);
+    std::swap(m_hierarchy_data, schema.m_hierarchy_data);
+
+    // children need to point to their new parents
+    Schema *schemas[2] = {this, &schema};
+    for(int s = 0; s < 2; s++)
+    {
+        index_t dt_id = schemas[s]->m_dtype.id();
+        if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+        {
+            std::vector<Schema*> &chld = schemas[s]->children();
+            for(size_t i = 0; i < chld.size(); i++)
+            {
+                chld[i]->m_parent = schemas[s];
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Schema::release()
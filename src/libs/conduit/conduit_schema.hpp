@@ -132,6 +132,12 @@ public:
     /// is this schema equal to given schema
     bool            equals(const Schema &s) const;
 
+    /// hash of this schema's structure: child names (and order),
+    /// dtype ids, number of elements, and endianness.
+    /// Layout details (offsets and strides) are not included, so schemas
+    /// that only differ in memory layout have the same structure hash.
+    uint64          structure_hash() const;
+
     /// sum of the strided bytes of all leaves
     index_t         total_strided_bytes() const;
     /// sum of the bytes of the compact form of all leaves
@@ -375,6 +381,9 @@ private:
     void        init_object();
     // cleanup any allocated memory.
     void        release();
+    // exchanges the dtype and hierarchy of this schema with the given
+    // schema (used by Node::swap, parents are left as-is)
+    void        swap(Schema &schema);
 
     /// helps with proper alloc size for:
     /// Node::set_using_schema()and Node::set_data_using_schema
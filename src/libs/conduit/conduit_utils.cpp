@@ -1902,6 +1902,121 @@ inline unsigned int Hash(const unsigned char *k, unsigned int length, unsigned i
 // Just to keep this macro from leaking out and polluting the global namespace
 #undef bjhash_mix
 
+//-----------------------------------------------------------------------------
+// xxHash64
+//
+// Implementation of the xxHash64 algorithm, see:
+//  https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+//
+// xxHash is Copyright (c) Yann Collet, BSD 2-Clause License
+//-----------------------------------------------------------------------------
+static const uint64 XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64 XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64 XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const uint64 XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64 XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64 xxh_rotl64(uint64 x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64 xxh_read64(const unsigned char *p)
+{
+    uint64 v;
+    memcpy(&v, p, sizeof(uint64));
+    return v;
+}
+
+inline uint64 xxh_read32(const unsigned char *p)
+{
+    uint32 v;
+    memcpy(&v, p, sizeof(uint32));
+    return (uint64)v;
+}
+
+inline uint64 xxh_round(uint64 acc, uint64 input)
+{
+    acc += input * XXH_PRIME64_2;
+    acc  = xxh_rotl64(acc, 31);
+    acc *= XXH_PRIME64_1;
+    return acc;
+}
+
+inline uint64 xxh_merge_round(uint64 acc, uint64 val)
+{
+    val  = xxh_round(0, val);
+    acc ^= val;
+    acc  = acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+    return acc;
+}
+
+inline uint64 XXHash64(const unsigned char *p, uint64 len, uint64 seed)
+{
+    const unsigned char *end = p + len;
+    uint64 h;
+
+    if(len >= 32)
+    {
+        const unsigned char *limit = end - 32;
+        uint64 v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64 v2 = seed + XXH_PRIME64_2;
+        uint64 v3 = seed + 0;
+        uint64 v4 = seed - XXH_PRIME64_1;
+
+        do
+        {
+            v1 = xxh_round(v1, xxh_read64(p)); p += 8;
+            v2 = xxh_round(v2, xxh_read64(p)); p += 8;
+            v3 = xxh_round(v3, xxh_read64(p)); p += 8;
+            v4 = xxh_round(v4, xxh_read64(p)); p += 8;
+        } while(p <= limit);
+
+        h = xxh_rotl64(v1, 1)  + xxh_rotl64(v2, 7) +
+            xxh_rotl64(v3, 12) + xxh_rotl64(v4, 18);
+        h = xxh_merge_round(h, v1);
+        h = xxh_merge_round(h, v2);
+        h = xxh_merge_round(h, v3);
+        h = xxh_merge_round(h, v4);
+    }
+    else
+    {
+        h = seed + XXH_PRIME64_5;
+    }
+
+    h += len;
+
+    while(p + 8 <= end)
+    {
+        h ^= xxh_round(0, xxh_read64(p));
+        h  = xxh_rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        p += 8;
+    }
+
+    if(p + 4 <= end)
+    {
+        h ^= xxh_read32(p) * XXH_PRIME64_1;
+        h  = xxh_rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+
+    while(p < end)
+    {
+        h ^= (*p) * XXH_PRIME64_5;
+        h  = xxh_rotl64(h, 11) * XXH_PRIME64_1;
+        p++;
+    }
+
+    // avalanche
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+
+    return h;
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::utils::hashing --
@@ -1927,6 +2042,28 @@ hash(const std::string &k, unsigned int initval)
                          (unsigned int)k.size(), initval);
 }
 
+uint64
+hash64(const void *data, index_t num_bytes, uint64 seed)
+{
+    return hashing::XXHash64((unsigned char const*)data,
+                             (uint64)num_bytes, seed);
+}
+
+uint64
+hash64(const std::string &k, uint64 seed)
+{
+    return hashing::XXHash64((unsigned char const*)k.c_str(),
+                             (uint64)k.size(), seed);
+}
+
+uint64
+hash64_combine(uint64 h0, uint64 h1)
+{
+    uint64 vals[2] = {h0, h1};
+    return hashing::XXHash64((unsigned char const*)vals,
+                             sizeof(vals), 0);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::utils --
@@ -595,6 +595,22 @@ namespace utils
      unsigned int CONDUIT_API hash(const std::string &k,
                                    unsigned int initval = 0);
 
+//-----------------------------------------------------------------------------
+// Fast 64-bit non-cryptographic hash functions (xxHash64 algorithm),
+// used for content hashing of node data.
+//
+// Note: Hash values depend on the byte order of the input and are not
+// guaranteed to be stable across conduit versions.
+//-----------------------------------------------------------------------------
+     uint64 CONDUIT_API hash64(const void *data,
+                               index_t num_bytes,
+                               uint64 seed = 0);
+     uint64 CONDUIT_API hash64(const std::string &k,
+                               uint64 seed = 0);
+     /// combines two hash values into a new hash value (order matters)
+     uint64 CONDUIT_API hash64_combine(uint64 h0,
+                                       uint64 h1);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::utils --
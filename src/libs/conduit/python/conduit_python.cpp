@@ -75,7 +75,11 @@
 //-----------------------------------------------------------------------------
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <vector>
 
 //---------------------------------------------------------------------------//
@@ -2245,6 +2249,91 @@ PyConduit_DataType_endianness(PyConduit_DataType *self)
     return PyLong_FromSsize_t((Py_ssize_t)self->dtype.endianness());
 }
 
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_DataType_set_shape(PyConduit_DataType *self,
+                             PyObject *args)
+{
+    PyObject *py_shape = NULL;
+
+    if (!PyArg_ParseTuple(args, "O", &py_shape))
+    {
+        PyErr_SetString(PyExc_TypeError,
+            "shape must be a sequence of integers");
+        return NULL;
+    }
+
+    std::vector<index_t> shape;
+    if(py_shape != Py_None)
+    {
+        PyObject *py_seq = PySequence_Fast(py_shape,
+                                           "shape must be a sequence of "
+                                           "integers");
+        if(py_seq == NULL)
+        {
+            return NULL;
+        }
+
+        Py_ssize_t seq_len = PySequence_Fast_GET_SIZE(py_seq);
+        for(Py_ssize_t i = 0; i < seq_len; i++)
+        {
+            PyObject *py_val = PySequence_Fast_GET_ITEM(py_seq, i);
+            Py_ssize_t val = PyNumber_AsSsize_t(py_val, PyExc_OverflowError);
+            if(val == -1 && PyErr_Occurred())
+            {
+                Py_DECREF(py_seq);
+                return NULL;
+            }
+            shape.push_back((index_t)val);
+        }
+        Py_DECREF(py_seq);
+    }
+
+    try
+    {
+        self->dtype.set_shape(shape);
+    }
+    catch(conduit::Error &e)
+    {
+        PyErr_SetString(PyExc_ValueError,
+                        e.message().c_str());
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_DataType_shape(PyConduit_DataType *self)
+{
+    // leaves without a shape are 1-D
+    index_t num_dims = self->dtype.number_of_dimensions();
+    PyObject *retval = PyTuple_New((Py_ssize_t)num_dims);
+    for(index_t i = 0; i < num_dims; i++)
+    {
+        PyTuple_SetItem(retval,
+                        (Py_ssize_t)i,
+                        PyLong_FromSsize_t(
+                            (Py_ssize_t)self->dtype.dimension(i)));
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_DataType_has_shape(PyConduit_DataType *self)
+{
+    if(self->dtype.has_shape())
+    {
+        Py_RETURN_TRUE;
+    }
+    else
+    {
+        Py_RETURN_FALSE;
+    }
+}
+
 //---------------------------------------------------------------------------//
 static PyObject *
 PyConduit_DataType_element_index(PyConduit_DataType *self,
@@ -2647,6 +2736,11 @@ static PyMethodDef PyConduit_DataType_METHODS[] = {
      METH_VARARGS,
      "Sets the endianness property of this DataType"},
     //-----------------------------------------------------------------------//
+    {"set_shape",
+     (PyCFunction)PyConduit_DataType_set_shape,
+     METH_VARARGS,
+     "Sets the N-D shape (C order) of this DataType"},
+    //-----------------------------------------------------------------------//
     {"id",
      (PyCFunction)PyConduit_DataType_id,
      METH_NOARGS,
@@ -2677,6 +2771,16 @@ static PyMethodDef PyConduit_DataType_METHODS[] = {
      METH_NOARGS,
      "Returns the number of bytes per element property of this DataType"},
     //-----------------------------------------------------------------------//
+    {"shape",
+     (PyCFunction)PyConduit_DataType_shape,
+     METH_NOARGS,
+     "Returns the shape of this DataType as a tuple"},
+    //-----------------------------------------------------------------------//
+    {"has_shape",
+     (PyCFunction)PyConduit_DataType_has_shape,
+     METH_NOARGS,
+     "Returns if an N-D shape was set on this DataType"},
+    //-----------------------------------------------------------------------//
     {"endianness",
      (PyCFunction)PyConduit_DataType_endianness,
      METH_NOARGS,
@@ -5013,156 +5117,1273 @@ PyConduit_Fill_DataArray_From_PyArray(DataArray<T> &conduit_array,
 }
 
 //---------------------------------------------------------------------------//
-// begin Node python special methods
+//---------------------------------------------------------------------------//
+//
+// Zero-copy views (numpy and the python buffer protocol)
+//
+//---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
 //---------------------------------------------------------------------------//
-static PyObject *
-PyConduit_Node_new(PyTypeObject* type,
-                   PyObject* args,
-                   PyObject* kwds)
+// Describes the memory of a numeric leaf, or of an object or list node whose
+// children are numeric leaves with the same number of elements and stride
+// (for example: an interleaved or a contiguous mcarray).
+//
+// uniform layouts (a leaf, or children that share a type and are evenly
+// spaced in memory) map to N-D arrays; other layouts map to records with
+// one field per child.
+//---------------------------------------------------------------------------//
+struct PyConduit_View_Layout
+{
+    uint8                    *data;
+    index_t                   num_ele;
+    index_t                   stride;
+    bool                      uniform;
+    // 0 for a leaf
+    index_t                   num_comps;
+    // uniform: bytes between components
+    index_t                   comp_stride;
+    // records: bytes per record
+    index_t                   itemsize;
+    std::vector<DataType>     comp_dtypes;
+    std::vector<std::string>  comp_names;
+    std::vector<index_t>      comp_offsets;
+};
+
+//---------------------------------------------------------------------------//
+static index_t
+PyConduit_DataType_Endianness(const DataType &dtype)
 {
-    static const char *kwlist[] = {"value", NULL};
-    PyObject* value = NULL;
-    if (!PyArg_ParseTupleAndKeywords(args,
-                                     kwds,
-                                     "|O",
-                                     const_cast<char**>(kwlist),
-                                     &value))
+    if(dtype.endianness() == Endianness::DEFAULT_ID)
     {
-        return (NULL);
+        return Endianness::machine_default();
+    }
+    return dtype.endianness();
+}
+
+//---------------------------------------------------------------------------//
+// byte distance between two children's data, computed on integers since
+// the children may live in different allocations
+//---------------------------------------------------------------------------//
+static index_t
+PyConduit_Byte_Distance(const uint8 *from,
+                        const uint8 *to)
+{
+    return (index_t)((uintptr_t)to - (uintptr_t)from);
+}
+
+//---------------------------------------------------------------------------//
+// returns false and fills err_msg if the node can't be viewed in place
+//
+// a view of several children must stay inside one allocation: either the
+// children share their parent's buffer, or they are interleaved (every
+// child's first element is inside the first stride of the others, which
+// can only happen in one allocation when there are several elements).
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Node_View_Layout(Node &node,
+                           PyConduit_View_Layout &layout,
+                           std::string &err_msg)
+{
+    const DataType &dtype = node.dtype();
+
+    layout.comp_dtypes.clear();
+    layout.comp_names.clear();
+    layout.comp_offsets.clear();
+
+    if(dtype.is_number())
+    {
+        layout.data        = (uint8*)node.element_ptr(0);
+        layout.num_ele     = dtype.number_of_elements();
+        layout.stride      = dtype.stride();
+        layout.uniform     = true;
+        layout.num_comps   = 0;
+        layout.comp_stride = 0;
+        layout.itemsize    = dtype.element_bytes();
+        layout.comp_dtypes.push_back(dtype);
+        layout.comp_names.push_back(node.name());
+        layout.comp_offsets.push_back(0);
+        return true;
     }
 
-    PyConduit_Node* self = (PyConduit_Node*)type->tp_alloc(type, 0);
+    index_t num_comps = node.number_of_children();
 
-    if (self)
+    if( !(dtype.is_object() || dtype.is_list()) || num_comps == 0 )
     {
-        self->node = 0;
-        self->python_owns = 0;
+        err_msg = "zero-copy views require a numeric leaf or a node whose"
+                  " children are numeric leaves";
+        return false;
     }
 
-    return ((PyObject*)self);
-}
+    std::vector<uint8*> comp_ptrs((size_t)num_comps);
+    bool same_buffer = true;
 
-//---------------------------------------------------------------------------//
-static int
-PyConduit_Node_init(PyConduit_Node* self,
-                    PyObject* args,
-                    PyObject* kwds)
-{
-    static const char *kwlist[] = {"value", NULL};
-    PyObject* value = NULL;
-    if (!PyArg_ParseTupleAndKeywords(args,
-                                     kwds,
-                                     "|O",
-                                     const_cast<char**>(kwlist),
-                                     &value))
+    for(index_t i = 0; i < num_comps; i++)
     {
-        return 0;
+        Node &child = node.child(i);
+        const DataType &cld_dtype = child.dtype();
+
+        if(!cld_dtype.is_number())
+        {
+            err_msg = "zero-copy views require all children to be numeric"
+                      " leaves (child '" + child.name() + "' is not)";
+            return false;
+        }
+
+        if(i == 0)
+        {
+            layout.num_ele = cld_dtype.number_of_elements();
+            layout.stride  = cld_dtype.stride();
+        }
+        else if(cld_dtype.number_of_elements() != layout.num_ele ||
+                cld_dtype.stride() != layout.stride)
+        {
+            err_msg = "zero-copy views require all children to have the"
+                      " same number of elements and the same stride";
+            return false;
+        }
+
+        comp_ptrs[(size_t)i] = (uint8*)child.element_ptr(0);
+        layout.comp_dtypes.push_back(cld_dtype);
+        same_buffer = same_buffer &&
+                      child.data_ptr() == node.child(0).data_ptr();
+
+        std::string cld_name = child.name();
+        if(cld_name.empty())
+        {
+            std::ostringstream oss;
+            oss << "f" << i;
+            cld_name = oss.str();
+        }
+        layout.comp_names.push_back(cld_name);
     }
-    
-    self->node = new Node();
-    self->python_owns = 1;
 
-    if (value)
+    // bytes from the lowest first element to the highest last byte of
+    // the first elements
+    uint8  *first_ptr = comp_ptrs[0];
+    index_t rec_end   = 0;
+    for(index_t i = 1; i < num_comps; i++)
     {
-        return (PyConduit_Node_Set_From_Python(*self->node, value));
+        if(comp_ptrs[(size_t)i] < first_ptr)
+        {
+            first_ptr = comp_ptrs[(size_t)i];
+        }
     }
-    else 
+
+    for(index_t i = 0; i < num_comps; i++)
     {
-        return 0;
+        index_t end = PyConduit_Byte_Distance(first_ptr,
+                                              comp_ptrs[(size_t)i]) +
+                      layout.comp_dtypes[(size_t)i].element_bytes();
+        rec_end = end > rec_end ? end : rec_end;
+    }
+
+    bool interleaved = layout.num_ele > 1 && rec_end <= layout.stride;
+
+    if(num_comps > 1 && !same_buffer && !interleaved)
+    {
+        err_msg = "zero-copy views of several children require the"
+                  " children to be interleaved or to share one buffer"
+                  " (the children were allocated separately)";
+        return false;
+    }
+
+    const DataType &dtype_0 = layout.comp_dtypes[0];
+
+    layout.num_comps   = num_comps;
+    layout.comp_stride = num_comps > 1
+                         ? PyConduit_Byte_Distance(comp_ptrs[0],
+                                                   comp_ptrs[1])
+                         : dtype_0.element_bytes();
+    layout.uniform     = true;
+
+    for(index_t i = 1; i < num_comps && layout.uniform; i++)
+    {
+        const DataType &dtype_i = layout.comp_dtypes[(size_t)i];
+        layout.uniform = dtype_i.id() == dtype_0.id() &&
+                         dtype_i.element_bytes() == dtype_0.element_bytes() &&
+                         PyConduit_DataType_Endianness(dtype_i) ==
+                            PyConduit_DataType_Endianness(dtype_0) &&
+                         PyConduit_Byte_Distance(comp_ptrs[(size_t)i-1],
+                                                 comp_ptrs[(size_t)i])
+                            == layout.comp_stride;
+    }
+
+    if(layout.uniform)
+    {
+        layout.data     = comp_ptrs[0];
+        layout.itemsize = dtype_0.element_bytes();
+        for(index_t i = 0; i < num_comps; i++)
+        {
+            layout.comp_offsets.push_back(i * layout.comp_stride);
+        }
+        return true;
+    }
+
+    // records: each child is a field at a fixed offset in the record
+    layout.data = first_ptr;
+    for(index_t i = 0; i < num_comps; i++)
+    {
+        layout.comp_offsets.push_back(
+            PyConduit_Byte_Distance(first_ptr, comp_ptrs[(size_t)i]));
+    }
+
+    if(layout.num_ele > 1 && !interleaved)
+    {
+        err_msg = "zero-copy views require children of mixed types to be"
+                  " fields of the same records (children are not"
+                  " interleaved within the stride)";
+        return false;
     }
+
+    layout.itemsize = layout.num_ele > 1 ? layout.stride : rec_end;
+
+    return true;
 }
 
 //---------------------------------------------------------------------------//
-static void 
-PyConduit_Node_dealloc(PyConduit_Node* self)
+// returns -1 if the dtype has no numpy equivalent
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Numpy_Type_From_DataType(const DataType &dtype)
 {
-    if(self->python_owns)
+    switch(dtype.id())
     {
-       delete self->node;
+        case DataType::INT8_ID:    return NPY_INT8;
+        case DataType::INT16_ID:   return NPY_INT16;
+        case DataType::INT32_ID:   return NPY_INT32;
+        case DataType::INT64_ID:   return NPY_INT64;
+        case DataType::UINT8_ID:   return NPY_UINT8;
+        case DataType::UINT16_ID:  return NPY_UINT16;
+        case DataType::UINT32_ID:  return NPY_UINT32;
+        case DataType::UINT64_ID:  return NPY_UINT64;
+        case DataType::FLOAT32_ID: return NPY_FLOAT32;
+        case DataType::FLOAT64_ID: return NPY_FLOAT64;
+        default: break;
     }
-
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    return -1;
 }
 
 //---------------------------------------------------------------------------//
-static PyObject *
-PyConduit_Node_str(PyConduit_Node* self)
+// returns a new reference (NULL with a python error set on failure)
+//---------------------------------------------------------------------------//
+static PyArray_Descr *
+PyConduit_Numpy_Descr_From_DataType(const DataType &dtype)
 {
-   return (Py_BuildValue("s", self->node->to_summary_string().c_str()));
+    int numpy_type = PyConduit_Numpy_Type_From_DataType(dtype);
+    if(numpy_type < 0)
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "Python Conduit does not support this type");
+        return NULL;
+    }
+
+    PyArray_Descr *descr = PyArray_DescrFromType(numpy_type);
+
+    if(PyConduit_DataType_Endianness(dtype) != Endianness::machine_default())
+    {
+        PyArray_Descr *swapped = PyArray_DescrNewByteorder(descr, NPY_SWAP);
+        Py_DECREF(descr);
+        descr = swapped;
+    }
+
+    return descr;
 }
 
 //---------------------------------------------------------------------------//
-static PyObject *
-PyConduit_Node_repr(PyConduit_Node* self)
+// returns a new reference (NULL with a python error set on failure)
+//---------------------------------------------------------------------------//
+static PyArray_Descr *
+PyConduit_Numpy_Record_Descr(const PyConduit_View_Layout &layout)
 {
-   return (Py_BuildValue("s", self->node->to_summary_string().c_str()));
+    PyObject *py_names   = PyList_New(0);
+    PyObject *py_formats = PyList_New(0);
+    PyObject *py_offsets = PyList_New(0);
+
+    for(size_t i = 0; i < layout.comp_dtypes.size(); i++)
+    {
+        PyArray_Descr *descr =
+            PyConduit_Numpy_Descr_From_DataType(layout.comp_dtypes[i]);
+        if(descr == NULL)
+        {
+            Py_DECREF(py_names);
+            Py_DECREF(py_formats);
+            Py_DECREF(py_offsets);
+            return NULL;
+        }
+        PyObject *py_name = PyString_FromString(layout.comp_names[i].c_str());
+        PyObject *py_offset = PyLong_FromSsize_t(
+                                    (Py_ssize_t)layout.comp_offsets[i]);
+        PyList_Append(py_names, py_name);
+        PyList_Append(py_formats, (PyObject*)descr);
+        PyList_Append(py_offsets, py_offset);
+        Py_DECREF(py_name);
+        Py_DECREF(descr);
+        Py_DECREF(py_offset);
+    }
+
+    PyObject *py_itemsize = PyLong_FromSsize_t((Py_ssize_t)layout.itemsize);
+
+    PyObject *py_spec = PyDict_New();
+    PyDict_SetItemString(py_spec, "names", py_names);
+    PyDict_SetItemString(py_spec, "formats", py_formats);
+    PyDict_SetItemString(py_spec, "offsets", py_offsets);
+    PyDict_SetItemString(py_spec, "itemsize", py_itemsize);
+    Py_DECREF(py_names);
+    Py_DECREF(py_formats);
+    Py_DECREF(py_offsets);
+    Py_DECREF(py_itemsize);
+
+    PyArray_Descr *res = NULL;
+    if(!PyArray_DescrConverter(py_spec, &res))
+    {
+        res = NULL;
+    }
+    Py_DECREF(py_spec);
+    return res;
 }
 
+//---------------------------------------------------------------------------//
+// Creates a numpy array that views the node's memory in place.
+// The array holds a reference to py_node.
+//
+// py_shape (optional) reshapes the element axis, so a leaf with 12 elements
+// can be viewed as (3,4), and a 3 component mcarray with 12 tuples as
+// (3,4,3).
 //---------------------------------------------------------------------------//
 static PyObject *
-PyConduit_Node_GetItem(PyConduit_Node* self,
-                       PyObject* key)
+PyConduit_Node_Create_Numpy_View(PyObject *py_node,
+                                 Node &node,
+                                 PyObject *py_shape)
 {
-    PyObject* retval = NULL;
+    PyConduit_View_Layout layout;
+    std::string err_msg;
 
-    if(PyString_Check(key))
+    if(!PyConduit_Node_View_Layout(node, layout, err_msg))
     {
-        char* ckey = PyString_AsString(key);
+        PyErr_SetString(PyExc_TypeError, err_msg.c_str());
+        return NULL;
+    }
 
-        if(self->node->has_path(ckey))
+    std::vector<npy_intp> shape;
+
+    if(py_shape != NULL && py_shape != Py_None)
+    {
+        PyObject *py_seq = PySequence_Fast(py_shape,
+                                           "shape must be a sequence of "
+                                           "integers");
+        if(py_seq == NULL)
         {
-            Node& node = (*self->node)[ckey];
-            retval = PyConduit_Convert_Node_To_Python(node);
+            return NULL;
         }
-        else
+
+        npy_intp num_vals = 1;
+        Py_ssize_t seq_len = PySequence_Fast_GET_SIZE(py_seq);
+        for(Py_ssize_t i = 0; i < seq_len; i++)
         {
-            retval = PyConduit_Node_Python_Wrap(&(*self->node)[ckey],0);
+            PyObject *py_val = PySequence_Fast_GET_ITEM(py_seq, i);
+            Py_ssize_t val = PyNumber_AsSsize_t(py_val, PyExc_OverflowError);
+            if(val == -1 && PyErr_Occurred())
+            {
+                Py_DECREF(py_seq);
+                return NULL;
+            }
+            shape.push_back((npy_intp)val);
+            num_vals *= (npy_intp)val;
+        }
+        Py_DECREF(py_seq);
+
+        if(shape.empty() || num_vals != (npy_intp)layout.num_ele)
+        {
+            std::ostringstream oss;
+            oss << "shape does not match the number of elements ("
+                << layout.num_ele << ")";
+            PyErr_SetString(PyExc_ValueError, oss.str().c_str());
+            return NULL;
         }
-    
-        PyString_AsString_Cleanup(ckey);
     }
-    else if(PyNumber_Check(key))
+    else if(node.dtype().has_shape())
     {
-        Py_ssize_t idx = PyNumber_AsSsize_t(key,NULL);
-        Node& node = (*self->node)[idx];
-        retval = PyConduit_Convert_Node_To_Python(node);
+        // leaves default to their N-D shape
+        shape.assign(node.dtype().shape().begin(),
+                     node.dtype().shape().end());
     }
     else
     {
-        PyErr_SetString(PyExc_TypeError,
-                        "Key must be a string or integer index");
+        shape.push_back((npy_intp)layout.num_ele);
     }
-    
-    return (retval);
-}
 
-//---------------------------------------------------------------------------//
-static PyObject *
-PyConduit_Node_python_owns(PyConduit_Node *self)
-{
-    if(self->python_owns)
+    // elements are walked in C order
+    std::vector<npy_intp> strides(shape.size());
+    npy_intp curr_stride = (npy_intp)layout.stride;
+    for(size_t i = shape.size(); i > 0; i--)
     {
-        Py_RETURN_TRUE;
+        strides[i-1] = curr_stride;
+        curr_stride *= shape[i-1];
+    }
+
+    PyArray_Descr *descr = NULL;
+
+    if(layout.uniform)
+    {
+        descr = PyConduit_Numpy_Descr_From_DataType(layout.comp_dtypes[0]);
+        if(layout.num_comps > 0)
+        {
+            shape.push_back((npy_intp)layout.num_comps);
+            strides.push_back((npy_intp)layout.comp_stride);
+        }
     }
     else
     {
-        Py_RETURN_FALSE;
+        descr = PyConduit_Numpy_Record_Descr(layout);
     }
-}
 
-//---------------------------------------------------------------------------//
-static PyObject *
-PyConduit_Node_python_detach(PyConduit_Node *self)
-{
-    self->python_owns = 0;
-    Py_RETURN_NONE;
-}
+    if(descr == NULL)
+    {
+        return NULL;
+    }
 
-//---------------------------------------------------------------------------//
-static PyObject *
-PyConduit_Node_python_attach(PyConduit_Node *self)
+    if(shape.size() > NPY_MAXDIMS)
+    {
+        Py_DECREF(descr);
+        PyErr_SetString(PyExc_ValueError, "too many dimensions");
+        return NULL;
+    }
+
+    // steals descr
+    PyObject *retval = PyArray_NewFromDescr(&PyArray_Type,
+                                            descr,
+                                            (int)shape.size(),
+                                            &shape[0],
+                                            &strides[0],
+                                            layout.data,
+                                            NPY_ARRAY_WRITEABLE,
+                                            NULL);
+    if(retval == NULL)
+    {
+        return NULL;
+    }
+
+    // keep the python node alive while the view exists
+    Py_INCREF(py_node);
+    if(PyArray_SetBaseObject((PyArrayObject*)retval, py_node) < 0)
+    {
+        Py_DECREF(retval);
+        return NULL;
+    }
+
+    return retval;
+}
+
+//---------------------------------------------------------------------------//
+// Finds the byte stride between consecutive elements of a numpy array in
+// C order. Returns false when the elements are not evenly spaced (for
+// example: a 2D slice that skips columns) and can't be described by a
+// single conduit leaf.
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Numpy_Flat_Stride(PyArrayObject *py_arr,
+                            index_t &stride)
+{
+    int nd = PyArray_NDIM(py_arr);
+    npy_intp *dims    = PyArray_DIMS(py_arr);
+    npy_intp *strides = PyArray_STRIDES(py_arr);
+
+    stride = (index_t)PyArray_ITEMSIZE(py_arr);
+
+    if(PyArray_SIZE(py_arr) == 0)
+    {
+        return true;
+    }
+
+    bool found = false;
+    npy_intp expected = 0;
+
+    for(int i = nd - 1; i >= 0; i--)
+    {
+        // unit dims don't change the layout
+        if(dims[i] == 1)
+        {
+            continue;
+        }
+
+        if(!found)
+        {
+            stride = (index_t)strides[i];
+            found  = true;
+        }
+        else if(strides[i] != expected)
+        {
+            return false;
+        }
+
+        expected = strides[i] * dims[i];
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// returns false if the numpy type has no conduit equivalent
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_DataType_From_Numpy_Descr(PyArray_Descr *descr,
+                                    index_t num_ele,
+                                    index_t stride,
+                                    DataType &dtype)
+{
+    PyObject *py_itemsize = PyObject_GetAttrString((PyObject*)descr,
+                                                   "itemsize");
+    if(py_itemsize == NULL)
+    {
+        PyErr_Clear();
+        return false;
+    }
+    index_t ele_bytes = (index_t)PyLong_AsSsize_t(py_itemsize);
+    Py_DECREF(py_itemsize);
+
+    index_t dtype_id = DataType::EMPTY_ID;
+
+    if(descr->kind == 'i')
+    {
+        switch(ele_bytes)
+        {
+            case 1: dtype_id = DataType::INT8_ID;  break;
+            case 2: dtype_id = DataType::INT16_ID; break;
+            case 4: dtype_id = DataType::INT32_ID; break;
+            case 8: dtype_id = DataType::INT64_ID; break;
+            default: break;
+        }
+    }
+    else if(descr->kind == 'u')
+    {
+        switch(ele_bytes)
+        {
+            case 1: dtype_id = DataType::UINT8_ID;  break;
+            case 2: dtype_id = DataType::UINT16_ID; break;
+            case 4: dtype_id = DataType::UINT32_ID; break;
+            case 8: dtype_id = DataType::UINT64_ID; break;
+            default: break;
+        }
+    }
+    else if(descr->kind == 'f')
+    {
+        switch(ele_bytes)
+        {
+            case 4: dtype_id = DataType::FLOAT32_ID; break;
+            case 8: dtype_id = DataType::FLOAT64_ID; break;
+            default: break;
+        }
+    }
+
+    if(dtype_id == DataType::EMPTY_ID)
+    {
+        return false;
+    }
+
+    index_t endianness = Endianness::machine_default();
+    if(!PyArray_ISNBO(descr->byteorder))
+    {
+        endianness = Endianness::machine_is_little_endian()
+                     ? Endianness::BIG_ID : Endianness::LITTLE_ID;
+    }
+
+    dtype = DataType(dtype_id,
+                     num_ele,
+                     0,
+                     stride,
+                     ele_bytes,
+                     endianness);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Returns dtype with the shape of a multidimensional numpy array, so N-D
+// arrays round trip through conduit leaves.
+//---------------------------------------------------------------------------//
+static DataType
+PyConduit_Numpy_Shaped_DataType(const DataType &dtype,
+                                PyArrayObject *py_arr)
+{
+    DataType res(dtype);
+    int nd = PyArray_NDIM(py_arr);
+    if(nd > 1)
+    {
+        npy_intp *dims = PyArray_DIMS(py_arr);
+        std::vector<index_t> shape(dims, dims + nd);
+        res.set_shape(shape);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// Describes the memory of a numpy array, relative to PyArray_BYTES.
+//
+// N-D arrays whose elements are evenly spaced in C order (any C contiguous
+// array, or a strided 1D view) become a single leaf. Structured arrays
+// become an object with one strided leaf per field.
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Numpy_Schema(PyArrayObject *py_arr,
+                       Schema &schema)
+{
+    index_t stride = 0;
+    if(!PyConduit_Numpy_Flat_Stride(py_arr, stride))
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "set_external does not handle multidimensional"
+                        " strided views whose elements are not evenly"
+                        " spaced in memory. C contiguous arrays and views"
+                        " that are effectively 1D-strided are supported.");
+        return -1;
+    }
+
+    PyArray_Descr *descr = PyArray_DESCR(py_arr);
+    index_t num_ele = (index_t)PyArray_SIZE(py_arr);
+
+    if(!PyDataType_HASFIELDS(descr))
+    {
+        DataType dtype;
+        if(!PyConduit_DataType_From_Numpy_Descr(descr,
+                                                num_ele,
+                                                stride,
+                                                dtype))
+        {
+            PyErr_SetString(PyExc_TypeError, "Unsupported type");
+            return -1;
+        }
+        schema.set(PyConduit_Numpy_Shaped_DataType(dtype, py_arr));
+        return 0;
+    }
+
+    // structured array case: one leaf per field
+    PyObject *py_names  = PyObject_GetAttrString((PyObject*)descr, "names");
+    PyObject *py_fields = PyObject_GetAttrString((PyObject*)descr, "fields");
+
+    if(py_names == NULL || py_fields == NULL)
+    {
+        Py_XDECREF(py_names);
+        Py_XDECREF(py_fields);
+        return -1;
+    }
+
+    std::vector<std::string> names;
+    std::vector<DataType>    dtypes;
+    std::vector<index_t>     offsets;
+    int res = 0;
+
+    Py_ssize_t num_fields = PyTuple_Size(py_names);
+    for(Py_ssize_t i = 0; i < num_fields && res == 0; i++)
+    {
+        PyObject *py_name  = PyTuple_GetItem(py_names, i);
+        // (field descr, offset [,title])
+        PyObject *py_field = PyObject_GetItem(py_fields, py_name);
+        PyArray_Descr *fld_descr = NULL;
+        Py_ssize_t     fld_offset = 0;
+        DataType       fld_dtype;
+
+        if(py_field == NULL ||
+           !PyTuple_Check(py_field) ||
+           PyTuple_Size(py_field) < 2 ||
+           !PyArray_DescrCheck(PyTuple_GetItem(py_field, 0)))
+        {
+            PyErr_SetString(PyExc_TypeError,
+                            "set_external could not read structured"
+                            " array fields");
+            res = -1;
+        }
+        else
+        {
+            fld_descr  = (PyArray_Descr*)PyTuple_GetItem(py_field, 0);
+            fld_offset = PyLong_AsSsize_t(PyTuple_GetItem(py_field, 1));
+
+            if(PyDataType_HASFIELDS(fld_descr) ||
+               !PyConduit_DataType_From_Numpy_Descr(fld_descr,
+                                                    num_ele,
+                                                    stride,
+                                                    fld_dtype))
+            {
+                PyErr_SetString(PyExc_TypeError,
+                                "set_external only supports structured"
+                                " arrays with numeric (scalar) fields");
+                res = -1;
+            }
+            else
+            {
+                char *cname = PyString_AsString(py_name);
+                names.push_back(std::string(cname));
+                PyString_AsString_Cleanup(cname);
+                dtypes.push_back(fld_dtype);
+                offsets.push_back((index_t)fld_offset);
+            }
+        }
+        Py_XDECREF(py_field);
+    }
+
+    Py_DECREF(py_names);
+    Py_DECREF(py_fields);
+
+    if(res != 0)
+    {
+        return res;
+    }
+
+    schema.reset();
+    for(size_t i = 0; i < names.size(); i++)
+    {
+        DataType fld_dtype(dtypes[i]);
+        fld_dtype.set_offset(fld_dtype.offset() + offsets[i]);
+        schema.add_child(names[i]).set(fld_dtype);
+    }
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// Points node at the memory of a numpy array (no copy).
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_Set_External_From_Numpy(Node &node,
+                                       PyArrayObject *py_arr)
+{
+    Schema schema;
+    if(PyConduit_Numpy_Schema(py_arr, schema))
+    {
+        return -1;
+    }
+
+    node.set_external(schema, PyArray_BYTES(py_arr));
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// Nodes that point at the memory of a buffer protocol exporter adopt it
+// using this allocator. The node holds a reference to a numpy array that
+// wraps the exporter until the node releases the memory, and that array
+// holds the buffer export, which keeps resizable exporters (bytearray,
+// array.array, ...) from moving or freeing the memory.
+//
+// Other memory (from allocations made later by the node or its children)
+// is plain heap memory.
+//---------------------------------------------------------------------------//
+static std::mutex &
+PyConduit_Buffer_Owners_Mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+//---------------------------------------------------------------------------//
+static std::multimap<void*, PyObject*> &
+PyConduit_Buffer_Owners()
+{
+    static std::multimap<void*, PyObject*> owners;
+    return owners;
+}
+
+//---------------------------------------------------------------------------//
+static void *
+PyConduit_Buffer_Allocate(size_t num_items,
+                          size_t item_size)
+{
+    return calloc(num_items, item_size);
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Buffer_Free(void *data_ptr)
+{
+    PyObject *owner = NULL;
+    {
+        std::lock_guard<std::mutex> lock(PyConduit_Buffer_Owners_Mutex());
+        std::multimap<void*, PyObject*> &owners = PyConduit_Buffer_Owners();
+        std::multimap<void*, PyObject*>::iterator itr = owners.find(data_ptr);
+        if(itr != owners.end())
+        {
+            owner = itr->second;
+            owners.erase(itr);
+        }
+    }
+
+    if(owner == NULL)
+    {
+        free(data_ptr);
+    }
+    // nodes may be released by threads that don't hold the GIL
+    else if(Py_IsInitialized())
+    {
+        PyGILState_STATE gil_state = PyGILState_Ensure();
+        Py_DECREF(owner);
+        PyGILState_Release(gil_state);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static index_t
+PyConduit_Buffer_Allocator_Id()
+{
+    static index_t allocator_id =
+        utils::register_allocator(PyConduit_Buffer_Allocate,
+                                  PyConduit_Buffer_Free);
+    return allocator_id;
+}
+
+//---------------------------------------------------------------------------//
+// Points node at the memory of a buffer protocol exporter (no copy),
+// through the numpy array py_arr that wraps it. On success the node takes
+// over the caller's reference to py_arr.
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_Adopt_From_Buffer(Node &node,
+                                 PyArrayObject *py_arr)
+{
+    Schema schema;
+    if(PyConduit_Numpy_Schema(py_arr, schema))
+    {
+        return -1;
+    }
+
+    void *data = PyArray_BYTES(py_arr);
+    if(data == NULL || schema.spanned_bytes() == 0)
+    {
+        // nothing to keep alive
+        node.set_external(schema, data);
+        Py_DECREF(py_arr);
+        return 0;
+    }
+
+    node.adopt(schema, data, PyConduit_Buffer_Allocator_Id());
+
+    std::lock_guard<std::mutex> lock(PyConduit_Buffer_Owners_Mutex());
+    PyConduit_Buffer_Owners().insert(std::make_pair(data, (PyObject*)py_arr));
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// python buffer protocol
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// held in Py_buffer::internal until the buffer is released
+//---------------------------------------------------------------------------//
+struct PyConduit_Buffer_Info
+{
+    std::vector<Py_ssize_t> shape;
+    std::vector<Py_ssize_t> strides;
+    std::string             format;
+};
+
+//---------------------------------------------------------------------------//
+// struct module format for a numeric dtype. byte order is only spelled out
+// for non native data, so the common case stays usable by memoryview
+//---------------------------------------------------------------------------//
+static std::string
+PyConduit_Buffer_Format(const DataType &dtype,
+                        bool explicit_order)
+{
+    std::string res;
+    index_t endianness = PyConduit_DataType_Endianness(dtype);
+
+    if(explicit_order || endianness != Endianness::machine_default())
+    {
+        if(endianness != Endianness::machine_default())
+        {
+            res += endianness == Endianness::LITTLE_ID ? "<" : ">";
+        }
+        else
+        {
+            res += "=";
+        }
+    }
+
+    switch(dtype.id())
+    {
+        case DataType::INT8_ID:    res += "b"; break;
+        case DataType::INT16_ID:   res += "h"; break;
+        case DataType::INT32_ID:   res += "i"; break;
+        case DataType::INT64_ID:   res += "q"; break;
+        case DataType::UINT8_ID:   res += "B"; break;
+        case DataType::UINT16_ID:  res += "H"; break;
+        case DataType::UINT32_ID:  res += "I"; break;
+        case DataType::UINT64_ID:  res += "Q"; break;
+        case DataType::FLOAT32_ID: res += "f"; break;
+        case DataType::FLOAT64_ID: res += "d"; break;
+        default: return std::string();
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Buffer_Is_Contiguous(const std::vector<Py_ssize_t> &shape,
+                               const std::vector<Py_ssize_t> &strides,
+                               Py_ssize_t itemsize,
+                               bool c_order)
+{
+    Py_ssize_t expected = itemsize;
+    size_t ndim = shape.size();
+    for(size_t i = 0; i < ndim; i++)
+    {
+        size_t idx = c_order ? ndim - 1 - i : i;
+        if(shape[idx] == 0)
+        {
+            return true;
+        }
+        if(shape[idx] != 1 && strides[idx] != expected)
+        {
+            return false;
+        }
+        expected *= shape[idx];
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// exposes numeric leaves (1D), uniform mcarrays (2D) and record layouts
+// (1D, struct format) in place. Buffers are always writable.
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_getbuffer(PyConduit_Node *self,
+                         Py_buffer *view,
+                         int flags)
+{
+    if(view == NULL)
+    {
+        PyErr_SetString(PyExc_BufferError, "NULL view in getbuffer");
+        return -1;
+    }
+
+    view->obj = NULL;
+
+    PyConduit_View_Layout layout;
+    std::string err_msg;
+
+    if(!PyConduit_Node_View_Layout(*self->node, layout, err_msg))
+    {
+        PyErr_SetString(PyExc_BufferError, err_msg.c_str());
+        return -1;
+    }
+
+    PyConduit_Buffer_Info *info = new PyConduit_Buffer_Info();
+
+    if(self->node->dtype().has_shape())
+    {
+        // leaves are exposed with their N-D shape (C order)
+        const DataType &dtype = self->node->dtype();
+        for(index_t i = 0; i < dtype.number_of_dimensions(); i++)
+        {
+            info->shape.push_back((Py_ssize_t)dtype.dimension(i));
+            info->strides.push_back((Py_ssize_t)dtype.dimension_stride(i));
+        }
+    }
+    else
+    {
+        info->shape.push_back((Py_ssize_t)layout.num_ele);
+        info->strides.push_back((Py_ssize_t)layout.stride);
+    }
+
+    if(layout.uniform)
+    {
+        info->format = PyConduit_Buffer_Format(layout.comp_dtypes[0], false);
+        if(layout.num_comps > 0)
+        {
+            info->shape.push_back((Py_ssize_t)layout.num_comps);
+            info->strides.push_back((Py_ssize_t)layout.comp_stride);
+        }
+    }
+    else
+    {
+        // fields in offset order, with explicit padding
+        std::vector<std::pair<index_t,size_t> > order;
+        for(size_t i = 0; i < layout.comp_offsets.size(); i++)
+        {
+            order.push_back(std::make_pair(layout.comp_offsets[i], i));
+        }
+        std::sort(order.begin(), order.end());
+
+        std::ostringstream oss;
+        oss << "T{";
+        index_t pos = 0;
+        for(size_t i = 0; i < order.size() && err_msg.empty(); i++)
+        {
+            const DataType &fld_dtype = layout.comp_dtypes[order[i].second];
+            index_t offset = order[i].first;
+            if(offset < pos)
+            {
+                err_msg = "overlapping fields can't be exposed through"
+                          " the buffer protocol";
+                break;
+            }
+            if(offset > pos)
+            {
+                oss << (offset - pos) << "x";
+            }
+            oss << PyConduit_Buffer_Format(fld_dtype, true)
+                << ":" << layout.comp_names[order[i].second] << ":";
+            pos = offset + fld_dtype.element_bytes();
+        }
+        if(layout.itemsize > pos)
+        {
+            oss << (layout.itemsize - pos) << "x";
+        }
+        oss << "}";
+        if(err_msg.empty())
+        {
+            info->format = oss.str();
+        }
+    }
+
+    if(info->format.empty())
+    {
+        delete info;
+        if(err_msg.empty())
+        {
+            err_msg = "node data type is not supported by the buffer"
+                      " protocol";
+        }
+        PyErr_SetString(PyExc_BufferError, err_msg.c_str());
+        return -1;
+    }
+
+    Py_ssize_t itemsize = (Py_ssize_t)layout.itemsize;
+    bool c_contig = PyConduit_Buffer_Is_Contiguous(info->shape,
+                                                   info->strides,
+                                                   itemsize,
+                                                   true);
+    bool f_contig = PyConduit_Buffer_Is_Contiguous(info->shape,
+                                                   info->strides,
+                                                   itemsize,
+                                                   false);
+
+    bool ok = true;
+    if((flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS)
+    {
+        ok = c_contig;
+    }
+    else if((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS)
+    {
+        ok = f_contig;
+    }
+    else if((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS)
+    {
+        ok = c_contig || f_contig;
+    }
+    else if((flags & PyBUF_STRIDES) != PyBUF_STRIDES)
+    {
+        // consumer can't handle strides
+        ok = c_contig;
+    }
+
+    if(!ok)
+    {
+        delete info;
+        PyErr_SetString(PyExc_BufferError,
+                        "node data is not contiguous in the requested order");
+        return -1;
+    }
+
+    Py_ssize_t num_items = 1;
+    for(size_t i = 0; i < info->shape.size(); i++)
+    {
+        num_items *= info->shape[i];
+    }
+
+    view->buf        = layout.data;
+    view->len        = num_items * itemsize;
+    view->readonly   = 0;
+    view->itemsize   = itemsize;
+    view->format     = NULL;
+    view->ndim       = (int)info->shape.size();
+    view->shape      = NULL;
+    view->strides    = NULL;
+    view->suboffsets = NULL;
+    view->internal   = info;
+
+    if((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+    {
+        view->format = const_cast<char*>(info->format.c_str());
+    }
+
+    if((flags & PyBUF_ND) == PyBUF_ND)
+    {
+        view->shape = &info->shape[0];
+    }
+    else
+    {
+        view->ndim = 1;
+    }
+
+    if((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+    {
+        view->strides = &info->strides[0];
+    }
+
+    view->obj = (PyObject*)self;
+    Py_INCREF(self);
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_releasebuffer(PyConduit_Node *, // self
+                             Py_buffer *view)
+{
+    delete (PyConduit_Buffer_Info*)view->internal;
+    view->internal = NULL;
+}
+
+//---------------------------------------------------------------------------//
+// begin Node python special methods
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_new(PyTypeObject* type,
+                   PyObject* args,
+                   PyObject* kwds)
+{
+    static const char *kwlist[] = {"value", NULL};
+    PyObject* value = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwds,
+                                     "|O",
+                                     const_cast<char**>(kwlist),
+                                     &value))
+    {
+        return (NULL);
+    }
+
+    PyConduit_Node* self = (PyConduit_Node*)type->tp_alloc(type, 0);
+
+    if (self)
+    {
+        self->node = 0;
+        self->python_owns = 0;
+    }
+
+    return ((PyObject*)self);
+}
+
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_init(PyConduit_Node* self,
+                    PyObject* args,
+                    PyObject* kwds)
+{
+    static const char *kwlist[] = {"value", NULL};
+    PyObject* value = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwds,
+                                     "|O",
+                                     const_cast<char**>(kwlist),
+                                     &value))
+    {
+        return 0;
+    }
+    
+    self->node = new Node();
+    self->python_owns = 1;
+
+    if (value)
+    {
+        return (PyConduit_Node_Set_From_Python(*self->node, value));
+    }
+    else 
+    {
+        return 0;
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void 
+PyConduit_Node_dealloc(PyConduit_Node* self)
+{
+    if(self->python_owns)
+    {
+       delete self->node;
+    }
+
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_str(PyConduit_Node* self)
+{
+   return (Py_BuildValue("s", self->node->to_summary_string().c_str()));
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_repr(PyConduit_Node* self)
+{
+   return (Py_BuildValue("s", self->node->to_summary_string().c_str()));
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_GetItem(PyConduit_Node* self,
+                       PyObject* key)
+{
+    PyObject* retval = NULL;
+
+    if(PyString_Check(key))
+    {
+        char* ckey = PyString_AsString(key);
+
+        if(self->node->has_path(ckey))
+        {
+            Node& node = (*self->node)[ckey];
+            retval = PyConduit_Convert_Node_To_Python(node);
+        }
+        else
+        {
+            retval = PyConduit_Node_Python_Wrap(&(*self->node)[ckey],0);
+        }
+    
+        PyString_AsString_Cleanup(ckey);
+    }
+    else if(PyNumber_Check(key))
+    {
+        Py_ssize_t idx = PyNumber_AsSsize_t(key,NULL);
+        Node& node = (*self->node)[idx];
+        retval = PyConduit_Convert_Node_To_Python(node);
+    }
+    else
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "Key must be a string or integer index");
+    }
+    
+    return (retval);
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_python_owns(PyConduit_Node *self)
+{
+    if(self->python_owns)
+    {
+        Py_RETURN_TRUE;
+    }
+    else
+    {
+        Py_RETURN_FALSE;
+    }
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_python_detach(PyConduit_Node *self)
+{
+    self->python_owns = 0;
+    Py_RETURN_NONE;
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_python_attach(PyConduit_Node *self)
 {
     self->python_owns = 1;
     Py_RETURN_NONE;
@@ -5183,6 +6404,29 @@ PyConduit_Node_value(PyConduit_Node* self)
     return (retval);
 }
 
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_ndarray_view(PyConduit_Node* self,
+                            PyObject* args,
+                            PyObject* kwargs)
+{
+    static const char *kwlist[] = {"shape", NULL};
+    PyObject *py_shape = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "|O",
+                                     const_cast<char**>(kwlist),
+                                     &py_shape))
+    {
+        return (NULL);
+    }
+
+    return PyConduit_Node_Create_Numpy_View((PyObject*)self,
+                                            *self->node,
+                                            py_shape);
+}
+
 //---------------------------------------------------------------------------//
 static PyObject *
 PyConduit_Node_generate(PyConduit_Node* self,
@@ -6113,10 +7357,14 @@ PyConduit_Node_set_external(PyConduit_Node* self,
     PyObject* value = NULL;
 
     if( !PyArg_ParseTuple(args, "O", &value) ||
-        ( !PyConduit_Node_Check(value) && !PyArray_Check(value) ) )
+        ( !PyConduit_Node_Check(value) &&
+          !PyArray_Check(value) &&
+          !PyObject_CheckBuffer(value) ) )
     {
         PyErr_SetString(PyExc_TypeError,
-                        "set_external requires a numpy array or conduit Node");
+                        "set_external requires a numpy array, an object"
+                        " that supports the buffer protocol, or a conduit"
+                        " Node");
         return NULL;
     }
 
@@ -6129,93 +7377,38 @@ PyConduit_Node_set_external(PyConduit_Node* self,
     }
 
     // numpy array case
-    PyArray_Descr *desc = PyArray_DESCR((PyArrayObject*)value);
-    PyArrayObject *py_arr = (PyArrayObject*)value;
-    npy_intp num_ele = PyArray_SIZE(py_arr);
-    index_t offset = 0;
-    index_t stride = (index_t) PyArray_STRIDE(py_arr, 0);
-    int nd = PyArray_NDIM(py_arr);
+    if(PyArray_Check(value))
+    {
+        if(PyConduit_Node_Set_External_From_Numpy(*self->node,
+                                                  (PyArrayObject*)value))
+        {
+            return NULL;
+        }
+        Py_RETURN_NONE;
+    }
 
-    if (nd > 1)
+    // buffer protocol case: numpy wraps the buffer without a copy, and
+    // the node keeps that wrapper (and with it the exporter's buffer
+    // export) alive for as long as it uses the memory
+    PyObject *py_arr = PyArray_FromAny(value, NULL, 0, 0, 0, NULL);
+    if(py_arr == NULL)
     {
-        PyErr_SetString(PyExc_TypeError,
-                        "set_external does not handle multidimensional numpy"
-                        " arrays or multidimensional complex strided views"
-                        " into numpy arrays."
-                        " Views that are effectively 1D-strided are"
-                        "supported.");
-        return (NULL);
+        return NULL;
     }
 
-    Node& node = *self->node;
+    if(!PyArray_ISWRITEABLE((PyArrayObject*)py_arr))
+    {
+        Py_DECREF(py_arr);
+        PyErr_SetString(PyExc_TypeError,
+                        "set_external requires a writable buffer");
+        return NULL;
+    }
 
-    switch (desc->type_num) 
+    if(PyConduit_Node_Adopt_From_Buffer(*self->node,
+                                        (PyArrayObject*)py_arr))
     {
-        case NPY_UINT8 :
-        {
-            uint8 *numpy_data = (uint8*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_UINT16 :
-        {
-            uint16 *numpy_data = (uint16*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_UINT32 :
-        {
-            uint32 *numpy_data = (uint32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_UINT64 :
-        {
-            uint64 *numpy_data = (uint64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT8 :
-        {
-            int8 *numpy_data = (int8*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT16 :
-        {
-            int16 *numpy_data = (int16*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT32 :
-        {
-            int32 *numpy_data = (int32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT64 :
-        {
-            int64 *numpy_data = (int64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_FLOAT32 :
-        {
-            float32 *numpy_data = (float32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_FLOAT64 :
-        {
-            float64 *numpy_data = (float64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        default :
-        {
-            PyErr_SetString(PyExc_TypeError, "Unsupported type");
-            return (NULL);
-        }
+        Py_DECREF(py_arr);
+        return NULL;
     }
 
     Py_RETURN_NONE;
@@ -6861,6 +8054,14 @@ static PyMethodDef PyConduit_Node_METHODS[] = {
      METH_NOARGS, 
      "Value access for leaf nodes"},
     //-----------------------------------------------------------------------//
+    {"ndarray_view",
+     (PyCFunction)PyConduit_Node_ndarray_view,
+     METH_VARARGS | METH_KEYWORDS,
+     "Zero-copy numpy view of a numeric leaf, or of a node whose children"
+     " are numeric leaves with the same number of elements and stride"
+     " (2D for evenly spaced children of one type, otherwise a structured"
+     " array). The optional 'shape' reshapes the element axis."},
+    //-----------------------------------------------------------------------//
     {"generate",
      (PyCFunction)PyConduit_Node_generate,
      METH_VARARGS,  // will become kwargs
@@ -6989,6 +8190,18 @@ static PyMappingMethods node_as_mapping = {
    (objobjargproc)PyConduit_Node_SetItem,
 };
 
+//---------------------------------------------------------------------------//
+static PyBufferProcs node_as_buffer = {
+#if !defined(IS_PY3K)
+   (readbufferproc)0,
+   (writebufferproc)0,
+   (segcountproc)0,
+   (charbufferproc)0,
+#endif
+   (getbufferproc)PyConduit_Node_getbuffer,
+   (releasebufferproc)PyConduit_Node_releasebuffer,
+};
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -7015,8 +8228,12 @@ static PyTypeObject PyConduit_Node_TYPE = {
    (reprfunc)PyConduit_Node_str,                         /* str */
    0, /* getattro */
    0, /* setattro */
-   0, /* asbuffer */
+   &node_as_buffer, /* asbuffer */
+#if defined(IS_PY3K)
    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,     /* flags */
+#else
+   Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_NEWBUFFER,
+#endif
    "Conduit node objects",
    0, /* traverse */
    0, /* clear */
@@ -7491,76 +8708,101 @@ PyConduit_Node_Set_From_Python(Node &node,
             }
             case NPY_UINT8 :
             {
-                node.set(DataType::uint8(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::uint8(num_ele), py_arr));
                 uint8_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_UINT16 :
             {
-                node.set(DataType::uint16(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::uint16(num_ele), py_arr));
                 uint16_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_UINT32 :
             {
-                node.set(DataType::uint32(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::uint32(num_ele), py_arr));
                 uint32_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_UINT64 :
             {
-                node.set(DataType::uint64(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::uint64(num_ele), py_arr));
                 uint64_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_INT8 :
             {
-                node.set(DataType::int8(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::int8(num_ele), py_arr));
                 int8_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_INT16 :
             {
-                node.set(DataType::int16(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::int16(num_ele), py_arr));
                 int16_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_INT32 :
             {
-                node.set(DataType::int32(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::int32(num_ele), py_arr));
                 int32_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_INT64 :
             {
-                node.set(DataType::int64(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::int64(num_ele), py_arr));
                 int64_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_FLOAT32 :
             {
-                node.set(DataType::float32(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::float32(num_ele), py_arr));
                 float32_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             case NPY_FLOAT64 :
             {
-                node.set(DataType::float64(num_ele));
+                node.set(PyConduit_Numpy_Shaped_DataType(
+                            DataType::float64(num_ele), py_arr));
                 float64_array c_arr = node.value();
                 PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
                 break;
             }
             default:
             {
+                if(PyDataType_HASFIELDS(desc))
+                {
+                    // structured arrays are copied field by field
+                    PyArrayObject *py_carr = PyArray_GETCONTIGUOUS(py_arr);
+                    Node n_view;
+                    int res = PyConduit_Node_Set_External_From_Numpy(n_view,
+                                                                     py_carr);
+                    if(res == 0)
+                    {
+                        node.set(n_view);
+                    }
+                    Py_DECREF(py_carr);
+                    return res;
+                }
+
                 std::ostringstream err_msg;
                 err_msg << "PyArray Array Type not supported: "
                         << desc->kind;
@@ -7691,7 +8933,28 @@ PyConduit_Create_Numpy_Type(Node& node,
     {
         retval = PyArray_Scalar(data, descr, NULL);
     }
-    else 
+    else if(dtype.has_shape())
+    {
+        // N-D leaves are returned with their shape (C order)
+        int nd = (int)dtype.number_of_dimensions();
+        std::vector<npy_intp> dims(nd);
+        std::vector<npy_intp> strides(nd);
+        for(int i = 0; i < nd; i++)
+        {
+            dims[i]    = (npy_intp)dtype.dimension(i);
+            strides[i] = (npy_intp)dtype.dimension_stride(i);
+        }
+        retval = PyArray_New(&PyArray_Type,
+                             nd,
+                             &dims[0],
+                             type,
+                             &strides[0],
+                             data,
+                             0,
+                             NPY_ARRAY_WRITEABLE,
+                             NULL);
+    }
+    else
     {
         retval = PyArray_SimpleNewFromData(1, &len, type, data);
 
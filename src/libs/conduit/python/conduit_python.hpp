@@ -18,11 +18,63 @@
 #include <structmember.h>
 #include "bytesobject.h"
 
+//---------------------------------------------------------------------------//
+// -- standard lib includes --
+//---------------------------------------------------------------------------//
+#include <exception>
+#include <string>
+
 //---------------------------------------------------------------------------//
 // conduit includes
 //---------------------------------------------------------------------------//
 #include "conduit.hpp"
 
+//---------------------------------------------------------------------------//
+// Calls func() with the GIL released, so other python threads can run
+// while conduit does the work. func must not use the python api.
+//
+// Errors thrown by func are caught before the GIL is reacquired. They
+// are set as a python exception of type py_exc_type and false is returned.
+//---------------------------------------------------------------------------//
+template<typename Func>
+static bool
+PyConduit_Call_Without_GIL(PyObject *py_exc_type,
+                           Func func)
+{
+    std::string err_msg;
+    bool        err = false;
+
+    Py_BEGIN_ALLOW_THREADS
+    try
+    {
+        func();
+    }
+    catch(conduit::Error &e)
+    {
+        err_msg = e.message();
+        err = true;
+    }
+    catch(std::exception &e)
+    {
+        err_msg = e.what();
+        err = true;
+    }
+    catch(...)
+    {
+        err_msg = "unknown C++ exception";
+        err = true;
+    }
+    Py_END_ALLOW_THREADS
+
+    if(err)
+    {
+        PyErr_SetString(py_exc_type,
+                        err_msg.c_str());
+    }
+
+    return !err;
+}
+
 //---------------------------------------------------------------------------//
 // These methods are exposed via python capsule at conduit._C_API, 
 // which allows them called in other python C modules.
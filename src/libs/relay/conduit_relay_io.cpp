@@ -33,6 +33,7 @@
 
 #include "conduit_relay_io_handle.hpp"
 #include "conduit_relay_io_csv.hpp"
+#include "conduit_relay_io_table.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -84,6 +85,9 @@ about(Node &n)
     // write table blueprints to csv
     io_protos["csv"] = "enabled";
 
+    // columnar binary files for table blueprints
+    io_protos["conduit_table"] = "enabled";
+
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
     // hdf5
     io_protos["hdf5"] = "enabled";
@@ -342,24 +346,17 @@ save(const Node &node,
     {
         write_csv(node, path, options);
     }
+    else if(protocol == "conduit_table")
+    {
+        write_table(node, path, options);
+    }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
         // hdf5 is the only protocol that currently takes "options"
-        Node prev_options;
-        if(options.has_child("hdf5"))
-        {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
-        }
-
+        // hdf5 applies options["hdf5"] for this write only
         hdf5_save(node,path,options);
 
-        if(!prev_options.dtype().is_empty())
-        {
-            hdf5_set_options(prev_options);
-        }
-
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " <<
                       "Failed to save conduit node to path " << path);
@@ -458,19 +455,8 @@ save_merged(const Node &node,
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
         // hdf5 is the only protocol that currently takes "options"
-        Node prev_options;
-        if(options.has_child("hdf5"))
-        {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
-        }
-
+        // hdf5 applies options["hdf5"] for this write only
         hdf5_append(node,path,options);
-
-        if(!prev_options.dtype().is_empty())
-        {
-            hdf5_set_options(prev_options);
-        }
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " <<
                       "Failed to save conduit node to path " << path);
@@ -560,6 +546,10 @@ load(const std::string &path,
     {
         read_csv(path, options, node);
     }
+    else if(protocol == "conduit_table")
+    {
+        read_table(path, options, node);
+    }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
@@ -10,15 +10,20 @@
 #include "conduit_relay_io_csv.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <utility>
 #include <type_traits>
+#include <vector>
 
 #include "conduit_log.hpp"
+#include "conduit_execution.hpp"
 #include "conduit_blueprint_table.hpp"
 
 using conduit::utils::log::quote;
@@ -51,6 +56,38 @@ namespace io
 
 // Static functions, internal types
 
+//-----------------------------------------------------------------------------
+// Options used by the reader
+//-----------------------------------------------------------------------------
+struct CSVReadOptions
+{
+    // Floating point columns are float64 instead of float32
+    bool use_float64;
+    // Columns of integers are int64
+    bool infer_types;
+};
+
+//-----------------------------------------------------------------------------
+// Options used by the writer
+//-----------------------------------------------------------------------------
+struct CSVWriteOptions
+{
+    // Significant digits of floating point values
+    int precision;
+};
+
+// Number of rows parsed or formatted by a single task
+static const index_t csv_rows_per_task = 4096;
+
+// Number of rows formatted before they are written to the file
+static const index_t csv_write_rows_per_block = 16 * csv_rows_per_task;
+
+// Number of rows used to pick the column types
+static const index_t csv_inference_rows = 1000;
+
+// Size of the chunks used to read the file
+static const std::size_t csv_read_chunk_bytes = 16 << 20;
+
 //-----------------------------------------------------------------------------
 static index_t
 get_nrows(const Node &table)
@@ -69,8 +106,14 @@ get_nrows(const Node &table)
 }
 
 //-----------------------------------------------------------------------------
+/**
+@brief Collects the leaves that make up the columns of the table (mcarray
+    components are separate columns) and builds the header line.
+*/
 static void
-write_header(const Node &values, std::ofstream &fout)
+gather_columns(const Node &values,
+               std::vector<const Node*> &columns,
+               std::string &header)
 {
     const index_t ncols = values.number_of_children();
     for(index_t col = 0; col < ncols; col++)
@@ -83,52 +126,155 @@ write_header(const Node &values, std::ofstream &fout)
             // Each column is "base_name/comp_name"
             for(index_t c = 0; c < nc; c++)
             {
-                fout << base_name << "/" << value[c].name();
-                if(c != (nc - 1)) fout << ", ";
+                header += base_name + "/" + value[c].name();
+                if(c != (nc - 1)) header += ", ";
+                columns.push_back(&value[c]);
             }
         }
         else
         {
-            fout << base_name;
+            header += base_name;
+            columns.push_back(&value);
         }
 
-        if(col != (ncols - 1)) fout << ", ";
+        if(col != (ncols - 1)) header += ", ";
     }
-    fout << std::endl;
+    header += "\n";
 }
 
 //-----------------------------------------------------------------------------
-static void
-write_element(const Node &e, std::ostream &fout)
+static inline void
+format_value(uint64 v, int, std::string &out)
 {
-    if(e.dtype().is_unsigned_integer())
+    char tmp[24];
+    int pos = 24;
+    do
     {
-        fout << e.to_uint64();
-    }
-    else if(e.dtype().is_integer())
+        tmp[--pos] = static_cast<char>('0' + (v % 10));
+        v /= 10;
+    } while(v != 0);
+    out.append(tmp + pos, 24 - pos);
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+format_value(int64 v, int precision, std::string &out)
+{
+    if(v < 0)
     {
-        fout << e.to_int64();
+        out.push_back('-');
+        // negate in unsigned space, so the min value is handled
+        format_value(uint64(0) - static_cast<uint64>(v), precision, out);
     }
-    else if(e.dtype().is_float32())
+    else
     {
-        fout << e.as_float32();
+        format_value(static_cast<uint64>(v), precision, out);
     }
-    else if(e.dtype().is_float64())
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+format_value(float64 v, int precision, std::string &out)
+{
+    // same output as std::ostream with the given precision
+    char tmp[64];
+    const int len = snprintf(tmp, sizeof(tmp), "%.*g", precision, v);
+    out.append(tmp, static_cast<std::size_t>(len));
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Formats rows [begin, end) of a column into out. The end offset of each
+    cell in out is appended to cell_ends.
+*/
+template<typename T, typename FormatType>
+static void
+format_cells(const Node &column, index_t begin, index_t end,
+    int precision, std::string &out, std::vector<index_t> &cell_ends)
+{
+    const uint8 *data = static_cast<const uint8*>(column.element_ptr(0));
+    const index_t stride = column.dtype().stride();
+    for(index_t row = begin; row < end; row++)
     {
-        fout << e.as_float64();
+        T val;
+        std::memcpy(&val, data + row * stride, sizeof(T));
+        format_value(static_cast<FormatType>(val), precision, out);
+        cell_ends.push_back(static_cast<index_t>(out.size()));
     }
-    else if(e.dtype().is_string())
+}
+
+//-----------------------------------------------------------------------------
+static void
+format_column(const Node &column, index_t begin, index_t end,
+    int precision, std::string &out, std::vector<index_t> &cell_ends)
+{
+    out.clear();
+    cell_ends.clear();
+    switch(column.dtype().id())
     {
-        fout << e.as_string();
+        case DataType::INT8_ID:
+            format_cells<int8, int64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::INT16_ID:
+            format_cells<int16, int64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::INT32_ID:
+            format_cells<int32, int64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::INT64_ID:
+            format_cells<int64, int64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::UINT8_ID:
+            format_cells<uint8, uint64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::UINT16_ID:
+            format_cells<uint16, uint64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::UINT32_ID:
+            format_cells<uint32, uint64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::UINT64_ID:
+            format_cells<uint64, uint64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::FLOAT32_ID:
+            format_cells<float32, float64>(column, begin, end, precision, out, cell_ends);
+            break;
+        case DataType::FLOAT64_ID:
+            format_cells<float64, float64>(column, begin, end, precision, out, cell_ends);
+            break;
+        default:
+            CONDUIT_ERROR("Unsupported data type " << quote(column.dtype().name())
+                << " for column " << quote(column.path()) << "."
+                << " write_csv only supports numeric columns.");
     }
 }
 
 //-----------------------------------------------------------------------------
+/**
+@brief Writes the table in blocks of rows. The cells of each block are
+    formatted in parallel (one task per column and sub block of rows) and
+    then interleaved into rows in a single buffer that is written at once.
+*/
 static void
-write_row_based(const Node &table, const std::string &path)
+write_single_table(const Node &table, const std::string &path,
+    const CSVWriteOptions &opts)
 {
     const Node &values = table["values"];
 
+    std::vector<const Node*> columns;
+    std::string header;
+    gather_columns(values, columns, header);
+
+    for(const Node *column : columns)
+    {
+        if(!column->dtype().is_number())
+        {
+            CONDUIT_ERROR("Unsupported data type " << quote(column->dtype().name())
+                << " for column " << quote(column->path()) << "."
+                << " write_csv only supports numeric columns.");
+        }
+    }
+
     // Open the file
     std::ofstream fout(path);
     if(!fout.is_open())
@@ -138,53 +284,64 @@ write_row_based(const Node &table, const std::string &path)
     }
 
     // First line, column names
-    write_header(values, fout);
+    fout.write(header.data(), header.size());
 
     // Write each row: col0, col1, col2, col3 ...
     const index_t nrows = get_nrows(table);
-    const index_t ncols = values.number_of_children();
-    Node temp;
-    for(index_t row = 0; row < nrows; row++)
+    const index_t ncols = static_cast<index_t>(columns.size());
+    const index_t nsub_blocks = csv_write_rows_per_block / csv_rows_per_task;
+
+    std::vector<std::string> cells(ncols * nsub_blocks);
+    std::vector<std::vector<index_t>> cell_ends(ncols * nsub_blocks);
+    std::string out;
+
+    for(index_t block_begin = 0; block_begin < nrows;
+        block_begin += csv_write_rows_per_block)
     {
-        for(index_t col = 0; col < ncols; col++)
+        const index_t block_end = std::min(nrows,
+            block_begin + csv_write_rows_per_block);
+
+        // task t formats column (t % ncols) of sub block (t / ncols)
+        execution::for_all(0, ncols * nsub_blocks, [&](index_t t)
         {
-            const Node &value = values[col];
-            const index_t nc = value.number_of_children();
-            if(nc > 0)
+            const index_t col = t % ncols;
+            const index_t sub_begin = block_begin + (t / ncols) * csv_rows_per_task;
+            const index_t sub_end = std::min(block_end, sub_begin + csv_rows_per_task);
+            if(sub_begin < sub_end)
             {
-                for(index_t c = 0; c < nc; c++)
-                {
-                    const Node &comp = value[c];
-                    temp.set_external(DataType(comp.dtype().id(), 1),
-                        const_cast<void*>(comp.element_ptr(row)));
-                    write_element(temp, fout);
-                    if(c != (nc - 1)) fout << ", ";
-                }
+                format_column(*columns[col], sub_begin, sub_end,
+                    opts.precision, cells[t], cell_ends[t]);
             }
-            else
+        });
+
+        // interleave the cells into rows
+        out.clear();
+        for(index_t row = block_begin; row < block_end; row++)
+        {
+            const index_t sub = (row - block_begin) / csv_rows_per_task;
+            const index_t idx = (row - block_begin) % csv_rows_per_task;
+            for(index_t col = 0; col < ncols; col++)
             {
-                temp.set_external(DataType(value.dtype().id(), 1),
-                    const_cast<void*>(value.element_ptr(row)));
-                write_element(temp, fout);
+                const index_t t = sub * ncols + col;
+                const index_t cell_begin = (idx > 0) ? cell_ends[t][idx - 1] : 0;
+                out.append(cells[t], cell_begin, cell_ends[t][idx] - cell_begin);
+                if(col != (ncols - 1)) out += ", ";
             }
-
-            if(col != (ncols - 1)) fout << ", ";
+            out += '\n';
         }
-        fout << "\n";
+        fout.write(out.data(), out.size());
     }
-}
 
-//-----------------------------------------------------------------------------
-static void
-write_single_table(const Node &table, const std::string &path)
-{
-    // IDEA: Write column based writer and benchmark performance
-    write_row_based(table, path);
+    if(!fout)
+    {
+        CONDUIT_ERROR("Failed to write file " << quote(path) << ".");
+    }
 }
 
 //-----------------------------------------------------------------------------
 static void
-write_multiple_tables(const Node &all_tables, const std::string &base_path)
+write_multiple_tables(const Node &all_tables, const std::string &base_path,
+    const CSVWriteOptions &opts)
 {
     const index_t ntables = all_tables.number_of_children();
     if(ntables < 1)
@@ -200,7 +357,7 @@ write_multiple_tables(const Node &all_tables, const std::string &base_path)
             const Node &table = all_tables[i];
             const std::string full_path = base_path + utils::file_path_separator()
                 + table_list_prefix + std::to_string(i) + ".csv";
-            write_single_table(table, full_path);
+            write_single_table(table, full_path, opts);
         }
     }
     else // if(table.dtype().is_object())
@@ -210,7 +367,7 @@ write_multiple_tables(const Node &all_tables, const std::string &base_path)
             const Node &table = all_tables[i];
             const std::string full_path = base_path + utils::file_path_separator()
                 + table.name() + ".csv";
-            write_single_table(table, full_path);
+            write_single_table(table, full_path, opts);
         }
     }
 }
@@ -242,30 +399,6 @@ add_column(const std::string &name, Node &values)
     }
 }
 
-//-----------------------------------------------------------------------------
-static void
-add_columns(Node &values, std::vector<std::string> &col_names,
-    index_t ncols, const DataType &dtype)
-{
-    if(col_names.empty())
-    {
-        for(index_t i = 0; i < ncols; i++)
-        {
-            Node &col = add_column("", values);
-            col.set_dtype(dtype);
-            col_names.push_back(col.name());
-        }
-    }
-    else
-    {
-        for(const std::string &name : col_names)
-        {
-            Node &col = add_column(name, values);
-            col.set_dtype(dtype);
-        }
-    }
-}
-
 //-----------------------------------------------------------------------------
 /**
 @brief Reads the first line of the file. Populates "col_names" with the names
@@ -322,184 +455,533 @@ read_column_names(const std::string &line, std::vector<std::string> &col_names,
 }
 
 //-----------------------------------------------------------------------------
-template<typename FloatType>
-void
-read_csv_data(std::ifstream &fin, const std::ifstream::pos_type &offset,
-    const std::vector<std::string> &col_names, Node &values,
-    const char sep = ',')
+/**
+@brief Reads the whole file into buf, in chunks, and adds a terminating null
+    character so number parsing never runs past the end of the data.
+*/
+static void
+read_file_contents(const std::string &path, std::vector<char> &buf)
 {
-    static_assert(std::is_floating_point<FloatType>().value,
-        "Function can only read floating point types from CSV file.");
-    std::string line;
-    fin.clear();
-    fin.seekg(offset, fin.beg);
-    index_t row = 0;
-    while(std::getline(fin, line))
-    {
-        std::size_t icol = 0;
-        std::size_t start = 0;
-        std::size_t end = line.find(sep);
-        while(end != std::string::npos)
-        {
-            const auto len = end - start;
-            if(icol > col_names.size())
-            {
-                CONDUIT_ERROR("Error while reading file, row " << row << " contains too many column entries!");
-                return;
-            }
+    std::ifstream fin(path, std::ios::in | std::ios::binary);
+    if(!fin.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+        return;
+    }
+
+    buf.clear();
+    const int64 file_size = utils::file_size(path);
+    if(file_size > 0)
+    {
+        buf.reserve(static_cast<std::size_t>(file_size) + 1);
+    }
 
-            Node *n = values.fetch_ptr(col_names[icol]);
-            if(!n)
+    const std::size_t chunk_size = csv_read_chunk_bytes;
+    std::size_t nbytes = 0;
+    while(fin)
+    {
+        buf.resize(nbytes + chunk_size);
+        fin.read(&buf[nbytes], chunk_size);
+        nbytes += static_cast<std::size_t>(fin.gcount());
+    }
+    buf.resize(nbytes);
+    buf.push_back('\0');
+}
+
+//-----------------------------------------------------------------------------
+static inline bool
+is_blank(const char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief True if a (non blank) row starts at data[pos].
+*/
+static inline bool
+is_row_start(const char *data, index_t pos, index_t data_begin,
+    index_t data_end)
+{
+    if(pos != data_begin && data[pos - 1] != '\n')
+    {
+        return false;
+    }
+    while(pos < data_end && is_blank(data[pos]))
+    {
+        pos++;
+    }
+    return pos < data_end && data[pos] != '\n';
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Finds the offsets of the rows in data[data_begin, data_end), blank
+    lines are skipped. The data is split into blocks that are scanned in
+    parallel.
+*/
+static void
+find_rows(const char *data, index_t data_begin, index_t data_end,
+    std::vector<index_t> &row_starts)
+{
+    const index_t block_bytes = execution::DEFAULT_BLOCK_BYTES;
+    const index_t nbytes = data_end - data_begin;
+    const index_t nblocks = (nbytes + block_bytes - 1) / block_bytes;
+
+    // count the rows that start in each block
+    std::vector<index_t> block_offsets(nblocks + 1, 0);
+    execution::for_all(0, nblocks, [&](index_t b)
+    {
+        const index_t b_begin = data_begin + b * block_bytes;
+        const index_t b_end = std::min(data_end, b_begin + block_bytes);
+        index_t count = 0;
+        for(index_t pos = b_begin; pos < b_end; pos++)
+        {
+            if(is_row_start(data, pos, data_begin, data_end))
             {
-                CONDUIT_ERROR("The allocated output table does not contain the path " << quote(col_names[icol]) << ".");
-                return;
+                count++;
             }
+        }
+        block_offsets[b + 1] = count;
+    });
 
-            std::string data = line.substr(start, len);
-            try
+    for(index_t b = 0; b < nblocks; b++)
+    {
+        block_offsets[b + 1] += block_offsets[b];
+    }
+
+    // record the row starts
+    row_starts.resize(block_offsets[nblocks]);
+    execution::for_all(0, nblocks, [&](index_t b)
+    {
+        const index_t b_begin = data_begin + b * block_bytes;
+        const index_t b_end = std::min(data_end, b_begin + block_bytes);
+        index_t idx = block_offsets[b];
+        for(index_t pos = b_begin; pos < b_end; pos++)
+        {
+            if(is_row_start(data, pos, data_begin, data_end))
             {
-                if(std::is_same<float, FloatType>().value)
-                {
-                    float *d = static_cast<float*>(n->element_ptr(row));
-                    *d = std::stof(data);
-                }
-                else if(std::is_same<double, FloatType>().value)
-                {
-                    double *d = static_cast<double*>(n->element_ptr(row));
-                    *d = std::stod(data);
-                }
-#ifdef CONDUIT_HAS_LONG_DOUBLE
-                else if(std::is_same<long double, FloatType>().value)
-                {
-                    long double *d = static_cast<long double*>(n->element_ptr(row));
-                    *d = std::stold(data);
-                }
-#endif
+                row_starts[idx++] = pos;
             }
-            catch (...)
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Finds the cells of the row that starts at row_begin. Cell i spans
+    [cells[2*i], cells[2*i+1]) with the surrounding blanks removed.
+*/
+static void
+split_row(const char *row_begin, const char *data_end, index_t row,
+    index_t ncols, std::vector<const char*> &cells, const char sep = ',')
+{
+    const char *line_end = static_cast<const char*>(
+        std::memchr(row_begin, '\n', data_end - row_begin));
+    if(line_end == nullptr)
+    {
+        line_end = data_end;
+    }
+
+    cells.clear();
+    const char *cell_begin = row_begin;
+    for(index_t col = 0; col < ncols; col++)
+    {
+        const char *cell_end = static_cast<const char*>(
+            std::memchr(cell_begin, sep, line_end - cell_begin));
+        if(cell_end == nullptr)
+        {
+            if(col != (ncols - 1))
             {
-                CONDUIT_ERROR("Unable to parse row " << row << " in column " << icol << "."
-                    << " The string " << quote(data) << "is not a number.");
+                CONDUIT_ERROR("Error while reading file, row " << row
+                    << " contains too few column entries!");
             }
-
-            // Update positions
-            icol++;
-            start = end + 1;
-            end = line.find(sep, start);
+            cell_end = line_end;
         }
-        // Get the last name
-        if(icol > col_names.size())
+        else if(col == (ncols - 1))
         {
-            CONDUIT_ERROR("Error while reading file, row " << row << " contains too many column entries!");
-            return;
+            CONDUIT_ERROR("Error while reading file, row " << row
+                << " contains too many column entries!");
         }
 
-        Node *n = values.fetch_ptr(col_names[icol]);
-        if(!n)
+        const char *b = cell_begin;
+        const char *e = cell_end;
+        while(b < e && is_blank(*b)) b++;
+        while(e > b && is_blank(*(e - 1))) e--;
+        cells.push_back(b);
+        cells.push_back(e);
+
+        cell_begin = cell_end + 1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+static inline bool
+parse_int64(const char *b, const char *e, int64 &res)
+{
+    bool neg = false;
+    if(b < e && (*b == '+' || *b == '-'))
+    {
+        neg = (*b == '-');
+        b++;
+    }
+    if(b == e)
+    {
+        return false;
+    }
+    // accumulate the magnitude, the full int64 range is accepted
+    // (down to -9223372036854775808), larger values are not ints
+    const uint64 int64_max = static_cast<uint64>(
+                                    std::numeric_limits<int64>::max());
+    const uint64 max_mag = neg ? int64_max + 1 : int64_max;
+    uint64 v = 0;
+    for(; b < e; b++)
+    {
+        const unsigned int d = static_cast<unsigned int>(*b - '0');
+        if(d > 9 || v > (max_mag - d) / 10)
         {
-            CONDUIT_ERROR("The allocated output table does not contain the path " << quote(col_names[icol]) << ".");
-            return;
+            return false;
         }
+        v = v * 10 + d;
+    }
+    res = neg ? static_cast<int64>(0 - v) : static_cast<int64>(v);
+    return true;
+}
 
-        std::string data = line.substr(start);
-        try
+//-----------------------------------------------------------------------------
+/**
+@brief Splits a decimal number into a mantissa and a power of 10. Returns
+    false for anything else (nan, inf, hex floats, more than 19 significant
+    digits, ...), those cases are left to strtod / strtof.
+*/
+static inline bool
+scan_decimal(const char *b, const char *e, bool &neg, uint64 &mantissa,
+    int &exp10)
+{
+    neg = false;
+    mantissa = 0;
+    exp10 = 0;
+    if(b < e && (*b == '+' || *b == '-'))
+    {
+        neg = (*b == '-');
+        b++;
+    }
+
+    int num_digits = 0;
+    bool has_digits = false;
+    for(; b < e && static_cast<unsigned int>(*b - '0') <= 9; b++)
+    {
+        has_digits = true;
+        if(mantissa != 0 || *b != '0')
         {
-            if(std::is_same<float, FloatType>().value)
-            {
-                float *d = static_cast<float*>(n->element_ptr(row));
-                *d = std::stof(data);
-            }
-            else if(std::is_same<double, FloatType>().value)
-            {
-                double *d = static_cast<double*>(n->element_ptr(row));
-                *d = std::stod(data);
-            }
-#ifdef CONDUIT_HAS_LONG_DOUBLE
-            else if(std::is_same<long double, FloatType>().value)
+            if(++num_digits > 19) return false;
+            mantissa = mantissa * 10 + static_cast<unsigned int>(*b - '0');
+        }
+    }
+    if(b < e && *b == '.')
+    {
+        b++;
+        for(; b < e && static_cast<unsigned int>(*b - '0') <= 9; b++)
+        {
+            has_digits = true;
+            if(mantissa != 0 || *b != '0')
             {
-                long double *d = static_cast<long double*>(n->element_ptr(row));
-                *d = std::stold(data);
+                if(++num_digits > 19) return false;
+                mantissa = mantissa * 10 + static_cast<unsigned int>(*b - '0');
             }
-#endif
+            exp10--;
         }
-        catch (...)
+    }
+    if(!has_digits)
+    {
+        return false;
+    }
+
+    if(b < e && (*b == 'e' || *b == 'E'))
+    {
+        b++;
+        bool exp_neg = false;
+        if(b < e && (*b == '+' || *b == '-'))
+        {
+            exp_neg = (*b == '-');
+            b++;
+        }
+        if(b == e)
+        {
+            return false;
+        }
+        int exp_val = 0;
+        for(; b < e; b++)
         {
-            CONDUIT_ERROR("Unable to parse row " << row << " in column " << icol << "."
-                << " The string " << quote(data) << "is not a number.");
+            const unsigned int d = static_cast<unsigned int>(*b - '0');
+            if(d > 9) return false;
+            if(exp_val < 100000) exp_val = exp_val * 10 + d;
         }
-        row++;
+        exp10 += exp_neg ? -exp_val : exp_val;
     }
+    return b == e;
 }
 
 //-----------------------------------------------------------------------------
-static void
-read_single_table(const std::string &path, const bool use_float64, Node &table)
+/**
+@brief Parses a float64. Mantissas up to 2^53 with powers of 10 up to 22
+    are exact in double precision, so a single multiply or divide gives the
+    correctly rounded result. Other values use strtod.
+*/
+static inline bool
+parse_float(const char *b, const char *e, float64 &res)
 {
-    table.reset();
-    std::ifstream fin(path);
-    if(!fin.is_open())
+    static const float64 pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+        1e22};
+
+    bool neg = false;
+    uint64 mantissa = 0;
+    int exp10 = 0;
+    if(scan_decimal(b, e, neg, mantissa, exp10) &&
+       mantissa <= (uint64(1) << 53) && exp10 >= -22 && exp10 <= 22)
     {
-        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
-        return;
+        float64 v = static_cast<float64>(mantissa);
+        v = (exp10 < 0) ? v / pow10[-exp10] : v * pow10[exp10];
+        res = neg ? -v : v;
+        return true;
+    }
+
+    if(b == e)
+    {
+        return false;
+    }
+    // the cell is followed by a separator, blank, newline, or the null
+    // terminator, all of which stop strtod
+    char *parse_end = nullptr;
+    res = std::strtod(b, &parse_end);
+    return parse_end == e;
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Parses a float32, same as the float64 case with the single precision
+    limits (mantissas up to 2^24, powers of 10 up to 10).
+*/
+static inline bool
+parse_float(const char *b, const char *e, float32 &res)
+{
+    static const float32 pow10[] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+    bool neg = false;
+    uint64 mantissa = 0;
+    int exp10 = 0;
+    if(scan_decimal(b, e, neg, mantissa, exp10) &&
+       mantissa <= (uint64(1) << 24) && exp10 >= -10 && exp10 <= 10)
+    {
+        float32 v = static_cast<float32>(mantissa);
+        v = (exp10 < 0) ? v / pow10[-exp10] : v * pow10[exp10];
+        res = neg ? -v : v;
+        return true;
     }
 
+    if(b == e)
+    {
+        return false;
+    }
+    char *parse_end = nullptr;
+    res = std::strtof(b, &parse_end);
+    return parse_end == e;
+}
+
+//-----------------------------------------------------------------------------
+// A column of the output table
+//-----------------------------------------------------------------------------
+struct CSVColumn
+{
+    Node   *node;
+    index_t dtype_id;
+    void   *data;
+};
+
+//-----------------------------------------------------------------------------
+/**
+@brief Parses the cells of the given columns for all rows, directly into the
+    column buffers. Rows are parsed in parallel blocks. Integer columns with
+    a cell that is not an integer are flagged in int_failed.
+*/
+static void
+parse_columns(const char *data, const char *data_end,
+    const std::vector<index_t> &row_starts, index_t ncols,
+    std::vector<CSVColumn> &columns, const std::vector<index_t> &col_ids,
+    std::vector<std::atomic<int>> &int_failed)
+{
+    const index_t nrows = static_cast<index_t>(row_starts.size());
+    execution::for_all_blocks(nrows, csv_rows_per_task,
+        [&](index_t row_begin, index_t row_end)
+    {
+        std::vector<const char*> cells;
+        cells.reserve(2 * ncols);
+        for(index_t row = row_begin; row < row_end; row++)
+        {
+            split_row(data + row_starts[row], data_end, row, ncols, cells);
+            for(const index_t col : col_ids)
+            {
+                const char *b = cells[2 * col];
+                const char *e = cells[2 * col + 1];
+                CSVColumn &column = columns[col];
+                bool ok = true;
+                if(column.dtype_id == DataType::INT64_ID)
+                {
+                    if(!parse_int64(b, e, static_cast<int64*>(column.data)[row]))
+                    {
+                        int_failed[col] = 1;
+                    }
+                }
+                else if(column.dtype_id == DataType::FLOAT32_ID)
+                {
+                    ok = parse_float(b, e, static_cast<float32*>(column.data)[row]);
+                }
+                else
+                {
+                    ok = parse_float(b, e, static_cast<float64*>(column.data)[row]);
+                }
+
+                if(!ok)
+                {
+                    CONDUIT_ERROR("Unable to parse row " << row << " in column " << col << "."
+                        << " The string " << quote(std::string(b, e)) << " is not a number.");
+                }
+            }
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+static void
+read_single_table(const std::string &path, const CSVReadOptions &opts,
+    Node &table)
+{
+    table.reset();
+
+    std::vector<char> buf;
+    read_file_contents(path, buf);
+    const char *data = &buf[0];
+    // exclude the null terminator
+    const index_t data_size = static_cast<index_t>(buf.size()) - 1;
+
     // Some basic sanity checks on the file
     // Q: Need to support comment character?
 
     // Make sure the file has data
-    std::string first_line;
-    if(!std::getline(fin, first_line))
+    if(data_size == 0)
     {
         CONDUIT_ERROR("The file " << quote(path) << "appears to be empty.");
         return;
     }
 
+    const char *first_end = static_cast<const char*>(
+        std::memchr(data, '\n', data_size));
+    const index_t first_len = (first_end != nullptr)
+        ? static_cast<index_t>(first_end - data) : data_size;
+    const std::string first_line(data, first_len);
+
     std::vector<std::string> column_names;
-    const index_t ncols = read_column_names(first_line, column_names);
-    // If there was no header for the column names, seek back to start
+    index_t ncols = read_column_names(first_line, column_names);
+    index_t data_begin = 0;
     if(column_names.empty())
     {
-        fin.seekg(0, fin.beg);
+        // No header, the first row has the number of columns
+        ncols = 1 + static_cast<index_t>(
+            std::count(first_line.begin(), first_line.end(), ','));
     }
+    else
+    {
+        data_begin = std::min(first_len + 1, data_size);
+    }
+
+    // Find the rows
+    std::vector<index_t> row_starts;
+    find_rows(data, data_begin, data_size, row_starts);
+    const index_t nrows = static_cast<index_t>(row_starts.size());
 
-    // Get number of rows in file
-    const auto data_start = fin.tellg();
-    std::string line;
-    index_t nrows = 0;
-    while(std::getline(fin, line))
+    // Pick the column types, columns where all the sampled cells are
+    // integers are read as int64
+    const index_t float_id = (opts.use_float64)
+        ? DataType::FLOAT64_ID : DataType::FLOAT32_ID;
+    std::vector<index_t> dtype_ids(ncols, float_id);
+    if(opts.infer_types && nrows > 0)
     {
-        nrows++;
+        std::vector<bool> all_ints(ncols, true);
+        std::vector<const char*> cells;
+        const index_t nsample = std::min(nrows, csv_inference_rows);
+        for(index_t row = 0; row < nsample; row++)
+        {
+            split_row(data + row_starts[row], data + data_size, row, ncols, cells);
+            for(index_t col = 0; col < ncols; col++)
+            {
+                int64 unused;
+                if(all_ints[col] &&
+                   !parse_int64(cells[2 * col], cells[2 * col + 1], unused))
+                {
+                    all_ints[col] = false;
+                }
+            }
+        }
+        for(index_t col = 0; col < ncols; col++)
+        {
+            if(all_ints[col])
+            {
+                dtype_ids[col] = DataType::INT64_ID;
+            }
+        }
     }
 
     // Allocate the output table
-    const DataType dtype((use_float64) ? DataType::FLOAT64_ID : DataType::FLOAT32_ID,
-        nrows);
     Node &values = table["values"];
-    add_columns(values, column_names, ncols, dtype);
-
-    if(dtype.is_float())
+    std::vector<CSVColumn> columns(ncols);
+    for(index_t col = 0; col < ncols; col++)
     {
-        read_csv_data<float>(fin, data_start, column_names, values);
+        const std::string name = column_names.empty()
+            ? std::string() : column_names[col];
+        Node &n = add_column(name, values);
+        n.set_dtype(DataType(dtype_ids[col], nrows));
+        columns[col].node = &n;
+        columns[col].dtype_id = dtype_ids[col];
+        columns[col].data = n.element_ptr(0);
     }
-    else if(dtype.is_double())
+
+    // Parse all columns
+    std::vector<index_t> col_ids(ncols);
+    for(index_t col = 0; col < ncols; col++)
     {
-        read_csv_data<double>(fin, data_start, column_names, values);
+        col_ids[col] = col;
     }
-#ifdef CONDUIT_HAS_LONG_DOUBLE
-    else if(dtype.is_long_double())
+    std::vector<std::atomic<int>> int_failed(ncols);
+    parse_columns(data, data + data_size, row_starts, ncols,
+        columns, col_ids, int_failed);
+
+    // Integer columns with non integer cells past the sampled rows are
+    // parsed again as floating point columns
+    col_ids.clear();
+    for(index_t col = 0; col < ncols; col++)
     {
-        read_csv_data<long double>(fin, data_start, column_names, values);
+        if(int_failed[col] != 0)
+        {
+            columns[col].node->set_dtype(DataType(float_id, nrows));
+            columns[col].dtype_id = float_id;
+            columns[col].data = columns[col].node->element_ptr(0);
+            col_ids.push_back(col);
+        }
     }
-#endif
-    else
+    if(!col_ids.empty())
     {
-        CONDUIT_ERROR("Unsupported data type for read_csv_data, needs to be a floating point type.");
+        parse_columns(data, data + data_size, row_starts, ncols,
+            columns, col_ids, int_failed);
     }
 }
 
 //-----------------------------------------------------------------------------
 static void
-read_many_tables(const std::string &path, const bool use_float64, Node &table)
+read_many_tables(const std::string &path, const CSVReadOptions &opts,
+    Node &table)
 {
     // Path must've been a directory
     std::vector<std::string> dir_contents;
@@ -559,7 +1041,7 @@ read_many_tables(const std::string &path, const bool use_float64, Node &table)
         for(const auto &pair : list_idxs)
         {
             // std::cout << pair.first << " " << *pair.second << std::endl;
-            read_single_table(*pair.second, use_float64, table.append());
+            read_single_table(*pair.second, opts, table.append());
         }
     }
     else
@@ -569,7 +1051,7 @@ read_many_tables(const std::string &path, const bool use_float64, Node &table)
             const auto no_ext = filename.size() - 4;
             const auto no_sep = filename.rfind(utils::file_path_separator()) + 1;
             const auto len = no_ext - no_sep;
-            read_single_table(filename, use_float64, table[filename.substr(no_sep, len)]);
+            read_single_table(filename, opts, table[filename.substr(no_sep, len)]);
         }
     }
 }
@@ -580,13 +1062,15 @@ read_csv(const std::string &path, const Node &opts, Node &table)
 {
     const bool many_tables = utils::is_directory(path);
 
-    bool use_float64 = false;
+    CSVReadOptions read_opts;
+    read_opts.use_float64 = false;
+    read_opts.infer_types = true;
     if(opts.has_child("use_float64"))
     {
         const Node &n_use_float64 = opts["use_float64"];
         if(n_use_float64.dtype().is_number())
         {
-            use_float64 = opts["use_float64"].to_int() != 0;
+            read_opts.use_float64 = opts["use_float64"].to_int() != 0;
         }
         else
         {
@@ -595,19 +1079,33 @@ read_csv(const std::string &path, const Node &opts, Node &table)
         }
     }
 
+    if(opts.has_child("infer_types"))
+    {
+        const Node &n_infer_types = opts["infer_types"];
+        if(n_infer_types.dtype().is_number())
+        {
+            read_opts.infer_types = opts["infer_types"].to_int() != 0;
+        }
+        else
+        {
+            CONDUIT_ERROR("options[" << quote("infer_types") <<
+                "] must be a number. It will be treated as a boolean (.to_int() != 0).");
+        }
+    }
+
     if(!many_tables)
     {
-        read_single_table(path, use_float64, table);
+        read_single_table(path, read_opts, table);
     }
     else
     {
-        read_many_tables(path, use_float64, table);
+        read_many_tables(path, read_opts, table);
     }
 }
 
 //-----------------------------------------------------------------------------
 void
-write_csv(const Node &table, const std::string &path, const Node &)
+write_csv(const Node &table, const std::string &path, const Node &opts)
 {
     Node info;
     const bool ok = blueprint::table::verify(table, info);
@@ -617,17 +1115,29 @@ write_csv(const Node &table, const std::string &path, const Node &)
             << "blueprint table!");
     }
 
-    // IDEA: Support a "fixed_width" option and write the file
-    //  one column at a time instead of one row at a time.
-    // Benchmark performance vs row-based writer.
+    CSVWriteOptions write_opts;
+    write_opts.precision = 6;
+    if(opts.has_child("precision"))
+    {
+        const Node &n_precision = opts["precision"];
+        if(n_precision.dtype().is_number() && n_precision.to_int() > 0)
+        {
+            write_opts.precision = n_precision.to_int();
+        }
+        else
+        {
+            CONDUIT_ERROR("options[" << quote("precision") <<
+                "] must be a positive number.");
+        }
+    }
 
     if(table.has_child("values"))
     {
-        write_single_table(table, path);
+        write_single_table(table, path, write_opts);
     }
     else
     {
-        write_multiple_tables(table, path);
+        write_multiple_tables(table, path, write_opts);
     }
 }
 
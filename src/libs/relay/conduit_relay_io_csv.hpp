@@ -38,6 +38,16 @@ namespace io
 {
 
 //-----------------------------------------------------------------------------
+/**
+@brief Reads a csv file (or a directory of csv files) into a blueprint table.
+    The file is parsed in parallel blocks of rows.
+
+Options:
+    use_float64: Non zero to read floating point columns as float64
+        (default: 0, float32).
+    infer_types: Non zero to read columns that only hold integers
+        as int64 (default: 1).
+*/
 CONDUIT_RELAY_API void read_csv(const std::string &path,
                                 const Node &options,
                                 Node &table);
@@ -45,6 +55,11 @@ CONDUIT_RELAY_API void read_csv(const std::string &path,
 //-----------------------------------------------------------------------------
 /**
 @brief Accepts a blueprint table and writes it out to the given filename.
+    Only numeric columns are supported.
+
+Options:
+    precision: Significant digits used for floating point values
+        (default: 6).
 */
 CONDUIT_RELAY_API void write_csv(const Node &table,
                                  const std::string &path,
@@ -170,7 +170,11 @@ IOHandle::HandleInterface::HandleInterface(const std::string &path,
                                            const Node &options)
 : m_path(path),
   m_protocol(protocol),
-  m_options(options)
+  m_options(options),
+  m_open_mode_read(false),
+  m_open_mode_write(false),
+  m_open_mode_append(false),
+  m_open_mode_truncate(false)
 {
     // empty
 }
@@ -487,9 +491,11 @@ BasicHandle::read(const std::string &path,
     CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
-    if(m_node.has_path(path))
+    // only const access, so concurrent reads don't modify m_node
+    const Node &n = m_node;
+    if(n.has_path(path))
     {
-        node.update(m_node[path]);
+        node.update(n.fetch_existing(path));
     }
 }
 
@@ -551,8 +557,9 @@ BasicHandle::list_child_names(const std::string &path,
     // note: wrong mode errors are handled before dispatch to interface
 
     res.clear();
-    if(m_node.has_path(path))
-        res = m_node[path].child_names();
+    const Node &n = m_node;
+    if(n.has_path(path))
+        res = n.fetch_existing(path).child_names();
 }
 
 //-----------------------------------------------------------------------------
@@ -713,20 +720,17 @@ HDF5Handle::write(const Node &node,
 {
     // note: wrong mode errors are handled before dispatch to interface
 
-    // Options Push / Pop (only needed for write, since hdf5 only supports
-    // write options
-    Node prev_options;
-    if(options().has_child("hdf5"))
+    // the handle's hdf5 options apply to this write only (hdf5_write
+    // swaps them in and restores the previous options under its lock)
+    if(options().has_child("hdf5") && !opts.has_child("hdf5"))
     {
-        hdf5_options(prev_options);
-        hdf5_set_options(options()["hdf5"]);
+        Node write_opts(opts);
+        write_opts["hdf5"].set(options()["hdf5"]);
+        hdf5_write(node,m_h5_id,write_opts);
     }
-
-    hdf5_write(node,m_h5_id, opts);
-
-    if(!prev_options.dtype().is_empty())
+    else
     {
-        hdf5_set_options(prev_options);
+        hdf5_write(node,m_h5_id,opts);
     }
 }
 
@@ -749,20 +753,17 @@ HDF5Handle::write(const Node &node,
 {
     // note: wrong mode errors are handled before dispatch to interface
 
-    // Options Push / Pop (only needed for write, since hdf5 only supports
-    // write options
-    Node prev_options;
-    if(options().has_child("hdf5"))
+    // the handle's hdf5 options apply to this write only (hdf5_write
+    // swaps them in and restores the previous options under its lock)
+    if(options().has_child("hdf5") && !opts.has_child("hdf5"))
     {
-        hdf5_options(prev_options);
-        hdf5_set_options(options()["hdf5"]);
+        Node write_opts(opts);
+        write_opts["hdf5"].set(options()["hdf5"]);
+        hdf5_write(node,m_h5_id,path,write_opts);
     }
-
-    hdf5_write(node,m_h5_id,path,opts);
-
-    if(!prev_options.dtype().is_empty())
+    else
     {
-        hdf5_set_options(prev_options);
+        hdf5_write(node,m_h5_id,path,opts);
     }
 }
 
@@ -19,6 +19,12 @@
 ///
 /// Contract: Changes to backing (file on disk, etc) aren't guaranteed to
 //  be reflected until a call to close
+///
+/// Thread safety: A handle opened read only (mode = "r") can be used from
+/// several threads at once for read, list_child_names, and has_path.
+/// Basic protocol handles read in parallel, HDF5 calls are serialized
+/// (the HDF5 library is not reentrant) and Sidre handles serialize calls
+/// per handle.
 //-----------------------------------------------------------------------------
 class CONDUIT_RELAY_API IOHandle
 {
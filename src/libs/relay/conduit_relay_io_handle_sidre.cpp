@@ -25,6 +25,7 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -62,7 +63,12 @@ namespace io
 SidreIOHandle::SidreIOHandle(const std::string &path,
                          const std::string &protocol,
                          const Node &options)
-: HandleInterface(path,protocol,options)
+: HandleInterface(path,protocol,options),
+  m_open(false),
+  m_has_spio_index(false),
+  m_num_trees(0),
+  m_num_files(0),
+  m_buffer_cache_bytes(0)
 {
     // empty
 }
@@ -77,6 +83,7 @@ SidreIOHandle::~SidreIOHandle()
 void
 SidreIOHandle::open()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     close();
 
     // call base class method, which does final sanity checks
@@ -87,6 +94,22 @@ SidreIOHandle::open()
         CONDUIT_ERROR("SidreIOHandle does not support write mode "
                       "(open_mode = 'w')");
 
+    m_buffer_cache_bytes = 0;
+    if(options().has_path("sidre/buffer_cache_bytes"))
+    {
+        const Node &n_cache_bytes = options().fetch_existing(
+                                                "sidre/buffer_cache_bytes");
+        if(!n_cache_bytes.dtype().is_number() ||
+           n_cache_bytes.to_int64() < 0)
+        {
+            CONDUIT_ERROR("SidreIOHandle: open option "
+                          "'sidre/buffer_cache_bytes' must be a "
+                          "non-negative number");
+        }
+        m_buffer_cache_bytes = n_cache_bytes.to_index_t();
+    }
+    m_root_buffer_cache.max_data_bytes = m_buffer_cache_bytes;
+
     // two cases,
     //  a standalone file with a sidre style hierarchy
     //  a collection of files with a spio generated root
@@ -185,6 +208,7 @@ SidreIOHandle::read(Node &node,
 {
     CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     std::vector<std::string> child_names;
     list_child_names(child_names);
@@ -212,6 +236,7 @@ SidreIOHandle::read(const std::string &path,
 {
     CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     // if blank path or "/", use other method and early exist.
     if(path.empty() || path == "/")
@@ -268,6 +293,7 @@ SidreIOHandle::read(const std::string &path,
         // we need to prep sidre meta ...
 
         read_from_sidre_tree(m_root_handle,
+                             m_root_buffer_cache,
                              "",
                              path,
                              m_sidre_meta[0],
@@ -327,6 +353,7 @@ void
 SidreIOHandle::list_child_names(std::vector<std::string> &res)
 {
     // note: wrong mode errors are handled before dispatch to interface
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     if(m_has_spio_index)
     {
@@ -355,6 +382,7 @@ SidreIOHandle::list_child_names(const std::string &path,
                                 std::vector<std::string> &res)
 {
     // note: wrong mode errors are handled before dispatch to interface
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     // note: if the path is bad, we return an empty list
     res.clear();
@@ -411,6 +439,7 @@ bool
 SidreIOHandle::has_path(const std::string &path)
 {
     // note: wrong mode errors are handled before dispatch to interface
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     bool res = false;
 
@@ -462,7 +491,7 @@ SidreIOHandle::has_path(const std::string &path)
     else
     {
         // we use tree id zero for non index case
-        sidre_meta_tree_has_path(0,path);
+        res = sidre_meta_tree_has_path(0,path);
     }
 
     return res;
@@ -473,6 +502,7 @@ SidreIOHandle::has_path(const std::string &path)
 void
 SidreIOHandle::close()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_open = false;
     m_root_handle.close();
 
@@ -482,12 +512,32 @@ SidreIOHandle::close()
 
     m_file_handles.clear();
     m_sidre_meta.clear();
+    m_root_buffer_cache.clear();
+    m_buffer_caches.clear();
 }
 
 //-----------------------------------------------------------------------------
 // Helpers
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+SidreIOHandle::BufferCache::BufferCache()
+: data_bytes(0),
+  max_data_bytes(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+SidreIOHandle::BufferCache::clear()
+{
+    schemas.clear();
+    data.clear();
+    data_order.clear();
+    data_bytes = 0;
+}
+
 //-----------------------------------------------------------------------------
 std::string
 SidreIOHandle::root_file_directory() const
@@ -831,6 +881,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                                const std::string &tree_prefix,
                                const std::string &tree_path,
                                const std::string &curr_path,
+                               BufferViewReads &buffer_reads,
                                Node &out)
 {
     // CONDUIT_INFO("load_sidre_tree w/ meta "
@@ -854,6 +905,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                              hnd,
                              tree_prefix,
                              "",
+                             buffer_reads,
                              out);
     }
     else if( sidre_meta["groups"].has_path(tree_curr) )
@@ -866,6 +918,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                              hnd,
                              tree_prefix,
                              curr_path + tree_curr  + "/",
+                             buffer_reads,
                              out);
         }
         else // keep descending
@@ -875,6 +928,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                             tree_prefix,
                             tree_next,
                             curr_path + tree_curr  + "/",
+                            buffer_reads,
                             out);
         }
     }
@@ -892,6 +946,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                             hnd,
                             tree_prefix,
                             curr_path + tree_curr  + "/",
+                            buffer_reads,
                             out);
         }
     }
@@ -910,6 +965,7 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &group_path,
+                                BufferViewReads &buffer_reads,
                                 Node &out)
 {
     // CONDUIT_INFO("load_sidre_group "
@@ -928,6 +984,7 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
                          hnd,
                          tree_prefix,
                          cld_path + "/",
+                         buffer_reads,
                          out[g_name]);
     }
 
@@ -942,6 +999,7 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
                         hnd,
                         tree_prefix,
                         cld_path,
+                        buffer_reads,
                         out[v_name]);
     }
 }
@@ -952,6 +1010,7 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
                                IOHandle &hnd,
                                const std::string &tree_prefix,
                                const std::string &view_path,
+                               BufferViewReads &buffer_reads,
                                Node &out)
 {
     // CONDUIT_INFO("load_sidre_view " << view_path);
@@ -985,112 +1044,250 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
     else if( view_state == "BUFFER" )
     {
         // BP_PLUGIN_INFO("loading " << view_path << " as sidre view linked to a buffer");
-        // we need to fetch the buffer
+        // defer the read, so all views of this buffer found in the
+        // current traversal are served by a single buffer read
+        // (see load_sidre_buffer_views)
         int buffer_id = sidre_meta_view["buffer_id"].to_int();
+        BufferViewRead view_read;
+        view_read.sidre_meta_view = &sidre_meta_view;
+        view_read.out = &out;
+        buffer_reads[buffer_id].push_back(view_read);
+    }
+    else if( view_state == "EXTERNAL" )
+    {
+        //BP_PLUGIN_INFO("loading " << view_path << " as sidre external view");
 
-        std::ostringstream buffer_fetch_path_oss;
-        buffer_fetch_path_oss << tree_prefix << "/sidre/buffers/buffer_id_" << buffer_id;
+        std::string fetch_path = tree_prefix + "sidre/external/" + view_path;
 
-        // buffer data path
-        std::string buffer_data_fetch_path   = buffer_fetch_path_oss.str() + "/data";
+        // BP_PLUGIN_INFO("relay:io::hdf5_read "
+        //                << "domain " << tree_id
+        //                << " : "
+        //                << fetch_path);
 
-        // we also need the buffer's schema
-        std::string buffer_schema_fetch_path = buffer_fetch_path_oss.str() + "/schema";
+        hnd.read(fetch_path,out);;
+    }
+    else
+    {
+        // error:  "unsupported sidre view state: " << view_state );
+    }
+}
+
+//----------------------------------------------------------------------------/
+const Schema &
+SidreIOHandle::buffer_schema(IOHandle &hnd,
+                             BufferCache &buffer_cache,
+                             const std::string &buffer_path)
+{
+    std::map<std::string,Schema>::iterator itr;
+    itr = buffer_cache.schemas.find(buffer_path);
 
+    if(itr == buffer_cache.schemas.end())
+    {
         Node n_buffer_schema_str;
+        hnd.read(buffer_path + "/schema",n_buffer_schema_str);
 
-        hnd.read(buffer_schema_fetch_path,n_buffer_schema_str);
+        Schema &res = buffer_cache.schemas[buffer_path];
+        res.set(n_buffer_schema_str.as_string());
+        return res;
+    }
 
-        std::string buffer_schema_str = n_buffer_schema_str.as_string();
-        Schema buffer_schema(buffer_schema_str);
+    return itr->second;
+}
 
-        //BP_PLUGIN_INFO("sidre buffer schema: " << buffer_schema.to_json());
-        //BP_PLUGIN_INFO("sidre buffer data path " << buffer_data_fetch_path);
+//----------------------------------------------------------------------------/
+void
+SidreIOHandle::load_sidre_buffer_views(IOHandle &hnd,
+                                       BufferCache &buffer_cache,
+                                       const std::string &tree_prefix,
+                                       BufferViewReads &buffer_reads)
+{
+    BufferViewReads::iterator b_itr;
+    for(b_itr = buffer_reads.begin(); b_itr != buffer_reads.end(); b_itr++)
+    {
+        std::vector<BufferViewRead> &views = b_itr->second;
+        size_t num_views = views.size();
 
-        std::string view_schema_str = sidre_meta_view["schema"].as_string();
-        // create the schema we want for this view
-        // it describes how the view relates to the buffer in the hdf5 file
+        std::ostringstream buffer_fetch_path_oss;
+        buffer_fetch_path_oss << tree_prefix << "/sidre/buffers/buffer_id_"
+                              << b_itr->first;
+        std::string buffer_path = buffer_fetch_path_oss.str();
 
-        Schema view_schema(view_schema_str);
-        // BP_PLUGIN_INFO("sidre view schema: " << view_schema.to_json());
+        // buffer data path
+        std::string buffer_data_fetch_path = buffer_path + "/data";
+
+        const Schema &buff_schema = buffer_schema(hnd,
+                                                  buffer_cache,
+                                                  buffer_path);
+        const DataType &buff_dtype = buff_schema.dtype();
+        index_t buff_num_eles = buff_dtype.number_of_elements();
+
+        // the view schemas describe how each view relates to the buffer
+        // in the file. A view that is compact and spans the entire buffer
+        // is read as the buffer, other views are compacted from the
+        // buffer data.
+        std::vector<Schema> view_schemas(num_views);
+        std::vector<bool>   view_is_buffer(num_views,false);
+
+        // we need the entire buffer if any view spans it or isn't a leaf,
+        // otherwise we only need the byte range the views cover
+        bool need_entire_buffer = false;
+        index_t range_begin = 0;
+        index_t range_end   = 0;
+
+        for(size_t i=0; i < num_views; i++)
+        {
+            Schema &view_schema = view_schemas[i];
+            view_schema.set(views[i].sidre_meta_view->fetch_existing("schema")
+                                                      .as_string());
+            const DataType &view_dtype = view_schema.dtype();
 
-        // if the schema isn't compact, or if we are reading
-        // less elements than the entire buffer,
-        // we need to read a subset of the hdf5 dataset
+            if( view_schema.is_compact() &&
+                view_dtype.number_of_elements() >= buff_num_eles )
+            {
+                view_is_buffer[i]  = true;
+                need_entire_buffer = true;
+            }
+            else if( view_schema.number_of_children() > 0 )
+            {
+                need_entire_buffer = true;
+            }
+            else if( view_dtype.number_of_elements() > 0 )
+            {
+                if(range_end == range_begin)
+                {
+                    range_begin = view_dtype.offset();
+                    range_end   = view_dtype.spanned_bytes();
+                }
+                else
+                {
+                    range_begin = std::min(range_begin, view_dtype.offset());
+                    range_end   = std::max(range_end,
+                                           view_dtype.spanned_bytes());
+                }
+            }
+        }
 
-        if(   !view_schema.is_compact() ||
-            ( view_schema.dtype().number_of_elements() <
-              buffer_schema.dtype().number_of_elements() )
-          )
+        // only empty views, nothing to read
+        if(!need_entire_buffer && range_end == range_begin)
         {
-            // BP_PLUGIN_INFO("Sidre View from Buffer Slab Fetch Case");
-            //
-            // Create a compact schema to describe our desired output data
-            //
-            Schema view_schema_compact;
-            view_schema.compact_to(view_schema_compact);
-            // setup and allocate the output node
-            out.set(view_schema_compact);
-
-            // TODO: Implement BUFFER-SLAB FETCH
-            // ---------------------------------------------------------------
-            // BUFFER-SLAB FETCH
-            // ---------------------------------------------------------------
-            //
-            // we can use hdf5 slab fetch if the the dtype.id() of the buffer
-            // and the view are the same.
-            //
-            //  otherwise, we will have to fetch the entire buffer since
-            //  hdf5 doesn't support byte level striding.
-
-            // if(
-            //     tree_cache.Read(tree_id,
-            //                     buffer_data_fetch_path,
-            //                     view_schema.dtype(),
-            //                     out)
-            //     )
-            // {
-                // BP_PLUGIN_INFO("Sidre View from Buffer Slab Fetch Case Failed");
-                // ---------------------------------------------------------------
-                // Fall back to Non BUFFER-SLAB FETCH
-                // ---------------------------------------------------------------
-                // this reads the entire buffer to get the proper subset
-                Node n_buff;
-                Node n_view;
+            for(size_t i=0; i < num_views; i++)
+            {
+                Schema view_schema_compact;
+                view_schemas[i].compact_to(view_schema_compact);
+                views[i].out->set(view_schema_compact);
+            }
+            continue;
+        }
 
-                hnd.read(buffer_data_fetch_path,n_buff);
+        Node n_buff_read;
+        const Node *n_buff = NULL;
+        // byte offset of the buffer data we read, when we read a slab
+        index_t buff_base_bytes = 0;
 
-                // create our view on the buffer
-                n_view.set_external(view_schema,n_buff.data_ptr());
-                // compact the view to our output
-                n_view.compact_to(out);
-            // }
-            // else
-            // {
-            //     //BP_PLUGIN_INFO("Sidre View from Buffer Slab Fetch Case Successful");
-            // }
+        std::map<std::string,Node>::iterator d_itr;
+        d_itr = buffer_cache.data.find(buffer_path);
+
+        index_t buff_bytes = buff_schema.total_bytes_compact();
+
+        if(d_itr != buffer_cache.data.end())
+        {
+            n_buff = &d_itr->second;
+        }
+        else if( buff_bytes <= buffer_cache.max_data_bytes )
+        {
+            // keep the entire buffer resident for later reads
+            Node &n_cached = buffer_cache.data[buffer_path];
+            hnd.read(buffer_data_fetch_path,n_cached);
+            buffer_cache.data_bytes += n_cached.total_bytes_compact();
+            buffer_cache.data_order.push_back(buffer_path);
+
+            // evict the oldest buffers to stay under the cap
+            while( buffer_cache.data_bytes > buffer_cache.max_data_bytes &&
+                   buffer_cache.data_order.size() > 1 )
+            {
+                std::string evict_path = buffer_cache.data_order.front();
+                buffer_cache.data_order.pop_front();
+                buffer_cache.data_bytes -=
+                    buffer_cache.data[evict_path].total_bytes_compact();
+                buffer_cache.data.erase(evict_path);
+            }
+
+            n_buff = &n_cached;
         }
-        else // compact, and compat, we can just read
+        else if( num_views == 1 && view_is_buffer[0] )
         {
-            hnd.read(buffer_data_fetch_path,out);
+            // compact, and compat, we can just read
+            hnd.read(buffer_data_fetch_path,*views[0].out);
+            continue;
         }
-    }
-    else if( view_state == "EXTERNAL" )
-    {
-        //BP_PLUGIN_INFO("loading " << view_path << " as sidre external view");
+        else
+        {
+            // read the slab of the buffer that covers the views.
+            //
+            // hdf5 doesn't support byte level striding, so we read
+            // whole elements of the buffer's dtype
+            Node read_opts;
+            index_t ele_bytes = buff_dtype.element_bytes();
+            if( !need_entire_buffer &&
+                buff_dtype.is_number() &&
+                !buff_dtype.has_shape() &&
+                ele_bytes > 0 )
+            {
+                index_t ele_begin = range_begin / ele_bytes;
+                index_t ele_end   = (range_end + ele_bytes - 1) / ele_bytes;
+                if(ele_begin > 0 || ele_end < buff_num_eles)
+                {
+                    read_opts["offset"] = ele_begin;
+                    read_opts["size"]   = ele_end - ele_begin;
+                }
+            }
 
-        std::string fetch_path = tree_prefix + "sidre/external/" + view_path;
+            hnd.read(buffer_data_fetch_path,n_buff_read,read_opts);
 
-        // BP_PLUGIN_INFO("relay:io::hdf5_read "
-        //                << "domain " << tree_id
-        //                << " : "
-        //                << fetch_path);
+            // handles without partial read support (basic protocols)
+            // ignore these options and give us the entire buffer
+            if( read_opts.has_child("offset") &&
+                n_buff_read.dtype().number_of_elements() ==
+                    read_opts["size"].to_index_t() )
+            {
+                buff_base_bytes = read_opts["offset"].to_index_t() *
+                                  ele_bytes;
+            }
 
-        hnd.read(fetch_path,out);;
-    }
-    else
-    {
-        // error:  "unsupported sidre view state: " << view_state );
+            n_buff = &n_buff_read;
+        }
+
+        // create our views on the buffer and compact them to the outputs
+        void *buff_ptr = const_cast<void*>(n_buff->data_ptr());
+        for(size_t i=0; i < num_views; i++)
+        {
+            Node &out = *views[i].out;
+            Schema &view_schema = view_schemas[i];
+
+            if(view_is_buffer[i])
+            {
+                out.set(*n_buff);
+            }
+            else if( view_schema.number_of_children() == 0 &&
+                     view_schema.dtype().number_of_elements() == 0 )
+            {
+                Schema view_schema_compact;
+                view_schema.compact_to(view_schema_compact);
+                out.set(view_schema_compact);
+            }
+            else
+            {
+                if(buff_base_bytes > 0)
+                {
+                    DataType &view_dtype = view_schema.dtype();
+                    view_dtype.set_offset(view_dtype.offset() -
+                                          buff_base_bytes);
+                }
+                Node n_view;
+                n_view.set_external(view_schema,buff_ptr);
+                n_view.compact_to(out);
+            }
+        }
     }
 }
 
@@ -1117,6 +1314,10 @@ SidreIOHandle::prepare_file_handle(int tree_id)
         // CONDUIT_INFO("opening: " << generate_file_path(tree_id));
         // if not, open the handle
         m_file_handles[file_id].open(generate_file_path(tree_id));
+        // and start a fresh buffer cache for it
+        BufferCache &buffer_cache = m_buffer_caches[file_id];
+        buffer_cache.clear();
+        buffer_cache.max_data_bytes = m_buffer_cache_bytes;
     }
 }
 
@@ -1215,6 +1416,7 @@ SidreIOHandle::prepare_sidre_meta_tree(int tree_id,
 //-----------------------------------------------------------------------------
 void
 SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
+                                    BufferCache &buffer_cache,
                                     const std::string &tree_prefix,
                                     const std::string &path,
                                     Node &sidre_meta,
@@ -1227,12 +1429,19 @@ SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
                             path,
                             sidre_meta);
 
+    BufferViewReads buffer_reads;
     load_sidre_tree(sidre_meta,
                     hnd,
                     tree_prefix,
                     path,
                     "", // current path starts at root
+                    buffer_reads,
                     out);
+
+    load_sidre_buffer_views(hnd,
+                            buffer_cache,
+                            tree_prefix,
+                            buffer_reads);
 }
 
 //-----------------------------------------------------------------------------
@@ -1259,24 +1468,40 @@ SidreIOHandle::read_from_sidre_tree(int tree_id,
         // start a top level traversal
         // call load sidre variant that uses existing sidre meta tree
         Node &sidre_meta = m_sidre_meta[tree_id];
+        std::string tree_prefix = generate_tree_path(tree_id);
+        BufferViewReads buffer_reads;
         load_sidre_tree(sidre_meta,
                         m_file_handles[file_id],
-                        generate_tree_path(tree_id),
+                        tree_prefix,
                         path,
                         "", // current path starts at root
+                        buffer_reads,
                         out);
+
+        load_sidre_buffer_views(m_file_handles[file_id],
+                                m_buffer_caches[file_id],
+                                tree_prefix,
+                                buffer_reads);
     }
     else
     {
         // start a top level traversal
         // call load sidre variant that uses existing sidre meta tree
         Node &sidre_meta = m_sidre_meta[tree_id];
+        std::string tree_prefix = generate_tree_path(tree_id);
+        BufferViewReads buffer_reads;
         load_sidre_tree(sidre_meta,
                         m_root_handle,
-                        generate_tree_path(tree_id),
+                        tree_prefix,
                         path,
                         "", // current path starts at root
+                        buffer_reads,
                         out);
+
+        load_sidre_buffer_views(m_root_handle,
+                                m_root_buffer_cache,
+                                tree_prefix,
+                                buffer_reads);
     }
 }
 
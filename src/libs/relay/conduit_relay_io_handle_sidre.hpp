@@ -19,6 +19,14 @@
 #include "conduit_relay_exports.h"
 #include "conduit_relay_config.h"
 
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
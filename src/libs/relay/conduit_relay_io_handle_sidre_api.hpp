@@ -54,6 +54,33 @@ public:
 
 private:
 
+    // per open file cache of parsed buffer schemas, and (up to
+    // max_data_bytes) of buffer data, so views that share a buffer
+    // don't re-read and re-parse it
+    struct BufferCache
+    {
+        BufferCache();
+        void clear();
+
+        std::map<std::string,Schema> schemas;
+        std::map<std::string,Node>   data;
+        // resident buffers, oldest first (evicted first)
+        std::deque<std::string>      data_order;
+        index_t                      data_bytes;
+        index_t                      max_data_bytes;
+    };
+
+    // a buffer attached view found during a traversal, its data is read
+    // after the traversal so all views of a buffer share one read
+    struct BufferViewRead
+    {
+        const Node *sidre_meta_view;
+        Node       *out;
+    };
+
+    // buffer id -> views attached to that buffer
+    typedef std::map<int,std::vector<BufferViewRead> > BufferViewReads;
+
     std::string root_file_directory() const;
     std::string detect_root_protocol() const;
 
@@ -73,6 +100,7 @@ private:
     static std::string generate_sidre_meta_view_path(const std::string &tree_path);
 
     static void read_from_sidre_tree(IOHandle &hnd,
+                                     BufferCache &buffer_cache,
                                      const std::string &tree_prefix,
                                      const std::string &path,
                                      Node &sidre_meta,
@@ -84,20 +112,33 @@ private:
                                 const std::string &tree_prefix,
                                 const std::string &tree_path,
                                 const std::string &curr_path,
+                                BufferViewReads &buffer_reads,
                                 Node &out);
 
     static void load_sidre_group(Node &sidre_meta,
                                  IOHandle &hnd,
                                  const std::string &tree_prefix,
                                  const std::string &group_path,
+                                 BufferViewReads &buffer_reads,
                                  Node &out);
 
     static void load_sidre_view(Node &sidre_meta_view,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &view_path,
+                                BufferViewReads &buffer_reads,
                                 Node &out);
 
+    // reads the data of the buffer attached views found by a traversal
+    static void load_sidre_buffer_views(IOHandle &hnd,
+                                        BufferCache &buffer_cache,
+                                        const std::string &tree_prefix,
+                                        BufferViewReads &buffer_reads);
+
+    static const Schema &buffer_schema(IOHandle &hnd,
+                                       BufferCache &buffer_cache,
+                                       const std::string &buffer_path);
+
     bool sidre_meta_tree_has_path(const Node &sidre_meta,
                                   const std::string &path);
 
@@ -148,4 +189,15 @@ private:
     // holds cached sidre meta date for each tree
     std::map<int,Node>       m_sidre_meta;
 
+    // buffer caches for the root file and each tree file
+    BufferCache              m_root_buffer_cache;
+    std::map<int,BufferCache> m_buffer_caches;
+    // max bytes of buffer data each cache keeps resident
+    // (open option: sidre/buffer_cache_bytes, default: 0)
+    index_t                  m_buffer_cache_bytes;
+
+    // guards the cached handles and meta data, so concurrent reads
+    // are serialized (recursive since reads list and read children)
+    std::recursive_mutex     m_mutex;
+
 };
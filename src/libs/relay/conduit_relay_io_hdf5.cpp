@@ -20,6 +20,10 @@
 // standard lib includes
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <algorithm>
+#include <vector>
+#include <exception>
+#include <mutex>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -126,6 +130,21 @@ namespace io
 
 static std::string conduit_hdf5_list_attr_name = "__conduit_list";
 
+//-----------------------------------------------------------------------------
+// The public hdf5 functions share global state (the hdf5 options and the
+// HDF5 error handler, which is swapped off while probing trees) and the
+// HDF5 library is not reentrant, so each one holds this lock. It is
+// recursive because they call each other.
+//-----------------------------------------------------------------------------
+static std::recursive_mutex &
+hdf5_api_mutex()
+{
+    static std::recursive_mutex m;
+    return m;
+}
+
+typedef std::lock_guard<std::recursive_mutex> HDF5APILock;
+
 
 //-----------------------------------------------------------------------------
 // Private class used to hold options that control hdf5 i/o params.
@@ -274,6 +293,7 @@ int         HDF5Options::compression_level  = 5;
 void
 hdf5_set_options(const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     HDF5Options::set(opts);
 }
 
@@ -281,9 +301,50 @@ hdf5_set_options(const Node &opts)
 void
 hdf5_options(Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     HDF5Options::about(opts);
 }
 
+//-----------------------------------------------------------------------------
+// Private class used to apply the hdf5 i/o options given in a write's
+// opts["hdf5"] for the duration of that write.
+//
+// The previous options are restored when the scope ends. Construct it
+// while holding the hdf5 api lock, so no other hdf5 call can observe
+// (or change) the swapped in options.
+//-----------------------------------------------------------------------------
+class HDF5ScopedOptions
+{
+public:
+    HDF5ScopedOptions(const Node &opts)
+    {
+        if(opts.has_child("hdf5"))
+        {
+            HDF5Options::about(m_prev_options);
+            try
+            {
+                HDF5Options::set(opts["hdf5"]);
+            }
+            catch(...)
+            {
+                HDF5Options::set(m_prev_options);
+                throw;
+            }
+        }
+    }
+
+    ~HDF5ScopedOptions()
+    {
+        if(!m_prev_options.dtype().is_empty())
+        {
+            HDF5Options::set(m_prev_options);
+        }
+    }
+
+private:
+    Node m_prev_options;
+};
+
 //-----------------------------------------------------------------------------
 // Private class used to suppress HDF5 error messages.
 //
@@ -497,6 +558,7 @@ hid_t
 conduit_dtype_to_hdf5_dtype(const DataType &dt,
                             const std::string &ref_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     hid_t res = -1;
 
     // // This code path enables writing strings in a way that is friendlier
@@ -614,6 +676,7 @@ void
 conduit_dtype_to_hdf5_dtype_cleanup(hid_t hdf5_dtype_id,
                             const std::string &ref_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // NOTE: This cleanup won't be triggered when we use thee
     // based H5T_C_S1 with a data space that encodes # of elements
     // (Our current path, given our logic to encode string size in the
@@ -638,6 +701,7 @@ hdf5_dtype_to_conduit_dtype(hid_t hdf5_dtype_id,
                             index_t num_elems,
                             const std::string &ref_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // TODO: there may be a more straight forward way to do this using
     // hdf5's data type introspection methods
 
@@ -890,10 +954,12 @@ check_if_conduit_leaf_is_compatible_with_hdf5_obj(const DataType &dtype,
             hid_t h5_test_dtype  = H5Dget_type(hdf5_id);
 
             // we will check the 1d-properties of the hdf5 dataspace
+            // (N-D datasets are treated as flat arrays in C order)
             hssize_t h5_test_num_ele = H5Sget_simple_extent_npoints(h5_test_dspace);
 
-            hsize_t dataset_max_dims[1];
-            H5Sget_simple_extent_dims(h5_test_dspace, NULL, dataset_max_dims);
+            int h5_test_rank = H5Sget_simple_extent_ndims(h5_test_dspace);
+            std::vector<hsize_t> dataset_max_dims(h5_test_rank > 0 ? h5_test_rank : 1, 0);
+            H5Sget_simple_extent_dims(h5_test_dspace, NULL, &dataset_max_dims[0]);
 
             // string case is special, check it first
 
@@ -1241,7 +1307,8 @@ create_hdf5_compact_plist_for_conduit_leaf()
 
 //---------------------------------------------------------------------------//
 hid_t
-create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
+create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype,
+                                           const std::vector<hsize_t> &dims)
 {
     hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
 
@@ -1251,7 +1318,26 @@ create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
     // our options are in bytes, so convert to # of elems
     hsize_t h5_chunk_size =  (hsize_t) (HDF5Options::chunk_size / dtype.element_bytes());
 
-    H5Pset_chunk(h5_cprops_id, 1, &h5_chunk_size);
+    if(dims.size() == 1)
+    {
+        H5Pset_chunk(h5_cprops_id, 1, &h5_chunk_size);
+    }
+    else
+    {
+        // N-D chunks: keep the fastest varying (trailing) dims whole
+        // and split the leading dims, so each chunk holds about
+        // h5_chunk_size contiguous elements
+        std::vector<hsize_t> h5_chunk_dims(dims.size(),1);
+        hsize_t chunk_eles_left = h5_chunk_size > 0 ? h5_chunk_size : 1;
+        for(size_t i = dims.size(); i > 0; i--)
+        {
+            hsize_t dim_size = dims[i-1] > 0 ? dims[i-1] : 1;
+            h5_chunk_dims[i-1] = std::min(dim_size, chunk_eles_left);
+            chunk_eles_left = std::max((hsize_t)1,
+                                       chunk_eles_left / h5_chunk_dims[i-1]);
+        }
+        H5Pset_chunk(h5_cprops_id, (int)dims.size(), &h5_chunk_dims[0]);
+    }
 
     if(HDF5Options::compression_method == "gzip" )
     {
@@ -1276,7 +1362,17 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
 
     hid_t h5_dtype = conduit_dtype_to_hdf5_dtype(dtype,ref_path);
 
-    hsize_t num_eles = (hsize_t) dtype.number_of_elements();
+    // the dims of the dataset, N-D datasets are created for leaves
+    // with an N-D shape (extendible datasets are always 1-D)
+    std::vector<hsize_t> h5_dims;
+    if(dtype.has_shape() && dtype.is_number() && !extendible)
+    {
+        h5_dims.assign(dtype.shape().begin(),dtype.shape().end());
+    }
+    else
+    {
+        h5_dims.push_back((hsize_t) dtype.number_of_elements());
+    }
 
     hid_t h5_cprops_id = H5P_DEFAULT;
 
@@ -1296,8 +1392,10 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
     else if( extendible || (HDF5Options::chunking_enabled &&
              dtype.bytes_compact() > HDF5Options::chunk_threshold))
     {
-        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype);
-        unlimited_dim = true;
+        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype,
+                                                                  h5_dims);
+        // N-D datasets keep fixed dims
+        unlimited_dim = (h5_dims.size() == 1);
     }
 
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_cprops_id,
@@ -1324,13 +1422,13 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
     {
         hsize_t unlimited_dims[1] = {H5S_UNLIMITED};
         h5_dspace_id = H5Screate_simple(1,
-                                        &num_eles,
+                                        &h5_dims[0],
                                         unlimited_dims);
     }
     else
     {
-        h5_dspace_id = H5Screate_simple(1,
-                                        &num_eles,
+        h5_dspace_id = H5Screate_simple((int)h5_dims.size(),
+                                        &h5_dims[0],
                                         NULL);
     }
 
@@ -1548,8 +1646,19 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
     // get dimensions of dset
     hid_t dataspace = H5Dget_space(hdf5_dset_id);
     hsize_t dataset_dim = H5Sget_simple_extent_npoints(dataspace);
-    hsize_t dataset_max_dims[1];
-    H5Sget_simple_extent_dims(dataspace, NULL, dataset_max_dims);
+    int dataset_rank = H5Sget_simple_extent_ndims(dataspace);
+    std::vector<hsize_t> dataset_max_dims(dataset_rank > 0 ? dataset_rank : 1, 0);
+    H5Sget_simple_extent_dims(dataspace, NULL, &dataset_max_dims[0]);
+
+    if(dataset_rank > 1 && (offset != 0 || stride != 1))
+    {
+        H5Sclose(dataspace);
+        conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Writing with `offset` or `stride` is only "
+                           "supported for 1-D HDF5 Datasets "
+                           "(dataset rank: " << dataset_rank << ")");
+    }
 
     // if the layout is fixed and no offset/stride is supplied,
     // the entire array is overwriten
@@ -2190,6 +2299,9 @@ struct h5_read_opdata
 
     // whether to only get metadata
     bool             metadata_only;
+
+    // error raised while visiting a link, rethrown after H5Literate
+    std::exception_ptr error;
 };
 
 //---------------------------------------------------------------------------//
@@ -2316,10 +2428,9 @@ h5l_iterate_traverse_op_func_get_child(Node &node,
 //  circular path in the file.
 //---------------------------------------------------------------------------//
 herr_t
-h5l_iterate_traverse_op_func(hid_t hdf5_id,
-                             const char *hdf5_path,
-                             const H5L_info_t *,// hdf5_info -- unused
-                             void *hdf5_operator_data)
+h5l_iterate_traverse_op_func_visit(hid_t hdf5_id,
+                                   const char *hdf5_path,
+                                   void *hdf5_operator_data)
 {
     herr_t h5_status = 0;
     herr_t h5_return_val = 0;
@@ -2467,6 +2578,33 @@ h5l_iterate_traverse_op_func(hid_t hdf5_id,
     return h5_return_val;
 }
 
+//---------------------------------------------------------------------------//
+// H5Literate callback. Exceptions must not unwind through the HDF5 library
+// (that skips its cleanup, and with a thread safe HDF5 leaves the library
+// lock held), so they are captured here and rethrown once H5Literate
+// returns.
+//---------------------------------------------------------------------------//
+herr_t
+h5l_iterate_traverse_op_func(hid_t hdf5_id,
+                             const char *hdf5_path,
+                             const H5L_info_t *,// hdf5_info -- unused
+                             void *hdf5_operator_data)
+{
+    try
+    {
+        return h5l_iterate_traverse_op_func_visit(hdf5_id,
+                                                  hdf5_path,
+                                                  hdf5_operator_data);
+    }
+    catch(...)
+    {
+        struct h5_read_opdata *h5_od = (struct h5_read_opdata*)hdf5_operator_data;
+        h5_od->error = std::current_exception();
+        // negative return value stops the iteration
+        return -1;
+    }
+}
+
 
 //---------------------------------------------------------------------------//
 void
@@ -2568,6 +2706,11 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                            h5l_iterate_traverse_op_func,
                            (void *) &h5_od);
 
+    if(h5_od.error)
+    {
+        std::rethrow_exception(h5_od.error);
+    }
+
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
                                                     hdf5_group_id,
                                                     ref_path,
@@ -2612,6 +2755,26 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
 
         index_t nelems     = H5Sget_simple_extent_npoints(h5_dspace_id);
 
+        // N-D datasets are read as flat arrays in C order, and their
+        // dims are kept as the shape of the resulting leaf
+        int dset_rank = H5Sget_simple_extent_ndims(h5_dspace_id);
+        std::vector<hsize_t> dset_dims(dset_rank > 0 ? dset_rank : 1, 0);
+        H5Sget_simple_extent_dims(h5_dspace_id, &dset_dims[0], NULL);
+
+        if(dset_rank > 1 && ( opts.has_child("offset") ||
+                              opts.has_child("stride") ||
+                              opts.has_child("size") ) )
+        {
+            H5Tclose(h5_dtype_id);
+            H5Sclose(h5_dspace_id);
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Error reading HDF5 Dataset with options:"
+                               << opts.to_yaml() <<
+                               "`offset`, `stride`, and `size` are only "
+                               "supported for 1-D HDF5 Datasets "
+                               "(dataset rank: " << dset_rank << ")");
+        }
+
         hsize_t offset = 0;
         if(opts.has_child("offset"))
         {
@@ -2703,6 +2866,13 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                 conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
             }
 
+            if(dset_rank > 1 && dt.is_number())
+            {
+                std::vector<index_t> shape(dset_dims.begin(),
+                                           dset_dims.end());
+                dt.set_shape(shape);
+            }
+
             hsize_t node_size[1] = {nelems_to_read};
             hsize_t offsets[1] = {offset};
             hsize_t strides[1] = {stride};
@@ -2710,8 +2880,16 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
             hid_t dataspace = H5Dget_space(hdf5_dset_id);
 
             // select hyperslab
-            H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offsets,
-                strides, node_size, NULL);
+            if(dset_rank > 1)
+            {
+                // the whole N-D dataset is read
+                H5Sselect_all(dataspace);
+            }
+            else
+            {
+                H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offsets,
+                    strides, node_size, NULL);
+            }
 
             // check for string special case, H5T_VARIABLE string
             if( H5Tis_variable_str(h5_dtype_id) )
@@ -2985,6 +3163,7 @@ create_hdf5_file_create_plist()
 hid_t
 hdf5_create_file(const std::string &file_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3018,6 +3197,7 @@ hdf5_create_file(const std::string &file_path)
 void
 hdf5_close_file(hid_t hdf5_id)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // close the hdf5 file
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(hdf5_id),
                              "Error closing HDF5 file handle: " << hdf5_id);
@@ -3031,6 +3211,7 @@ hdf5_write(const Node &node,
            hid_t hdf5_id,
            const std::string &hdf5_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,hdf5_id,hdf5_path,opts);
 }
@@ -3044,6 +3225,8 @@ hdf5_write(const Node &node,
            const std::string &hdf5_path,
            const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
+    HDF5ScopedOptions scoped_options(opts);
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3132,6 +3315,7 @@ void
 hdf5_write(const Node &node,
            hid_t hdf5_id)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,hdf5_id,opts);
 }
@@ -3144,6 +3328,8 @@ hdf5_write(const Node &node,
            hid_t &hdf5_id,
            const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
+    HDF5ScopedOptions scoped_options(opts);
     // disable hdf5 error stack
     // TODO: we may only need to use this in an outer level variant
     // of check_if_conduit_node_is_compatible_with_hdf5_tree
@@ -3184,6 +3370,7 @@ void
 hdf5_save(const Node &node,
           const std::string &path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,path,opts,false);
 }
@@ -3195,6 +3382,7 @@ hdf5_save(const Node &node,
           const std::string &path,
           const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     hdf5_write(node,path,opts,false);
 }
 
@@ -3204,6 +3392,7 @@ hdf5_save(const Node &node,
           const std::string &file_path,
           const std::string &hdf5_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,file_path,hdf5_path,opts,false);
 }
@@ -3216,6 +3405,7 @@ hdf5_save(const Node &node,
           const std::string &hdf5_path,
           const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     hdf5_write(node,file_path,hdf5_path,opts,false);
 }
 
@@ -3225,6 +3415,7 @@ void
 hdf5_append(const Node &node,
             const std::string &path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,path,opts,true);
 }
@@ -3236,6 +3427,7 @@ hdf5_append(const Node &node,
             const std::string &path,
             const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     hdf5_write(node,path,opts,true);
 }
 
@@ -3245,6 +3437,7 @@ hdf5_append(const Node &node,
             const std::string &file_path,
             const std::string &hdf5_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,file_path,hdf5_path,opts,true);
 }
@@ -3256,6 +3449,7 @@ hdf5_append(const Node &node,
             const std::string &hdf5_path,
             const Node &opts)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     hdf5_write(node,file_path,hdf5_path,opts,true);
 }
 
@@ -3266,6 +3460,7 @@ hdf5_write(const  Node &node,
            const std::string &path,
            bool append)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,path,opts,append);
 }
@@ -3278,6 +3473,7 @@ hdf5_write(const  Node &node,
            const Node &opts,
            bool append)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // check for ":" split
     std::string file_path;
     std::string hdf5_path;
@@ -3309,6 +3505,7 @@ hdf5_write(const Node &node,
            const std::string &hdf5_path,
            bool append)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_write(node,file_path,hdf5_path,opts,append);
 }
@@ -3322,6 +3519,7 @@ hdf5_write(const Node &node,
            const Node &opts,
            bool append)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3363,6 +3561,7 @@ hdf5_write(const Node &node,
 hid_t
 hdf5_open_file_for_read(const std::string &file_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3390,6 +3589,7 @@ hdf5_open_file_for_read(const std::string &file_path)
 hid_t
 hdf5_open_file_for_read_write(const std::string &file_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3420,6 +3620,7 @@ hdf5_read(hid_t hdf5_id,
           const std::string &hdf5_path,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read(hdf5_id,hdf5_path,opts,dest);
 }
@@ -3431,6 +3632,7 @@ hdf5_read(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3466,6 +3668,7 @@ hdf5_read(const std::string &file_path,
           const std::string &hdf5_path,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read(file_path,hdf5_path,opts,node);
 }
@@ -3477,6 +3680,7 @@ hdf5_read(const std::string &file_path,
           const Node &opts,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // note: hdf5 error stack is suppressed in these calls
 
     // open the hdf5 file for reading
@@ -3497,6 +3701,7 @@ void
 hdf5_read(const std::string &path,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read(path,opts,node);
 }
@@ -3507,6 +3712,7 @@ hdf5_read(const std::string &path,
           const Node &opts,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // check for ":" split
     std::string file_path;
     std::string hdf5_path;
@@ -3535,6 +3741,7 @@ void
 hdf5_read(hid_t hdf5_id,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read(hdf5_id,opts,dest);
 }
@@ -3546,6 +3753,7 @@ hdf5_read(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3565,6 +3773,7 @@ hdf5_read_info(hid_t hdf5_id,
           const std::string &hdf5_path,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read_info(hdf5_id,hdf5_path,opts,dest);
 }
@@ -3576,6 +3785,7 @@ hdf5_read_info(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3611,6 +3821,7 @@ hdf5_read_info(const std::string &file_path,
           const std::string &hdf5_path,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read_info(file_path,hdf5_path,opts,node);
 }
@@ -3622,6 +3833,7 @@ hdf5_read_info(const std::string &file_path,
           const Node &opts,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // note: hdf5 error stack is suppressed in these calls
 
     // open the hdf5 file for reading
@@ -3642,6 +3854,7 @@ void
 hdf5_read_info(const std::string &path,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read_info(path,opts,node);
 }
@@ -3652,6 +3865,7 @@ hdf5_read_info(const std::string &path,
           const Node &opts,
           Node &node)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // check for ":" split
     std::string file_path;
     std::string hdf5_path;
@@ -3680,6 +3894,7 @@ void
 hdf5_read_info(hid_t hdf5_id,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     Node opts;
     hdf5_read_info(hdf5_id,opts,dest);
 }
@@ -3691,6 +3906,7 @@ hdf5_read_info(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3709,6 +3925,7 @@ bool
 hdf5_has_path(hid_t hdf5_id,
               const std::string &hdf5_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3733,6 +3950,7 @@ void
 hdf5_remove_path(hid_t hdf5_id,
                  const std::string &hdf5_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3754,6 +3972,7 @@ hdf5_remove_path(hid_t hdf5_id,
 bool
 is_hdf5_file(const std::string &file_path)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3783,6 +4002,7 @@ void hdf5_group_list_child_names(hid_t hdf5_id,
                                  const std::string &hdf5_path,
                                  std::vector<std::string> &res)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3916,6 +4136,7 @@ void hdf5_group_list_child_names(hid_t hdf5_id,
 void
 hdf5_identifier_report(Node &out)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     hdf5_identifier_report(H5F_OBJ_ALL,out);
 }
 
@@ -3923,6 +4144,7 @@ hdf5_identifier_report(Node &out)
 void
 hdf5_identifier_report(hid_t hdf5_id, Node &out)
 {
+    HDF5APILock hdf5_api_lock(hdf5_api_mutex());
     out.reset();
     int h5_num_objs = H5Fget_obj_count(hdf5_id, H5F_OBJ_ALL);
 
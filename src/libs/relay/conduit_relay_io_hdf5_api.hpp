@@ -201,6 +201,9 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
 // To support this, hdf5_id is passed as a reference and is updated
 // as needed.
 //
+// If opts has an "hdf5" child, those hdf5 i/o options (see
+// hdf5_set_options) are used for this write only.
+//
 void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   hid_t &hdf5_id,
                                   const std::string &hdf5_path,
@@ -221,6 +224,9 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
 // To support this, hdf5_id is passed as a reference and is updated
 // as needed.
 //
+// If opts has an "hdf5" child, those hdf5 i/o options (see
+// hdf5_set_options) are used for this write only.
+//
 void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   hid_t &hdf5_id,
                                   const Node &opts);
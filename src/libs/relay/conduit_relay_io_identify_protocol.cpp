@@ -111,6 +111,10 @@ identify_protocol(const std::string &path,
     {
         io_type = "csv";
     }
+    else if(file_name_ext == "conduit_table")
+    {
+        io_type = "conduit_table";
+    }
 
     // default to conduit_bin
 
@@ -0,0 +1,1061 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_table.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_relay_io_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "conduit_log.hpp"
+#include "conduit_execution.hpp"
+#include "conduit_blueprint_table.hpp"
+
+using conduit::utils::log::quote;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+// Static functions, internal types
+
+// Magic bytes at the start and end of a table file
+static const char table_magic[] = "CDTABLE1";
+static const std::size_t table_magic_bytes = 8;
+
+// Current version of the file format
+static const int table_format_version = 1;
+
+// Default number of rows in a row group
+static const index_t table_default_row_group_rows = 65536;
+
+// Number of row groups encoded or decoded together
+static const index_t table_groups_per_batch = 32;
+
+//-----------------------------------------------------------------------------
+// Encodings of column chunks
+//-----------------------------------------------------------------------------
+enum TableEncoding
+{
+    // compact element data (in the file's endianness)
+    TABLE_ENCODING_RAW   = 0,
+    // (varint run length, element) pairs (elements in the file's endianness)
+    TABLE_ENCODING_RLE   = 1,
+    // zig-zag varint differences between consecutive integers
+    // (byte order independent)
+    TABLE_ENCODING_DELTA = 2
+};
+
+//-----------------------------------------------------------------------------
+// Options used by the writer
+//-----------------------------------------------------------------------------
+struct TableWriteOptions
+{
+    index_t row_group_rows;
+    bool    compress;
+};
+
+//-----------------------------------------------------------------------------
+// Options used by the reader
+//-----------------------------------------------------------------------------
+struct TableReadOptions
+{
+    std::vector<std::string> columns;
+    index_t row_offset;
+    // -1 reads all remaining rows
+    index_t row_count;
+};
+
+//-----------------------------------------------------------------------------
+// A column of a table that is written
+//-----------------------------------------------------------------------------
+struct TableColumn
+{
+    const Node *leaf;
+    // index of the column's child in "values"
+    index_t     base;
+    std::string name;
+    // mcarray component name, empty for plain arrays
+    std::string component;
+};
+
+//-----------------------------------------------------------------------------
+static void
+gather_table_columns(const Node &values, std::vector<TableColumn> &columns)
+{
+    const index_t nvalues = values.number_of_children();
+    for(index_t i = 0; i < nvalues; i++)
+    {
+        const Node &value = values[i];
+        const index_t nc = value.number_of_children();
+        if(nc > 0)
+        {
+            for(index_t c = 0; c < nc; c++)
+            {
+                TableColumn column;
+                column.leaf = &value[c];
+                column.base = i;
+                column.name = value.name();
+                column.component = value[c].name();
+                columns.push_back(column);
+            }
+        }
+        else
+        {
+            TableColumn column;
+            column.leaf = &value;
+            column.base = i;
+            column.name = value.name();
+            columns.push_back(column);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+append_varint(uint64 v, std::vector<uint8> &out)
+{
+    while(v >= 0x80)
+    {
+        out.push_back(static_cast<uint8>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8>(v));
+}
+
+//-----------------------------------------------------------------------------
+static inline bool
+read_varint(const uint8 *&ptr, const uint8 *end, uint64 &v)
+{
+    v = 0;
+    for(int shift = 0; shift < 64 && ptr < end; shift += 7)
+    {
+        const uint8 b = *ptr++;
+        v |= static_cast<uint64>(b & 0x7f) << shift;
+        if((b & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+static inline int64
+load_integer(const uint8 *ptr, index_t ele_bytes, bool is_signed)
+{
+    switch(ele_bytes)
+    {
+        case 1:
+        {
+            uint8 v; std::memcpy(&v, ptr, 1);
+            return is_signed ? static_cast<int64>(static_cast<int8>(v)) : v;
+        }
+        case 2:
+        {
+            uint16 v; std::memcpy(&v, ptr, 2);
+            return is_signed ? static_cast<int64>(static_cast<int16>(v)) : v;
+        }
+        case 4:
+        {
+            uint32 v; std::memcpy(&v, ptr, 4);
+            return is_signed ? static_cast<int64>(static_cast<int32>(v)) : v;
+        }
+        default:
+        {
+            int64 v; std::memcpy(&v, ptr, 8);
+            return v;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+store_integer(int64 v, index_t ele_bytes, uint8 *ptr)
+{
+    switch(ele_bytes)
+    {
+        case 1: { uint8  t = static_cast<uint8>(v);  std::memcpy(ptr, &t, 1); break; }
+        case 2: { uint16 t = static_cast<uint16>(v); std::memcpy(ptr, &t, 2); break; }
+        case 4: { uint32 t = static_cast<uint32>(v); std::memcpy(ptr, &t, 4); break; }
+        default: { std::memcpy(ptr, &v, 8); break; }
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Copies rows [begin, end) of a leaf into out as compact elements.
+*/
+static void
+compact_rows(const Node &leaf, index_t begin, index_t end,
+    std::vector<uint8> &out)
+{
+    const DataType &dt = leaf.dtype();
+    const index_t ele_bytes = dt.element_bytes();
+    const index_t stride = dt.stride();
+    const uint8 *src = static_cast<const uint8*>(leaf.element_ptr(0));
+    out.resize((end - begin) * ele_bytes);
+    if(stride == ele_bytes)
+    {
+        std::memcpy(out.data(), src + begin * stride, out.size());
+    }
+    else
+    {
+        uint8 *dst = out.data();
+        for(index_t row = begin; row < end; row++, dst += ele_bytes)
+        {
+            std::memcpy(dst, src + row * stride, ele_bytes);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Run length encodes compact elements. Returns false (and gives up)
+    when the encoded data would be larger than max_bytes.
+*/
+static bool
+encode_rle(const std::vector<uint8> &raw, index_t ele_bytes,
+    std::size_t max_bytes, std::vector<uint8> &out)
+{
+    out.clear();
+    const index_t nele = static_cast<index_t>(raw.size()) / ele_bytes;
+    const uint8 *data = raw.data();
+    index_t i = 0;
+    while(i < nele)
+    {
+        index_t run = 1;
+        while(i + run < nele &&
+              std::memcmp(data + i * ele_bytes,
+                          data + (i + run) * ele_bytes,
+                          ele_bytes) == 0)
+        {
+            run++;
+        }
+        append_varint(static_cast<uint64>(run), out);
+        out.insert(out.end(), data + i * ele_bytes, data + (i + 1) * ele_bytes);
+        if(out.size() > max_bytes)
+        {
+            return false;
+        }
+        i += run;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Delta encodes compact integer elements. Returns false (and gives up)
+    when the encoded data would be larger than max_bytes.
+*/
+static bool
+encode_delta(const std::vector<uint8> &raw, index_t ele_bytes,
+    bool is_signed, std::size_t max_bytes, std::vector<uint8> &out)
+{
+    out.clear();
+    const index_t nele = static_cast<index_t>(raw.size()) / ele_bytes;
+    const uint8 *data = raw.data();
+    uint64 prev = 0;
+    for(index_t i = 0; i < nele; i++)
+    {
+        const uint64 v = static_cast<uint64>(load_integer(data + i * ele_bytes,
+                                                          ele_bytes,
+                                                          is_signed));
+        // differences wrap around, which decodes exactly
+        const uint64 d = v - prev;
+        const uint64 zz = (d << 1) ^ static_cast<uint64>(static_cast<int64>(d) >> 63);
+        append_varint(zz, out);
+        if(out.size() > max_bytes)
+        {
+            return false;
+        }
+        prev = v;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Encodes rows [begin, end) of a column. With compression the smallest
+    of the raw, run length, and (for integers) delta encodings is used.
+*/
+static void
+encode_chunk(const Node &leaf, index_t begin, index_t end, bool compress,
+    uint8 &encoding, std::vector<uint8> &out)
+{
+    const DataType &dt = leaf.dtype();
+    const index_t ele_bytes = dt.element_bytes();
+
+    std::vector<uint8> raw;
+    compact_rows(leaf, begin, end, raw);
+    encoding = TABLE_ENCODING_RAW;
+    if(compress)
+    {
+        std::vector<uint8> encoded;
+        if(encode_rle(raw, ele_bytes, raw.size() - 1, encoded) &&
+           encoded.size() < raw.size())
+        {
+            encoding = TABLE_ENCODING_RLE;
+            out.swap(encoded);
+        }
+
+        const std::size_t max_bytes = (encoding == TABLE_ENCODING_RAW)
+            ? raw.size() : out.size();
+        if(dt.is_integer() && max_bytes > 0 &&
+           encode_delta(raw, ele_bytes, dt.is_signed_integer(),
+                        max_bytes - 1, encoded))
+        {
+            encoding = TABLE_ENCODING_DELTA;
+            out.swap(encoded);
+        }
+    }
+
+    if(encoding == TABLE_ENCODING_RAW)
+    {
+        out.swap(raw);
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Decodes a chunk with nele elements into dest (compact elements in
+    machine byte order). swap is true when the file was written on a
+    machine with the other endianness.
+*/
+static void
+decode_chunk(uint8 encoding, const std::vector<uint8> &chunk, index_t nele,
+    index_t ele_bytes, bool swap, uint8 *dest)
+{
+    const uint8 *ptr = chunk.data();
+    const uint8 *end = ptr + chunk.size();
+    if(encoding == TABLE_ENCODING_RAW)
+    {
+        if(static_cast<index_t>(chunk.size()) != nele * ele_bytes)
+        {
+            CONDUIT_ERROR("Corrupt table file: raw chunk holds "
+                << chunk.size() << " bytes, expected " << nele * ele_bytes);
+        }
+        std::memcpy(dest, ptr, chunk.size());
+        if(swap)
+        {
+            Endianness::swap(dest, nele, ele_bytes);
+        }
+    }
+    else if(encoding == TABLE_ENCODING_RLE)
+    {
+        index_t i = 0;
+        while(i < nele)
+        {
+            uint64 run = 0;
+            if(!read_varint(ptr, end, run) || run == 0 ||
+               run > static_cast<uint64>(nele - i) ||
+               end - ptr < ele_bytes)
+            {
+                CONDUIT_ERROR("Corrupt table file: invalid run length chunk");
+            }
+            for(uint64 r = 0; r < run; r++, i++)
+            {
+                std::memcpy(dest + i * ele_bytes, ptr, ele_bytes);
+            }
+            ptr += ele_bytes;
+        }
+        if(swap)
+        {
+            Endianness::swap(dest, nele, ele_bytes);
+        }
+    }
+    else if(encoding == TABLE_ENCODING_DELTA)
+    {
+        uint64 prev = 0;
+        for(index_t i = 0; i < nele; i++)
+        {
+            uint64 zz = 0;
+            if(!read_varint(ptr, end, zz))
+            {
+                CONDUIT_ERROR("Corrupt table file: invalid delta chunk");
+            }
+            const uint64 d = (zz >> 1) ^ (uint64(0) - (zz & 1));
+            prev += d;
+            store_integer(static_cast<int64>(prev), ele_bytes, dest + i * ele_bytes);
+        }
+    }
+    else
+    {
+        CONDUIT_ERROR("Corrupt table file: unknown chunk encoding "
+            << static_cast<int>(encoding));
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Writes the chunks of a single table and records them in info.
+    Batches of row groups are encoded in parallel, one task per column
+    chunk, and written in order.
+*/
+static void
+write_single_table(const Node &table, const std::string &name,
+    const TableWriteOptions &opts, std::ofstream &fout, int64 &file_offset,
+    Node &info)
+{
+    const Node &values = table["values"];
+    std::vector<TableColumn> columns;
+    gather_table_columns(values, columns);
+
+    const index_t ncols = static_cast<index_t>(columns.size());
+    const index_t nrows = (ncols > 0)
+        ? columns[0].leaf->dtype().number_of_elements() : 0;
+    const index_t group_rows = opts.row_group_rows;
+    const index_t ngroups = (nrows + group_rows - 1) / group_rows;
+
+    info["name"] = name;
+    info["num_rows"] = nrows;
+    info["row_group_rows"] = group_rows;
+    info["num_row_groups"] = ngroups;
+    info["values_layout"] = values.dtype().is_list() ? "list" : "object";
+    // make sure "columns" is a list, even without columns
+    Node &cols_info = info["columns"];
+    cols_info.set(DataType::list());
+
+    for(const TableColumn &column : columns)
+    {
+        const DataType &dt = column.leaf->dtype();
+        if(dt.is_empty() || dt.is_object() || dt.is_list())
+        {
+            CONDUIT_ERROR("write_table: column " << quote(column.leaf->path())
+                << " is not a leaf.");
+        }
+    }
+
+    std::vector<std::vector<int64>> offsets(ncols, std::vector<int64>(ngroups));
+    std::vector<std::vector<int64>> sizes(ncols, std::vector<int64>(ngroups));
+    std::vector<std::vector<uint8>> encodings(ncols, std::vector<uint8>(ngroups));
+    std::vector<std::vector<uint8>> chunks(ncols * table_groups_per_batch);
+
+    for(index_t batch_begin = 0; batch_begin < ngroups;
+        batch_begin += table_groups_per_batch)
+    {
+        const index_t batch_end = std::min(ngroups,
+            batch_begin + table_groups_per_batch);
+        const index_t nbatch = batch_end - batch_begin;
+
+        // task t encodes column (t % ncols) of row group (t / ncols)
+        execution::for_all(0, nbatch * ncols, [&](index_t t)
+        {
+            const index_t col = t % ncols;
+            const index_t group = batch_begin + t / ncols;
+            const index_t row_begin = group * group_rows;
+            const index_t row_end = std::min(nrows, row_begin + group_rows);
+            encode_chunk(*columns[col].leaf, row_begin, row_end,
+                opts.compress, encodings[col][group], chunks[t]);
+        });
+
+        for(index_t group = batch_begin; group < batch_end; group++)
+        {
+            for(index_t col = 0; col < ncols; col++)
+            {
+                const std::vector<uint8> &chunk =
+                    chunks[(group - batch_begin) * ncols + col];
+                offsets[col][group] = file_offset;
+                sizes[col][group] = static_cast<int64>(chunk.size());
+                fout.write(reinterpret_cast<const char*>(chunk.data()),
+                    chunk.size());
+                file_offset += static_cast<int64>(chunk.size());
+            }
+        }
+    }
+
+    for(index_t col = 0; col < ncols; col++)
+    {
+        const TableColumn &column = columns[col];
+        Node &col_info = cols_info.append();
+        col_info["name"] = column.name;
+        col_info["component"] = column.component;
+        col_info["base"] = column.base;
+        col_info["data_type"] = column.leaf->dtype().name();
+        if(ngroups > 0)
+        {
+            col_info["offsets"].set(offsets[col]);
+            col_info["sizes"].set(sizes[col]);
+            col_info["encodings"].set(encodings[col]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+read_footer(std::ifstream &fin, const std::string &path, Node &footer,
+    int64 &data_end)
+{
+    fin.seekg(0, std::ios::end);
+    const int64 file_size = static_cast<int64>(fin.tellg());
+    if(file_size < static_cast<int64>(3 * table_magic_bytes))
+    {
+        CONDUIT_ERROR("File " << quote(path) << " is not a table file.");
+    }
+
+    char head[table_magic_bytes];
+    char tail[2 * table_magic_bytes];
+    fin.seekg(0, std::ios::beg);
+    fin.read(head, table_magic_bytes);
+    fin.seekg(file_size - 2 * table_magic_bytes, std::ios::beg);
+    fin.read(tail, 2 * table_magic_bytes);
+    if(!fin ||
+       std::memcmp(head, table_magic, table_magic_bytes) != 0 ||
+       std::memcmp(tail + table_magic_bytes, table_magic, table_magic_bytes) != 0)
+    {
+        CONDUIT_ERROR("File " << quote(path) << " is not a table file.");
+    }
+
+    // footer size is stored little endian
+    uint64 footer_bytes = 0;
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        footer_bytes |= static_cast<uint64>(static_cast<uint8>(tail[i])) << (8 * i);
+    }
+    if(footer_bytes > static_cast<uint64>(file_size - 3 * table_magic_bytes))
+    {
+        CONDUIT_ERROR("Corrupt table file " << quote(path)
+            << ": invalid footer size.");
+    }
+
+    // chunks are stored between the leading magic and the footer
+    data_end = file_size - static_cast<int64>(2 * table_magic_bytes
+                                              + footer_bytes);
+
+    std::string footer_json(footer_bytes, '\0');
+    fin.seekg(data_end, std::ios::beg);
+    fin.read(&footer_json[0], footer_bytes);
+    if(!fin)
+    {
+        CONDUIT_ERROR("Failed to read the footer of table file " << quote(path));
+    }
+    footer.parse(footer_json, "json");
+
+    if(footer["format_version"].to_int() > table_format_version)
+    {
+        CONDUIT_ERROR("Table file " << quote(path) << " uses format version "
+            << footer["format_version"].to_int() << ", this version of conduit"
+            << " reads version " << table_format_version << " and older.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+static bool
+column_selected(const Node &col_info, bool list_layout,
+    const std::vector<std::string> &selected)
+{
+    if(selected.empty())
+    {
+        return true;
+    }
+    const std::string base_name = list_layout
+        ? std::to_string(col_info["base"].to_index_t())
+        : col_info["name"].as_string();
+    const std::string component = col_info["component"].as_string();
+    for(const std::string &s : selected)
+    {
+        if(s == base_name ||
+           (!component.empty() && s == base_name + "/" + component))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+static void
+copy_int64s(const Node &n, std::vector<int64> &out)
+{
+    const int64_accessor values = n.as_int64_accessor();
+    out.resize(values.number_of_elements());
+    for(index_t i = 0; i < values.number_of_elements(); i++)
+    {
+        out[i] = values[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+// A column of a table that is read
+//-----------------------------------------------------------------------------
+struct TableReadColumn
+{
+    std::string name;
+    uint8      *data;
+    index_t     ele_bytes;
+    // per row group chunk offsets, sizes, and encodings
+    std::vector<int64> offsets;
+    std::vector<int64> sizes;
+    std::vector<int64> encodings;
+};
+
+//-----------------------------------------------------------------------------
+/**
+@brief Reads the selected columns and rows of a single table. The chunks of
+    a batch of row groups are read in order and decoded in parallel.
+*/
+static void
+read_single_table(std::ifstream &fin, const Node &info,
+    const TableReadOptions &opts, index_t file_endianness, int64 data_end,
+    Node &table)
+{
+    const index_t nrows = info["num_rows"].to_index_t();
+    const index_t group_rows = info["row_group_rows"].to_index_t();
+    if(nrows < 0 || group_rows <= 0)
+    {
+        CONDUIT_ERROR("Corrupt table file: invalid num_rows (" << nrows
+            << ") or row_group_rows (" << group_rows << ")");
+    }
+    const index_t ngroups = nrows / group_rows +
+        ((nrows % group_rows) != 0 ? 1 : 0);
+    const bool swap = file_endianness != Endianness::machine_default();
+    const bool list_layout = info["values_layout"].as_string() == "list";
+
+    const index_t row_begin = std::min(nrows, opts.row_offset);
+    const index_t row_end = (opts.row_count < 0)
+        ? nrows : std::min(nrows, row_begin + opts.row_count);
+    const index_t out_rows = row_end - row_begin;
+
+    Node &values = table["values"];
+    values.set(list_layout ? DataType::list() : DataType::object());
+
+    // create the output columns
+    std::vector<TableReadColumn> columns;
+    std::map<index_t, Node*> bases;
+    const Node &cols_info = info["columns"];
+    for(index_t i = 0; i < cols_info.number_of_children(); i++)
+    {
+        const Node &col_info = cols_info[i];
+        if(!column_selected(col_info, list_layout, opts.columns))
+        {
+            continue;
+        }
+
+        const index_t base = col_info["base"].to_index_t();
+        const std::string name = col_info["name"].as_string();
+        const std::string component = col_info["component"].as_string();
+        if(bases.find(base) == bases.end())
+        {
+            bases[base] = list_layout ? &values.append() : &values[name];
+        }
+        Node &leaf = component.empty()
+            ? *bases[base] : bases[base]->fetch(component);
+
+        const std::string dtype_name = col_info["data_type"].as_string();
+        const index_t dtype_id = DataType::name_to_id(dtype_name);
+        if(dtype_id < DataType::INT8_ID || dtype_id > DataType::CHAR8_STR_ID)
+        {
+            CONDUIT_ERROR("Corrupt table file: column " << quote(name)
+                << " has unsupported data type " << quote(dtype_name));
+        }
+        DataType dt = DataType::default_dtype(dtype_id);
+        dt.set_number_of_elements(out_rows);
+        leaf.set(dt);
+
+        TableReadColumn column;
+        column.name = leaf.path();
+        column.data = static_cast<uint8*>(leaf.element_ptr(0));
+        column.ele_bytes = dt.element_bytes();
+        if(nrows > 0)
+        {
+            if(!col_info.has_child("offsets") ||
+               !col_info.has_child("sizes") ||
+               !col_info.has_child("encodings"))
+            {
+                CONDUIT_ERROR("Corrupt table file: column " << quote(name)
+                    << " is missing chunk offsets, sizes, or encodings");
+            }
+            copy_int64s(col_info["offsets"], column.offsets);
+            copy_int64s(col_info["sizes"], column.sizes);
+            copy_int64s(col_info["encodings"], column.encodings);
+            if(static_cast<index_t>(column.offsets.size()) != ngroups ||
+               static_cast<index_t>(column.sizes.size()) != ngroups ||
+               static_cast<index_t>(column.encodings.size()) != ngroups)
+            {
+                CONDUIT_ERROR("Corrupt table file: column " << quote(name)
+                    << " must have one chunk per row group (" << ngroups
+                    << " row groups)");
+            }
+            for(index_t group = 0; group < ngroups; group++)
+            {
+                const int64 offset = column.offsets[group];
+                const int64 size = column.sizes[group];
+                const int64 encoding = column.encodings[group];
+                if(offset < static_cast<int64>(table_magic_bytes) ||
+                   size < 0 || offset > data_end || size > data_end - offset ||
+                   encoding < TABLE_ENCODING_RAW ||
+                   encoding > TABLE_ENCODING_DELTA)
+                {
+                    CONDUIT_ERROR("Corrupt table file: column " << quote(name)
+                        << " has an invalid chunk for row group " << group
+                        << " (offset " << offset << ", size " << size
+                        << ", encoding " << encoding << ")");
+                }
+            }
+        }
+        columns.push_back(column);
+    }
+
+    const index_t ncols = static_cast<index_t>(columns.size());
+    if(ncols == 0 || out_rows == 0)
+    {
+        return;
+    }
+
+    const index_t group_begin = row_begin / group_rows;
+    const index_t group_end = (row_end - 1) / group_rows + 1;
+    std::vector<std::vector<uint8>> chunks(ncols * table_groups_per_batch);
+
+    for(index_t batch_begin = group_begin; batch_begin < group_end;
+        batch_begin += table_groups_per_batch)
+    {
+        const index_t batch_end = std::min(group_end,
+            batch_begin + table_groups_per_batch);
+        const index_t nbatch = batch_end - batch_begin;
+
+        // read the chunks
+        for(index_t group = batch_begin; group < batch_end; group++)
+        {
+            for(index_t col = 0; col < ncols; col++)
+            {
+                const TableReadColumn &column = columns[col];
+                const int64 offset = column.offsets[group];
+                const int64 size = column.sizes[group];
+                std::vector<uint8> &chunk = chunks[(group - batch_begin) * ncols + col];
+                chunk.resize(static_cast<std::size_t>(size));
+                fin.seekg(offset, std::ios::beg);
+                fin.read(reinterpret_cast<char*>(chunk.data()), size);
+                if(!fin)
+                {
+                    CONDUIT_ERROR("Failed to read chunk of column "
+                        << quote(column.name)
+                        << " from table file.");
+                }
+            }
+        }
+
+        // decode the chunks, task t decodes column (t % ncols) of row
+        // group (batch_begin + t / ncols)
+        execution::for_all(0, nbatch * ncols, [&](index_t t)
+        {
+            const index_t col = t % ncols;
+            const index_t group = batch_begin + t / ncols;
+            const TableReadColumn &column = columns[col];
+            const uint8 encoding = static_cast<uint8>(column.encodings[group]);
+
+            const index_t g_begin = group * group_rows;
+            const index_t g_end = std::min(nrows, g_begin + group_rows);
+            const index_t copy_begin = std::max(g_begin, row_begin);
+            const index_t copy_end = std::min(g_end, row_end);
+            uint8 *dest = column.data + (copy_begin - row_begin) * column.ele_bytes;
+
+            if(copy_begin == g_begin && copy_end == g_end)
+            {
+                decode_chunk(encoding, chunks[t], g_end - g_begin,
+                    column.ele_bytes, swap, dest);
+            }
+            else
+            {
+                // partial row group, decode it and copy the requested rows
+                std::vector<uint8> group_data((g_end - g_begin) * column.ele_bytes);
+                decode_chunk(encoding, chunks[t], g_end - g_begin,
+                    column.ele_bytes, swap, group_data.data());
+                std::memcpy(dest,
+                    group_data.data() + (copy_begin - g_begin) * column.ele_bytes,
+                    (copy_end - copy_begin) * column.ele_bytes);
+            }
+        });
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- end static functions --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+write_table(const Node &table, const std::string &path, const Node &options)
+{
+    Node info;
+    const bool ok = blueprint::table::verify(table, info);
+    if(!ok)
+    {
+        CONDUIT_ERROR("The node provided to write_table must be a valid "
+            << "blueprint table!");
+    }
+
+    TableWriteOptions opts;
+    opts.row_group_rows = table_default_row_group_rows;
+    opts.compress = true;
+    if(options.has_child("row_group_rows"))
+    {
+        const Node &n = options["row_group_rows"];
+        if(n.dtype().is_number() && n.to_index_t() > 0)
+        {
+            opts.row_group_rows = n.to_index_t();
+        }
+        else
+        {
+            CONDUIT_ERROR("options[" << quote("row_group_rows") <<
+                "] must be a positive number.");
+        }
+    }
+
+    if(options.has_child("compression"))
+    {
+        const Node &n = options["compression"];
+        const std::string compression = n.dtype().is_string()
+            ? n.as_string() : std::string();
+        if(compression == "auto" || compression == "none")
+        {
+            opts.compress = (compression == "auto");
+        }
+        else
+        {
+            CONDUIT_ERROR("options[" << quote("compression") <<
+                "] must be " << quote("auto") << " or " << quote("none") << ".");
+        }
+    }
+
+    std::ofstream fout(path, std::ios::out | std::ios::binary);
+    if(!fout.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+        return;
+    }
+
+    fout.write(table_magic, table_magic_bytes);
+    int64 file_offset = static_cast<int64>(table_magic_bytes);
+
+    Node footer;
+    footer["format_version"] = table_format_version;
+    footer["endianness"] = Endianness::id_to_name(Endianness::machine_default());
+    Node &tables = footer["tables"];
+    if(table.has_child("values"))
+    {
+        footer["layout"] = "single";
+        write_single_table(table, "", opts, fout, file_offset, tables.append());
+    }
+    else
+    {
+        footer["layout"] = table.dtype().is_list() ? "list" : "object";
+        for(index_t i = 0; i < table.number_of_children(); i++)
+        {
+            const Node &t = table[i];
+            write_single_table(t, t.name(), opts, fout, file_offset,
+                tables.append());
+        }
+    }
+
+    const std::string footer_json = footer.to_json("json");
+    fout.write(footer_json.data(), footer_json.size());
+
+    // footer size, little endian
+    const uint64 footer_bytes = static_cast<uint64>(footer_json.size());
+    char footer_size[8];
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        footer_size[i] = static_cast<char>((footer_bytes >> (8 * i)) & 0xff);
+    }
+    fout.write(footer_size, 8);
+    fout.write(table_magic, table_magic_bytes);
+
+    if(!fout)
+    {
+        CONDUIT_ERROR("Failed to write file " << quote(path) << ".");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+read_table(const std::string &path, const Node &options, Node &table)
+{
+    table.reset();
+
+    TableReadOptions opts;
+    opts.row_offset = 0;
+    opts.row_count = -1;
+    if(options.has_child("columns"))
+    {
+        const Node &n = options["columns"];
+        if(n.dtype().is_string())
+        {
+            opts.columns.push_back(n.as_string());
+        }
+        else if(n.dtype().is_list() || n.dtype().is_object())
+        {
+            for(index_t i = 0; i < n.number_of_children(); i++)
+            {
+                if(!n[i].dtype().is_string())
+                {
+                    CONDUIT_ERROR("options[" << quote("columns") <<
+                        "] must be a string or a list of strings.");
+                }
+                opts.columns.push_back(n[i].as_string());
+            }
+        }
+        else
+        {
+            CONDUIT_ERROR("options[" << quote("columns") <<
+                "] must be a string or a list of strings.");
+        }
+    }
+
+    if(options.has_path("rows/offset"))
+    {
+        const Node &n = options["rows/offset"];
+        if(!n.dtype().is_number() || n.to_index_t() < 0)
+        {
+            CONDUIT_ERROR("options[" << quote("rows/offset") <<
+                "] must be a non-negative number.");
+        }
+        opts.row_offset = n.to_index_t();
+    }
+
+    if(options.has_path("rows/count"))
+    {
+        const Node &n = options["rows/count"];
+        if(!n.dtype().is_number() || n.to_index_t() < 0)
+        {
+            CONDUIT_ERROR("options[" << quote("rows/count") <<
+                "] must be a non-negative number.");
+        }
+        opts.row_count = n.to_index_t();
+    }
+
+    std::ifstream fin(path, std::ios::in | std::ios::binary);
+    if(!fin.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+        return;
+    }
+
+    Node footer;
+    int64 data_end = 0;
+    read_footer(fin, path, footer, data_end);
+
+    const index_t file_endianness =
+        Endianness::name_to_id(footer["endianness"].as_string());
+    const std::string layout = footer["layout"].as_string();
+    const Node &tables = footer["tables"];
+    if(layout == "single")
+    {
+        read_single_table(fin, tables[0], opts, file_endianness, data_end,
+            table);
+    }
+    else
+    {
+        for(index_t i = 0; i < tables.number_of_children(); i++)
+        {
+            const Node &t = tables[i];
+            Node &out = (layout == "list")
+                ? table.append() : table[t["name"].as_string()];
+            read_single_table(fin, t, opts, file_endianness, data_end, out);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+read_table_info(const std::string &path, Node &info)
+{
+    info.reset();
+
+    std::ifstream fin(path, std::ios::in | std::ios::binary);
+    if(!fin.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+        return;
+    }
+
+    Node footer;
+    int64 data_end = 0;
+    read_footer(fin, path, footer, data_end);
+
+    info["format_version"] = footer["format_version"];
+    info["endianness"] = footer["endianness"];
+    info["layout"] = footer["layout"];
+    Node &tables = info["tables"];
+    const Node &f_tables = footer["tables"];
+    for(index_t i = 0; i < f_tables.number_of_children(); i++)
+    {
+        const Node &f_table = f_tables[i];
+        const bool list_layout = f_table["values_layout"].as_string() == "list";
+        Node &t = tables.append();
+        t["name"] = f_table["name"];
+        t["num_rows"] = f_table["num_rows"];
+        t["row_group_rows"] = f_table["row_group_rows"];
+        t["num_row_groups"] = f_table["num_row_groups"];
+        t["values_layout"] = f_table["values_layout"];
+        Node &cols = t["columns"];
+        cols.set(DataType::list());
+        const Node &f_cols = f_table["columns"];
+        for(index_t c = 0; c < f_cols.number_of_children(); c++)
+        {
+            const Node &f_col = f_cols[c];
+            const std::string component = f_col["component"].as_string();
+            std::string name = list_layout
+                ? std::to_string(f_col["base"].to_index_t())
+                : f_col["name"].as_string();
+            if(!component.empty())
+            {
+                name += "/" + component;
+            }
+
+            int64 stored_bytes = 0;
+            if(f_col.has_child("sizes"))
+            {
+                const int64_accessor sizes = f_col["sizes"].as_int64_accessor();
+                for(index_t g = 0; g < sizes.number_of_elements(); g++)
+                {
+                    stored_bytes += sizes[g];
+                }
+            }
+
+            Node &col = cols.append();
+            col["name"] = name;
+            col["dtype"] = f_col["data_type"];
+            col["stored_bytes"] = stored_bytes;
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,110 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_table.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_RELAY_IO_TABLE_HPP
+#define CONDUIT_RELAY_IO_TABLE_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_node.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+// Columnar binary files for blueprint tables ("conduit_table" protocol).
+//
+// The rows of each table are split into row groups. Each column of a row
+// group is stored as a separate chunk, encoded as raw data, run lengths, or
+// (for integer columns) zig-zag varint deltas. A json footer at the end of
+// the file describes the tables, columns, and chunks, so readers only touch
+// the chunks of the columns and row groups they need.
+//
+// File layout:
+//   [magic] [chunks ...] [footer (json)] [footer bytes (uint64 LE)]
+//   [magic]
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/**
+@brief Writes a blueprint table (or a collection of tables) to a columnar
+    table file. Column chunks are encoded in parallel.
+
+Options:
+    row_group_rows: Number of rows in each row group (default: 65536).
+    compression: "auto" picks the smallest encoding for each chunk,
+        "none" stores raw data (default: "auto").
+*/
+CONDUIT_RELAY_API void write_table(const Node &table,
+                                   const std::string &path,
+                                   const Node &options);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Reads a columnar table file written by write_table.
+
+Options:
+    columns: A column name or a list of column names to read. Names are
+        the column's path in "values" (an mcarray name selects all of its
+        components, for list values the column index is the name).
+        Default: all columns.
+    rows/offset: First row to read (default: 0).
+    rows/count: Number of rows to read (default: all remaining rows).
+*/
+CONDUIT_RELAY_API void read_table(const std::string &path,
+                                  const Node &options,
+                                  Node &table);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Describes the tables of a columnar table file (names, number of
+    rows and row groups, and the dtype and stored bytes of each column)
+    without reading any column data.
+*/
+CONDUIT_RELAY_API void read_table_info(const std::string &path,
+                                       Node &info);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -227,19 +227,8 @@ save(const Node &node,
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        Node prev_options;
-        if(options.has_child("hdf5"))
-        {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
-        }
-
-        hdf5_save(node,path);
-        
-        if(!prev_options.dtype().is_empty())
-        {
-            hdf5_set_options(prev_options);
-        }
+        // hdf5 applies options["hdf5"] for this write only
+        hdf5_save(node,path,options);
 #else
         CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
                       "Failed to save conduit node to path " << path);
@@ -12,6 +12,11 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -204,7 +209,7 @@ public:
         // handler used when a websocket receives a text payload
         //---------------------------------------------------------------------------//
         bool
-        handleWebSocketText(struct mg_connection *,  // conn -- unused
+        handleWebSocketText(struct mg_connection *conn,
                             char *data,
                             size_t data_len)
         {
@@ -219,6 +224,13 @@ public:
                 //
                 Node n;
                 n.generate(json_schema,"json");
+
+                // publish / subscribe requests
+                if(handleSubscription(conn,n))
+                {
+                    return true;
+                }
+
                 CONDUIT_INFO("WebSocket received message:" << n.to_json());
                 // TODO: Call recv handler callback.
             }
@@ -233,6 +245,53 @@ public:
         }
         
 
+        //---------------------------------------------------------------------------//
+        // handles {"type": "subscribe" | "unsubscribe", "topic": "name"}
+        // messages, returns false for other messages
+        //---------------------------------------------------------------------------//
+        bool
+        handleSubscription(const struct mg_connection *conn,
+                           const Node &msg)
+        {
+            if(!msg.dtype().is_object() ||
+               !msg.has_child("type") ||
+               !msg.has_child("topic") ||
+               !msg["type"].dtype().is_string() ||
+               !msg["topic"].dtype().is_string())
+            {
+                return false;
+            }
+
+            std::string type  = msg["type"].as_string();
+            std::string topic = msg["topic"].as_string();
+
+            if(type != "subscribe" && type != "unsubscribe")
+            {
+                return false;
+            }
+
+            WebSocket *ws = NULL;
+            m_server->lock_context();
+            {
+                ws = find_socket_for_connection(conn);
+            }
+            m_server->unlock_context();
+
+            if(ws != NULL)
+            {
+                if(type == "subscribe")
+                {
+                    ws->subscribe(topic);
+                }
+                else
+                {
+                    ws->unsubscribe(topic);
+                }
+            }
+
+            return true;
+        }
+
         //---------------------------------------------------------------------------//
         // handler used when a websocket receives data
         //---------------------------------------------------------------------------//
@@ -310,139 +369,991 @@ public:
                     const struct mg_connection *conn)
         {
             WebSocket *ws = NULL;
-            // lock context while we cleanup the websocket
+            // lock context while we find the websocket
             m_server->lock_context();
             {
                 ws = find_socket_for_connection(conn);
-                // TODO, actually clean up websocket
-                if(ws != NULL)
-                {
-                    ws->set_connection(NULL);
-                }
             }
             // unlock context
             m_server->unlock_context();
+
+            // this waits for any send in progress, so it is done without
+            // the context lock (which publishers take)
+            // TODO, actually clean up websocket
+            if(ws != NULL)
+            {
+                ws->set_connection(NULL);
+            }
             
             if(ws == NULL)
             {
                 CONDUIT_ERROR("Bad WebSocket state");
             }
 
-            CONDUIT_INFO("conduit::relay::web::WebServer WebSocket Disconnected");
+            CONDUIT_INFO("conduit::relay::web::WebServer WebSocket Disconnected");
+        }
+        
+        //---------------------------------------------------------------------------//
+        // loops over active websockets and returns the instance
+        // that is linked to the given connection
+        //---------------------------------------------------------------------------//
+        WebSocket *
+        find_socket_for_connection(const struct mg_connection *conn)
+            
+        {
+            WebSocket *res = NULL;
+            if(conn != NULL)
+            {
+                // loop over websockets and return the one associated with 
+                // the passed civet connection 
+                for(size_t i=0; i< m_sockets.size();i++)
+                {
+                    if(m_sockets[i] != NULL && 
+                       m_sockets[i]->has_connection(conn))
+                    {
+                        res = m_sockets[i];
+                    }
+                }
+            }
+            return res;
+        }
+
+        //---------------------------------------------------------------------------//
+        // returns all active websockets (websocket instances are never
+        // deleted before the handler, so the pointers stay valid)
+        //---------------------------------------------------------------------------//
+        void
+        connected_websockets(std::vector<WebSocket*> &res)
+        {
+            res.clear();
+            m_server->lock_context();
+            {
+                for(size_t i=0; i < m_sockets.size(); i++)
+                {
+                    if(m_sockets[i]->is_connected())
+                    {
+                        res.push_back(m_sockets[i]);
+                    }
+                }
+            }
+            m_server->unlock_context();
+        }
+
+        //---------------------------------------------------------------------------//
+        // returns the first active websocket. 
+        // waits for a new websocket connection if none are active.
+        //---------------------------------------------------------------------------//
+        WebSocket *
+        websocket(index_t ms_poll,
+                  index_t ms_timeout)
+        {
+            WebSocket *res = NULL;
+            
+            // check if an active websocket exists
+            m_server->lock_context();
+            {
+                for(size_t i=0; i < m_sockets.size() && res == NULL; i++)
+                {
+                    if(m_sockets[i]->is_connected())
+                    {
+                        res = m_sockets[i];
+                    }
+                }
+            }
+            m_server->unlock_context();
+            
+            // if we don't have a websocket connected, wait for one
+            if(res == NULL)
+            {
+                res = accept_websocket(ms_poll,ms_timeout);
+            }
+            
+            return res;
+        }
+
+        //---------------------------------------------------------------------------//
+        // waits for a new websocket connection
+        //---------------------------------------------------------------------------//
+        WebSocket *
+        accept_websocket(index_t ms_poll,
+                         index_t ms_timeout)
+        {
+            WebSocket *res = NULL;
+
+            index_t ms_total = 0;
+            size_t  start_num_sockets = 0;
+            size_t  curr_num_sockets  = 0;
+
+            // check for bad or un-inited context
+            if(m_server->context() == NULL)
+            {
+                return NULL;
+            }
+
+            // we will need to lock the context while we check for new websocket
+            m_server->lock_context();
+            {
+                start_num_sockets = m_sockets.size();
+            }
+            m_server->unlock_context();
+
+            curr_num_sockets = start_num_sockets;
+
+            while(curr_num_sockets == start_num_sockets && 
+                  ms_total <= ms_timeout)
+            {
+                utils::sleep(ms_poll);
+                ms_total += ms_poll;
+
+                m_server->lock_context();
+                {
+                    curr_num_sockets = m_sockets.size();
+                    if(curr_num_sockets != start_num_sockets)
+                    {
+                        // we will return the last socket added
+                        res = m_sockets[curr_num_sockets-1];
+                    }
+                }
+                m_server->unlock_context();
+            }
+
+            return res;
+        }
+
+
+  private:
+      WebServer                  *m_server;
+      WebRequestHandler          *m_handler;
+      std::vector<WebSocket*>     m_sockets;
+};
+
+//-----------------------------------------------------------------------------
+// Publishes messages to subscribed websockets from a sender thread.
+//
+// Each published message is encoded once and shared by its subscribers.
+// A websocket has at most one pending message per topic: publishing a new
+// message for a topic replaces an unsent one, so publishers never wait on
+// slow clients and slow clients receive the latest data.
+//
+// Note: there is a single sender thread, a slow client delays the sends
+// to other clients. The publisher only checks websocket state, which is
+// not locked during sends, so it does not wait on slow clients.
+//-----------------------------------------------------------------------------
+class WebSocketPublisher
+{
+public:
+        //---------------------------------------------------------------------------//
+        WebSocketPublisher(CivetDispatchHandler &dispatch)
+        : m_dispatch(&dispatch),
+          m_mutex(),
+          m_cond(),
+          m_pending(),
+          m_sending(false),
+          m_stop(false),
+          m_msg_id(0),
+          m_num_coalesced(0),
+          m_thread()
+        {
+            // empty
+        }
+
+        //---------------------------------------------------------------------------//
+        ~WebSocketPublisher()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_cond.notify_all();
+
+            if(m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        //---------------------------------------------------------------------------//
+        void
+        publish(const std::string &topic,
+                const Node &data)
+        {
+            std::vector<WebSocket*> sockets;
+            m_dispatch->connected_websockets(sockets);
+
+            std::vector<WebSocket*> subscribers;
+            for(size_t i=0; i < sockets.size(); i++)
+            {
+                if(topic.empty() || sockets[i]->is_subscribed(topic))
+                {
+                    subscribers.push_back(sockets[i]);
+                }
+            }
+
+            // no need to encode if nobody is listening
+            if(subscribers.empty())
+            {
+                return;
+            }
+
+            std::shared_ptr<Message> msg(new Message());
+            BinaryMessageEncoder::encode_topic(topic, data, msg->data);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            msg->id = m_msg_id++;
+
+            for(size_t i=0; i < subscribers.size(); i++)
+            {
+                std::shared_ptr<const Message> &slot =
+                                            m_pending[subscribers[i]][topic];
+                if(slot)
+                {
+                    m_num_coalesced++;
+                }
+                slot = msg;
+            }
+
+            // the sender thread is started by the first publish
+            if(!m_thread.joinable())
+            {
+                m_thread = std::thread(&WebSocketPublisher::send_loop, this);
+            }
+
+            m_cond.notify_one();
+        }
+
+        //---------------------------------------------------------------------------//
+        // waits until nothing is pending or being sent
+        //---------------------------------------------------------------------------//
+        bool
+        wait_for_sends(index_t ms_poll,
+                       index_t ms_timeout)
+        {
+            index_t ms_total = 0;
+            while(true)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if(m_pending.empty() && !m_sending)
+                    {
+                        return true;
+                    }
+                }
+
+                if(ms_total > ms_timeout)
+                {
+                    return false;
+                }
+
+                utils::sleep(ms_poll);
+                ms_total += ms_poll;
+            }
+        }
+
+        //---------------------------------------------------------------------------//
+        index_t
+        number_of_coalesced() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_num_coalesced;
+        }
+
+private:
+        struct Message
+        {
+            uint32      id;
+            std::string data;
+        };
+
+        typedef std::map<std::string,
+                         std::shared_ptr<const Message> > TopicMessages;
+
+        //---------------------------------------------------------------------------//
+        // sender thread
+        //---------------------------------------------------------------------------//
+        void
+        send_loop()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(true)
+            {
+                while(!m_stop && m_pending.empty())
+                {
+                    m_cond.wait(lock);
+                }
+
+                if(m_stop)
+                {
+                    return;
+                }
+
+                std::map<WebSocket*, TopicMessages> sending;
+                sending.swap(m_pending);
+                m_sending = true;
+                lock.unlock();
+
+                std::map<WebSocket*, TopicMessages>::iterator ws_itr;
+                for(ws_itr = sending.begin(); ws_itr != sending.end(); ++ws_itr)
+                {
+                    TopicMessages::iterator msg_itr;
+                    for(msg_itr = ws_itr->second.begin();
+                        msg_itr != ws_itr->second.end();
+                        ++msg_itr)
+                    {
+                        const Message &msg = *msg_itr->second;
+                        try
+                        {
+                            ws_itr->first->send_binary_message(
+                                msg.data,
+                                msg.id,
+                                BinaryMessageEncoder::DEFAULT_MAX_FRAME_BYTES);
+                        }
+                        catch(conduit::Error &e)
+                        {
+                            CONDUIT_INFO("Error sending published message\n"
+                                         << e.message());
+                        }
+                    }
+                }
+                // release our references to the messages
+                sending.clear();
+
+                lock.lock();
+                m_sending = false;
+            }
+        }
+
+        CivetDispatchHandler                 *m_dispatch;
+        mutable std::mutex                    m_mutex;
+        std::condition_variable               m_cond;
+        std::map<WebSocket*, TopicMessages>   m_pending;
+        bool                                  m_sending;
+        bool                                  m_stop;
+        uint32                                m_msg_id;
+        index_t                               m_num_coalesced;
+        std::thread                           m_thread;
+};
+
+//-----------------------------------------------------------------------------
+// Binary Message Helpers
+//-----------------------------------------------------------------------------
+
+// "CDNB"
+static const uint32 BINARY_FRAME_MAGIC   = 0x424E4443;
+static const uint32 BINARY_MSG_FLAG_DELTA = 1;
+
+//-----------------------------------------------------------------------------
+static void
+write_uint32_le(uint32 val,
+                uint8 *dest)
+{
+    dest[0] = (uint8)(val & 0xFF);
+    dest[1] = (uint8)((val >> 8) & 0xFF);
+    dest[2] = (uint8)((val >> 16) & 0xFF);
+    dest[3] = (uint8)((val >> 24) & 0xFF);
+}
+
+//-----------------------------------------------------------------------------
+static uint32
+read_uint32_le(const uint8 *src)
+{
+    return  (uint32)src[0]        |
+           ((uint32)src[1] << 8)  |
+           ((uint32)src[2] << 16) |
+           ((uint32)src[3] << 24);
+}
+
+//-----------------------------------------------------------------------------
+// Collects the units used for delta messages: leaves, and lists (which
+// are sent whole). An empty path is used when the root itself is a unit.
+//-----------------------------------------------------------------------------
+static void
+binary_message_units(const Node &node,
+                     const std::string &path,
+                     std::vector<std::string> &paths,
+                     std::vector<const Node*> &nodes)
+{
+    if(node.dtype().is_object())
+    {
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            std::string child_path = path.empty()
+                                     ? itr.name()
+                                     : path + "/" + itr.name();
+            binary_message_units(child, child_path, paths, nodes);
+        }
+    }
+    else if(!node.dtype().is_empty())
+    {
+        paths.push_back(path);
+        nodes.push_back(&node);
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+encode_binary_message(const Node &data,
+                      bool delta,
+                      const std::vector<std::string> &removed,
+                      const std::string &topic,
+                      std::string &msg)
+{
+    LayoutPlan plan(data.schema());
+
+    // leaf data is sent little endian. The plan copies leaves as is, so
+    // it is only used directly when no byte swapping is needed
+    bool swap = !Endianness::machine_is_little_endian();
+    if(!swap)
+    {
+        std::vector<const Node*> stack(1, &data);
+        while(!stack.empty() && !swap)
+        {
+            const Node *curr = stack.back();
+            stack.pop_back();
+            if(curr->number_of_children() > 0)
+            {
+                for(index_t i = 0; i < curr->number_of_children(); i++)
+                {
+                    stack.push_back(&curr->child(i));
+                }
+            }
+            else if(curr->dtype().endianness() == Endianness::BIG_ID)
+            {
+                swap = true;
+            }
+        }
+    }
+
+    Node swapped;
+    const Schema *schema = &plan.compact_schema();
+    if(swap)
+    {
+        data.compact_to(swapped, Endianness::LITTLE_ID);
+        schema = &swapped.schema();
+    }
+
+    std::ostringstream oss;
+    oss << "{\"schema\": ";
+    schema->to_json_stream(oss, 0, 0, "", "");
+    oss << ", \"removed\": [";
+    for(size_t i = 0; i < removed.size(); i++)
+    {
+        if(i > 0)
+        {
+            oss << ", ";
+        }
+        oss << "\"" << utils::escape_special_chars(removed[i]) << "\"";
+    }
+    oss << "]";
+    if(!topic.empty())
+    {
+        oss << ", \"topic\": \"" << utils::escape_special_chars(topic) << "\"";
+    }
+    oss << "}";
+
+    std::string header = oss.str();
+    // pad so leaf data starts 8 byte aligned
+    if(header.size() % 8 != 0)
+    {
+        header.append(8 - header.size() % 8, ' ');
+    }
+
+    index_t data_bytes = plan.total_bytes_compact();
+
+    msg.resize(8 + header.size() + (size_t)data_bytes);
+    uint8 *msg_ptr = (uint8*)&msg[0];
+
+    write_uint32_le((uint32)header.size(), msg_ptr);
+    write_uint32_le(delta ? BINARY_MSG_FLAG_DELTA : 0, msg_ptr + 4);
+    memcpy(msg_ptr + 8, header.c_str(), header.size());
+
+    uint8 *data_ptr = msg_ptr + 8 + header.size();
+
+    if(data_bytes > 0)
+    {
+        if(swap)
+        {
+            memcpy(data_ptr, swapped.data_ptr(), (size_t)data_bytes);
+        }
+        else
+        {
+            plan.compact(data, data_ptr);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// BinaryMessageEncoder Class Implementation
+//-----------------------------------------------------------------------------
+
+const index_t BinaryMessageEncoder::FRAME_HEADER_BYTES;
+const index_t BinaryMessageEncoder::DEFAULT_MAX_FRAME_BYTES;
+
+//-----------------------------------------------------------------------------
+BinaryMessageEncoder::BinaryMessageEncoder()
+: m_hashes(),
+  m_has_state(false),
+  m_msg_id(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+BinaryMessageEncoder::~BinaryMessageEncoder()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryMessageEncoder::reset()
+{
+    m_hashes.reset();
+    m_has_state = false;
+}
+
+//-----------------------------------------------------------------------------
+uint32
+BinaryMessageEncoder::next_message_id()
+{
+    return m_msg_id++;
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryMessageEncoder::encode(const Node &data,
+                             std::string &msg)
+{
+    // record the state for following delta messages
+    update_state(data, NULL, NULL);
+
+    std::vector<std::string> removed;
+    encode_binary_message(data, false, removed, "", msg);
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryMessageEncoder::encode_topic(const std::string &topic,
+                                   const Node &data,
+                                   std::string &msg)
+{
+    std::vector<std::string> removed;
+    encode_binary_message(data, false, removed, topic, msg);
+}
+
+//-----------------------------------------------------------------------------
+bool
+BinaryMessageEncoder::encode_delta(const Node &data,
+                                   std::string &msg)
+{
+    msg.clear();
+
+    Node changed;
+    std::vector<std::string> removed;
+    update_state(data, &changed, &removed);
+
+    if(changed.dtype().is_empty() && removed.empty())
+    {
+        return false;
+    }
+
+    encode_binary_message(changed, true, removed, "", msg);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryMessageEncoder::update_state(const Node &data,
+                                   Node *changed,
+                                   std::vector<std::string> *removed)
+{
+    std::vector<std::string> paths;
+    std::vector<const Node*> units;
+    binary_message_units(data, "", paths, units);
+
+    Node hashes;
+    uint64 root_hash = data.content_hash(hashes);
+
+    // flat object keyed by the literal unit paths, the root uses "/"
+    // (when the root itself is a leaf or a list)
+    Node unit_hashes;
+
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        const std::string &path = paths[i];
+        const std::string key = path.empty() ? std::string("/") : path;
+        uint64 hash = path.empty() ? root_hash
+                                   : hashes.child(path).to_uint64();
+        unit_hashes.add_child(key).set(hash);
+
+        if(changed == NULL ||
+           (m_has_state &&
+            m_hashes.has_child(key) &&
+            m_hashes.child(key).to_uint64() == hash))
+        {
+            continue;
+        }
+
+        if(path.empty())
+        {
+            changed->set_external(*units[i]);
+        }
+        else
+        {
+            (*changed)[path].set_external(*units[i]);
+        }
+    }
+
+    if(removed != NULL && m_has_state)
+    {
+        NodeConstIterator itr = m_hashes.children();
+        while(itr.has_next())
+        {
+            itr.next();
+            std::string key = itr.name();
+            if(!unit_hashes.has_child(key))
+            {
+                removed->push_back(key == "/" ? std::string() : key);
+            }
+        }
+    }
+
+    m_hashes.swap(unit_hashes);
+    m_has_state = true;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+BinaryMessageEncoder::number_of_frames(index_t msg_bytes,
+                                       index_t max_frame_bytes)
+{
+    index_t payload_bytes = max_frame_bytes - FRAME_HEADER_BYTES;
+    if(payload_bytes <= 0)
+    {
+        CONDUIT_ERROR("max_frame_bytes (" << max_frame_bytes << ")"
+                      " must be larger than the frame header ("
+                      << FRAME_HEADER_BYTES << " bytes)");
+    }
+
+    index_t res = (msg_bytes + payload_bytes - 1) / payload_bytes;
+    return res > 0 ? res : 1;
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryMessageEncoder::frame(const std::string &msg,
+                            uint32 msg_id,
+                            index_t frame_idx,
+                            index_t max_frame_bytes,
+                            std::string &frame)
+{
+    index_t msg_bytes  = (index_t)msg.size();
+    index_t num_frames = number_of_frames(msg_bytes, max_frame_bytes);
+
+    if(frame_idx < 0 || frame_idx >= num_frames)
+    {
+        CONDUIT_ERROR("invalid frame index " << frame_idx
+                      << " (number of frames: " << num_frames << ")");
+    }
+
+    index_t payload_bytes = max_frame_bytes - FRAME_HEADER_BYTES;
+    index_t begin = frame_idx * payload_bytes;
+    index_t end   = begin + payload_bytes;
+    end = end < msg_bytes ? end : msg_bytes;
+
+    frame.resize((size_t)(FRAME_HEADER_BYTES + end - begin));
+    uint8 *frame_ptr = (uint8*)&frame[0];
+
+    write_uint32_le(BINARY_FRAME_MAGIC, frame_ptr);
+    write_uint32_le(msg_id, frame_ptr + 4);
+    write_uint32_le((uint32)frame_idx, frame_ptr + 8);
+    write_uint32_le((uint32)num_frames, frame_ptr + 12);
+
+    if(end > begin)
+    {
+        memcpy(frame_ptr + FRAME_HEADER_BYTES,
+               msg.data() + begin,
+               (size_t)(end - begin));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// BinaryMessageDecoder Class Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+BinaryMessageDecoder::BinaryMessageDecoder()
+: m_msg(),
+  m_msg_id(0),
+  m_num_frames(0),
+  m_next_frame(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+BinaryMessageDecoder::~BinaryMessageDecoder()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+bool
+BinaryMessageDecoder::add_frame(const void *frame,
+                                index_t frame_bytes)
+{
+    const uint8 *frame_ptr = (const uint8*)frame;
+
+    if(frame_bytes < BinaryMessageEncoder::FRAME_HEADER_BYTES ||
+       read_uint32_le(frame_ptr) != BINARY_FRAME_MAGIC)
+    {
+        CONDUIT_ERROR("invalid binary websocket frame");
+    }
+
+    uint32  msg_id     = read_uint32_le(frame_ptr + 4);
+    index_t frame_idx  = (index_t)read_uint32_le(frame_ptr + 8);
+    index_t num_frames = (index_t)read_uint32_le(frame_ptr + 12);
+
+    if(frame_idx == 0)
+    {
+        m_msg.clear();
+        m_msg_id     = msg_id;
+        m_num_frames = num_frames;
+        m_next_frame = 0;
+    }
+    else if(msg_id != m_msg_id || frame_idx != m_next_frame)
+    {
+        CONDUIT_ERROR("unexpected binary websocket frame"
+                      << " (message id: " << msg_id
+                      << " frame: " << frame_idx << "), expected"
+                      << " (message id: " << m_msg_id
+                      << " frame: " << m_next_frame << ")");
+    }
+
+    m_msg.append((const char*)frame_ptr +
+                    BinaryMessageEncoder::FRAME_HEADER_BYTES,
+                 (size_t)(frame_bytes -
+                          BinaryMessageEncoder::FRAME_HEADER_BYTES));
+    m_next_frame++;
+
+    return m_next_frame == m_num_frames;
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryMessageDecoder::apply(Node &data) const
+{
+    if(m_num_frames == 0 || m_next_frame != m_num_frames)
+    {
+        CONDUIT_ERROR("BinaryMessageDecoder::apply: no complete message");
+    }
+
+    apply_message(m_msg.data(), (index_t)m_msg.size(), data);
+}
+
+//-----------------------------------------------------------------------------
+// reads the header of an assembled message
+//-----------------------------------------------------------------------------
+static void
+read_binary_message_header(const void *msg,
+                           index_t msg_bytes,
+                           index_t &header_bytes,
+                           uint32 &flags,
+                           Node &n_header)
+{
+    const uint8 *msg_ptr = (const uint8*)msg;
+
+    if(msg_bytes < 8)
+    {
+        CONDUIT_ERROR("invalid binary websocket message");
+    }
+
+    header_bytes = (index_t)read_uint32_le(msg_ptr);
+    flags        = read_uint32_le(msg_ptr + 4);
+
+    if(8 + header_bytes > msg_bytes)
+    {
+        CONDUIT_ERROR("invalid binary websocket message header");
+    }
+
+    std::string header((const char*)msg_ptr + 8, (size_t)header_bytes);
+    n_header.reset();
+    Generator(header, "json").walk(n_header);
+}
+
+//-----------------------------------------------------------------------------
+std::string
+BinaryMessageDecoder::topic() const
+{
+    if(m_num_frames == 0 || m_next_frame != m_num_frames)
+    {
+        CONDUIT_ERROR("BinaryMessageDecoder::topic: no complete message");
+    }
+
+    return message_topic(m_msg.data(), (index_t)m_msg.size());
+}
+
+//-----------------------------------------------------------------------------
+std::string
+BinaryMessageDecoder::message_topic(const void *msg,
+                                    index_t msg_bytes)
+{
+    index_t header_bytes = 0;
+    uint32  flags        = 0;
+    Node n_header;
+    read_binary_message_header(msg, msg_bytes, header_bytes, flags, n_header);
+
+    std::string res;
+    if(n_header.has_child("topic"))
+    {
+        res = n_header["topic"].as_string();
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// copies the units of a delta message into data
+//-----------------------------------------------------------------------------
+static void
+apply_binary_message_units(const Node &src,
+                           Node &dest)
+{
+    if(src.dtype().is_object())
+    {
+        if(!dest.dtype().is_object())
+        {
+            dest.reset();
         }
-        
-        //---------------------------------------------------------------------------//
-        // loops over active websockets and returns the instance
-        // that is linked to the given connection
-        //---------------------------------------------------------------------------//
-        WebSocket *
-        find_socket_for_connection(const struct mg_connection *conn)
-            
+
+        NodeConstIterator itr = src.children();
+        while(itr.has_next())
         {
-            WebSocket *res = NULL;
-            if(conn != NULL)
-            {
-                // loop over websockets and return the one associated with 
-                // the passed civet connection 
-                for(size_t i=0; i< m_sockets.size();i++)
-                {
-                    if(m_sockets[i] != NULL && 
-                       m_sockets[i]->m_connection == conn)
-                    {
-                        res = m_sockets[i];
-                    }
-                }
-            }
-            return res;
+            const Node &child = itr.next();
+            apply_binary_message_units(child, dest.add_child(itr.name()));
         }
+    }
+    else
+    {
+        dest.set(src);
+    }
+}
 
-        //---------------------------------------------------------------------------//
-        // returns the first active websocket. 
-        // waits for a new websocket connection if none are active.
-        //---------------------------------------------------------------------------//
-        WebSocket *
-        websocket(index_t ms_poll,
-                  index_t ms_timeout)
+//-----------------------------------------------------------------------------
+// checks that every element described by a (received) schema lies inside
+// the first data_bytes bytes of the data. The schema comes off the wire,
+// so offsets and strides can't be trusted (and can overflow).
+//-----------------------------------------------------------------------------
+static bool
+binary_message_schema_in_bounds(const Schema &schema,
+                                index_t data_bytes)
+{
+    const DataType &dtype = schema.dtype();
+    if(dtype.is_object() || dtype.is_list())
+    {
+        for(index_t i = 0; i < schema.number_of_children(); i++)
         {
-            WebSocket *res = NULL;
-            
-            // check if an active websocket exists
-            m_server->lock_context();
-            {
-                for(size_t i=0; i < m_sockets.size() && res == NULL; i++)
-                {
-                    if(m_sockets[i]->is_connected())
-                    {
-                        res = m_sockets[i];
-                    }
-                }
-            }
-            m_server->unlock_context();
-            
-            // if we don't have a websocket connected, wait for one
-            if(res == NULL)
+            if(!binary_message_schema_in_bounds(schema.child(i), data_bytes))
             {
-                res = accept_websocket(ms_poll,ms_timeout);
+                return false;
             }
-            
-            return res;
         }
+        return true;
+    }
 
-        //---------------------------------------------------------------------------//
-        // waits for a new websocket connection
-        //---------------------------------------------------------------------------//
-        WebSocket *
-        accept_websocket(index_t ms_poll,
-                         index_t ms_timeout)
-        {
-            WebSocket *res = NULL;
+    if(dtype.is_empty())
+    {
+        return true;
+    }
 
-            index_t ms_total = 0;
-            size_t  start_num_sockets = 0;
-            size_t  curr_num_sockets  = 0;
+    index_t num_eles = dtype.number_of_elements();
+    if(num_eles < 0)
+    {
+        return false;
+    }
+    else if(num_eles == 0)
+    {
+        return true;
+    }
 
-            // check for bad or un-inited context
-            if(m_server->context() == NULL)
-            {
-                return NULL;
-            }
+    index_t offset    = dtype.offset();
+    index_t stride    = dtype.stride();
+    index_t ele_bytes = dtype.element_bytes();
 
-            // we will need to lock the context while we check for new websocket
-            m_server->lock_context();
-            {
-                start_num_sockets = m_sockets.size();
-            }
-            m_server->unlock_context();
+    if(offset < 0 || stride < 0 || ele_bytes <= 0 ||
+       offset > data_bytes || ele_bytes > data_bytes - offset)
+    {
+        return false;
+    }
 
-            curr_num_sockets = start_num_sockets;
+    // the last element must also end inside the data
+    // (same as spanned_bytes() <= data_bytes, without overflow)
+    if(num_eles > 1 && stride > 0 &&
+       (num_eles - 1) > (data_bytes - offset - ele_bytes) / stride)
+    {
+        return false;
+    }
 
-            while(curr_num_sockets == start_num_sockets && 
-                  ms_total <= ms_timeout)
-            {
-                utils::sleep(ms_poll);
-                ms_total += ms_poll;
+    return true;
+}
 
-                m_server->lock_context();
-                {
-                    curr_num_sockets = m_sockets.size();
-                    if(curr_num_sockets != start_num_sockets)
-                    {
-                        // we will return the last socket added
-                        res = m_sockets[curr_num_sockets-1];
-                    }
-                }
-                m_server->unlock_context();
-            }
+//-----------------------------------------------------------------------------
+void
+BinaryMessageDecoder::apply_message(const void *msg,
+                                    index_t msg_bytes,
+                                    Node &data)
+{
+    const uint8 *msg_ptr = (const uint8*)msg;
 
-            return res;
-        }
+    index_t header_bytes = 0;
+    uint32  flags        = 0;
+    Node n_header;
+    read_binary_message_header(msg, msg_bytes, header_bytes, flags, n_header);
 
+    Schema schema(n_header["schema"].to_json());
 
-  private:
-      WebServer                  *m_server;
-      WebRequestHandler          *m_handler;
-      std::vector<WebSocket*>     m_sockets;
-};
+    if(!binary_message_schema_in_bounds(schema, msg_bytes - 8 - header_bytes))
+    {
+        CONDUIT_ERROR("binary websocket message is truncated or its schema"
+                      " describes data outside of the message");
+    }
+
+    Node incoming;
+    incoming.set_external(schema,
+                          const_cast<uint8*>(msg_ptr + 8 + header_bytes));
+
+    if((flags & BINARY_MSG_FLAG_DELTA) == 0)
+    {
+        data.set(incoming);
+        return;
+    }
+
+    if(n_header.has_child("removed"))
+    {
+        NodeConstIterator itr = n_header["removed"].children();
+        while(itr.has_next())
+        {
+            std::string path = itr.next().as_string();
+            if(path.empty())
+            {
+                data.reset();
+            }
+            else if(data.has_path(path))
+            {
+                data.remove(path);
+            }
+        }
+    }
+
+    if(incoming.dtype().is_object())
+    {
+        apply_binary_message_units(incoming, data);
+    }
+    else if(!incoming.dtype().is_empty())
+    {
+        data.set(incoming);
+    }
+}
 
 //-----------------------------------------------------------------------------
 // WebSocket Class Implementation
@@ -450,7 +1361,11 @@ public:
 
 //-----------------------------------------------------------------------------
 WebSocket::WebSocket()
-: m_connection(NULL)
+: m_connection(NULL),
+  m_encoder(),
+  m_state_mutex(),
+  m_send_mutex(),
+  m_topics()
 {
     // empty
 }
@@ -467,16 +1382,52 @@ WebSocket::~WebSocket()
 void
 WebSocket::set_connection(mg_connection *connection)
 {
+    // waits for any send in progress
+    std::lock_guard<std::mutex> send_lock(m_send_mutex);
+    std::lock_guard<std::mutex> state_lock(m_state_mutex);
     m_connection = connection;
 }
 
+//-----------------------------------------------------------------------------
+bool
+WebSocket::has_connection(const mg_connection *connection) const
+{
+    std::lock_guard<std::mutex> lock(m_state_mutex);
+    return m_connection == connection;
+}
+
 //-----------------------------------------------------------------------------
 bool
 WebSocket::is_connected() const
 {
+    std::lock_guard<std::mutex> lock(m_state_mutex);
     return m_connection != NULL;
 }
 
+//-----------------------------------------------------------------------------
+void
+WebSocket::subscribe(const std::string &topic)
+{
+    std::lock_guard<std::mutex> lock(m_state_mutex);
+    m_topics.insert(topic);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::unsubscribe(const std::string &topic)
+{
+    std::lock_guard<std::mutex> lock(m_state_mutex);
+    m_topics.erase(topic);
+}
+
+//-----------------------------------------------------------------------------
+bool
+WebSocket::is_subscribed(const std::string &topic) const
+{
+    std::lock_guard<std::mutex> lock(m_state_mutex);
+    return m_topics.find(topic) != m_topics.end();
+}
+
 //-----------------------------------------------------------------------------
 mg_context *
 WebSocket::context()
@@ -517,7 +1468,7 @@ void
 WebSocket::send(const Node &data,
                 const std::string &protocol)
 {
-    if(m_connection == NULL)
+    if(!is_connected())
     {
         CONDUIT_WARN("attempt to write to bad websocket connection");
         return;
@@ -527,18 +1478,94 @@ WebSocket::send(const Node &data,
     std::ostringstream oss;
     data.to_json_stream(oss,protocol);
     
-    // get the length of our  message data.
-    size_t        msg_len = oss.str().size();
+    std::string msg = oss.str();
 
-    lock_context();
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+    if(m_connection != NULL)
     {
         // send our message via civetweb's websocket interface
+        // (which locks this connection)
         mg_websocket_write(m_connection,
                            WEBSOCKET_OPCODE_TEXT,
-                           oss.str().c_str(),
-                           msg_len);
+                           msg.c_str(),
+                           msg.size());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_binary(const Node &data,
+                       index_t max_frame_bytes)
+{
+    if(!is_connected())
+    {
+        CONDUIT_WARN("attempt to write to bad websocket connection");
+        return;
+    }
+
+    std::string msg;
+    m_encoder.encode(data, msg);
+    send_binary_message(msg, m_encoder.next_message_id(), max_frame_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_delta(const Node &data,
+                      index_t max_frame_bytes)
+{
+    if(!is_connected())
+    {
+        CONDUIT_WARN("attempt to write to bad websocket connection");
+        return;
+    }
+
+    std::string msg;
+    if(m_encoder.encode_delta(data, msg))
+    {
+        send_binary_message(msg,
+                            m_encoder.next_message_id(),
+                            max_frame_bytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_binary_message(const std::string &msg,
+                               uint32 msg_id,
+                               index_t max_frame_bytes)
+{
+    index_t num_frames = BinaryMessageEncoder::number_of_frames(
+                                                    (index_t)msg.size(),
+                                                    max_frame_bytes);
+    std::string frame;
+
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+    if(m_connection == NULL)
+    {
+        return;
+    }
+
+    // keep the frames of a message together
+    // (civetweb's connection locks are recursive)
+    mg_lock_connection(m_connection);
+    for(index_t i = 0; i < num_frames; i++)
+    {
+        BinaryMessageEncoder::frame(msg,
+                                    msg_id,
+                                    i,
+                                    max_frame_bytes,
+                                    frame);
+
+        if(mg_websocket_write(m_connection,
+                              WEBSOCKET_OPCODE_BINARY,
+                              frame.data(),
+                              frame.size()) <= 0)
+        {
+            // the connection failed, drop the rest of the message
+            break;
+        }
     }
-    unlock_context();
+    mg_unlock_connection(m_connection);
 }
 
 
@@ -560,7 +1587,8 @@ WebServer::WebServer()
   m_using_entangle(false),
   m_running(false),
   m_server(NULL),
-  m_dispatch(NULL)
+  m_dispatch(NULL),
+  m_publisher(NULL)
 {
     // empty
 }
@@ -800,6 +1828,48 @@ WebServer::websocket(index_t ms_poll,
     return m_dispatch->websocket(ms_poll,ms_timeout);
 }
 
+//-----------------------------------------------------------------------------
+void
+WebServer::publish(const std::string &topic,
+                   const Node &data)
+{
+    // without a running server there are no subscribers
+    if(m_publisher != NULL)
+    {
+        m_publisher->publish(topic,data);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+WebServer::broadcast(const Node &data)
+{
+    publish("",data);
+}
+
+//-----------------------------------------------------------------------------
+bool
+WebServer::wait_for_published(index_t ms_poll,
+                              index_t ms_timeout)
+{
+    if(m_publisher == NULL)
+    {
+        return true;
+    }
+    return m_publisher->wait_for_sends(ms_poll,ms_timeout);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebServer::number_of_coalesced_messages() const
+{
+    if(m_publisher == NULL)
+    {
+        return 0;
+    }
+    return m_publisher->number_of_coalesced();
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -863,7 +1933,8 @@ WebServer::serve(bool block)
     }
     
     
-    m_dispatch = new CivetDispatchHandler(*this);
+    m_dispatch  = new CivetDispatchHandler(*this);
+    m_publisher = new WebSocketPublisher(*m_dispatch);
 
     bool use_ssl = m_ssl_cert_file.size() > 0;
     bool use_auth_domain = m_htpasswd_auth_domain.size() > 0;
@@ -1017,13 +2088,16 @@ WebServer::shutdown()
         m_running = false;
         m_using_entangle = false;
 
+        // stop the sender thread before the websockets go away
+        delete m_publisher;
         delete m_server;
         delete m_handler;
         delete m_dispatch;
 
-        m_server   = NULL;
-        m_handler  = NULL;
-        m_dispatch = NULL;
+        m_publisher = NULL;
+        m_server    = NULL;
+        m_handler   = NULL;
+        m_dispatch  = NULL;
     }
 }
 
@@ -18,6 +18,12 @@
 
 #include "conduit_relay_exports.h"
 
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <mutex>
+#include <set>
+
 //
 // forward declare civetweb types so we don't need the 
 // civetweb headers in our public interface. 
@@ -82,6 +88,8 @@ public:
 class WebSocket;
 // forward declare internal handler class
 class CivetDispatchHandler;
+// forward declare internal publish / subscribe class
+class WebSocketPublisher;
 
 class CONDUIT_RELAY_API WebServer
 {
@@ -155,6 +163,30 @@ public:
     WebSocket  *websocket(index_t ms_poll = 100,
                           index_t ms_timeout = 60000);
 
+    /// publishes data to all websockets subscribed to topic
+    /// (see WebSocket::subscribe), an empty topic is sent to all
+    /// connected websockets.
+    ///
+    /// data is encoded once, as a binary message (see BinaryMessageEncoder)
+    /// that includes the topic, and a sender thread sends it to the
+    /// subscribers. publish() does not wait for the sends: if a client has
+    /// not been sent the last message for a topic when a new one is
+    /// published, the unsent message is replaced by the new one.
+    void        publish(const std::string &topic,
+                        const Node &data);
+
+    /// same as publish("", data)
+    void        broadcast(const Node &data);
+
+    /// waits until all published messages have been sent, returns false
+    /// if that did not happen within ms_timeout milliseconds.
+    bool        wait_for_published(index_t ms_poll = 10,
+                                   index_t ms_timeout = 60000);
+
+    /// number of published messages that were replaced by newer messages
+    /// before they were sent
+    index_t     number_of_coalesced_messages() const;
+
     /// returns the request handler used by this server instance
     WebRequestHandler *handler();
     
@@ -183,7 +215,128 @@ private:
 
     CivetServer            *m_server;
     CivetDispatchHandler   *m_dispatch;
+    WebSocketPublisher     *m_publisher;
+
+};
+
+//-----------------------------------------------------------------------------
+/// -- Binary WebSocket Messages -
+//-----------------------------------------------------------------------------
+///
+/// Binary messages hold a json header followed by the compact little endian
+/// leaf data of a tree (all integers are little endian uint32s):
+///
+///   [header bytes (H)] [flags] [H bytes of json header] [leaf data]
+///
+///  flags:  1 for delta messages, 0 for full messages
+///  header: {"schema": <compact schema json>, "removed": [<paths>]}
+///          (published messages also hold "topic": <name>)
+///          (H is padded with spaces to a multiple of 8, so leaf data
+///           starts 8 byte aligned)
+///
+/// Full messages describe a whole tree. Delta messages hold the leaves
+/// that changed since the previous message, and the paths of leaves that
+/// were removed. Lists are treated as a single unit, if anything in a list
+/// changed the whole list is sent.
+///
+/// Messages are sent as one or more binary frames, each frame starts with
+/// a 16 byte frame header:
+///
+///   ["CDNB" magic] [message id] [frame index] [number of frames]
+///
+/// The node_viewer web client includes a javascript decoder
+/// (resources/binary-decoder.js).
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API BinaryMessageEncoder
+{
+public:
+                   BinaryMessageEncoder();
+                  ~BinaryMessageEncoder();
+
+    /// encodes all of data into msg
+    void           encode(const Node &data,
+                          std::string &msg);
+
+    /// encodes all of data into msg, with topic in the message header.
+    /// Does not change the state used by encode_delta().
+    static void    encode_topic(const std::string &topic,
+                                const Node &data,
+                                std::string &msg);
+
+    /// encodes the changes since the last encode() or encode_delta() call.
+    /// returns false (and clears msg) when nothing changed.
+    bool           encode_delta(const Node &data,
+                                std::string &msg);
+
+    /// forgets the state used by encode_delta()
+    void           reset();
+
+    /// returns a new message id (used to label frames)
+    uint32         next_message_id();
+
+    /// number of frames used to send a message of msg_bytes
+    static index_t number_of_frames(index_t msg_bytes,
+                                    index_t max_frame_bytes);
+
+    /// fills frame with frame frame_idx of msg (header and payload)
+    static void    frame(const std::string &msg,
+                         uint32 msg_id,
+                         index_t frame_idx,
+                         index_t max_frame_bytes,
+                         std::string &frame);
+
+    /// bytes used by the frame header
+    static const index_t FRAME_HEADER_BYTES = 16;
+    /// default max frame size
+    static const index_t DEFAULT_MAX_FRAME_BYTES = 1048576;
 
+private:
+    // records the hashes of data, and optionally the units (leaves and
+    // lists) that changed and the paths that were removed
+    void           update_state(const Node &data,
+                                Node *changed,
+                                std::vector<std::string> *removed);
+
+    // hashes of the units of the last encoded tree, keyed by path
+    Node           m_hashes;
+    bool           m_has_state;
+    uint32         m_msg_id;
+};
+
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API BinaryMessageDecoder
+{
+public:
+                   BinaryMessageDecoder();
+                  ~BinaryMessageDecoder();
+
+    /// adds a received frame, returns true when it completes a message
+    bool           add_frame(const void *frame,
+                             index_t frame_bytes);
+
+    /// applies the last completed message to data. Full messages replace
+    /// data, delta messages update the changed and removed paths.
+    void           apply(Node &data) const;
+
+    /// applies an already assembled message to data (see apply())
+    static void    apply_message(const void *msg,
+                                 index_t msg_bytes,
+                                 Node &data);
+
+    /// returns the topic of the last completed message
+    /// (empty for messages that were not published to a topic)
+    std::string    topic() const;
+
+    /// returns the topic of an already assembled message
+    static std::string message_topic(const void *msg,
+                                     index_t msg_bytes);
+
+private:
+    std::string    m_msg;
+    uint32         m_msg_id;
+    index_t        m_num_frames;
+    index_t        m_next_frame;
 };
 
 //-----------------------------------------------------------------------------
@@ -197,10 +350,35 @@ class CONDUIT_RELAY_API WebSocket
 {
 public:
     friend class CivetDispatchHandler;
+    friend class WebSocketPublisher;
     
     void           send(const Node &data,
                         const std::string &protocol="json");
 
+    /// sends data as a binary message (see BinaryMessageEncoder).
+    /// Messages larger than max_frame_bytes are split into several frames.
+    void           send_binary(const Node &data,
+                               index_t max_frame_bytes =
+                                BinaryMessageEncoder::DEFAULT_MAX_FRAME_BYTES);
+
+    /// sends the leaves that changed (and the paths that were removed)
+    /// since the last send_binary() or send_delta() call on this websocket.
+    /// Nothing is sent if nothing changed.
+    ///
+    /// Note: the previous state is per websocket, send_binary() and
+    /// send_delta() should not be called concurrently on one websocket.
+    void           send_delta(const Node &data,
+                              index_t max_frame_bytes =
+                                BinaryMessageEncoder::DEFAULT_MAX_FRAME_BYTES);
+
+    /// subscribes this websocket to messages published to topic
+    /// (see WebServer::publish).
+    /// Clients can also send {"type": "subscribe", "topic": "<name>"}
+    /// and {"type": "unsubscribe", "topic": "<name>"} text messages.
+    void           subscribe(const std::string &topic);
+    void           unsubscribe(const std::string &topic);
+    bool           is_subscribed(const std::string &topic) const;
+
     // todo: receive? 
 
     bool           is_connected() const;
@@ -214,8 +392,21 @@ private:
     virtual       ~WebSocket();
 
     void           set_connection(mg_connection *connection);
-
-    mg_connection  *m_connection;
+    bool           has_connection(const mg_connection *connection) const;
+    void           send_binary_message(const std::string &msg,
+                                       uint32 msg_id,
+                                       index_t max_frame_bytes);
+
+    mg_connection        *m_connection;
+    BinaryMessageEncoder  m_encoder;
+    // guards the connection and the subscribed topics, it is never held
+    // during a send, so state checks don't wait on slow clients
+    mutable std::mutex    m_state_mutex;
+    // held for the whole of a send. Changing the connection takes both
+    // locks (so it is not closed during a send), reading it takes either.
+    // Sends lock this websocket's connection, not the civetweb context.
+    std::mutex            m_send_mutex;
+    std::set<std::string> m_topics;
 };
 
 
@@ -12,6 +12,11 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <stdio.h>
+#include <limits>
+#include <sstream>
+#include <streambuf>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -44,6 +49,297 @@ namespace relay
 namespace web
 {
 
+//-----------------------------------------------------------------------------
+// -- Viewer Request Handler Helpers  -
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Stream buffer that sends what is written to it as an http response with
+// chunked transfer encoding. Data is sent in chunks of (at most)
+// buffer_bytes, so a response is never held in memory as a whole.
+//-----------------------------------------------------------------------------
+class ChunkedResponseBuffer : public std::streambuf
+{
+public:
+    ChunkedResponseBuffer(struct mg_connection *conn,
+                          size_t buffer_bytes = 65536)
+    : m_conn(conn),
+      m_buffer(buffer_bytes),
+      m_ok(true)
+    {
+        // leave room for the char passed to overflow
+        setp(&m_buffer[0], &m_buffer[0] + m_buffer.size() - 1);
+        mg_printf(m_conn,
+                  "HTTP/1.1 200 OK\r\n"
+                  "Content-Type: application/json\r\n"
+                  "Transfer-Encoding: chunked\r\n\r\n");
+    }
+
+    // sends any buffered data and the final (empty) chunk
+    void finish()
+    {
+        send_chunk();
+        if(m_ok)
+        {
+            mg_write(m_conn, "0\r\n\r\n", 5);
+        }
+    }
+
+protected:
+    virtual int_type overflow(int_type ch)
+    {
+        if(!traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        send_chunk();
+        return traits_type::not_eof(ch);
+    }
+
+    virtual int sync()
+    {
+        send_chunk();
+        return 0;
+    }
+
+private:
+    void send_chunk()
+    {
+        size_t num_bytes = (size_t)(pptr() - pbase());
+        // once a write fails (the client went away), the rest of the
+        // response is dropped
+        if(num_bytes > 0 && m_ok)
+        {
+            char chunk_header[32];
+            int header_bytes = snprintf(chunk_header,
+                                        sizeof(chunk_header),
+                                        "%lx\r\n",
+                                        (unsigned long)num_bytes);
+            m_ok = mg_write(m_conn, chunk_header, header_bytes) > 0 &&
+                   mg_write(m_conn, pbase(), num_bytes) > 0 &&
+                   mg_write(m_conn, "\r\n", 2) > 0;
+        }
+        setp(&m_buffer[0], &m_buffer[0] + m_buffer.size() - 1);
+    }
+
+    struct mg_connection *m_conn;
+    std::vector<char>     m_buffer;
+    bool                  m_ok;
+};
+
+//-----------------------------------------------------------------------------
+// Sends a small json error response
+//-----------------------------------------------------------------------------
+static void
+send_json_error(struct mg_connection *conn,
+                int status,
+                const std::string &status_text,
+                const std::string &message)
+{
+    std::string body = "{\"error\": \"" +
+                       utils::escape_special_chars(message) + "\"}";
+    mg_printf(conn,
+              "HTTP/1.1 %d %s\r\n"
+              "Content-Type: application/json\r\n"
+              "Content-Length: %lu\r\n\r\n",
+              status,
+              status_text.c_str(),
+              (unsigned long)body.size());
+    mg_write(conn, body.c_str(), body.size());
+}
+
+//-----------------------------------------------------------------------------
+// Requests only carry a path and a few integers, larger post bodies are
+// rejected instead of being read into memory
+//-----------------------------------------------------------------------------
+static const size_t max_request_body_bytes = 1024 * 1024;
+
+//-----------------------------------------------------------------------------
+// Holds the parameters of a request, from the query string and the post
+// body (up to max_request_body_bytes)
+//-----------------------------------------------------------------------------
+class RequestVars
+{
+public:
+    RequestVars(struct mg_connection *conn)
+    : m_query(),
+      m_body(),
+      m_body_too_large(false)
+    {
+        const struct mg_request_info *req_info = mg_get_request_info(conn);
+        if(req_info->query_string != NULL)
+        {
+            m_query = req_info->query_string;
+        }
+
+        // a declared length is checked before anything is read
+        if(req_info->content_length > (long long)max_request_body_bytes)
+        {
+            m_body_too_large = true;
+            return;
+        }
+
+        char buff[4096];
+        int num_read = mg_read(conn, buff, sizeof(buff));
+        while(num_read > 0)
+        {
+            if(m_body.size() + (size_t)num_read > max_request_body_bytes)
+            {
+                m_body_too_large = true;
+                m_body.clear();
+                return;
+            }
+            m_body.append(buff, (size_t)num_read);
+            num_read = mg_read(conn, buff, sizeof(buff));
+        }
+    }
+
+    bool body_too_large() const
+    {
+        return m_body_too_large;
+    }
+
+    bool get(const std::string &name, std::string &value) const
+    {
+        return get(m_body, name, value) || get(m_query, name, value);
+    }
+
+    index_t get_index_t(const std::string &name, index_t default_value) const
+    {
+        std::string value;
+        if(!get(name, value) || value.empty())
+        {
+            return default_value;
+        }
+        return utils::string_to_value<index_t>(value);
+    }
+
+private:
+    static bool get(const std::string &data,
+                    const std::string &name,
+                    std::string &value)
+    {
+        if(data.empty())
+        {
+            return false;
+        }
+        // a decoded value is never longer than the data it came from
+        std::vector<char> buff(data.size() + 1);
+        int res = mg_get_var(data.c_str(),
+                             data.size(),
+                             name.c_str(),
+                             &buff[0],
+                             buff.size());
+        if(res < 0)
+        {
+            return false;
+        }
+        value = std::string(&buff[0], (size_t)res);
+        return true;
+    }
+
+    std::string m_query;
+    std::string m_body;
+    bool        m_body_too_large;
+};
+
+//-----------------------------------------------------------------------------
+// Rejects a request whose post body is over max_request_body_bytes, the
+// connection is closed since the rest of the body is not read
+//-----------------------------------------------------------------------------
+static void
+send_body_too_large(struct mg_connection *conn)
+{
+    std::ostringstream oss;
+    oss << "{\"error\": \"request body exceeds "
+        << max_request_body_bytes << " bytes\"}";
+    std::string body = oss.str();
+    mg_printf(conn,
+              "HTTP/1.1 413 Payload Too Large\r\n"
+              "Content-Type: application/json\r\n"
+              "Content-Length: %lu\r\n"
+              "Connection: close\r\n\r\n",
+              (unsigned long)body.size());
+    mg_write(conn, body.c_str(), body.size());
+}
+
+//-----------------------------------------------------------------------------
+// One pass min, max, sum and nan count of a numeric leaf
+//-----------------------------------------------------------------------------
+template<typename T>
+static void
+leaf_summary(const DataArray<T> &vals,
+             Node &res)
+{
+    index_t num_eles = vals.number_of_elements();
+    index_t num_vals = 0;
+    index_t num_nans = 0;
+    T       min_val  = T();
+    T       max_val  = T();
+    float64 sum      = 0.0;
+
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        T v = vals[i];
+        // only true for floating point nans
+        if(v != v)
+        {
+            num_nans++;
+            continue;
+        }
+
+        if(num_vals == 0 || v < min_val)
+        {
+            min_val = v;
+        }
+
+        if(num_vals == 0 || v > max_val)
+        {
+            max_val = v;
+        }
+
+        sum += (float64)v;
+        num_vals++;
+    }
+
+    if(num_vals > 0)
+    {
+        res["min"] = min_val;
+        res["max"] = max_val;
+        res["mean"] = sum / (float64) num_vals;
+    }
+    res["sum"] = sum;
+    res["nan_count"] = num_nans;
+}
+
+//-----------------------------------------------------------------------------
+// Finds the node for a request path, returns NULL if the path does not exist
+//-----------------------------------------------------------------------------
+static const Node *
+find_request_node(const Node &root,
+                  const std::string &cpath)
+{
+    // the node viewer client uses paths with a leading "/"
+    std::string path = cpath;
+    while(!path.empty() && path[0] == '/')
+    {
+        path = path.substr(1);
+    }
+
+    if(path.empty())
+    {
+        return &root;
+    }
+
+    if(!root.has_path(path))
+    {
+        return NULL;
+    }
+
+    return &root.fetch_existing(path);
+}
+
 //-----------------------------------------------------------------------------
 // -- Viewer Request Handler  -
 //-----------------------------------------------------------------------------
@@ -99,6 +395,18 @@ NodeViewerRequestHandler::handle_request(WebServer *server,
     {
         return handle_get_value(conn);
     }
+    else if(uri_cmd == "get-value-slice")
+    {
+        return handle_get_value_slice(conn);
+    }
+    else if(uri_cmd == "get-value-summary")
+    {
+        return handle_get_value_summary(conn);
+    }
+    else if(uri_cmd == "get-children")
+    {
+        return handle_get_children(conn);
+    }
     else if(uri_cmd == "get-base64-json")
     {
         return handle_get_base64_json(conn);
@@ -125,9 +433,11 @@ NodeViewerRequestHandler::handle_get_schema(struct mg_connection *conn)
 {
     if(m_node != NULL)
     {
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "%s",m_node->schema().to_json(true).c_str());
+        ChunkedResponseBuffer res_buff(conn);
+        std::ostream os(&res_buff);
+        m_node->schema().to_json_stream(os,true);
+        os.flush();
+        res_buff.finish();
     }
     else
     {
@@ -145,20 +455,32 @@ NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
 {
     if(m_node != NULL)
     {
-        // TODO size checks?
-        char post_data[2048];
-        char cpath[2048];
+        RequestVars vars(conn);
+        if(vars.body_too_large())
+        {
+            send_body_too_large(conn);
+            return true;
+        }
+
+        std::string cpath;
+        vars.get("cpath",cpath);
+
+        const Node *node = find_request_node(*m_node,cpath);
+        if(node == NULL)
+        {
+            send_json_error(conn, 404, "Not Found",
+                            "path \"" + cpath + "\" does not exist");
+            return true;
+        }
 
-        int post_data_len = mg_read(conn, post_data, sizeof(post_data));
-        
-        // TODO: path instead of cpath?
-        
-        mg_get_var(post_data, post_data_len, "cpath", cpath, sizeof(cpath));
         // TODO: value instead of datavalue
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "{ \"datavalue\": %s }",
-                  m_node->fetch(cpath).to_json().c_str());
+        ChunkedResponseBuffer res_buff(conn);
+        std::ostream os(&res_buff);
+        os << "{ \"datavalue\": ";
+        node->to_json_stream(os);
+        os << " }";
+        os.flush();
+        res_buff.finish();
     }
     else
     {
@@ -168,6 +490,299 @@ NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
     return true;
 }
 
+//---------------------------------------------------------------------------//
+// Handles requests that send a node built from the request parameters
+// (value slices, summaries and pages of children).
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::handle_get_value_slice(struct mg_connection *conn)
+{
+    return handle_node_query(conn, VALUE_SLICE);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::handle_get_value_summary(struct mg_connection *conn)
+{
+    return handle_node_query(conn, VALUE_SUMMARY);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::handle_get_children(struct mg_connection *conn)
+{
+    return handle_node_query(conn, CHILDREN_PAGE);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::handle_node_query(struct mg_connection *conn,
+                                            QueryType query)
+{
+    if(m_node == NULL)
+    {
+        CONDUIT_WARN("rest request for NULL Node");
+        return false;
+    }
+
+    RequestVars vars(conn);
+    if(vars.body_too_large())
+    {
+        send_body_too_large(conn);
+        return true;
+    }
+
+    std::string cpath;
+    vars.get("cpath",cpath);
+
+    const Node *node = find_request_node(*m_node,cpath);
+    if(node == NULL)
+    {
+        send_json_error(conn, 404, "Not Found",
+                        "path \"" + cpath + "\" does not exist");
+        return true;
+    }
+
+    // the result references the node's data, values are formatted as
+    // they are streamed
+    Node res;
+    try
+    {
+        if(query == VALUE_SLICE)
+        {
+            value_slice(*node,
+                        vars.get_index_t("offset",0),
+                        vars.get_index_t("count",-1),
+                        vars.get_index_t("stride",1),
+                        res);
+        }
+        else if(query == VALUE_SUMMARY)
+        {
+            value_summary(*node,res);
+        }
+        else
+        {
+            children_page(*node,
+                          vars.get_index_t("offset",0),
+                          vars.get_index_t("count",-1),
+                          res);
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        send_json_error(conn, 400, "Bad Request", e.message());
+        return true;
+    }
+
+    ChunkedResponseBuffer res_buff(conn);
+    std::ostream os(&res_buff);
+    res.to_json_stream(os);
+    os.flush();
+    res_buff.finish();
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeViewerRequestHandler::value_slice(const Node &leaf,
+                                      index_t offset,
+                                      index_t count,
+                                      index_t stride,
+                                      Node &res)
+{
+    const DataType &dtype = leaf.dtype();
+
+    if(dtype.is_object() || dtype.is_list() || dtype.is_empty())
+    {
+        CONDUIT_ERROR("value slices are only supported for leaves"
+                      " (dtype: " << dtype.name() << ")");
+    }
+
+    index_t num_eles = dtype.number_of_elements();
+
+    if(stride < 1)
+    {
+        CONDUIT_ERROR("invalid stride: " << stride
+                      << " (stride must be >= 1)");
+    }
+
+    if(offset < 0 || offset > num_eles)
+    {
+        CONDUIT_ERROR("invalid offset: " << offset
+                      << " (number of elements: " << num_eles << ")");
+    }
+
+    // strings are always sent whole
+    if(dtype.is_string())
+    {
+        offset = 0;
+        count  = num_eles;
+        stride = 1;
+    }
+
+    // offset <= num_eles, so this can't overflow for any stride
+    index_t num_avail = 0;
+    if(offset < num_eles)
+    {
+        num_avail = (num_eles - offset - 1) / stride + 1;
+    }
+
+    if(count < 0 || count > num_avail)
+    {
+        count = num_avail;
+    }
+
+    // the slice's byte stride must also be representable
+    index_t ele_stride = dtype.stride();
+    if(ele_stride > 0 &&
+       stride > std::numeric_limits<index_t>::max() / ele_stride)
+    {
+        CONDUIT_ERROR("invalid stride: " << stride
+                      << " (byte stride overflows index_t)");
+    }
+
+    res.reset();
+    res["dtype"] = dtype.name();
+    res["number_of_elements"] = num_eles;
+    res["offset"] = offset;
+    res["stride"] = stride;
+    res["count"]  = count;
+
+    if(count > 0)
+    {
+        DataType slice_dtype(dtype);
+        slice_dtype.set_number_of_elements(count);
+        slice_dtype.set_offset(0);
+        slice_dtype.set_stride(ele_stride * stride);
+        res["values"].set_external(slice_dtype,
+                                   const_cast<void*>(leaf.element_ptr(offset)));
+    }
+    else
+    {
+        res["values"].set(DataType::list());
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeViewerRequestHandler::value_summary(const Node &node,
+                                        Node &res)
+{
+    const DataType &dtype = node.dtype();
+
+    res.reset();
+    res["dtype"] = dtype.name();
+
+    if(dtype.is_object() || dtype.is_list())
+    {
+        res["number_of_children"] = node.number_of_children();
+        res["total_bytes_compact"] = node.total_bytes_compact();
+        return;
+    }
+
+    res["number_of_elements"] = dtype.number_of_elements();
+
+    if(dtype.is_int8())
+    {
+        leaf_summary(node.as_int8_array(),res);
+    }
+    else if(dtype.is_int16())
+    {
+        leaf_summary(node.as_int16_array(),res);
+    }
+    else if(dtype.is_int32())
+    {
+        leaf_summary(node.as_int32_array(),res);
+    }
+    else if(dtype.is_int64())
+    {
+        leaf_summary(node.as_int64_array(),res);
+    }
+    else if(dtype.is_uint8())
+    {
+        leaf_summary(node.as_uint8_array(),res);
+    }
+    else if(dtype.is_uint16())
+    {
+        leaf_summary(node.as_uint16_array(),res);
+    }
+    else if(dtype.is_uint32())
+    {
+        leaf_summary(node.as_uint32_array(),res);
+    }
+    else if(dtype.is_uint64())
+    {
+        leaf_summary(node.as_uint64_array(),res);
+    }
+    else if(dtype.is_float32())
+    {
+        leaf_summary(node.as_float32_array(),res);
+    }
+    else if(dtype.is_float64())
+    {
+        leaf_summary(node.as_float64_array(),res);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeViewerRequestHandler::children_page(const Node &node,
+                                        index_t offset,
+                                        index_t count,
+                                        Node &res)
+{
+    const DataType &dtype = node.dtype();
+
+    if(!dtype.is_object() && !dtype.is_list())
+    {
+        CONDUIT_ERROR("children are only available for objects and lists"
+                      " (dtype: " << dtype.name() << ")");
+    }
+
+    index_t num_children = node.number_of_children();
+
+    if(offset < 0 || offset > num_children)
+    {
+        CONDUIT_ERROR("invalid offset: " << offset
+                      << " (number of children: " << num_children << ")");
+    }
+
+    if(count < 0 || offset + count > num_children)
+    {
+        count = num_children - offset;
+    }
+
+    res.reset();
+    res["dtype"] = dtype.name();
+    res["number_of_children"] = num_children;
+    res["offset"] = offset;
+    res["count"]  = count;
+
+    Node &res_children = res["children"];
+    res_children.set(DataType::list());
+
+    for(index_t i = offset; i < offset + count; i++)
+    {
+        const Node &child = node.child(i);
+        Node &res_child = res_children.append();
+        if(dtype.is_object())
+        {
+            res_child["name"] = node.schema().child_name(i);
+        }
+        res_child["dtype"] = child.dtype().name();
+        if(child.dtype().is_object() || child.dtype().is_list())
+        {
+            res_child["number_of_children"] = child.number_of_children();
+        }
+        else
+        {
+            res_child["number_of_elements"] =
+                child.dtype().number_of_elements();
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Handles a request from the client for a compact, base64 encoded version
 // of the node.
@@ -177,12 +792,11 @@ NodeViewerRequestHandler::handle_get_base64_json(struct mg_connection *conn)
 {
     if(m_node != NULL)
     {
-        std::ostringstream oss;
-        m_node->to_json_stream(oss,"conduit_base64_json");
-        
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "%s",oss.str().c_str());
+        ChunkedResponseBuffer res_buff(conn);
+        std::ostream os(&res_buff);
+        m_node->to_json_stream(os,"conduit_base64_json");
+        os.flush();
+        res_buff.finish();
     }
     else
     {
@@ -40,6 +40,25 @@ namespace web
 //-----------------------------------------------------------------------------
 // -- Viewer Web Request Handler  -
 //-----------------------------------------------------------------------------
+///
+/// REST api (all requests accept GET query or POST form parameters):
+///
+///  /api/get-schema           schema of the node
+///  /api/get-value            value at `cpath`
+///  /api/get-value-slice      elements of the leaf at `cpath`, selected with
+///                            `offset`, `count` and `stride` (in elements)
+///  /api/get-value-summary    summary statistics (min, max, mean, sum,
+///                            nan count) of the leaf at `cpath`
+///  /api/get-children         a page of the children of the node at
+///                            `cpath`, selected with `offset` and `count`
+///  /api/get-base64-json      the node in conduit_base64_json format
+///  /api/kill-server          shuts down the server
+///
+/// Responses use chunked transfer encoding and are streamed from a fixed
+/// size buffer, they are not built in memory before they are sent.
+/// POST bodies over 1 MB are rejected with a 413 response.
+///
+//-----------------------------------------------------------------------------
 class CONDUIT_RELAY_API NodeViewerRequestHandler : public WebRequestHandler
 {
 public:
@@ -54,6 +73,27 @@ public:
                               
     void           set_node(Node *node);
 
+    // builders for the REST api results, they throw a conduit::Error
+    // for invalid requests
+
+    /// describes elements [offset, offset + count * stride) of a leaf
+    /// (count < 0 selects all remaining elements). res["values"] is an
+    /// external view of the selected elements.
+    static void    value_slice(const Node &leaf,
+                               index_t offset,
+                               index_t count,
+                               index_t stride,
+                               Node &res);
+    /// summary statistics of a leaf (or the size of a tree)
+    static void    value_summary(const Node &node,
+                                 Node &res);
+    /// names and types of children [offset, offset + count)
+    /// (count < 0 selects all remaining children)
+    static void    children_page(const Node &node,
+                                 index_t offset,
+                                 index_t count,
+                                 Node &res);
+
 private:
     // catch all, used for any post or get
     bool           handle_request(WebServer *server,
@@ -61,6 +101,13 @@ private:
     // handlers for specific commands 
     bool           handle_get_schema(struct mg_connection *conn);
     bool           handle_get_value(struct mg_connection *conn);
+    bool           handle_get_value_slice(struct mg_connection *conn);
+    bool           handle_get_value_summary(struct mg_connection *conn);
+    bool           handle_get_children(struct mg_connection *conn);
+
+    enum QueryType { VALUE_SLICE, VALUE_SUMMARY, CHILDREN_PAGE };
+    bool           handle_node_query(struct mg_connection *conn,
+                                     QueryType query);
     bool           handle_get_base64_json(struct mg_connection *conn);
     bool           handle_shutdown(WebServer *server);
 
@@ -102,17 +102,18 @@ PyRelay_io_blueprint_write_mesh(PyObject *, //self
         protocol_str = std::string(protocol);
     }
     
-    try
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::blueprint::write_mesh(node,
+                                             std::string(path),
+                                             protocol_str,
+                                             *opts_ptr);
+        });
+
+    if(!ok)
     {
-        relay::io::blueprint::write_mesh(node,
-                                         std::string(path),
-                                         protocol_str,
-                                         *opts_ptr);
-    }
-    catch(conduit::Error &e)
-    {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -187,17 +188,18 @@ PyRelay_io_blueprint_save_mesh(PyObject *, //self
         protocol_str = std::string(protocol);
     }
     
-    try
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::blueprint::save_mesh(node,
+                                            std::string(path),
+                                            protocol_str,
+                                            *opts_ptr);
+        });
+
+    if(!ok)
     {
-        relay::io::blueprint::save_mesh(node,
-                                        std::string(path),
-                                        protocol_str,
-                                        *opts_ptr);
-    }
-    catch(conduit::Error &e)
-    {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -264,16 +266,17 @@ PyRelay_io_blueprint_read_mesh(PyObject *, //self
     }
 
 
-    try
-    {
-        relay::io::blueprint::read_mesh(std::string(path),
-                                        *opts_ptr,
-                                        node);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::blueprint::read_mesh(std::string(path),
+                                            *opts_ptr,
+                                            node);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -338,16 +341,17 @@ PyRelay_io_blueprint_load_mesh(PyObject *, //self
     }
 
 
-    try
-    {
-        relay::io::blueprint::load_mesh(std::string(path),
-                                        *opts_ptr,
-                                        node);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::blueprint::load_mesh(std::string(path),
+                                            *opts_ptr,
+                                            node);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -116,6 +116,10 @@ PyString_FromString(const char *s)
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+// IOHandle methods release the GIL while the handle does I/O, so a handle
+// (and the nodes passed to it) must not be used by more than one python
+// thread at a time.
 //---------------------------------------------------------------------------//
 struct PyRelay_IOHandle
 {
@@ -222,16 +226,17 @@ PyRelay_IOHandle_open(PyRelay_IOHandle *self,
     }
     
     
-    try
-    {
-        self->handle->open(std::string(path),
-                           protocol_str,
-                           *opts_ptr);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            self->handle->open(std::string(path),
+                               protocol_str,
+                               *opts_ptr);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -306,24 +311,25 @@ PyRelay_IOHandle_read(PyRelay_IOHandle *self,
 
     Node *node_ptr = PyConduit_Node_Get_Node_Ptr(py_node);
     
-    try
-    {
-        if(path == NULL)
-        {
-            self->handle->read(*node_ptr,
-                               *opts_ptr);
-        }
-        else
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
         {
-            self->handle->read(std::string(path),
-                               *node_ptr,
-                               *opts_ptr);
-        }
-    }
-    catch(conduit::Error &e)
+            if(path == NULL)
+            {
+                self->handle->read(*node_ptr,
+                                   *opts_ptr);
+            }
+            else
+            {
+                self->handle->read(std::string(path),
+                                   *node_ptr,
+                                   *opts_ptr);
+            }
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -383,24 +389,25 @@ PyRelay_IOHandle_write(PyRelay_IOHandle *self,
 
     Node *node_ptr = PyConduit_Node_Get_Node_Ptr(py_node);
 
-    try
-    {
-        if(path == NULL)
-        {
-            self->handle->write(*node_ptr,
-                                *opts_ptr);
-        }
-        else
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
         {
-            self->handle->write(*node_ptr,
-                                std::string(path),
-                                *opts_ptr);
-        }
-    }
-    catch(conduit::Error &e)
+            if(path == NULL)
+            {
+                self->handle->write(*node_ptr,
+                                    *opts_ptr);
+            }
+            else
+            {
+                self->handle->write(*node_ptr,
+                                    std::string(path),
+                                    *opts_ptr);
+            }
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -427,22 +434,23 @@ PyRelay_IOHandle_list_child_names(PyRelay_IOHandle *self,
     
     std::vector<std::string> cld_names;
     
-    try
-    {
-        if(path == NULL)
-        {
-            self->handle->list_child_names(cld_names);
-        }
-        else
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
         {
-            self->handle->list_child_names(std::string(path),
-                                           cld_names);
-        }
-    }
-    catch(conduit::Error &e)
+            if(path == NULL)
+            {
+                self->handle->list_child_names(cld_names);
+            }
+            else
+            {
+                self->handle->list_child_names(std::string(path),
+                                               cld_names);
+            }
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -482,14 +490,15 @@ PyRelay_IOHandle_has_path(PyRelay_IOHandle *self,
 
     bool res = false;
 
-    try
-    {
-        res = self->handle->has_path(std::string(path));
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            res = self->handle->has_path(std::string(path));
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -519,14 +528,15 @@ PyRelay_IOHandle_remove(PyRelay_IOHandle *self,
         return NULL;
     }
 
-    try
-    {
-        self->handle->remove(std::string(path));
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            self->handle->remove(std::string(path));
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -537,14 +547,15 @@ PyRelay_IOHandle_remove(PyRelay_IOHandle *self,
 static PyObject *
 PyRelay_IOHandle_close(PyRelay_IOHandle *self)
 {
-    try
-    {
-        self->handle->close();
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            self->handle->close();
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -738,18 +749,18 @@ PyRelay_io_save(PyObject *, //self
         protocol_str = std::string(protocol);
     }
     
-    try
-    {
-    
-        relay::io::save(node,
-                        std::string(path),
-                        protocol_str,
-                        *opts_ptr);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::save(node,
+                            std::string(path),
+                            protocol_str,
+                            *opts_ptr);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -824,17 +835,18 @@ PyRelay_io_save_merged(PyObject *, //self
         protocol_str = std::string(protocol);
     }
     
-    try
-    {
-        relay::io::save_merged(node,
-                               std::string(path),
-                               protocol_str,
-                               *opts_ptr);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::save_merged(node,
+                                   std::string(path),
+                                   protocol_str,
+                                   *opts_ptr);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -885,16 +897,17 @@ PyRelay_io_load(PyObject *, //self
     }
     
     
-    try
-    {
-        relay::io::load(std::string(path),
-                        protocol_str,
-                        node);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::load(std::string(path),
+                            protocol_str,
+                            node);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
     
@@ -947,16 +960,17 @@ PyRelay_io_load_merged(PyObject *, //self
         protocol_str = std::string(protocol);
     }
     
-    try
-    {
-        relay::io::load_merged(std::string(path),
-                               protocol_str,
-                               node);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_IOError,
+        [&]()
+        {
+            relay::io::load_merged(std::string(path),
+                                   protocol_str,
+                                   node);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_IOError,
-                        e.message().c_str());
         return NULL;
     }
 
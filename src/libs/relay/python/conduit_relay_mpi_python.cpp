@@ -374,14 +374,15 @@ PyRelay_MPI_send(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::send(node, dest, tag, comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::send(node, dest, tag, comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -435,14 +436,15 @@ PyRelay_MPI_recv(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::recv(node, source, tag, comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::recv(node, source, tag, comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -495,14 +497,15 @@ PyRelay_MPI_send_using_schema(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::send_using_schema(node, dest, tag, comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::send_using_schema(node, dest, tag, comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -555,14 +558,15 @@ PyRelay_MPI_recv_using_schema(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::recv_using_schema(node, source, tag, comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::recv_using_schema(node, source, tag, comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -671,17 +675,18 @@ PyRelay_MPI_sum_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::sum_reduce(send_node,
-                               recv_node,
-                               root,
-                               comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::sum_reduce(send_node,
+                                   recv_node,
+                                   root,
+                                   comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -746,17 +751,18 @@ PyRelay_MPI_min_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::min_reduce(send_node,
-                               recv_node,
-                               root,
-                               comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::min_reduce(send_node,
+                                   recv_node,
+                                   root,
+                                   comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -822,17 +828,18 @@ PyRelay_MPI_max_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::max_reduce(send_node,
-                               recv_node,
-                               root,
-                               comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::max_reduce(send_node,
+                                   recv_node,
+                                   root,
+                                   comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -898,17 +905,18 @@ PyRelay_MPI_prod_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::prod_reduce(send_node,
-                               recv_node,
-                               root,
-                               comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::prod_reduce(send_node,
+                                   recv_node,
+                                   root,
+                                   comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -970,16 +978,17 @@ PyRelay_MPI_sum_all_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::sum_all_reduce(send_node,
-                                   recv_node,
-                                   comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::sum_all_reduce(send_node,
+                                       recv_node,
+                                       comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1042,16 +1051,17 @@ PyRelay_MPI_min_all_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::min_all_reduce(send_node,
-                                   recv_node,
-                                   comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::min_all_reduce(send_node,
+                                       recv_node,
+                                       comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1113,16 +1123,17 @@ PyRelay_MPI_max_all_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::max_all_reduce(send_node,
-                                   recv_node,
-                                   comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::max_all_reduce(send_node,
+                                       recv_node,
+                                       comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1184,16 +1195,17 @@ PyRelay_MPI_prod_all_reduce(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::prod_all_reduce(send_node,
-                                    recv_node,
-                                    comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::prod_all_reduce(send_node,
+                                        recv_node,
+                                        comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1448,17 +1460,18 @@ PyRelay_MPI_gather(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::gather(send_node,
-                           recv_node,
-                           root,
-                           comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::gather(send_node,
+                               recv_node,
+                               root,
+                               comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1520,17 +1533,18 @@ PyRelay_MPI_gather_using_schema(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::gather_using_schema(send_node,
-                                        recv_node,
-                                        root,
-                                        comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::gather_using_schema(send_node,
+                                            recv_node,
+                                            root,
+                                            comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1589,16 +1603,17 @@ PyRelay_MPI_all_gather(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::all_gather(send_node,
-                               recv_node,
-                               comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::all_gather(send_node,
+                                   recv_node,
+                                   comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1657,16 +1672,17 @@ PyRelay_MPI_all_gather_using_schema(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::all_gather_using_schema(send_node,
-                                            recv_node,
-                                            comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::all_gather_using_schema(send_node,
+                                                recv_node,
+                                                comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1720,14 +1736,15 @@ PyRelay_MPI_broadcast(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::broadcast(node, root, comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::broadcast(node, root, comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
@@ -1777,14 +1794,15 @@ PyRelay_MPI_broadcast_using_schema(PyObject *, //self
     // get c mpi comm hnd
     MPI_Comm comm = MPI_Comm_f2c(mpi_comm_id);
 
-    try
-    {
-        relay::mpi::broadcast_using_schema(node, root, comm);
-    }
-    catch(conduit::Error &e)
+    // release the GIL while conduit does the work
+    bool ok = PyConduit_Call_Without_GIL(PyExc_Exception,
+        [&]()
+        {
+            relay::mpi::broadcast_using_schema(node, root, comm);
+        });
+
+    if(!ok)
     {
-        PyErr_SetString(PyExc_Exception,
-                        e.message().c_str());
         return NULL;
     }
 
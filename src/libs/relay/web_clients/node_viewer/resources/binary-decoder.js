@@ -0,0 +1,193 @@
+/*
+# Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+# Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+# other details. No copyright assignment is required to contribute to Conduit.
+*/
+
+// Decoder for the binary websocket messages sent by
+// conduit::relay::web::WebSocket::send_binary() and send_delta().
+//
+// A message is sent as one or more frames, each frame starts with a 16 byte
+// header: ["CDNB" magic] [message id] [frame index] [number of frames]
+//
+// A message holds a json header followed by the compact little endian
+// leaf data: [header bytes (H)] [flags] [H bytes of json header] [leaf data]
+//
+// Decoded trees are plain javascript objects (conduit objects), arrays
+// (conduit lists), strings (char8_str leaves) and typed arrays (all other
+// leaves).
+
+var CONDUIT_BINARY_FRAME_MAGIC   = 0x424E4443;
+var CONDUIT_BINARY_FRAME_HEADER  = 16;
+var CONDUIT_BINARY_MSG_DELTA     = 1;
+
+var CONDUIT_TYPED_ARRAYS = {
+  "int8":    Int8Array,
+  "int16":   Int16Array,
+  "int32":   Int32Array,
+  "uint8":   Uint8Array,
+  "uint16":  Uint16Array,
+  "uint32":  Uint32Array,
+  "float32": Float32Array,
+  "float64": Float64Array
+};
+
+if (typeof BigInt64Array !== "undefined") {
+  CONDUIT_TYPED_ARRAYS["int64"] = BigInt64Array;
+  CONDUIT_TYPED_ARRAYS["uint64"] = BigUint64Array;
+}
+
+function ConduitBinaryDecoder() {
+  this.frames = [];
+  this.msgId = null;
+  this.numFrames = 0;
+  this.data = null;
+  // topic of the last message (see WebServer::publish), "" if none
+  this.topic = "";
+}
+
+// Adds a frame (an ArrayBuffer), returns true when a message is complete
+// and has been applied to this.data
+ConduitBinaryDecoder.prototype.addFrame = function (buffer) {
+  if (buffer.byteLength < CONDUIT_BINARY_FRAME_HEADER) {
+    throw new Error("invalid binary websocket frame");
+  }
+  var view = new DataView(buffer);
+  if (view.getUint32(0, true) !== CONDUIT_BINARY_FRAME_MAGIC) {
+    throw new Error("invalid binary websocket frame");
+  }
+  var msgId = view.getUint32(4, true);
+  var frameIdx = view.getUint32(8, true);
+  var numFrames = view.getUint32(12, true);
+
+  if (frameIdx === 0) {
+    this.frames = [];
+    this.msgId = msgId;
+    this.numFrames = numFrames;
+  } else if (msgId !== this.msgId || frameIdx !== this.frames.length) {
+    throw new Error("unexpected binary websocket frame");
+  }
+
+  this.frames.push(new Uint8Array(buffer, CONDUIT_BINARY_FRAME_HEADER));
+  if (this.frames.length < this.numFrames) {
+    return false;
+  }
+
+  var msg;
+  if (this.frames.length === 1) {
+    msg = this.frames[0];
+  } else {
+    var total = 0;
+    this.frames.forEach(function (f) { total += f.byteLength; });
+    msg = new Uint8Array(total);
+    var offset = 0;
+    this.frames.forEach(function (f) {
+      msg.set(f, offset);
+      offset += f.byteLength;
+    });
+  }
+  this.frames = [];
+  this.data = this.applyMessage(msg, this.data);
+  return true;
+};
+
+// Decodes a complete message (an Uint8Array) and applies it to data,
+// returns the updated tree
+ConduitBinaryDecoder.prototype.applyMessage = function (msg, data) {
+  var view = new DataView(msg.buffer, msg.byteOffset, msg.byteLength);
+  var headerBytes = view.getUint32(0, true);
+  var flags = view.getUint32(4, true);
+  var headerText = "";
+  for (var i = 0; i < headerBytes; i++) {
+    headerText += String.fromCharCode(msg[8 + i]);
+  }
+  var header = JSON.parse(headerText);
+  this.topic = header.topic || "";
+  var dataOffset = msg.byteOffset + 8 + headerBytes;
+  var incoming = this.decodeSchema(header.schema, msg.buffer, dataOffset);
+
+  if ((flags & CONDUIT_BINARY_MSG_DELTA) === 0) {
+    return incoming;
+  }
+
+  (header.removed || []).forEach(function (path) {
+    if (path === "") {
+      data = null;
+      return;
+    }
+    var parts = path.split("/");
+    var parent = data;
+    for (var i = 0; i < parts.length - 1 && parent; i++) {
+      parent = parent[parts[i]];
+    }
+    if (parent) {
+      delete parent[parts[parts.length - 1]];
+    }
+  });
+
+  return this.applyUnits(incoming, data, header.schema);
+};
+
+// merges the units (leaves and whole lists) of a delta into data
+ConduitBinaryDecoder.prototype.applyUnits = function (src, dest, schema) {
+  if (schema === null || typeof schema !== "object" ||
+      Array.isArray(schema) || typeof schema.dtype === "string") {
+    return src;
+  }
+  if (dest === null || typeof dest !== "object" || Array.isArray(dest) ||
+      ArrayBuffer.isView(dest)) {
+    dest = {};
+  }
+  for (var name in schema) {
+    dest[name] = this.applyUnits(src[name], dest[name], schema[name]);
+  }
+  return dest;
+};
+
+// builds a tree from a compact schema and the leaf data
+ConduitBinaryDecoder.prototype.decodeSchema = function (schema, buffer,
+                                                        dataOffset) {
+  var self = this;
+  if (Array.isArray(schema)) {
+    return schema.map(function (s) {
+      return self.decodeSchema(s, buffer, dataOffset);
+    });
+  }
+  if (schema === null || typeof schema !== "object") {
+    return null;
+  }
+  if (typeof schema.dtype === "string") {
+    return this.decodeLeaf(schema, buffer, dataOffset);
+  }
+  var res = {};
+  for (var name in schema) {
+    res[name] = this.decodeSchema(schema[name], buffer, dataOffset);
+  }
+  return res;
+};
+
+ConduitBinaryDecoder.prototype.decodeLeaf = function (dtype, buffer,
+                                                      dataOffset) {
+  var num = dtype.number_of_elements || 0;
+  var offset = dataOffset + (dtype.offset || 0);
+  var bytes = new Uint8Array(buffer, offset, num * dtype.element_bytes);
+
+  if (dtype.dtype === "char8_str") {
+    var s = "";
+    for (var i = 0; i < bytes.length && bytes[i] !== 0; i++) {
+      s += String.fromCharCode(bytes[i]);
+    }
+    return s;
+  }
+
+  var TypedArray = CONDUIT_TYPED_ARRAYS[dtype.dtype];
+  if (TypedArray === undefined) {
+    // other types are left as raw bytes
+    return bytes.slice();
+  }
+  // typed arrays require aligned offsets, copy when the data is unaligned
+  if (offset % TypedArray.BYTES_PER_ELEMENT !== 0) {
+    return new TypedArray(bytes.slice().buffer);
+  }
+  return new TypedArray(buffer, offset, num).slice();
+};
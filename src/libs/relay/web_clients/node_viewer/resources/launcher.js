@@ -49,9 +49,21 @@ function websocket_test()
 {
     var wsproto = (location.protocol === 'https:') ? 'wss:' : 'ws:';
     connection = new WebSocket(wsproto + '//' + window.location.host + '/websocket');
+    // binary messages (send_binary / send_delta) are decoded into
+    // binary_decoder.data
+    connection.binaryType = 'arraybuffer';
+    var binary_decoder = new ConduitBinaryDecoder();
     
     connection.onmessage = function (msg) 
     {
+        if (msg.data instanceof ArrayBuffer)
+        {
+            if (binary_decoder.addFrame(msg.data))
+            {
+                console.log('WebSocket binary message', binary_decoder.data);
+            }
+            return;
+        }
         console.log('WebSocket message' + msg.data);
         connection.send('{"type":"info","message":"response from browser"}');
     }
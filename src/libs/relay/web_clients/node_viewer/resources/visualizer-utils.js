@@ -58,14 +58,17 @@ var nodeOffset = function (d) {
 	return d.offset;
 };
 
+// max number of elements fetched for the value inspector
+var NODE_VIEWER_VALUE_PAGE_SIZE = 10000;
+
 var getNodeValue = function (d, callback) {
 	if (!d.datavalue && d.leaf && d.length !== 0) {
     var request = new XMLHttpRequest();
-    request.open('POST', '/api/get-value', true);
+    request.open('POST', '/api/get-value-slice', true);
     request.onload = function () {
       if (request.status >= 200 && request.status < 400) {
         json = JSON.parse(request.response.replace(/nan/ig, "null"));
-        d.datavalue = json.datavalue;
+        d.datavalue = json.values;
         callback(d.datavalue);
       } else {
         callback("Server error code " + request.status);
@@ -76,7 +79,8 @@ var getNodeValue = function (d, callback) {
       callback("Server connection error");
     };
 
-    request.send("cpath=" + d.cpath);
+    request.send("cpath=" + encodeURIComponent(d.cpath) +
+                 "&count=" + NODE_VIEWER_VALUE_PAGE_SIZE);
 	} else {
     callback(d.datavalue);
   }
@@ -435,3 +435,29 @@ TEST(blueprint_mesh_flatten, domains_missing_fields)
         table::compare_to_baseline(table, baseline);
     }
 }
+
+TEST(blueprint_mesh_flatten, element_centers_poly)
+{
+    // Polygonal / polyhedral versions of the braid quads and hexs have the
+    // same elements, so their element centers should match.
+    const std::pair<std::string, std::string> cases[] = {
+        {"quads", "quads_poly"}, {"hexs", "hexs_poly"}
+    };
+    for(const auto &c : cases)
+    {
+        const index_t npts_z = (c.first == "hexs") ? 3 : 0;
+        Node mesh, mesh_poly;
+        blueprint::mesh::examples::braid(c.first, 4, 3, npts_z, mesh);
+        blueprint::mesh::examples::braid(c.second, 4, 3, npts_z, mesh_poly);
+
+        Node table, table_poly, opts;
+        blueprint::mesh::flatten(mesh, opts, table);
+        blueprint::mesh::flatten(mesh_poly, opts, table_poly);
+
+        const Node &centers = table["element_data/values/element_centers"];
+        const Node &centers_poly = table_poly["element_data/values/element_centers"];
+        Node info;
+        EXPECT_FALSE(centers.diff(centers_poly, info, CONDUIT_EPSILON))
+            << c.second << "\n" << info.to_yaml();
+    }
+}
@@ -1629,3 +1629,127 @@ TEST(conduit_blueprint_generate_unstructured, generate_corners)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_fixed_shape_matches_general)
+{
+    // Single tri/quad/tet/hex topologies use shape specialized kernels,
+    // compare them with the general (TopologyMetadata) implementation used
+    // for the poly form of the same topology. Polyhedral faces are numbered
+    // differently, so only centroids are compared in 3D.
+    const std::string shapes[4] = {"tris", "quads", "tets", "hexs"};
+    for(index_t si = 0; si < 4; si++)
+    {
+        const index_t npts_z = (si < 2) ? 0 : 4;
+        Node mesh;
+        mesh::examples::braid(shapes[si], 4, 4, npts_z, mesh);
+        const Node &topo = mesh["topologies/mesh"];
+        Node &poly_topo = mesh["topologies/poly"];
+        mesh::topology::unstructured::to_polygonal(topo, poly_topo);
+
+        const index_t num_gens = (si < 2) ? 3 : 1;
+        for(index_t gi = 0; gi < num_gens; gi++)
+        {
+            Node res[2];
+            for(index_t ri = 0; ri < 2; ri++)
+            {
+                const Node &src_topo = (ri == 0) ? topo : poly_topo;
+                Node &res_topo = res[ri]["topologies/ctopo"];
+                Node &res_coords = res[ri]["coordsets/ccoords"];
+                Node &s2dmap = res[ri]["s2dmap"];
+                Node &d2smap = res[ri]["d2smap"];
+                if(gi == 0)
+                {
+                    mesh::topology::unstructured::generate_centroids(
+                        src_topo, res_topo, res_coords, s2dmap, d2smap);
+                }
+                else if(gi == 1)
+                {
+                    mesh::topology::unstructured::generate_sides(
+                        src_topo, res_topo, res_coords, s2dmap, d2smap);
+                }
+                else
+                {
+                    mesh::topology::unstructured::generate_corners(
+                        src_topo, res_topo, res_coords, s2dmap, d2smap);
+                }
+            }
+
+            Node info;
+            EXPECT_TRUE(mesh::topology::verify(res[0]["topologies/ctopo"], info));
+            EXPECT_FALSE(res[0].diff(res[1], info, 0.0)) << shapes[si] << " " << gi;
+        }
+    }
+
+    // In 3D, compare sides and corners (topologies, coordinates and maps)
+    // with the general implementation run on the same elements. Padding
+    // the connectivity gives non-standard offsets, which the shape
+    // specialized kernels don't handle.
+    for(index_t si = 2; si < 4; si++)
+    {
+        Node mesh;
+        mesh::examples::braid(shapes[si], 4, 4, 4, mesh);
+        const Node &topo = mesh["topologies/mesh"];
+        const int32_array conn = topo["elements/connectivity"].value();
+        const index_t elem_verts = (si == 2) ? 4 : 8;
+        const index_t num_elems = conn.number_of_elements() / elem_verts;
+
+        std::vector<int32> pad_conn, pad_offsets;
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            pad_offsets.push_back((int32)pad_conn.size());
+            for(index_t vi = 0; vi < elem_verts; vi++)
+            {
+                pad_conn.push_back(conn[ei * elem_verts + vi]);
+            }
+            pad_conn.push_back(-1);
+        }
+
+        Node &pad_topo = mesh["topologies/pad"];
+        pad_topo["type"] = "unstructured";
+        pad_topo["coordset"] = topo["coordset"].as_string();
+        pad_topo["elements/shape"] = topo["elements/shape"].as_string();
+        pad_topo["elements/connectivity"].set(pad_conn);
+        pad_topo["elements/offsets"].set(pad_offsets);
+
+        for(index_t gi = 0; gi < 2; gi++)
+        {
+            Node res[2];
+            for(index_t ri = 0; ri < 2; ri++)
+            {
+                const Node &src_topo = (ri == 0) ? topo : pad_topo;
+                Node &res_topo = res[ri]["topologies/ctopo"];
+                Node &res_coords = res[ri]["coordsets/ccoords"];
+                Node &s2dmap = res[ri]["s2dmap"];
+                Node &d2smap = res[ri]["d2smap"];
+                if(gi == 0)
+                {
+                    mesh::topology::unstructured::generate_sides(
+                        src_topo, res_topo, res_coords, s2dmap, d2smap);
+                }
+                else
+                {
+                    mesh::topology::unstructured::generate_corners(
+                        src_topo, res_topo, res_coords, s2dmap, d2smap);
+                }
+            }
+
+            // element offsets are compared even if they weren't generated
+            Node offsets[2];
+            for(index_t ri = 0; ri < 2; ri++)
+            {
+                mesh::topology::unstructured::generate_offsets(
+                    res[ri]["topologies/ctopo"], offsets[ri]);
+            }
+
+            Node info;
+            EXPECT_TRUE(mesh::topology::verify(res[0]["topologies/ctopo"], info));
+            EXPECT_EQ(offsets[0].dtype().number_of_elements(),
+                      mesh::topology::length(res[0]["topologies/ctopo"]));
+            EXPECT_FALSE(offsets[0].diff(offsets[1], info, 0.0))
+                << shapes[si] << " " << gi << "\n" << info.to_yaml();
+            EXPECT_FALSE(res[0].diff(res[1], info, 0.0))
+                << shapes[si] << " " << gi << "\n" << info.to_yaml();
+        }
+    }
+}
@@ -202,3 +202,105 @@ TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_venn_to_silo_matset_values)
 
 }
 
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_venn_matset_layouts)
+{
+    const int nx = 9, ny = 7;
+    const double radius = 0.3;
+
+    const std::string venn_types[] = {"full",
+                                      "sparse_by_material",
+                                      "sparse_by_element"};
+
+    Node silo_baseline;
+    {
+        Node mesh;
+        blueprint::mesh::examples::venn("full", nx, ny, radius, mesh);
+        blueprint::mesh::matset::to_silo(mesh["matsets/matset"], silo_baseline);
+    }
+
+    for(const std::string &venn_type : venn_types)
+    {
+        CONDUIT_INFO("venn " << venn_type << " matset layouts");
+
+        Node mesh, info;
+        blueprint::mesh::examples::venn(venn_type, nx, ny, radius, mesh);
+        const Node &mset = mesh["matsets/matset"];
+
+        // element dominant (uni-buffer)
+        Node &elem_dom = mesh["matsets/elem_dom"];
+        blueprint::mesh::matset::to_element_dominant(mset, elem_dom);
+        EXPECT_TRUE(blueprint::mesh::matset::verify(elem_dom, info));
+        EXPECT_TRUE(blueprint::mesh::matset::is_uni_buffer(elem_dom));
+        EXPECT_TRUE(blueprint::mesh::matset::is_element_dominant(elem_dom));
+
+        // material dominant (multi-buffer)
+        Node &mat_dom = mesh["matsets/mat_dom"];
+        blueprint::mesh::matset::to_material_dominant(mset, mat_dom);
+        EXPECT_TRUE(blueprint::mesh::matset::verify(mat_dom, info));
+        EXPECT_TRUE(blueprint::mesh::matset::is_multi_buffer(mat_dom));
+        EXPECT_TRUE(blueprint::mesh::matset::is_material_dominant(mat_dom));
+
+        // all layouts describe the same materials
+        Node silo;
+        blueprint::mesh::matset::to_silo(elem_dom, silo);
+        EXPECT_FALSE(silo.diff(silo_baseline, info));
+        blueprint::mesh::matset::to_silo(mat_dom, silo);
+        EXPECT_FALSE(silo.diff(silo_baseline, info));
+
+        // silo round trip
+        Node &from_silo = mesh["matsets/from_silo"];
+        blueprint::mesh::matset::from_silo(silo_baseline, from_silo);
+        EXPECT_TRUE(blueprint::mesh::matset::verify(from_silo, info));
+        EXPECT_FALSE(from_silo["material_ids"].diff(elem_dom["material_ids"], info));
+        EXPECT_FALSE(from_silo["sizes"].diff(elem_dom["sizes"], info));
+        blueprint::mesh::matset::to_silo(from_silo, silo);
+        EXPECT_FALSE(silo.diff(silo_baseline, info));
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_uni_buffer_material_dominant)
+{
+    Node mset;
+    mset["topology"] = "mesh";
+    mset["material_map/a"] = 0;
+    mset["material_map/b"] = 1;
+    mset["material_map/c"] = 2;
+
+    int32   eids[] = {3,   0,   1,    1,    2,   3,   5};
+    int32   mids[] = {0,   1,   0,    2,    1,   2,   1};
+    float64 vfs[]  = {0.5, 1.0, 0.25, 0.75, 0.0, 0.5, 1.0};
+    mset["element_ids"].set(eids, 7);
+    mset["material_ids"].set(mids, 7);
+    mset["volume_fractions"].set(vfs, 7);
+
+    Node silo, info;
+    blueprint::mesh::matset::to_silo(mset, silo);
+
+    // element 2 only has a zero volume fraction, element 4 has no entries
+    int32 expected_matlist[] = {2, -1, 0, -3, 0, 2};
+    int32 expected_mix_mat[] = {0, 2, 0, 2};
+    int32 expected_mix_next[] = {2, 0, 4, 0};
+    float64 expected_mix_vf[] = {0.25, 0.75, 0.5, 0.5};
+
+    Node expected;
+    expected["matlist"].set(expected_matlist, 6);
+    expected["mix_mat"].set(expected_mix_mat, 4);
+    expected["mix_next"].set(expected_mix_next, 4);
+    expected["mix_vf"].set(expected_mix_vf, 4);
+    EXPECT_FALSE(silo["matlist"].diff(expected["matlist"], info));
+    EXPECT_FALSE(silo["mix_mat"].diff(expected["mix_mat"], info));
+    EXPECT_FALSE(silo["mix_next"].diff(expected["mix_next"], info));
+    EXPECT_FALSE(silo["mix_vf"].diff(expected["mix_vf"], info));
+
+    Node mat_dom;
+    blueprint::mesh::matset::to_material_dominant(mset, mat_dom);
+    int32 expected_b_eids[] = {0, 5};
+    Node expected_b(DataType::int32(2), expected_b_eids, true);
+    EXPECT_FALSE(mat_dom["element_ids/b"].diff(expected_b, info));
+    EXPECT_EQ(mat_dom["volume_fractions/c"].dtype().number_of_elements(), 2);
+}
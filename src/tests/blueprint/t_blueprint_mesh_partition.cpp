@@ -1126,6 +1126,100 @@ TEST(conduit_blueprint_mesh_combine, multidomain)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_combine, merge_methods)
+{
+    // Split a mesh into many domains, then combine them back into one with
+    // each of the point merge methods. They should all recover the original
+    // points.
+    const conduit::index_t nx = 11, ny = 11, nz = 11;
+    conduit::Node braid;
+    conduit::blueprint::mesh::examples::braid("hexs", nx, ny, nz, braid);
+
+    conduit::Node split, split_opts;
+    split_opts["target"] = 27;
+    conduit::blueprint::mesh::partition(braid, split_opts, split);
+    EXPECT_EQ(split.number_of_children(), 27);
+
+    const std::vector<std::string> methods = {"spatial_hash", "kdtree", "simple"};
+    std::vector<conduit::Node> results(methods.size());
+    for(size_t i = 0; i < methods.size(); i++)
+    {
+        conduit::Node opts;
+        opts["target"] = 1;
+        opts["merge_tolerance"] = 1.e-6;
+        opts["merge_method"] = methods[i];
+        conduit::blueprint::mesh::partition(split, opts, results[i]);
+
+        const conduit::Node &coords = results[i]["coordsets/coords"];
+        EXPECT_EQ(conduit::blueprint::mesh::coordset::length(coords),
+                  nx * ny * nz);
+
+        conduit::Node verify_info;
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(results[i], verify_info));
+    }
+
+    // All methods should produce the same points in the same order
+    for(size_t i = 1; i < methods.size(); i++)
+    {
+        conduit::Node info;
+        bool is_different = results[0]["coordsets"].diff(results[i]["coordsets"], info);
+        EXPECT_FALSE(is_different);
+        if(is_different)
+        {
+            info.print();
+        }
+        is_different = results[0]["topologies"].diff(results[i]["topologies"], info);
+        EXPECT_FALSE(is_different);
+    }
+
+    // Invalid methods are reported
+    conduit::Node opts, output;
+    opts["target"] = 1;
+    opts["merge_method"] = "bogus";
+    EXPECT_THROW(conduit::blueprint::mesh::partition(split, opts, output),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_combine, merge_tolerance)
+{
+    // Two single quad domains that share an edge, with the points of the
+    // second domain perturbed by less than the merge tolerance.
+    conduit::Node mesh;
+    for(int d = 0; d < 2; d++)
+    {
+        conduit::Node &dom = mesh.append();
+        dom["state/domain_id"] = d;
+        dom["coordsets/coords/type"] = "explicit";
+        const double eps = (d == 0) ? 0. : 1.e-7;
+        std::vector<double> x = {1. * d, 1. * d + 1., 1. * d + 1., 1. * d};
+        std::vector<double> y = {0., 0., 1., 1.};
+        for(size_t i = 0; i < x.size(); i++)
+        {
+            x[i] += eps;
+            y[i] -= eps;
+        }
+        dom["coordsets/coords/values/x"].set(x);
+        dom["coordsets/coords/values/y"].set(y);
+        dom["topologies/mesh/type"] = "unstructured";
+        dom["topologies/mesh/coordset"] = "coords";
+        dom["topologies/mesh/elements/shape"] = "quad";
+        dom["topologies/mesh/elements/connectivity"].set(std::vector<conduit::index_t>{0,1,2,3});
+    }
+
+    conduit::Node opts, output;
+    opts["target"] = 1;
+    opts["merge_tolerance"] = 1.e-5;
+    conduit::blueprint::mesh::partition(mesh, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::coordset::length(output["coordsets/coords"]), 6);
+
+    // A tolerance smaller than the perturbation keeps the points separate
+    opts["merge_tolerance"] = 1.e-8;
+    conduit::blueprint::mesh::partition(mesh, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::coordset::length(output["coordsets/coords"]), 8);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_combine, to_poly)
 {
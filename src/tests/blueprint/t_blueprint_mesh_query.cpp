@@ -10,6 +10,7 @@
 
 #include "conduit.hpp"
 #include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
 #include "conduit_log.hpp"
 
 #include <set>
@@ -187,3 +188,108 @@ TEST(conduit_blueprint_mesh_query, adjset_formats)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, element_blocks)
+{
+    using conduit::blueprint::mesh::utils::topology::entity;
+    using conduit::blueprint::mesh::utils::topology::element_block;
+    namespace bputopo = conduit::blueprint::mesh::utils::topology;
+
+    // (braid mesh type, npts_z)
+    const std::vector<std::pair<std::string, index_t>> cases = {
+        {"points_implicit", 0}, {"points_implicit", 3},
+        {"uniform", 0}, {"uniform", 3},
+        {"rectilinear", 0}, {"rectilinear", 3},
+        {"structured", 0}, {"structured", 3},
+        {"points", 3}, {"lines", 0}, {"tris", 0}, {"quads", 0},
+        {"quads_poly", 0}, {"quads_and_tris", 0},
+        {"quads_and_tris_offsets", 0},
+        {"tets", 3}, {"hexs", 3}, {"hexs_poly", 3}, {"hexs_and_tets", 3}
+    };
+
+    for(const auto &c : cases)
+    {
+        const std::string &mesh_type = c.first;
+        const index_t npts_z = c.second;
+
+        Node mesh;
+        blueprint::mesh::examples::braid(mesh_type, 5, 4, npts_z, mesh);
+        const Node &topo = mesh["topologies"][0];
+
+        // reference: per element entity iteration
+        std::vector<std::vector<index_t>> expected;
+        bputopo::iterate_elements(topo, [&](const entity &e) {
+            EXPECT_EQ(e.entity_id, (index_t)expected.size());
+            expected.push_back(e.element_ids);
+        });
+        EXPECT_TRUE(expected.size() > 0) << mesh_type;
+
+        // serial blocks, in element order
+        std::vector<std::vector<index_t>> serial;
+        bputopo::iterate_element_blocks(topo, [&](const element_block &b) {
+            EXPECT_EQ(b.first_element_id, (index_t)serial.size());
+            EXPECT_TRUE(b.num_elements <= 7);
+            for(index_t ei = 0; ei < b.num_elements; ei++)
+            {
+                const index_t *ids = b.element(ei);
+                serial.push_back(std::vector<index_t>(ids, ids + b.element_size(ei)));
+            }
+        }, 7);
+        EXPECT_EQ(expected, serial) << mesh_type << " " << npts_z;
+
+        // parallel blocks, placed by element id
+        std::vector<std::vector<index_t>> parallel(expected.size());
+        bputopo::for_all_element_blocks(topo, [&](const element_block &b) {
+            for(index_t ei = 0; ei < b.num_elements; ei++)
+            {
+                const index_t *ids = b.element(ei);
+                parallel[b.first_element_id + ei].assign(ids, ids + b.element_size(ei));
+            }
+        }, 5);
+        EXPECT_EQ(expected, parallel) << mesh_type << " " << npts_z;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, element_blocks_stream)
+{
+    using conduit::blueprint::mesh::utils::topology::element_block;
+    namespace bputopo = conduit::blueprint::mesh::utils::topology;
+
+    // 2 tris, 1 quad, 1 tri (as int32 with element counts)
+    Node topo;
+    topo["type"] = "unstructured";
+    topo["coordset"] = "coords";
+    topo["elements/element_types/tris/stream_id"] = 5;
+    topo["elements/element_types/tris/shape"] = "tri";
+    topo["elements/element_types/quads/stream_id"] = 9;
+    topo["elements/element_types/quads/shape"] = "quad";
+    int32 stream_ids[] = {5, 9, 5};
+    int32 counts[] = {2, 1, 1};
+    int32 stream[] = {0,1,2, 1,2,3, 2,3,4,5, 4,5,6};
+    topo["elements/element_index/stream_ids"].set(stream_ids, 3);
+    topo["elements/element_index/element_counts"].set(counts, 3);
+    topo["elements/stream"].set(stream, 13);
+
+    Node info;
+    EXPECT_TRUE(blueprint::mesh::topology::unstructured::verify(topo, info));
+
+    std::vector<index_t> block_sizes;
+    std::vector<index_t> block_nverts;
+    bputopo::iterate_element_blocks(topo, [&](const element_block &b) {
+        block_sizes.push_back(b.num_elements);
+        block_nverts.push_back(b.shape.indices);
+        EXPECT_EQ(b.element(b.num_elements - 1)[0],
+                  (b.first_element_id == 0) ? 1 : (b.first_element_id == 2 ? 2 : 4));
+    });
+    EXPECT_EQ(block_sizes, std::vector<index_t>({2, 1, 1}));
+    EXPECT_EQ(block_nverts, std::vector<index_t>({3, 4, 3}));
+
+    // bad shape stream
+    topo["elements/element_types/quads/shape"] = "polygonal";
+    EXPECT_FALSE(blueprint::mesh::topology::unstructured::verify(topo, info));
+    topo["elements/element_types/quads/shape"] = "quad";
+    topo["elements/element_index"].remove("element_counts");
+    EXPECT_FALSE(blueprint::mesh::topology::unstructured::verify(topo, info));
+}
@@ -15,6 +15,8 @@
 #include "conduit_log.hpp"
 
 #include <algorithm>
+#include <limits>
+#include <map>
 #include <set>
 #include <vector>
 #include <string>
@@ -394,6 +396,127 @@ TEST(conduit_blueprint_mesh_transform, topology_transform_dtypes)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, topology_transform_implicit)
+{
+    const std::string braid_types[] = {"uniform", "rectilinear", "structured"};
+    const index_t braid_npts_z[] = {0, 5};
+    for(const std::string &braid_type : braid_types)
+    {
+        for(index_t npts_z : braid_npts_z)
+        {
+            std::cout << "Testing implicit connectivity " << braid_type
+                      << " (npts_z=" << npts_z << ")..." << std::endl;
+
+            Node mesh;
+            blueprint::mesh::examples::braid(braid_type, 20, 17, npts_z, mesh);
+            const Node &topo = mesh["topologies"].child(0);
+
+            Node &xtopo = mesh["topologies/test"];
+            Node &xcoords = mesh["coordsets/test"];
+            Node opts;
+            opts["index_dtype"] = "int64";
+            if(braid_type == "uniform")
+            {
+                blueprint::mesh::topology::uniform::to_unstructured(topo, xtopo, xcoords, opts);
+            }
+            else if(braid_type == "rectilinear")
+            {
+                blueprint::mesh::topology::rectilinear::to_unstructured(topo, xtopo, xcoords, opts);
+            }
+            else
+            {
+                blueprint::mesh::topology::structured::to_unstructured(topo, xtopo, xcoords, opts);
+            }
+            EXPECT_EQ(xtopo["elements/connectivity"].dtype().id(), DataType::INT64_ID);
+
+            // the implicit view describes the generated topology
+            bputils::StructuredConnectivity sconn(topo);
+            EXPECT_EQ(sconn.shape().type, xtopo["elements/shape"].as_string());
+            EXPECT_EQ(sconn.number_of_points(),
+                      blueprint::mesh::coordset::length(xcoords));
+            EXPECT_EQ(sconn.number_of_elements() * sconn.indices_per_element(),
+                      xtopo["elements/connectivity"].dtype().number_of_elements());
+
+            // the requested index type must be able to hold all vertex ids
+            if(braid_type == "uniform")
+            {
+                mesh["topologies"].remove("test");
+                mesh["coordsets"].remove("test");
+                Node &ytopo = mesh["topologies/test"];
+                Node &ycoords = mesh["coordsets/test"];
+
+                opts["index_dtype"] = "uint8";
+                EXPECT_THROW(blueprint::mesh::topology::uniform::to_unstructured(
+                                 topo, ytopo, ycoords, opts),
+                             conduit::Error);
+
+                opts["index_dtype"] = "float64";
+                EXPECT_THROW(blueprint::mesh::topology::uniform::to_unstructured(
+                                 topo, ytopo, ycoords, opts),
+                             conduit::Error);
+            }
+        }
+    }
+
+    // the view and the conversion match hand written connectivity
+    // for a 3x3 point 2D mesh and a 3x2x2 point 3D mesh
+    const index_t small_dims[2][3] = {{3, 3, 0}, {3, 2, 2}};
+    const std::vector<int64> small_conns[2] = {
+        {0, 1, 4, 3,
+         1, 2, 5, 4,
+         3, 4, 7, 6,
+         4, 5, 8, 7},
+        {0, 1, 4, 3, 6, 7, 10, 9,
+         1, 2, 5, 4, 7, 8, 11, 10}};
+    for(index_t si = 0; si < 2; si++)
+    {
+        Node small;
+        Node &small_dims_node = small["coordsets/coords/dims"];
+        small["coordsets/coords/type"] = "uniform";
+        small_dims_node["i"] = small_dims[si][0];
+        small_dims_node["j"] = small_dims[si][1];
+        if(small_dims[si][2] > 0)
+        {
+            small_dims_node["k"] = small_dims[si][2];
+        }
+        small["topologies/mesh/type"] = "uniform";
+        small["topologies/mesh/coordset"] = "coords";
+        const Node &small_topo = small["topologies/mesh"];
+        const std::vector<int64> &expected = small_conns[si];
+
+        bputils::StructuredConnectivity sconn(small_topo);
+        const index_t nverts = sconn.indices_per_element();
+        EXPECT_EQ(sconn.number_of_elements() * nverts, (index_t)expected.size());
+        std::vector<index_t> ids((size_t)nverts);
+        for(index_t e = 0; e < sconn.number_of_elements(); e++)
+        {
+            sconn.element(e, ids.data());
+            for(index_t v = 0; v < nverts; v++)
+            {
+                EXPECT_EQ(ids[(size_t)v], expected[(size_t)(e * nverts + v)]);
+            }
+        }
+
+        Node xtopo, xcoords, opts;
+        opts["index_dtype"] = "int64";
+        blueprint::mesh::topology::uniform::to_unstructured(small_topo, xtopo, xcoords, opts);
+        const int64_array conn = xtopo["elements/connectivity"].value();
+        EXPECT_EQ(conn.number_of_elements(), (index_t)expected.size());
+        for(index_t ci = 0; ci < conn.number_of_elements(); ci++)
+        {
+            EXPECT_EQ(conn[ci], expected[(size_t)ci]);
+        }
+    }
+
+    // points topologies have no structured connectivity
+    Node mesh;
+    blueprint::mesh::examples::braid("points", 3, 3, 0, mesh);
+    EXPECT_THROW(bputils::StructuredConnectivity sconn(mesh["topologies"].child(0)),
+                 conduit::Error);
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_transform, polygonal_transforms)
 {
@@ -677,3 +800,134 @@ TEST(conduit_blueprint_mesh_transform, adjset_transform_dtypes)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, adjset_index_span)
+{
+    // compact index_t values are viewed in place
+    std::vector<index_t> idx_vals = {4, 2, 7};
+    Node n_idx;
+    n_idx.set_external(idx_vals);
+    bputils::IndexSpan idx_span(n_idx);
+    EXPECT_FALSE(idx_span.converted());
+    EXPECT_EQ(idx_span.data(), idx_vals.data());
+    EXPECT_EQ(idx_span.size(), 3);
+
+    // other integer types (and strided values) are converted once
+    std::vector<int32> i32_vals = {4, -1, 2, -1, 7, -1};
+    Node n_i32;
+    n_i32.set_external(DataType::int32(3, 0, 2 * sizeof(int32)), i32_vals.data());
+    bputils::IndexSpan i32_span(n_i32);
+    EXPECT_TRUE(i32_span.converted());
+    EXPECT_EQ(std::vector<index_t>(i32_span.begin(), i32_span.end()), idx_vals);
+
+    Node n_u8;
+    n_u8.set(DataType::uint8(3));
+    uint8_array u8_vals = n_u8.value();
+    u8_vals[0] = 4; u8_vals[1] = 2; u8_vals[2] = 7;
+    i32_span.set(n_u8);
+    EXPECT_EQ(i32_span[2], 7);
+    EXPECT_EQ(std::vector<index_t>(i32_span.begin(), i32_span.end()), idx_vals);
+
+    Node n_empty;
+    bputils::IndexSpan empty_span(n_empty);
+    EXPECT_TRUE(empty_span.empty());
+    EXPECT_EQ(empty_span.begin(), empty_span.end());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, adjset_sort_unique_pairs)
+{
+    // small (std::sort), radix sorted, negative, and too wide to pack inputs
+    const index_t num_pairs[4] = {100, 200000, 200000, 100000};
+    const index_t min_first[4] = {0, 0, -5000, std::numeric_limits<index_t>::min() / 2};
+    for(index_t ci = 0; ci < 4; ci++)
+    {
+        std::vector<std::pair<index_t, index_t>> pairs, expected;
+        uint64 state = 12345 + ci;
+        for(index_t pi = 0; pi < num_pairs[ci]; pi++)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const index_t first = min_first[ci] +
+                (index_t)((state >> 33) % (uint64)(num_pairs[ci] / 3 + 1)) *
+                ((ci == 3) ? (index_t)1 << 44 : 1);
+            const index_t second = (index_t)((state >> 17) % 27);
+            pairs.push_back(std::make_pair(first, second));
+        }
+        expected = pairs;
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        bputils::adjset::sort_unique_pairs(pairs);
+        EXPECT_EQ(pairs, expected);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, adjset_transform_large)
+{
+    // many shared entities with overlapping neighbor sets
+    Node adjset;
+    adjset["association"].set("vertex");
+    adjset["topology"].set("mesh");
+    const index_t num_groups = 12;
+    const index_t num_values = 8000;
+    uint64 state = 7;
+    std::map<index_t, std::set<index_t>> expected_neighbors;
+    for(index_t gi = 0; gi < num_groups; gi++)
+    {
+        Node &group = adjset["groups"]["group_" + std::to_string(gi)];
+        std::vector<int64> neighbors(1, gi % 5 + 1);
+        if(gi >= 5)
+        {
+            neighbors.push_back((gi + 2) % 5 + 6);
+        }
+        std::vector<int64> values((size_t)num_values);
+        for(int64 &value : values)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            value = (int64)((state >> 33) % (uint64)(4 * num_values));
+            expected_neighbors[value].insert(neighbors.begin(), neighbors.end());
+        }
+        group["neighbors"].set(neighbors);
+        group["values"].set(values);
+    }
+
+    Node maxshare, pairwise, info;
+    blueprint::mesh::adjset::to_maxshare(adjset, maxshare);
+    ASSERT_TRUE(blueprint::mesh::adjset::verify(maxshare, info));
+    ASSERT_TRUE(blueprint::mesh::adjset::is_maxshare(maxshare));
+
+    // each entity is in exactly one group, which has its neighbors
+    index_t num_entities = 0;
+    NodeConstIterator gitr = maxshare["groups"].children();
+    while(gitr.has_next())
+    {
+        const Node &group = gitr.next();
+        const bputils::IndexSpan neighbors(group["neighbors"]);
+        const bputils::IndexSpan values(group["values"]);
+        const std::set<index_t> group_neighbors(neighbors.begin(), neighbors.end());
+        for(const index_t &value : values)
+        {
+            EXPECT_EQ(expected_neighbors[value], group_neighbors);
+        }
+        num_entities += values.size();
+    }
+    EXPECT_EQ(num_entities, (index_t)expected_neighbors.size());
+
+    // pairwise groups hold each neighbor's values, group by group
+    blueprint::mesh::adjset::to_pairwise(adjset, pairwise);
+    ASSERT_TRUE(blueprint::mesh::adjset::is_pairwise(pairwise));
+    index_t num_pairwise_values = 0;
+    gitr = pairwise["groups"].children();
+    while(gitr.has_next())
+    {
+        num_pairwise_values += gitr.next()["values"].dtype().number_of_elements();
+    }
+    index_t expected_pairwise_values = 0;
+    for(index_t gi = 0; gi < num_groups; gi++)
+    {
+        expected_pairwise_values += num_values * ((gi >= 5) ? 2 : 1);
+    }
+    EXPECT_EQ(num_pairwise_values, expected_pairwise_values);
+}
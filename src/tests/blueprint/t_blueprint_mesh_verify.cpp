@@ -2458,6 +2458,62 @@ TEST(conduit_blueprint_mesh_verify, mesh_multi_domain)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_bool_only)
+{
+    blueprint::mesh::clear_verify_cache();
+
+    Node mesh, info;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+
+    mesh.set(1.0);
+    EXPECT_FALSE(blueprint::mesh::verify(mesh));
+    mesh.reset();
+
+    for(index_t d = 0; d < 4; d++)
+    {
+        std::string dom_name = "domain_" + std::to_string(d);
+        blueprint::mesh::examples::braid("quads",5,5,0,mesh[dom_name]);
+    }
+
+    // bool only results should match the full verify
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+    EXPECT_TRUE(blueprint::mesh::verify(mesh["domain_0"]));
+    // the second call uses cached results
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+
+    // structure changes invalidate cached results
+    Node &dom = mesh["domain_2"];
+    Node coordsets = dom["coordsets"];
+    dom.remove("coordsets");
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh));
+    EXPECT_FALSE(info["domain_2/valid"].as_string() == "true");
+    EXPECT_TRUE(info["domain_1/valid"].as_string() == "true");
+    dom["coordsets"].set(coordsets);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+
+    // as do changes to string leaves, such as references
+    dom["topologies/mesh/coordset"].set("bad_coords");
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh));
+    dom["topologies/mesh/coordset"].set("coords");
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+
+    // changing array values keeps the cached result
+    float64_array vals = dom["fields/braid/values"].value();
+    vals[0] = -1.0;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+
+    // the bool only path does not leave log messages disabled
+    EXPECT_TRUE(log::messages_enabled());
+
+    blueprint::mesh::clear_verify_cache();
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_verify, mesh_general)
 {
@@ -2707,6 +2763,57 @@ TEST(conduit_blueprint_mesh_verify, mesh_bad_spacing_name)
     blueprint::mesh::generate_index(n_test,"",1,n_idx);
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, generate_index_many_domains)
+{
+    // domains with repeated and differing structure
+    Node mesh;
+    for(index_t d = 0; d < 12; d++)
+    {
+        std::string dom_name = "domain_" + std::to_string(d);
+        Node &dom = mesh[dom_name];
+        if(d % 3 == 1)
+        {
+            blueprint::mesh::examples::braid("tris",4,4,0,dom);
+            dom["state/cycle"] = 10;
+        }
+        else
+        {
+            blueprint::mesh::examples::braid("quads",4,4,0,dom);
+            dom["state/cycle"] = (d < 6) ? 20 : 30;
+        }
+        dom["state/domain_id"] = d;
+        if(d == 7)
+        {
+            dom["fields/extra/association"] = "element";
+            dom["fields/extra/topology"] = "mesh";
+            dom["fields/extra/values"].set(DataType::float64(18));
+        }
+    }
+
+    // reference: merge the index of every domain in order
+    Node ref_idx;
+    NodeConstIterator itr = mesh.children();
+    while(itr.has_next())
+    {
+        Node dom_idx;
+        blueprint::mesh::generate_index_for_single_domain(itr.next(),
+                                                          "",
+                                                          dom_idx);
+        ref_idx.update(dom_idx);
+    }
+    ref_idx["state/number_of_domains"] = (index_t)12;
+
+    Node idx, info;
+    blueprint::mesh::generate_index(mesh,"",12,idx);
+    EXPECT_FALSE(idx.diff(ref_idx,info));
+    EXPECT_EQ(idx.child_names(), ref_idx.child_names());
+    EXPECT_EQ(idx["fields"].child_names(), ref_idx["fields"].child_names());
+    EXPECT_EQ(idx["state/cycle"].to_index_t(), 30);
+    EXPECT_TRUE(idx.has_path("fields/extra"));
+    EXPECT_EQ(idx["topologies/mesh/type"].as_string(), "unstructured");
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_verify, empty_mesh_vs_gen_index)
 {
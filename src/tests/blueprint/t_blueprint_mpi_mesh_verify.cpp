@@ -11,6 +11,7 @@
 #include "conduit.hpp"
 #include "conduit_blueprint.hpp"
 #include "conduit_blueprint_mpi.hpp"
+#include "conduit_relay_mpi.hpp"
 
 #include "conduit_fmt/conduit_fmt.h"
 
@@ -194,6 +195,26 @@ TEST(blueprint_mpi_smoke, multi_domain)
     // all ranks should have index data.
     EXPECT_TRUE(bp_index["mesh"].dtype().is_object());
 
+    // the index should match the union of all ranks' local indices
+    {
+        conduit::Node local_idx, gather_idx, ref_idx, diff_info;
+        conduit::blueprint::mesh::generate_index(mesh,
+                                                 "",
+                                                 num_domains,
+                                                 local_idx);
+        conduit::relay::mpi::all_gather_using_schema(local_idx,
+                                                     gather_idx,
+                                                     MPI_COMM_WORLD);
+        conduit::NodeConstIterator itr = gather_idx.children();
+        while(itr.has_next())
+        {
+            ref_idx.update(itr.next());
+        }
+        EXPECT_FALSE(bp_index["mesh"].diff(ref_idx,diff_info));
+        EXPECT_EQ(bp_index["mesh/state/number_of_domains"].to_index_t(),
+                  num_domains);
+    }
+
     conduit::Node domain_to_rank_map;
     conduit::blueprint::mpi::mesh::generate_domain_to_rank_map(mesh,domain_to_rank_map,MPI_COMM_WORLD);
 
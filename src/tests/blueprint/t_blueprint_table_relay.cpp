@@ -9,6 +9,9 @@
 //-----------------------------------------------------------------------------
 #include <algorithm>
 #include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -18,6 +21,7 @@
 #include <conduit_blueprint_table_examples.hpp>
 #include <conduit_relay_io.hpp>
 #include <conduit_relay_io_csv.hpp>
+#include <conduit_relay_io_table.hpp>
 
 #include "blueprint_test_helpers.hpp"
 
@@ -42,6 +46,77 @@ int cleanup_dir(const std::string &dirname)
     return 0;
 }
 
+//-----------------------------------------------------------------------------
+// Rewrites the footer of a conduit_table file. When swap_chunks is true the
+// raw and run length encoded chunks are byte swapped, so the file looks like
+// it was written on a machine with the other endianness.
+void rewrite_table_file(const std::string &filename,
+                        const std::function<void(Node&)> &modify_footer,
+                        bool swap_chunks)
+{
+    std::string contents;
+    {
+        std::ifstream fin(filename, std::ios::in | std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(fin),
+                        std::istreambuf_iterator<char>());
+    }
+    const std::size_t magic_bytes = 8;
+    uint64 footer_bytes = 0;
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        footer_bytes |= static_cast<uint64>(static_cast<uint8>(
+            contents[contents.size() - 2 * magic_bytes + i])) << (8 * i);
+    }
+    const std::size_t data_end = contents.size() - 2 * magic_bytes - footer_bytes;
+    Node footer;
+    footer.parse(contents.substr(data_end, footer_bytes), "json");
+
+    if(swap_chunks)
+    {
+        NodeIterator t_itr = footer["tables"].children();
+        while(t_itr.has_next())
+        {
+            NodeIterator c_itr = t_itr.next()["columns"].children();
+            while(c_itr.has_next())
+            {
+                const Node &col = c_itr.next();
+                const index_t ele_bytes = DataType::default_dtype(
+                    col["data_type"].as_string()).element_bytes();
+                const int64_accessor offsets = col["offsets"].as_int64_accessor();
+                const int64_accessor sizes = col["sizes"].as_int64_accessor();
+                const int64_accessor encodings = col["encodings"].as_int64_accessor();
+                for(index_t g = 0; g < offsets.number_of_elements(); g++)
+                {
+                    char *ptr = &contents[offsets[g]];
+                    char *end = ptr + sizes[g];
+                    while(ptr < end && encodings[g] != 2)
+                    {
+                        // skip the varint run length of rle chunks
+                        while(encodings[g] == 1 && (*ptr++ & 0x80) != 0);
+                        std::reverse(ptr, ptr + ele_bytes);
+                        ptr += ele_bytes;
+                    }
+                }
+            }
+        }
+        footer["endianness"] =
+            Endianness::machine_is_little_endian() ? "big" : "little";
+    }
+    modify_footer(footer);
+
+    const std::string footer_json = footer.to_string("json");
+    contents.resize(data_end);
+    contents += footer_json;
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        contents.push_back(static_cast<char>(
+            (static_cast<uint64>(footer_json.size()) >> (8 * i)) & 0xff));
+    }
+    contents += "CDTABLE1";
+    std::ofstream fout(filename, std::ios::out | std::ios::binary);
+    fout.write(contents.data(), contents.size());
+}
+
 TEST(t_blueprint_table_relay, read_write_csv)
 {
     const std::string filename = "t_blueprint_table_relay_read_write_csv.csv";
@@ -67,6 +142,118 @@ TEST(t_blueprint_table_relay, read_write_csv)
     table::compare_to_baseline(read_table, table);
 }
 
+TEST(t_blueprint_table_relay, read_write_csv_large)
+{
+    const std::string filename = "t_blueprint_table_relay_read_write_csv_large.csv";
+
+    // Enough rows for several parse and write blocks
+    const index_t nrows = 100003;
+    Node table;
+    Node &values = table["values"];
+    values["ids"].set(DataType::int32(nrows));
+    values["vals"].set(DataType::float64(nrows));
+    int32 *ids = values["ids"].value();
+    float64 *vals = values["vals"].value();
+    for(index_t i = 0; i < nrows; i++)
+    {
+        ids[i] = static_cast<int32>(i - 50000);
+        vals[i] = (i - 50000) * 0.001 + 1.0 / 3.0;
+    }
+
+    Node opts;
+    opts["precision"] = 17;
+    opts["use_float64"] = 1;
+    relay::io::write_csv(table, filename, opts);
+
+    Node read_table;
+    relay::io::read_csv(filename, opts, read_table);
+
+    // integer columns are inferred
+    ASSERT_TRUE(read_table["values/ids"].dtype().is_int64());
+    ASSERT_TRUE(read_table["values/vals"].dtype().is_float64());
+    ASSERT_EQ(nrows, read_table["values/ids"].dtype().number_of_elements());
+
+    const int64 *rids = read_table["values/ids"].value();
+    const float64 *rvals = read_table["values/vals"].value();
+    for(index_t i = 0; i < nrows; i++)
+    {
+        ASSERT_EQ(ids[i], rids[i]);
+        ASSERT_EQ(vals[i], rvals[i]);
+    }
+
+    // without type inference all columns are floating point
+    opts["infer_types"] = 0;
+    relay::io::read_csv(filename, opts, read_table);
+    EXPECT_TRUE(read_table["values/ids"].dtype().is_float64());
+}
+
+TEST(t_blueprint_table_relay, read_csv_types)
+{
+    const std::string filename = "t_blueprint_table_relay_read_csv_types.csv";
+
+    // No header, the second column looks like integers until row 2000
+    {
+        std::ofstream fout(filename);
+        for(int i = 0; i < 3000; i++)
+        {
+            fout << i << ",  " << i;
+            if(i == 2000) fout << ".5";
+            fout << " , -" << i << "e-2\r\n";
+            // blank lines are skipped
+            if(i == 10) fout << "\n";
+        }
+    }
+
+    Node opts, read_table;
+    relay::io::read_csv(filename, opts, read_table);
+
+    const Node &values = read_table["values"];
+    ASSERT_EQ(3, values.number_of_children());
+    EXPECT_TRUE(values[0].dtype().is_int64());
+    EXPECT_TRUE(values[1].dtype().is_float32());
+    EXPECT_TRUE(values[2].dtype().is_float32());
+    ASSERT_EQ(3000, values[0].dtype().number_of_elements());
+
+    const int64_array c0 = values[0].value();
+    const float32_array c1 = values[1].value();
+    const float32_array c2 = values[2].value();
+    EXPECT_EQ(2999, c0[2999]);
+    EXPECT_EQ(1999.0f, c1[1999]);
+    EXPECT_EQ(2000.5f, c1[2000]);
+    EXPECT_EQ(-12.34f, c2[1234]);
+
+    // The full int64 range is read as int64, values past it are floats
+    {
+        std::ofstream fout(filename);
+        fout << "id, big\n"
+             << "9223372036854775807, 1\n"
+             << "-9223372036854775808, 9223372036854775808\n"
+             << "+0000000000000000000042, -9223372036854775809\n";
+    }
+    relay::io::read_csv(filename, opts, read_table);
+    {
+        const Node &ids = read_table["values/id"];
+        ASSERT_TRUE(ids.dtype().is_int64());
+        const int64_array id_vals = ids.value();
+        EXPECT_EQ(std::numeric_limits<int64>::max(), id_vals[0]);
+        EXPECT_EQ(std::numeric_limits<int64>::min(), id_vals[1]);
+        EXPECT_EQ(42, id_vals[2]);
+        EXPECT_FALSE(read_table["values/big"].dtype().is_integer());
+    }
+
+    // Bad cells and rows are errors
+    {
+        std::ofstream fout(filename);
+        fout << "a, b\n1, 2\n3, x\n";
+    }
+    EXPECT_THROW(relay::io::read_csv(filename, opts, read_table), conduit::Error);
+    {
+        std::ofstream fout(filename);
+        fout << "a, b\n1, 2\n3, 4, 5\n";
+    }
+    EXPECT_THROW(relay::io::read_csv(filename, opts, read_table), conduit::Error);
+}
+
 TEST(t_blueprint_table_relay, read_write_relay)
 {
     const std::string filename = "t_blueprint_table_relay_read_write_relay.csv";
@@ -194,3 +381,213 @@ TEST(t_blueprint_table_relay, read_write_table_with_list_values)
 
     table::compare_to_baseline(read_table, table);
 }
+
+TEST(t_blueprint_table_relay, read_write_conduit_table)
+{
+    const std::string filename =
+        "t_blueprint_table_relay_read_write_conduit_table.conduit_table";
+
+    // Flatten a mesh into a collection of tables
+    Node mesh, table, opts;
+    blueprint::mesh::examples::braid("hexs", 11, 11, 11, mesh);
+    blueprint::mesh::flatten(mesh, opts, table);
+
+    // small row groups, so each column has several chunks
+    opts["row_group_rows"] = 97;
+    relay::io::save(table, filename, opts);
+
+    Node read_table, info;
+    relay::io::load(filename, read_table);
+    EXPECT_FALSE(table.diff(read_table, info)) << info.to_json();
+
+    // Uncompressed
+    opts["compression"] = "none";
+    relay::io::save(table, filename, opts);
+    relay::io::load(filename, read_table);
+    EXPECT_FALSE(table.diff(read_table, info)) << info.to_json();
+
+    // Table lists
+    Node table_list;
+    table_list.append().set_external(table["vertex_data"]);
+    table_list.append().set_external(table["element_data"]);
+    relay::io::write_table(table_list, filename, Node());
+    relay::io::read_table(filename, Node(), read_table);
+    ASSERT_TRUE(read_table.dtype().is_list());
+    table::compare_to_baseline(read_table, table_list);
+}
+
+TEST(t_blueprint_table_relay, read_conduit_table_columns_and_rows)
+{
+    const std::string filename =
+        "t_blueprint_table_relay_read_conduit_table_columns_and_rows.conduit_table";
+
+    const index_t nrows = 1000;
+    Node table;
+    Node &values = table["values"];
+    values["ids"].set(DataType::int64(nrows));
+    values["domain"].set(DataType::int32(nrows));
+    values["coords/x"].set(DataType::float64(nrows));
+    values["coords/y"].set(DataType::float64(nrows));
+    int64 *ids = values["ids"].value();
+    int32 *domain = values["domain"].value();
+    float64 *x = values["coords/x"].value();
+    float64 *y = values["coords/y"].value();
+    for(index_t i = 0; i < nrows; i++)
+    {
+        ids[i] = 1000000 + 3 * i;
+        domain[i] = static_cast<int32>(i / 400);
+        x[i] = 0.5 * i;
+        y[i] = -0.25 * i;
+    }
+
+    Node opts;
+    opts["row_group_rows"] = 128;
+    relay::io::write_table(table, filename, opts);
+
+    // Info describes the columns without reading them
+    Node info;
+    relay::io::read_table_info(filename, info);
+    const Node &t_info = info["tables"][0];
+    EXPECT_EQ(nrows, t_info["num_rows"].to_index_t());
+    EXPECT_EQ(8, t_info["num_row_groups"].to_index_t());
+    ASSERT_EQ(4, t_info["columns"].number_of_children());
+    EXPECT_EQ("coords/y", t_info["columns"][3]["name"].as_string());
+    EXPECT_EQ("int32", t_info["columns"][1]["dtype"].as_string());
+    // sequential ids and repeated domain ids are encoded compactly
+    EXPECT_LT(t_info["columns"][0]["stored_bytes"].to_int64(), 2 * nrows);
+    EXPECT_LT(t_info["columns"][1]["stored_bytes"].to_int64(), 100);
+    EXPECT_EQ(nrows * 8, t_info["columns"][2]["stored_bytes"].to_int64());
+
+    // Read a subset of the columns and rows, across row groups
+    Node read_opts, read_table;
+    read_opts["columns"].append() = "ids";
+    read_opts["columns"].append() = "coords/y";
+    read_opts["rows/offset"] = 100;
+    read_opts["rows/count"] = 300;
+    relay::io::read_table(filename, read_opts, read_table);
+
+    const Node &read_values = read_table["values"];
+    ASSERT_EQ(2, read_values.number_of_children());
+    ASSERT_FALSE(read_values.has_child("domain"));
+    ASSERT_FALSE(read_values.has_path("coords/x"));
+    ASSERT_EQ(300, read_values["ids"].dtype().number_of_elements());
+    const int64 *read_ids = read_values["ids"].value();
+    const float64 *read_y = read_values["coords/y"].value();
+    for(index_t i = 0; i < 300; i++)
+    {
+        EXPECT_EQ(ids[100 + i], read_ids[i]);
+        EXPECT_EQ(y[100 + i], read_y[i]);
+    }
+
+    // Selecting an mcarray reads all of its components, row counts are
+    // clamped to the table
+    read_opts.reset();
+    read_opts["columns"] = "coords";
+    read_opts["rows/offset"] = 900;
+    read_opts["rows/count"] = 500;
+    relay::io::read_table(filename, read_opts, read_table);
+    ASSERT_EQ(1, read_table["values"].number_of_children());
+    ASSERT_EQ(100, read_table["values/coords/x"].dtype().number_of_elements());
+    EXPECT_EQ(x[999], read_table["values/coords/x"].as_float64_ptr()[99]);
+
+    // Not a table file
+    const std::string csv_filename =
+        "t_blueprint_table_relay_read_conduit_table_columns_and_rows.csv";
+    relay::io::write_csv(table, csv_filename, Node());
+    EXPECT_THROW(relay::io::read_table(csv_filename, Node(), read_table),
+                 conduit::Error);
+}
+
+TEST(t_blueprint_table_relay, read_conduit_table_other_endianness)
+{
+    const std::string filename =
+        "t_blueprint_table_relay_read_conduit_table_other_endianness.conduit_table";
+
+    // columns that use each encoding
+    const index_t nrows = 500;
+    Node table;
+    Node &values = table["values"];
+    values["ramp"].set(DataType::int64(nrows));
+    values["constant"].set(DataType::int32(nrows));
+    values["small"].set(DataType::uint16(nrows));
+    values["noise"].set(DataType::float64(nrows));
+    int64 *ramp = values["ramp"].value();
+    int32 *constant = values["constant"].value();
+    uint16 *small = values["small"].value();
+    float64 *noise = values["noise"].value();
+    for(index_t i = 0; i < nrows; i++)
+    {
+        ramp[i] = -7 * i;
+        constant[i] = i < 250 ? 3 : 70000;
+        small[i] = static_cast<uint16>(i % 300);
+        noise[i] = 1.0 / (1 + i);
+    }
+
+    Node opts;
+    opts["row_group_rows"] = 64;
+    relay::io::write_table(table, filename, opts);
+    rewrite_table_file(filename, [](Node &){}, true);
+
+    Node read_table, info;
+    relay::io::read_table(filename, Node(), read_table);
+    EXPECT_FALSE(table.diff(read_table, info));
+
+    // partial row groups are swapped too
+    Node read_opts;
+    read_opts["rows/offset"] = 30;
+    read_opts["rows/count"] = 100;
+    relay::io::read_table(filename, read_opts, read_table);
+    EXPECT_EQ(ramp[30], read_table["values/ramp"].as_int64_ptr()[0]);
+    EXPECT_EQ(constant[129], read_table["values/constant"].as_int32_ptr()[99]);
+    EXPECT_EQ(small[31], read_table["values/small"].as_uint16_ptr()[1]);
+    EXPECT_EQ(noise[40], read_table["values/noise"].as_float64_ptr()[10]);
+}
+
+TEST(t_blueprint_table_relay, read_conduit_table_corrupt_footer)
+{
+    const std::string filename =
+        "t_blueprint_table_relay_read_conduit_table_corrupt_footer.conduit_table";
+
+    Node table;
+    table["values/a"].set(DataType::int64(100));
+    table["values/b"].set(DataType::float32(100));
+
+    std::vector<std::function<void(Node&)>> corruptions;
+    corruptions.push_back([](Node &f) { f["tables"][0]["row_group_rows"] = 0; });
+    corruptions.push_back([](Node &f) { f["tables"][0]["num_rows"] = -5; });
+    corruptions.push_back([](Node &f)
+    {
+        // fewer chunks than row groups
+        Node &offsets = f["tables"][0]["columns"][0]["offsets"];
+        offsets.reset();
+        offsets.set_int64(8);
+    });
+    corruptions.push_back([](Node &f)
+    {
+        f["tables"][0]["columns"][1]["sizes"].as_int64_ptr()[0] = -1;
+    });
+    corruptions.push_back([](Node &f)
+    {
+        f["tables"][0]["columns"][1]["sizes"].as_int64_ptr()[1] = 1LL << 40;
+    });
+    corruptions.push_back([](Node &f)
+    {
+        f["tables"][0]["columns"][0]["encodings"].as_int64_ptr()[0] = 9;
+    });
+    corruptions.push_back([](Node &f)
+    {
+        f["tables"][0]["columns"][0]["data_type"] = "not_a_type";
+    });
+
+    Node opts, read_table;
+    opts["row_group_rows"] = 16;
+    for(std::size_t i = 0; i < corruptions.size(); i++)
+    {
+        relay::io::write_table(table, filename, opts);
+        relay::io::read_table(filename, Node(), read_table);
+        rewrite_table_file(filename, corruptions[i], false);
+        SCOPED_TRACE("corruption " + std::to_string(i));
+        EXPECT_THROW(relay::io::read_table(filename, Node(), read_table),
+                     conduit::Error);
+    }
+}
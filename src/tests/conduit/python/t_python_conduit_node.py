@@ -11,6 +11,7 @@ import sys
 import unittest
 
 from conduit import Node
+from conduit import DataType
 
 import numpy as np
 
@@ -536,6 +537,162 @@ class Test_Conduit_Node(unittest.TestCase):
         n['vs_expected'] = np.array(v[:,0,0],np.float64)
 
 
+    def test_set_external_nd(self):
+        n = Node()
+        # c contiguous n-d arrays become a leaf with an n-d shape
+        v = np.arange(24, dtype=np.int32).reshape((2, 3, 4))
+        n.set_external(v)
+        self.assertEqual(n.dtype().number_of_elements(), 24)
+        self.assertEqual(n.dtype().shape(), (2, 3, 4))
+        v[1, 2, 3] = -1
+        self.assertEqual(n.value()[1, 2, 3], -1)
+        # structured arrays become one strided leaf per field
+        rec = np.zeros(4, dtype=[('id', np.int32), ('val', np.float64)])
+        rec['id'] = [1, 2, 3, 4]
+        rec['val'] = [0.5, 1.5, 2.5, 3.5]
+        n.set_external(rec)
+        self.assertEqual(n.number_of_children(), 2)
+        self.assertTrue(np.all(n['val'] == rec['val']))
+        n['id'][0] = 10
+        self.assertEqual(rec['id'][0], 10)
+        # set copies structured arrays
+        n_copy = Node()
+        n_copy.set(rec)
+        rec['id'][0] = 20
+        self.assertEqual(n_copy['id'][0], 10)
+        # objects that support the buffer protocol
+        buf = bytearray(16)
+        n.set_external(memoryview(buf).cast('i'))
+        n.value()[1] = 7
+        self.assertEqual(buf[4], 7)
+        # the node holds the buffer export while it uses the memory,
+        # so resizable exporters can't move it
+        with self.assertRaises(BufferError):
+            buf.extend(b"more")
+        n.reset()
+        buf.extend(b"more")
+        self.assertEqual(len(buf), 20)
+        n['b'].set_external(buf)
+        with self.assertRaises(BufferError):
+            buf.extend(b"more")
+        n['b'][0] = 3
+        self.assertEqual(buf[0], 3)
+        n.remove(path='b')
+        buf.extend(b"more")
+        self.assertEqual(len(buf), 24)
+        # read only buffers are rejected
+        with self.assertRaises(TypeError):
+            n.set_external(b"read only")
+
+    def test_ndarray_view(self):
+        n = Node()
+        n['vals'] = np.arange(12, dtype=np.float64)
+        v = n.fetch('vals').ndarray_view(shape=(3, 4))
+        self.assertEqual(v.shape, (3, 4))
+        v[1, 1] = -1.0
+        self.assertEqual(n['vals'][5], -1.0)
+        with self.assertRaises(ValueError):
+            n.fetch('vals').ndarray_view(shape=(5, 5))
+        # interleaved mcarray -> 2d view
+        xyz = np.zeros((5, 3))
+        m = Node()
+        for i, c in enumerate(['x', 'y', 'z']):
+            m[c].set_external(xyz[:, i])
+        mv = m.ndarray_view()
+        self.assertEqual(mv.shape, (5, 3))
+        self.assertTrue(np.shares_memory(mv, xyz))
+        mv[:, 2] = 3.0
+        self.assertTrue(np.all(m['z'] == 3.0))
+        # mixed types -> structured view
+        rec = np.zeros(3, dtype=[('id', np.int32), ('val', np.float64)])
+        s = Node()
+        s.set_external(rec)
+        sv = s.ndarray_view()
+        self.assertEqual(sv.dtype.names, ('id', 'val'))
+        sv['val'][2] = 4.0
+        self.assertEqual(rec['val'][2], 4.0)
+        # non numeric children can't be viewed
+        bad = Node()
+        bad['a'] = 1.0
+        bad['b'] = "string"
+        with self.assertRaises(TypeError):
+            bad.ndarray_view()
+
+    def test_buffer_protocol(self):
+        n = Node()
+        n['vals'] = np.arange(10, dtype=np.int64)
+        mv = memoryview(n.fetch('vals'))
+        self.assertEqual(mv.format, 'q')
+        self.assertEqual(mv.shape, (10,))
+        self.assertFalse(mv.readonly)
+        self.assertEqual(mv[3], 3)
+        mv[3] = 30
+        self.assertEqual(n['vals'][3], 30)
+        # strided leaves
+        v = np.arange(10, dtype=np.float32)
+        n['strided'].set_external(v[::2])
+        a = np.asarray(n.fetch('strided'))
+        self.assertTrue(np.all(a == v[::2]))
+        self.assertTrue(np.shares_memory(a, v))
+        # contiguous only consumers get an error for strided data
+        self.assertFalse(memoryview(n.fetch('strided')).c_contiguous)
+        with self.assertRaises(BufferError):
+            np.frombuffer(n.fetch('strided'), dtype=np.float32)
+        # separately allocated children can't be viewed as one array
+        m = Node()
+        m['x'] = np.arange(4, dtype=np.float64)
+        m['y'] = np.arange(4, dtype=np.float64)
+        with self.assertRaises(BufferError):
+            memoryview(m)
+        with self.assertRaises(TypeError):
+            m.ndarray_view()
+        # contiguous children in one compact buffer
+        mc = Node()
+        m.compact_to(mc)
+        a = np.asarray(mc)
+        self.assertEqual(a.shape, (4, 2))
+        self.assertTrue(np.all(a[:, 1] == np.arange(4)))
+        # interleaved mcarray
+        xy = np.arange(8, dtype=np.float64).reshape((4, 2))
+        mi = Node()
+        mi['x'].set_external(xy[:, 0])
+        mi['y'].set_external(xy[:, 1])
+        a = np.asarray(mi)
+        self.assertEqual(a.shape, (4, 2))
+        self.assertTrue(np.shares_memory(a, xy))
+        self.assertTrue(np.all(a == xy))
+        with self.assertRaises(BufferError):
+            memoryview(Node())
+
+    def test_nd_shape(self):
+        n = Node()
+        v = np.arange(12, dtype=np.float64).reshape((3, 4))
+        # set copies the shape
+        n['copy'] = v
+        self.assertEqual(n['copy'].shape, (3, 4))
+        self.assertTrue(np.all(n['copy'] == v))
+        self.assertEqual(n.fetch('copy').dtype().shape(), (3, 4))
+        # views, the buffer protocol and numpy conversions use the shape
+        self.assertEqual(n.fetch('copy').ndarray_view().shape, (3, 4))
+        self.assertEqual(memoryview(n.fetch('copy')).shape, (3, 4))
+        self.assertEqual(np.asarray(n.fetch('copy')).shape, (3, 4))
+        # an explicit shape overrides the leaf shape
+        self.assertEqual(n.fetch('copy').ndarray_view(shape=(12,)).shape,
+                         (12,))
+        # the shape survives schema json round trips
+        n_gen = Node()
+        n_gen.parse(n.to_json("conduit_json"), "conduit_json")
+        self.assertEqual(n_gen['copy'].shape, (3, 4))
+        # shape on datatypes
+        dt = DataType.float64(6)
+        self.assertFalse(dt.has_shape())
+        self.assertEqual(dt.shape(), (6,))
+        dt.set_shape((2, 3))
+        self.assertTrue(dt.has_shape())
+        self.assertEqual(dt.shape(), (2, 3))
+        with self.assertRaises(ValueError):
+            dt.set_shape((4, 4))
+
     def test_describe(self):
         n = Node()
         n["a"] = [1,2,3,4,5];
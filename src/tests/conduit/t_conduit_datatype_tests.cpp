@@ -737,3 +737,84 @@ TEST(dtype_tests,dtype_comparison_checks)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(dtype_tests,dtype_shape)
+{
+    DataType dt = DataType::float64(12);
+    EXPECT_FALSE(dt.has_shape());
+    EXPECT_EQ(dt.number_of_dimensions(),1);
+    EXPECT_EQ(dt.dimension(0),12);
+
+    index_t shape[3] = {2,3,2};
+    dt.set_shape(shape,3);
+    EXPECT_TRUE(dt.has_shape());
+    EXPECT_EQ(dt.number_of_dimensions(),3);
+    EXPECT_EQ(dt.dimension(1),3);
+    EXPECT_EQ(dt.dimension_stride(0),48);
+    EXPECT_EQ(dt.dimension_stride(1),16);
+    EXPECT_EQ(dt.dimension_stride(2),8);
+
+    // shape must match the number of elements
+    index_t bad_shape[2] = {5,3};
+    EXPECT_THROW(dt.set_shape(bad_shape,2),conduit::Error);
+    EXPECT_THROW(dt.dimension(3),conduit::Error);
+
+    // a shape whose element count overflows index_t is rejected, even
+    // when the wrapped count would match
+    DataType dt_empty = DataType::float64(0);
+    index_t huge_shape[2] = {((index_t)1) << 62, 4};
+    EXPECT_THROW(dt_empty.set_shape(huge_shape,2),conduit::Error);
+    EXPECT_FALSE(dt_empty.has_shape());
+
+    // shape entries in json schemas must be non-negative integers
+    EXPECT_THROW(Schema("{\"dtype\":\"float64\", \"number_of_elements\": 4,"
+                        " \"shape\": [-2, -2]}"),
+                 conduit::Error);
+    EXPECT_THROW(Schema("{\"dtype\":\"float64\", \"number_of_elements\": 4,"
+                        " \"shape\": [2.5, 2]}"),
+                 conduit::Error);
+
+    // copies, compaction and comparisons keep the shape
+    DataType dt_copy(dt);
+    EXPECT_TRUE(dt_copy.equals(dt));
+    DataType dt_compact;
+    DataType dt_strided(dt);
+    dt_strided.set_stride(16);
+    dt_strided.compact_to(dt_compact);
+    EXPECT_EQ(dt_compact.shape(),dt.shape());
+    EXPECT_EQ(dt_compact.stride(),8);
+
+    DataType dt_flat = DataType::float64(12);
+    EXPECT_FALSE(dt_flat.equals(dt));
+
+    // changing the number of elements drops the shape
+    dt_copy.set_number_of_elements(4);
+    EXPECT_FALSE(dt_copy.has_shape());
+
+    // json round trip
+    Schema s(dt);
+    std::string json = s.to_json();
+    EXPECT_TRUE(json.find("\"shape\": [2, 3, 2]") != std::string::npos);
+    Schema s_parsed(json);
+    EXPECT_EQ(s_parsed.dtype().shape(),dt.shape());
+    EXPECT_EQ(s_parsed.dtype().number_of_elements(),12);
+
+    // yaml output
+    std::string yaml = dt.to_yaml();
+    EXPECT_TRUE(yaml.find("shape: [2, 3, 2]") != std::string::npos);
+
+    // the shape is kept when nodes are copied and serialized
+    Node n(dt);
+    Node n_copy;
+    n_copy.set(n);
+    EXPECT_EQ(n_copy.dtype().shape(),dt.shape());
+
+    std::string gen_json = n.to_json("conduit_json");
+    Node n_gen;
+    Generator g(gen_json,"conduit_json");
+    g.walk(n_gen);
+    EXPECT_EQ(n_gen.dtype().shape(),dt.shape());
+    Node n_info;
+    EXPECT_FALSE(n.diff(n_gen,n_info));
+}
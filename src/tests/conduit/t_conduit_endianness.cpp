@@ -10,7 +10,9 @@
 
 #include "conduit.hpp"
 
+#include <cstring>
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -462,3 +464,152 @@ TEST(conduit_endianness, node_swap_using_explicit_funcs)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, swap_arrays)
+{
+    // odd sizes exercise both the vector and remainder loops
+    const index_t num_ele = 37;
+    std::vector<uint16> v16(num_ele);
+    std::vector<uint32> v32(num_ele);
+    std::vector<uint64> v64(num_ele);
+
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        v16[i] = (uint16)(0x0102 + i);
+        v32[i] = (uint32)(0x01020304 + i);
+        v64[i] = (uint64)(0x0102030405060708ULL + i);
+    }
+
+    std::vector<uint16> v16_exp(v16);
+    std::vector<uint32> v32_exp(v32);
+    std::vector<uint64> v64_exp(v64);
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        Endianness::swap16(&v16_exp[i]);
+        Endianness::swap32(&v32_exp[i]);
+        Endianness::swap64(&v64_exp[i]);
+    }
+
+    // fused copy + swap
+    std::vector<uint16> v16_res(num_ele);
+    std::vector<uint32> v32_res(num_ele);
+    std::vector<uint64> v64_res(num_ele);
+    Endianness::copy_and_swap(&v16[0],&v16_res[0],num_ele,2);
+    Endianness::copy_and_swap(&v32[0],&v32_res[0],num_ele,4);
+    Endianness::copy_and_swap(&v64[0],&v64_res[0],num_ele,8);
+    EXPECT_EQ(v16_res,v16_exp);
+    EXPECT_EQ(v32_res,v32_exp);
+    EXPECT_EQ(v64_res,v64_exp);
+
+    // in place
+    Endianness::swap(&v16[0],num_ele,2);
+    Endianness::swap(&v32[0],num_ele,4);
+    Endianness::swap(&v64[0],num_ele,8);
+    EXPECT_EQ(v16,v16_exp);
+    EXPECT_EQ(v32,v32_exp);
+    EXPECT_EQ(v64,v64_exp);
+
+    // strided: swap every other element
+    std::vector<uint32> v32_strided(v32_exp);
+    Endianness::swap(&v32_strided[0],(num_ele+1)/2,4,8);
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        if(i % 2 == 0)
+        {
+            EXPECT_EQ(v32_strided[i],(uint32)(0x01020304 + i));
+        }
+        else
+        {
+            EXPECT_EQ(v32_strided[i],v32_exp[i]);
+        }
+    }
+
+    // strided to compact
+    std::vector<uint32> v32_compact((num_ele+1)/2);
+    Endianness::copy_and_swap(&v32_exp[0],&v32_compact[0],
+                              (num_ele+1)/2,4,8,4);
+    for(size_t i = 0; i < v32_compact.size(); i++)
+    {
+        EXPECT_EQ(v32_compact[i],(uint32)(0x01020304 + 2*i));
+    }
+
+    EXPECT_THROW(Endianness::swap(&v32[0],num_ele,3),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, swap_large_array)
+{
+    // spans several parallel blocks
+    index_t num_ele = execution::DEFAULT_BLOCK_BYTES / 8 * 3 + 5;
+    Node n;
+    n.set(DataType::float64(num_ele));
+    float64_array vals = n.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        vals[i] = (float64) i;
+    }
+
+    Node n_orig;
+    n_orig.set(n);
+
+    n.endian_swap_to_big();
+    EXPECT_EQ(n.dtype().endianness(),(index_t)Endianness::BIG_ID);
+
+    // fused copy + swap produces the same bytes as the in place swap
+    Node n_big;
+    n_orig.compact_to(n_big,Endianness::BIG_ID);
+    EXPECT_EQ(n_big.dtype().endianness(),(index_t)Endianness::BIG_ID);
+    EXPECT_EQ(memcmp(n_big.data_ptr(),n.data_ptr(),(size_t)(num_ele*8)),0);
+
+    uint64 v_orig = 0;
+    memcpy(&v_orig,n_orig.element_ptr(7),8);
+    uint64 v_swap = 0;
+    memcpy(&v_swap,n.element_ptr(7),8);
+    Endianness::swap64(&v_swap);
+    EXPECT_EQ(v_orig,v_swap);
+
+    n.endian_swap_to_machine_default();
+    EXPECT_TRUE(n.equals(n_orig,0.0));
+
+    Node n_back;
+    n_big.compact_to(n_back,Endianness::DEFAULT_ID);
+    EXPECT_EQ(n_back.dtype().endianness(),Endianness::machine_default());
+    EXPECT_EQ(memcmp(n_back.data_ptr(),n_orig.data_ptr(),(size_t)(num_ele*8)),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, compact_to_endianness)
+{
+    Node n;
+    n["a"].set(DataType::int32(4));
+    n["b/c"] = "a string";
+    std::vector<uint16> strided(8);
+    for(size_t i = 0; i < strided.size(); i++)
+    {
+        strided[i] = (uint16)(0x0102 + i);
+    }
+    n["b/d"].set_external(DataType::uint16(4,0,4),&strided[0]);
+    int32_array a_vals = n["a"].value();
+    a_vals.fill(0x01020304);
+
+    Node n_big;
+    n.compact_to(n_big,Endianness::BIG_ID);
+    n_big.print();
+    EXPECT_TRUE(n_big.is_compact());
+    EXPECT_EQ(n_big["a"].dtype().endianness(),(index_t)Endianness::BIG_ID);
+    EXPECT_EQ(n_big["b/c"].as_string(),"a string");
+
+    // swapping a copy of n in place gives the same result
+    Node n_swapped;
+    n.compact_to(n_swapped);
+    n_swapped.endian_swap_to_big();
+    EXPECT_EQ(memcmp(n_big.data_ptr(),
+                     n_swapped.data_ptr(),
+                     (size_t)n_big.total_bytes_compact()),0);
+
+    // and back
+    Node n_back;
+    n_big.compact_to(n_back,Endianness::DEFAULT_ID);
+    EXPECT_TRUE(n_back.equals(n));
+}
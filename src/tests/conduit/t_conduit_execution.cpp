@@ -0,0 +1,88 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_execution.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, about)
+{
+    Node n;
+    conduit::about(n);
+    n.print();
+
+    if(execution::openmp_enabled())
+    {
+        EXPECT_EQ(n["openmp"].as_string(),"enabled");
+        EXPECT_TRUE(execution::num_threads() >= 1);
+    }
+    else
+    {
+        EXPECT_EQ(n["openmp"].as_string(),"disabled");
+        EXPECT_EQ(execution::num_threads(),1);
+    }
+
+    EXPECT_FALSE(execution::in_parallel());
+    EXPECT_EQ(execution::thread_id(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, for_all)
+{
+    std::vector<index_t> vals(1000,0);
+
+    execution::for_all(0, 1000, [&](index_t i)
+    {
+        vals[(size_t)i] = i * 2;
+    });
+
+    for(index_t i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(vals[(size_t)i], i * 2);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, for_all_blocks)
+{
+    std::vector<index_t> vals(1003,0);
+
+    execution::for_all_blocks(1003, 10, [&](index_t b_begin, index_t b_end)
+    {
+        EXPECT_TRUE(b_end - b_begin <= 10);
+        for(index_t i = b_begin; i < b_end; i++)
+        {
+            vals[(size_t)i] += 1;
+        }
+    });
+
+    for(index_t i = 0; i < 1003; i++)
+    {
+        EXPECT_EQ(vals[(size_t)i], 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, for_all_error)
+{
+    EXPECT_THROW(execution::for_all(0, 100, [&](index_t i)
+                 {
+                     if(i == 50)
+                     {
+                         CONDUIT_ERROR("error at index " << i);
+                     }
+                 }),
+                 conduit::Error);
+}
@@ -0,0 +1,186 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_layout_plan.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+void
+create_strided_tree(Node &n, float64 offset)
+{
+    n.reset();
+    n["a"].set(DataType::int32(5));
+    int32_array a_vals = n["a"].value();
+    for(index_t i = 0; i < 5; i++)
+    {
+        a_vals[i] = (int32)(i + offset);
+    }
+
+    // interleaved x,y values, described with strided leaves
+    std::vector<float64> xy(20);
+    for(size_t i = 0; i < 10; i++)
+    {
+        xy[2*i]   = i + offset;
+        xy[2*i+1] = -(i + offset);
+    }
+    n["b/x"].set(DataType::float64(10,0,16), &xy[0]);
+    n["b/y"].set(DataType::float64(10,8,16), &xy[0]);
+    n["b/empty"];
+    n["c"] = "my string";
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_layout_plan, compact_matches_node_compact)
+{
+    Node n;
+    create_strided_tree(n, 0.0);
+
+    LayoutPlan plan(n.schema());
+    EXPECT_EQ(plan.number_of_leaves(), 4);
+    EXPECT_EQ(plan.total_bytes_compact(), n.total_bytes_compact());
+    EXPECT_TRUE(plan.compact_schema().is_compact());
+
+    Node n_compact, info;
+    plan.compact_to(n, n_compact);
+    EXPECT_TRUE(n_compact.is_compact());
+    EXPECT_FALSE(n.diff(n_compact, info));
+
+    float64_array y_vals = n_compact["b/y"].value();
+    EXPECT_EQ(y_vals[3], -3.0);
+    EXPECT_EQ(n_compact["c"].as_string(), "my string");
+
+    // raw buffer variant
+    std::vector<uint8> buff((size_t)plan.total_bytes_compact());
+    plan.compact(n, &buff[0]);
+
+    std::vector<uint8> ser;
+    n.serialize(ser);
+    EXPECT_EQ(buff, ser);
+
+    Node n_ser(plan.compact_schema(), &buff[0], true);
+    EXPECT_FALSE(n.diff(n_ser, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_layout_plan, reuse)
+{
+    Node n_a, n_b;
+    create_strided_tree(n_a, 0.0);
+    create_strided_tree(n_b, 10.0);
+
+    LayoutPlan plan(n_a.schema());
+    EXPECT_TRUE(plan.compatible(n_b.schema()));
+
+    Node n_res, info;
+    for(int i = 0; i < 3; i++)
+    {
+        plan.compact_to(n_a, n_res);
+        EXPECT_FALSE(n_a.diff(n_res, info));
+        plan.compact_to(n_b, n_res);
+        EXPECT_FALSE(n_b.diff(n_res, info));
+    }
+
+    // changing the shape breaks compatibility
+    n_b["a"].set(DataType::int32(6));
+    EXPECT_FALSE(plan.compatible(n_b.schema()));
+    EXPECT_THROW(plan.compact_to(n_b, n_res), conduit::Error);
+
+    n_b.remove("a");
+    EXPECT_FALSE(plan.compatible(n_b.schema()));
+    EXPECT_THROW(plan.compact_to(n_b, n_res), conduit::Error);
+
+    // same shape and stride, but a different dtype
+    n_b["a"].set(DataType::float32(5));
+    EXPECT_FALSE(plan.compatible(n_b.schema()));
+    EXPECT_THROW(plan.compact_to(n_b, n_res), conduit::Error);
+
+    n_b["a"].set(DataType::int32(5));
+    n_b["d"] = 42;
+    EXPECT_FALSE(plan.compatible(n_b.schema()));
+    EXPECT_THROW(plan.compact_to(n_b, n_res), conduit::Error);
+
+    plan.set(n_b.schema());
+    EXPECT_TRUE(plan.compatible(n_b.schema()));
+    plan.compact_to(n_b, n_res);
+    EXPECT_FALSE(n_b.diff(n_res, info));
+
+    plan.reset();
+    EXPECT_EQ(plan.number_of_leaves(), 0);
+    EXPECT_EQ(plan.total_bytes_compact(), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_layout_plan, compact_from_raw_buffer)
+{
+    // schema with interleaved leaves in a single buffer
+    Schema s;
+    s["x"].set(DataType::int64(100,0,16));
+    s["y"].set(DataType::int64(100,8,16));
+
+    std::vector<int64> vals(200);
+    for(size_t i = 0; i < 200; i++)
+    {
+        vals[i] = (int64)i;
+    }
+
+    LayoutPlan plan(s);
+    std::vector<int64> res(200, -1);
+    plan.compact(&vals[0], &res[0]);
+
+    for(size_t i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(res[i], (int64)(2*i));
+        EXPECT_EQ(res[100+i], (int64)(2*i+1));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_layout_plan, large_leaves)
+{
+    // large enough to be split into several blocks
+    index_t num_vals = 3 * execution::DEFAULT_BLOCK_BYTES / 8 + 17;
+
+    Node n;
+    n["big"].set(DataType::float64(num_vals, 0, 16));
+    n["small"] = (int8) 3;
+
+    float64_array big_vals = n["big"].value();
+    for(index_t i = 0; i < num_vals; i++)
+    {
+        big_vals[i] = (float64) i;
+    }
+
+    Node n_compact, info;
+    n.compact_to(n_compact);
+    EXPECT_TRUE(n_compact.is_compact());
+    EXPECT_FALSE(n.diff(n_compact, info));
+
+    float64_array res = n_compact["big"].value();
+    EXPECT_EQ(res[num_vals-1], (float64)(num_vals-1));
+    EXPECT_EQ(n_compact["small"].to_int(), 3);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_layout_plan, empty)
+{
+    LayoutPlan plan;
+    EXPECT_EQ(plan.number_of_leaves(), 0);
+
+    Node n, n_res;
+    plan.set(n.schema());
+    EXPECT_TRUE(plan.compatible(n.schema()));
+    plan.compact_to(n, n_res);
+    EXPECT_TRUE(n_res.dtype().is_empty());
+}
@@ -251,3 +251,73 @@ TEST(conduit_memory_allocator, test_strange)
     EXPECT_EQ(buff[1],0);
     EXPECT_EQ(buff[2],1);
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_steal_with_custom_allocator)
+{
+    // earlier tests install custom handlers, use the defaults so
+    // copied values can be checked
+    conduit::utils::set_memcpy_handler(conduit::utils::default_memcpy_handler);
+    conduit::utils::set_memset_handler(conduit::utils::default_memset_handler);
+
+    int allocator_id
+     = conduit::utils::register_allocator(TestAllocator::banana_alloc,
+                                          TestAllocator::free_bananas);
+
+    size_t alloc_count = TestAllocator::m_alloc_count;
+    size_t free_count  = TestAllocator::m_free_count;
+
+    conduit::Node src;
+    src.set_allocator(allocator_id);
+    src["array"].set(conduit::DataType::float64(10));
+    src["array"].as_float64_ptr()[3] = 3.0;
+    EXPECT_EQ(TestAllocator::m_alloc_count,alloc_count + 1);
+
+    // steal transfers the buffer and its allocator id
+    conduit::Node dest;
+    dest.steal(src);
+    EXPECT_EQ(dest.allocator(),allocator_id);
+    EXPECT_EQ(TestAllocator::m_alloc_count,alloc_count + 1);
+    EXPECT_EQ(TestAllocator::m_free_count,free_count);
+    EXPECT_EQ(dest["array"].as_float64_ptr()[3],3.0);
+
+    // move assign into a node w/ a different allocator copies
+    conduit::Node host;
+    host = std::move(dest);
+    EXPECT_EQ(host.allocator(),0);
+    EXPECT_EQ(TestAllocator::m_free_count,free_count + 1);
+    EXPECT_TRUE(dest.dtype().is_empty());
+    EXPECT_EQ(host["array"].as_float64_ptr()[3],3.0);
+
+    // move assign a child w/ a different allocator into its parent
+    conduit::Node parent;
+    parent["old"] = 10;
+    conduit::Node &child = parent["child"];
+    child.set_allocator(allocator_id);
+    child["array"].set(conduit::DataType::float64(10));
+    child["array"].as_float64_ptr()[3] = 3.0;
+    EXPECT_EQ(TestAllocator::m_alloc_count,alloc_count + 2);
+
+    parent = std::move(child);
+    EXPECT_EQ(parent.allocator(),0);
+    EXPECT_FALSE(parent.has_child("old"));
+    EXPECT_FALSE(parent.has_child("child"));
+    EXPECT_EQ(parent["array"].dtype().number_of_elements(),10);
+    EXPECT_EQ(parent["array"].as_float64_ptr()[3],3.0);
+    EXPECT_EQ(TestAllocator::m_free_count,free_count + 2);
+
+    // can't move assign an ancestor into a node w/ a different allocator
+    conduit::Node anc;
+    anc["a/b"] = 1;
+    anc["a"].set_allocator(allocator_id);
+    EXPECT_THROW(anc["a"] = std::move(anc),conduit::Error);
+
+    // adopt a buffer allocated with our allocator
+    void *data = conduit::utils::conduit_allocate(4,sizeof(conduit::int32),
+                                                  allocator_id);
+    conduit::Node adopted;
+    adopted.adopt(conduit::DataType::int32(4),data,allocator_id);
+    EXPECT_EQ(adopted.allocator(),allocator_id);
+    adopted.reset();
+    EXPECT_EQ(TestAllocator::m_free_count,free_count + 3);
+}
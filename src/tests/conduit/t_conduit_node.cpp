@@ -1315,9 +1315,118 @@ TEST(conduit_node, avoid_crazy_town)
     EXPECT_EQ(res,"\ncrazy_town: \"not here\"\n");
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node, move_and_swap)
+{
+    Node n;
+    n["a/b"].set(DataType::float64(5));
+    n["c"] = "here";
+    const void *b_ptr = n["a/b"].data_ptr();
+
+    Node n_copy(n);
+
+    // move ctor
+    Node n_moved(std::move(n));
+    EXPECT_TRUE(n.dtype().is_empty());
+    EXPECT_EQ(n_moved["a/b"].data_ptr(),b_ptr);
+    EXPECT_TRUE(n_moved.equals(n_copy));
+    EXPECT_EQ(n_moved["a/b"].parent(),&n_moved["a"]);
+    EXPECT_EQ(n_moved["a"].parent(),&n_moved);
+    EXPECT_EQ(n_moved["a/b"].path(),"a/b");
+
+    // move assign
+    Node n_other;
+    n_other = std::move(n_moved);
+    EXPECT_TRUE(n_moved.dtype().is_empty());
+    EXPECT_EQ(n_other["a/b"].data_ptr(),b_ptr);
+    EXPECT_TRUE(n_other.equals(n_copy));
+
+    // swap with a child in another tree
+    Node tree;
+    tree["x/y"] = 42;
+    tree["x"].swap(n_other);
+    EXPECT_EQ(n_other["y"].to_int(),42);
+    EXPECT_EQ(tree["x/a/b"].data_ptr(),b_ptr);
+    EXPECT_EQ(tree["x/a/b"].path(),"x/a/b");
+    EXPECT_EQ(tree["x/c"].as_string(),"here");
+    EXPECT_TRUE(tree["x"].equals(n_copy));
+    EXPECT_EQ(tree.schema().child("x").child("a").parent(),
+              &tree.schema().child("x"));
+    tree.print();
+
+    // swap back
+    n_other.swap(tree["x"]);
+    EXPECT_EQ(tree["x/y"].to_int(),42);
+    EXPECT_TRUE(n_other.equals(n_copy));
+
+    // can't swap with an ancestor or descendant
+    EXPECT_THROW(tree.swap(tree["x/y"]),conduit::Error);
+    EXPECT_THROW(tree["x/y"].swap(tree),conduit::Error);
+}
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node, steal)
+{
+    Node n;
+    n["a"].set(DataType::int32(10));
+    n["b"].append() = 1.0;
+    const void *a_ptr = n["a"].data_ptr();
+
+    Node n_copy(n);
+
+    Node res;
+    res["old"] = 10;
+    res.steal(n);
+    EXPECT_TRUE(n.dtype().is_empty());
+    EXPECT_FALSE(res.has_child("old"));
+    EXPECT_EQ(res["a"].data_ptr(),a_ptr);
+    EXPECT_TRUE(res.equals(n_copy));
+
+    // steal from a descendant
+    res["a"].steal(res["b"]);
+    EXPECT_TRUE(res["a"].dtype().is_list());
+    EXPECT_TRUE(res["b"].dtype().is_empty());
+
+    res.steal(res["a"]);
+    EXPECT_TRUE(res.dtype().is_list());
+    EXPECT_EQ(res[0].to_float64(),1.0);
+
+    // can't steal from an ancestor
+    Node other;
+    other["a/b"] = 1;
+    EXPECT_THROW(other["a/b"].steal(other),conduit::Error);
+}
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node, adopt)
+{
+    Schema s;
+    s["a"].set(DataType::float64(4,0));
+    s["b"].set(DataType::int64(2,4*sizeof(float64)));
 
+    index_t nbytes = s.total_bytes_compact();
+    void *data = utils::conduit_allocate((size_t)nbytes,1,0);
 
-
-
+    Node n;
+    n.adopt(s,data);
+    EXPECT_EQ(n.data_ptr(),data);
+    EXPECT_EQ(n["a"].data_ptr(),data);
+    EXPECT_EQ(n.total_bytes_allocated(),nbytes);
+
+    float64_array a_vals = n["a"].value();
+    a_vals.fill(2.0);
+    int64_array b_vals = n["b"].value();
+    b_vals.fill(3);
+    EXPECT_EQ(((float64*)data)[3],2.0);
+
+    // the buffer moves along with the contents
+    Node n_moved(std::move(n));
+    EXPECT_EQ(n_moved.total_bytes_allocated(),nbytes);
+    EXPECT_EQ(n.total_bytes_allocated(),0);
+
+    Node n_leaf;
+    float64 *vals = (float64*) utils::conduit_allocate(3,sizeof(float64),0);
+    n_leaf.adopt(DataType::float64(3),vals);
+    EXPECT_EQ(n_leaf.as_float64_ptr(),vals);
+    EXPECT_EQ(n_leaf.allocated_bytes(),3*sizeof(float64));
+}
@@ -463,6 +463,167 @@ TEST(conduit_node_compare, compare_list_size_diff)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, compare_equals)
+{
+    Node n_ref;
+    n_ref["a"].set_int32(10);
+    n_ref["b/c"].set_string("my string");
+    n_ref["b/d"].set(DataType::float64(100));
+    float64_array d_vals = n_ref["b/d"].value();
+    for(index_t i = 0; i < 100; i++)
+    {
+        d_vals[i] = i * 0.5;
+    }
+    n_ref["e"].append().set_int64(1);
+    n_ref["e"].append().set_int64(2);
+
+    // self + copy
+    EXPECT_TRUE(n_ref.equals(n_ref));
+    Node n_copy(n_ref);
+    EXPECT_TRUE(n_ref.equals(n_copy));
+    EXPECT_TRUE(n_ref.equals_compatible(n_copy));
+
+    // different leaf value
+    {
+        Node o(n_ref), info;
+        float64_array o_vals = o["b/d"].value();
+        o_vals[50] += 1.0;
+        EXPECT_FALSE(n_ref.equals(o));
+        EXPECT_FALSE(n_ref.equals_compatible(o));
+        EXPECT_EQ(n_ref.equals(o), !n_ref.diff(o,info));
+    }
+
+    // within epsilon
+    {
+        Node o(n_ref);
+        float64_array o_vals = o["b/d"].value();
+        o_vals[50] += 1e-4;
+        EXPECT_FALSE(n_ref.equals(o));
+        EXPECT_TRUE(n_ref.equals(o,1e-3));
+    }
+
+    // different string
+    {
+        Node o(n_ref);
+        o["b/c"].set_string("my strinG");
+        EXPECT_FALSE(n_ref.equals(o));
+    }
+
+    // extra child
+    {
+        Node o(n_ref), info;
+        o["f"] = 1;
+        EXPECT_FALSE(n_ref.equals(o));
+        EXPECT_TRUE(n_ref.equals_compatible(o));
+        EXPECT_FALSE(o.equals_compatible(n_ref));
+        EXPECT_EQ(n_ref.equals_compatible(o),
+                  !n_ref.diff_compatible(o,info));
+    }
+
+    // extra list entry
+    {
+        Node o(n_ref);
+        o["e"].append().set_int64(3);
+        EXPECT_FALSE(n_ref.equals(o));
+        EXPECT_TRUE(n_ref.equals_compatible(o));
+    }
+
+    // relaxed int compare
+    {
+        Node o(n_ref);
+        o["a"].set_int64(10);
+        EXPECT_FALSE(n_ref.equals(o));
+        EXPECT_TRUE(n_ref.equals(o,CONDUIT_EPSILON,true));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, compare_equals_large_leaves)
+{
+    // large enough to be split into several blocks
+    const index_t nele = 1000000;
+    Node n, o;
+    n.set(DataType::float64(nele));
+    float64 *n_ptr = n.value();
+    for(index_t i = 0; i < nele; i++)
+    {
+        n_ptr[i] = (float64) i;
+    }
+
+    // strided copy of the same values
+    std::vector<float64> strided((size_t)(2 * nele), -1.0);
+    for(index_t i = 0; i < nele; i++)
+    {
+        strided[(size_t)(2 * i)] = (float64) i;
+    }
+    o.set_external(DataType::float64(nele, 0, 2 * sizeof(float64)),
+                   &strided[0]);
+
+    EXPECT_TRUE(n.equals(o));
+    EXPECT_TRUE(o.equals(n));
+
+    strided[(size_t)(2 * (nele - 1))] += 1.0;
+    EXPECT_FALSE(n.equals(o));
+    EXPECT_FALSE(o.equals(n));
+
+    Node info;
+    EXPECT_EQ(n.equals(o), !n.diff(o,info));
+
+    // compact integer data
+    Node n_int, o_int;
+    n_int.set(DataType::int32(nele));
+    o_int.set(DataType::int32(nele));
+    int32 *n_int_ptr = n_int.value();
+    int32 *o_int_ptr = o_int.value();
+    for(index_t i = 0; i < nele; i++)
+    {
+        n_int_ptr[i] = (int32) i;
+        o_int_ptr[i] = (int32) i;
+    }
+    EXPECT_TRUE(n_int.equals(o_int));
+    o_int_ptr[nele/2] = -1;
+    EXPECT_FALSE(n_int.equals(o_int));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, compare_diff_max_diffs)
+{
+    const index_t n_num_children = 10;
+
+    Node n, o;
+    for(index_t ci = 0; ci < n_num_children; ci++)
+    {
+        std::string cs = to_string(ci);
+        n[cs].set(ci);
+        o[cs].set(ci+1);
+    }
+
+    Node opts, info;
+    opts["max_diffs"] = 3;
+
+    EXPECT_TRUE(n.diff(o, info, opts));
+    info.print();
+    EXPECT_EQ(info["children/diff"].number_of_children(), 3);
+    EXPECT_TRUE(info.has_child("info"));
+
+    EXPECT_TRUE(n.diff_compatible(o, info, opts));
+    EXPECT_EQ(info["children/diff"].number_of_children(), 3);
+
+    // no limit
+    opts.reset();
+    EXPECT_TRUE(n.diff(o, info, opts));
+    EXPECT_EQ(info["children/diff"].number_of_children(), n_num_children);
+    EXPECT_FALSE(info.has_child("info"));
+
+    // epsilon option is respected
+    n.set_float64(1.0);
+    o.set_float64(1.5);
+    EXPECT_TRUE(n.diff(o, info, opts));
+    opts["epsilon"] = 1.0;
+    EXPECT_FALSE(n.diff(o, info, opts));
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_yaml, check_string_diffs)
 {
@@ -484,3 +645,76 @@ TEST(conduit_yaml, check_string_diffs)
     
     
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, content_hash)
+{
+    Node n;
+    n["a/b"].set(DataType::float64(10));
+    n["a/c"] = "my string";
+    n["d"].append().set((int32)1);
+    n["d"].append().set((int32)2);
+
+    float64_array vals = n["a/b"].value();
+    for(index_t i = 0; i < 10; i++)
+    {
+        vals[i] = i * 0.5;
+    }
+
+    Node n_copy;
+    n_copy.set(n);
+    EXPECT_EQ(n.content_hash(),n_copy.content_hash());
+    EXPECT_EQ(n.structure_hash(),n_copy.structure_hash());
+
+    // same values w/ a strided layout
+    std::vector<float64> inter(20,0.0);
+    for(index_t i = 0; i < 10; i++)
+    {
+        inter[i*2] = i * 0.5;
+    }
+
+    Node n_strided;
+    n_strided.set(n);
+    n_strided["a/b"].set_external(DataType::float64(10,0,16),&inter[0]);
+    EXPECT_EQ(n.content_hash(),n_strided.content_hash());
+
+    Node hashes;
+    uint64 h = n.content_hash(hashes);
+    hashes.print();
+    EXPECT_EQ(h,n.content_hash());
+    EXPECT_TRUE(hashes.has_child("a"));
+    EXPECT_TRUE(hashes.has_child("a/b"));
+    EXPECT_TRUE(hashes.has_child("d/1"));
+    EXPECT_EQ(hashes.child("a/b").to_uint64(),n["a/b"].content_hash());
+
+    // change a value, only the hashes along its path should change
+    n_copy["d"][1].set((int32)3);
+    Node hashes_changed;
+    EXPECT_NE(n_copy.content_hash(hashes_changed),h);
+    EXPECT_EQ(n.structure_hash(),n_copy.structure_hash());
+
+    EXPECT_EQ(hashes.child("a").to_uint64(),
+              hashes_changed.child("a").to_uint64());
+    EXPECT_EQ(hashes.child("d/0").to_uint64(),
+              hashes_changed.child("d/0").to_uint64());
+    EXPECT_NE(hashes.child("d").to_uint64(),
+              hashes_changed.child("d").to_uint64());
+    EXPECT_NE(hashes.child("d/1").to_uint64(),
+              hashes_changed.child("d/1").to_uint64());
+
+    // structure changes
+    Node n_other;
+    n_other.set(n);
+    n_other["a/b"].set(DataType::float32(10));
+    EXPECT_NE(n.structure_hash(),n_other.structure_hash());
+    EXPECT_NE(n.content_hash(),n_other.content_hash());
+
+    // large leaf (several blocks)
+    Node n_big;
+    n_big.set(DataType::uint8(execution::DEFAULT_BLOCK_BYTES * 3 + 7));
+    Node n_big_copy;
+    n_big_copy.set(n_big);
+    EXPECT_EQ(n_big.content_hash(),n_big_copy.content_hash());
+    n_big_copy.as_uint8_ptr()[execution::DEFAULT_BLOCK_BYTES * 2 + 5] = 1;
+    EXPECT_NE(n_big.content_hash(),n_big_copy.content_hash());
+}
@@ -894,3 +894,19 @@ TEST(conduit_utils, value_fits)
 
 }
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, hash64)
+{
+    // xxHash64 reference value
+    EXPECT_EQ(utils::hash64(NULL,0),0xEF46DB3751D8E999ULL);
+
+    std::string s("conduit hash64 test string, long enough for all stripes");
+    EXPECT_EQ(utils::hash64(s),utils::hash64(s.c_str(),(index_t)s.size()));
+    EXPECT_NE(utils::hash64(s),utils::hash64(s,1));
+    EXPECT_NE(utils::hash64("a"),utils::hash64("b"));
+
+    uint64 h0 = utils::hash64("a");
+    uint64 h1 = utils::hash64("b");
+    EXPECT_NE(utils::hash64_combine(h0,h1),utils::hash64_combine(h1,h0));
+}
@@ -183,6 +183,39 @@ class Test_Relay_IO(unittest.TestCase):
         with self.assertRaises(IOError):
             relay.io.save_merged(n,"/bad/bad/bad/cant_write_here_either.conduit_bin");
 
+    def test_threaded_save_load(self):
+        # relay io releases the GIL, each thread uses its own nodes
+        import threading
+        num_threads = 4
+        errors = []
+        def save_load(idx):
+            try:
+                fname = "tout_python_relay_io_threaded_%d.conduit_bin" % idx
+                n = Node()
+                n['idx'] = int64(idx)
+                n['vals'] = arange(100000,dtype=float64) * idx
+                relay.io.save(n,fname)
+                n_load = Node()
+                relay.io.load(n_load,fname)
+                if n_load['idx'] != idx or \
+                   not all(n_load['vals'] == n['vals']):
+                    errors.append("thread %d: bad data" % idx)
+                # errors are still raised as python exceptions
+                try:
+                    relay.io.load(n_load,"garbage_%d.conduit_bin" % idx)
+                    errors.append("thread %d: no error" % idx)
+                except IOError:
+                    pass
+            except Exception as e:
+                errors.append(str(e))
+        threads = [threading.Thread(target=save_load, args=(i,))
+                   for i in range(num_threads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, [])
+
 
 
 
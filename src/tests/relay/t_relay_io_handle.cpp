@@ -10,6 +10,7 @@
 
 #include "conduit_relay.hpp"
 #include <iostream>
+#include <thread>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -827,3 +828,115 @@ TEST(conduit_relay_io_handle, test_ref_path_error_msg)
     }
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_concurrent_reads)
+{
+    const int num_domains = 16;
+    Node n;
+    for(int d = 0; d < num_domains; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d;
+        n[oss.str() + "/id"] = (int64) d;
+        n[oss.str() + "/values"].set(DataType::float64(1000));
+        float64_array vals = n[oss.str() + "/values"].value();
+        for(index_t i = 0; i < 1000; i++)
+        {
+            vals[i] = d * 1000.0 + i;
+        }
+    }
+
+    std::vector<std::string> protocols;
+    protocols.push_back("conduit_bin");
+    protocols.push_back("json");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    for(size_t p = 0; p < protocols.size(); p++)
+    {
+        const std::string protocol = protocols[p];
+        CONDUIT_INFO("Testing Relay IO Handle concurrent reads with protocol: "
+                     << protocol );
+        std::string test_file_name = "tout_conduit_relay_io_handle_concurrent."
+                                     + protocol;
+        utils::remove_path_if_exists(test_file_name);
+        io::save(n, test_file_name, protocol);
+
+        Node opts;
+        opts["mode"] = "r";
+        io::IOHandle h;
+        h.open(test_file_name, protocol, opts);
+
+        // each thread reads a different set of domains
+        const int num_threads = 4;
+        std::vector<Node> results(num_domains);
+        std::vector<int> errors(num_threads, 0);
+        std::vector<std::thread> threads;
+        for(int t = 0; t < num_threads; t++)
+        {
+            threads.push_back(std::thread([&, t]()
+            {
+                try
+                {
+                    for(int d = t; d < num_domains; d += num_threads)
+                    {
+                        std::ostringstream oss;
+                        oss << "domain_" << d;
+                        if(!h.has_path(oss.str()))
+                        {
+                            errors[t]++;
+                        }
+                        std::vector<std::string> names;
+                        h.list_child_names(oss.str(), names);
+                        if(names.size() != 2)
+                        {
+                            errors[t]++;
+                        }
+                        h.read(oss.str(), results[d]);
+                    }
+                }
+                catch(conduit::Error &)
+                {
+                    errors[t]++;
+                }
+            }));
+        }
+
+        // the free functions can be used at the same time as handles
+        Node loaded;
+        threads.push_back(std::thread([&]()
+        {
+            io::load(test_file_name, protocol, loaded);
+        }));
+
+        for(size_t t = 0; t < threads.size(); t++)
+        {
+            threads[t].join();
+        }
+
+        Node load_info;
+        EXPECT_FALSE(n.diff(loaded, load_info)) << load_info.to_yaml();
+
+        h.close();
+
+        for(int t = 0; t < num_threads; t++)
+        {
+            EXPECT_EQ(0, errors[t]);
+        }
+
+        for(int d = 0; d < num_domains; d++)
+        {
+            std::ostringstream oss;
+            oss << "domain_" << d;
+            Node info;
+            EXPECT_EQ(d, results[d]["id"].to_int64());
+            EXPECT_FALSE(n[oss.str()]["values"].diff(results[d]["values"], info))
+                << info.to_yaml();
+        }
+    }
+}
@@ -260,6 +260,112 @@ TEST(conduit_relay_io_handle, test_sidre_with_root)
     h.close();
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_sidre_buffer_cache)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    bool hdf5_enabled = io_protos["io/protocols/hdf5"].as_string() == "enabled";
+    if(!hdf5_enabled)
+    {
+        CONDUIT_INFO("HDF5 disabled, skipping sidre buffer cache test");
+        return;
+    }
+
+    // views b_v0, b_v1 and b_v2 share one buffer, b_v1 and b_v2 are
+    // strided, so reads of them alone only need part of the buffer
+    conduit::int64    conduit_vals_1[5] = {0,1,2,3,4};
+    conduit::float64  conduit_vals_2[6] = { 1.0, 2.0,
+                                            1.0, 2.0,
+                                            1.0, 2.0,};
+    std::vector<conduit::int64> conduit_vals_0;
+
+    Node n;
+    n["a0_i64"].set(conduit_vals_0.data(),0);
+    n["a5_i64"].set(conduit_vals_1,5);
+    // the external array was modified before it was saved
+    conduit_vals_1[4] = -5;
+    n["a5_i64_ext"].set(conduit_vals_1,5);
+    n["b_v0"].set(conduit_vals_2,0);
+    n["b_v1"].set(conduit_vals_2,
+                  3,
+                  0,
+                  2 * sizeof(conduit::float64));
+    n["b_v2"].set(conduit_vals_2,
+                  3,
+                  sizeof(conduit::float64),
+                  2 * sizeof(conduit::float64));
+
+    std::string sidre_file = relay_test_data_path(
+                                "texample_sidre_basic_ds_demo.sidre_hdf5");
+
+    // no resident buffers, a cap smaller than the shared buffer,
+    // and a cap that holds every buffer
+    index_t cache_bytes[3] = {0, 16, 1024 * 1024};
+
+    for(int i=0; i < 3; i++)
+    {
+        CONDUIT_INFO("buffer_cache_bytes: " << cache_bytes[i]);
+        Node opts;
+        opts["mode"] = "r";
+        opts["sidre/buffer_cache_bytes"] = cache_bytes[i];
+
+        io::IOHandle h;
+        h.open(sidre_file,"sidre_hdf5",opts);
+
+        Node n_read, n_info;
+        // read twice, the second pass is served by the caches
+        for(int pass=0; pass < 2; pass++)
+        {
+            NodeConstIterator itr = n.children();
+            while(itr.has_next())
+            {
+                const Node &n_expected = itr.next();
+                n_read.reset();
+                h.read("my_arrays/" + itr.name(),n_read);
+                EXPECT_FALSE(n_expected.diff(n_read,n_info));
+            }
+
+            n_read.reset();
+            h.read("my_arrays",n_read);
+            EXPECT_FALSE(n.diff(n_read,n_info));
+        }
+
+        EXPECT_TRUE(h.has_path("my_arrays/b_v1"));
+        EXPECT_FALSE(h.has_path("my_arrays/b_v7"));
+        EXPECT_FALSE(h.has_path("garbage"));
+
+        h.close();
+    }
+
+    // cache size must be a non-negative number
+    Node opts;
+    opts["sidre/buffer_cache_bytes"] = -1;
+    io::IOHandle h;
+    EXPECT_THROW(h.open(sidre_file,"sidre_hdf5",opts),conduit::Error);
+
+    // check per tree reads of a spio root file match with a cache
+    Node n_plain, n_cached, n_info;
+    opts["sidre/buffer_cache_bytes"] = 1024 * 1024;
+    io::IOHandle h_plain, h_cached;
+    h_plain.open(relay_test_data_path("out_spio_blueprint_example.root"),
+                 "sidre_hdf5");
+    h_cached.open(relay_test_data_path("out_spio_blueprint_example.root"),
+                  "sidre_hdf5",
+                  opts);
+    for(int i=0;i<4;i++)
+    {
+        std::ostringstream oss;
+        oss << i;
+        n_plain.reset();
+        n_cached.reset();
+        h_plain.read(oss.str() + "/mesh",n_plain);
+        h_cached.read(oss.str() + "/mesh/coordsets",n_cached["coordsets"]);
+        h_cached.read(oss.str() + "/mesh",n_cached);
+        EXPECT_FALSE(n_plain.diff(n_cached,n_info));
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_handle, test_sidre_bad_reads)
 {
@@ -1400,6 +1400,55 @@ TEST(conduit_relay_io_hdf5, conduit_hdf5_save_generic_options)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_write_options_are_scoped)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    Node n;
+    n["value"] = DataType::float64(5000);
+
+    Node opts;
+    opts["hdf5/chunking/threshold"]  = 2000;
+    opts["hdf5/chunking/chunk_size"] = 2000;
+
+    Node global_opts;
+    io::hdf5_options(global_opts);
+
+    std::string tout_std = "tout_hdf5_scoped_default_options.hdf5";
+    std::string tout_save = "tout_hdf5_scoped_save_options.hdf5";
+    std::string tout_handle = "tout_hdf5_scoped_handle_options.hdf5";
+
+    utils::remove_path_if_exists(tout_std);
+    utils::remove_path_if_exists(tout_save);
+    utils::remove_path_if_exists(tout_handle);
+
+    io::save(n,tout_std, "hdf5");
+    io::save(n,tout_save, "hdf5", opts);
+
+    Node h_opts;
+    h_opts["mode"] = "w";
+    h_opts["hdf5"] = opts["hdf5"];
+    io::IOHandle h;
+    h.open(tout_handle, "hdf5", h_opts);
+    h.write(n);
+    h.close();
+
+    // the options apply to these writes only
+    Node info;
+    Node after_opts;
+    io::hdf5_options(after_opts);
+    EXPECT_FALSE(global_opts.diff(after_opts, info)) << info.to_yaml();
+
+    int64 tout_std_fs = utils::file_size(tout_std);
+    EXPECT_TRUE(utils::file_size(tout_save) < tout_std_fs);
+    EXPECT_TRUE(utils::file_size(tout_handle) < tout_std_fs);
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_hdf5, conduit_hdf5_group_list_children)
 {
@@ -2081,3 +2130,129 @@ TEST(conduit_relay_io_hdf5, test_ref_path_error_msg)
    // //make sure we aren't leaking
    // EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_nd_shape)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout = "tout_hdf5_nd_shape.hdf5";
+    std::string tout_chunked = "tout_hdf5_nd_shape_chunked.hdf5";
+
+    Node n;
+    n["vals"].set(DataType::float64(4*5*6));
+    float64_array vals = n["vals"].value();
+    for(index_t i=0; i < vals.number_of_elements(); i++)
+    {
+        vals[i] = (float64) i;
+    }
+
+    index_t shape[3] = {4,5,6};
+    DataType dt_shaped(n["vals"].dtype());
+    dt_shaped.set_shape(shape,3);
+    Node n_shaped;
+    n_shaped["vals"].set_external(dt_shaped,n["vals"].data_ptr());
+
+    io::hdf5_write(n_shaped,tout);
+
+    Node opts;
+    opts["hdf5/compact_storage/enabled"] = "false";
+    opts["hdf5/chunking/threshold"]  = 100;
+    opts["hdf5/chunking/chunk_size"] = 8 * 6 * 2;
+    io::save(n_shaped,tout_chunked,"hdf5",opts);
+
+    // check the native dataset dims and the chunk dims
+    hid_t h5_file_id = H5Fopen(tout_chunked.c_str(),
+                               H5F_ACC_RDONLY,
+                               H5P_DEFAULT);
+    hid_t h5_dset_id = H5Dopen(h5_file_id, "vals", H5P_DEFAULT);
+    hid_t h5_dspace_id = H5Dget_space(h5_dset_id);
+    EXPECT_EQ(H5Sget_simple_extent_ndims(h5_dspace_id),3);
+    hsize_t dims[3];
+    H5Sget_simple_extent_dims(h5_dspace_id,dims,NULL);
+    EXPECT_EQ(dims[0],4);
+    EXPECT_EQ(dims[1],5);
+    EXPECT_EQ(dims[2],6);
+
+    hid_t h5_cprops_id = H5Dget_create_plist(h5_dset_id);
+    EXPECT_EQ(H5Pget_layout(h5_cprops_id),H5D_CHUNKED);
+    hsize_t chunk_dims[3];
+    EXPECT_EQ(H5Pget_chunk(h5_cprops_id,3,chunk_dims),3);
+    EXPECT_EQ(chunk_dims[0],1);
+    EXPECT_EQ(chunk_dims[1],2);
+    EXPECT_EQ(chunk_dims[2],6);
+
+    H5Pclose(h5_cprops_id);
+    H5Sclose(h5_dspace_id);
+    H5Dclose(h5_dset_id);
+    H5Fclose(h5_file_id);
+
+    // read back, the shape is kept
+    Node n_load, n_load_chunked, info;
+    io::hdf5_read(tout,n_load);
+    io::hdf5_read(tout_chunked,n_load_chunked);
+    EXPECT_EQ(n_load["vals"].dtype().shape(),dt_shaped.shape());
+    EXPECT_EQ(n_load_chunked["vals"].dtype().shape(),dt_shaped.shape());
+    EXPECT_FALSE(n_shaped.diff(n_load,info));
+    EXPECT_FALSE(n_shaped.diff(n_load_chunked,info));
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+
+    // offset, stride, and size reads are 1-D only
+    Node read_opts;
+    read_opts["offset"] = 2;
+    EXPECT_THROW(io::hdf5_read(tout + ":vals",read_opts,n_load),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_read_native_nd_dataset)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout = "tout_hdf5_read_native_nd_dataset.hdf5";
+
+    int32 data[2][3] = { {0, 1, 2}, {3, 4, 5} };
+    hsize_t dims[2] = {2, 3};
+
+    hid_t h5_file_id = H5Fcreate(tout.c_str(),
+                                 H5F_ACC_TRUNC,
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT);
+    hid_t h5_dspace_id = H5Screate_simple(2, dims, NULL);
+    hid_t h5_dset_id = H5Dcreate(h5_file_id,
+                                 "myarray",
+                                 H5T_NATIVE_INT32,
+                                 h5_dspace_id,
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT);
+    H5Dwrite(h5_dset_id,
+             H5T_NATIVE_INT32,
+             H5S_ALL,
+             H5S_ALL,
+             H5P_DEFAULT,
+             data);
+    H5Dclose(h5_dset_id);
+    H5Sclose(h5_dspace_id);
+    H5Fclose(h5_file_id);
+
+    Node n;
+    io::hdf5_read(tout,n);
+    n.print();
+
+    EXPECT_EQ(n["myarray"].dtype().number_of_dimensions(),2);
+    EXPECT_EQ(n["myarray"].dtype().dimension(0),2);
+    EXPECT_EQ(n["myarray"].dtype().dimension(1),3);
+    int32_array vals = n["myarray"].value();
+    for(index_t i=0; i < 6; i++)
+    {
+        EXPECT_EQ(vals[i],i);
+    }
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
@@ -9,7 +9,9 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay.hpp"
+#include "civetweb.h"
 #include <iostream>
+#include <limits>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -71,6 +73,169 @@ TEST(conduit_relay_web, node_viewer)
     delete n;
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_value_slice)
+{
+    Node n;
+    n.set(DataType::float64(100));
+    float64 *vals = n.value();
+    for(index_t i = 0; i < 100; i++)
+    {
+        vals[i] = (float64) i;
+    }
+
+    Node res;
+    web::NodeViewerRequestHandler::value_slice(n, 10, 5, 3, res);
+    EXPECT_EQ(res["number_of_elements"].to_index_t(), 100);
+    EXPECT_EQ(res["offset"].to_index_t(), 10);
+    EXPECT_EQ(res["stride"].to_index_t(), 3);
+    EXPECT_EQ(res["count"].to_index_t(), 5);
+    float64_array res_vals = res["values"].value();
+    EXPECT_EQ(res_vals.number_of_elements(), 5);
+    for(index_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(res_vals[i], 10.0 + 3.0 * i);
+    }
+    // values are a view, not a copy
+    EXPECT_EQ(res["values"].element_ptr(0), n.element_ptr(10));
+
+    // count is clamped to the end of the leaf
+    web::NodeViewerRequestHandler::value_slice(n, 95, -1, 2, res);
+    EXPECT_EQ(res["count"].to_index_t(), 3);
+    web::NodeViewerRequestHandler::value_slice(n, 100, 10, 1, res);
+    EXPECT_EQ(res["count"].to_index_t(), 0);
+
+    // invalid requests
+    EXPECT_THROW(web::NodeViewerRequestHandler::value_slice(n, 101, 1, 1, res),
+                 conduit::Error);
+    EXPECT_THROW(web::NodeViewerRequestHandler::value_slice(n, 0, 1, 0, res),
+                 conduit::Error);
+    Node obj;
+    obj["a"] = 1;
+    EXPECT_THROW(web::NodeViewerRequestHandler::value_slice(obj, 0, 1, 1, res),
+                 conduit::Error);
+
+    // offsets and strides near the index_t limits don't overflow
+    index_t max_idx = std::numeric_limits<index_t>::max();
+    EXPECT_THROW(web::NodeViewerRequestHandler::value_slice(n, max_idx, 1, 1,
+                                                            res),
+                 conduit::Error);
+    web::NodeViewerRequestHandler::value_slice(n, 99, -1, max_idx / 8, res);
+    EXPECT_EQ(res["count"].to_index_t(), 1);
+    res_vals = res["values"].value();
+    EXPECT_EQ(res_vals[0], 99.0);
+    EXPECT_THROW(web::NodeViewerRequestHandler::value_slice(n, 99, -1,
+                                                            max_idx / 8 + 1,
+                                                            res),
+                 conduit::Error);
+    EXPECT_THROW(web::NodeViewerRequestHandler::value_slice(n, 5, -1, max_idx,
+                                                            res),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_request_body_limit)
+{
+    Node n;
+    n["a"] = 42;
+
+    web::NodeViewerServer svr;
+    svr.set_port(9129);
+    svr.set_node(&n);
+    svr.serve();
+
+    char err_buff[256];
+    struct mg_connection *conn = NULL;
+
+    // small post bodies are read
+    std::string body = "cpath=a";
+    conn = mg_download("127.0.0.1", 9129, 0, err_buff, sizeof(err_buff),
+                       "POST /api/get-value HTTP/1.1\r\n"
+                       "Host: 127.0.0.1\r\n"
+                       "Content-Type: application/x-www-form-urlencoded\r\n"
+                       "Content-Length: %lu\r\n\r\n%s",
+                       (unsigned long)body.size(),
+                       body.c_str());
+    ASSERT_TRUE(conn != NULL);
+    EXPECT_EQ(std::string(mg_get_request_info(conn)->request_uri), "200");
+    mg_close_connection(conn);
+
+    // a body over the limit is rejected before it is read
+    conn = mg_download("127.0.0.1", 9129, 0, err_buff, sizeof(err_buff),
+                       "POST /api/get-value-slice HTTP/1.1\r\n"
+                       "Host: 127.0.0.1\r\n"
+                       "Content-Type: application/x-www-form-urlencoded\r\n"
+                       "Content-Length: %lu\r\n\r\n",
+                       (unsigned long)(64 * 1024 * 1024));
+    ASSERT_TRUE(conn != NULL);
+    EXPECT_EQ(std::string(mg_get_request_info(conn)->request_uri), "413");
+    mg_close_connection(conn);
+
+    svr.shutdown();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_value_summary)
+{
+    Node n;
+    n.set(DataType::float64(5));
+    float64 *vals = n.value();
+    vals[0] = 2.0;
+    vals[1] = -1.0;
+    vals[2] = std::numeric_limits<float64>::quiet_NaN();
+    vals[3] = 5.0;
+    vals[4] = 0.0;
+
+    Node res;
+    web::NodeViewerRequestHandler::value_summary(n, res);
+    EXPECT_EQ(res["number_of_elements"].to_index_t(), 5);
+    EXPECT_EQ(res["min"].to_float64(), -1.0);
+    EXPECT_EQ(res["max"].to_float64(), 5.0);
+    EXPECT_EQ(res["sum"].to_float64(), 6.0);
+    EXPECT_EQ(res["mean"].to_float64(), 1.5);
+    EXPECT_EQ(res["nan_count"].to_index_t(), 1);
+
+    std::vector<int32> ivals(3, 7);
+    n.set(ivals);
+    web::NodeViewerRequestHandler::value_summary(n, res);
+    EXPECT_EQ(res["dtype"].as_string(), "int32");
+    EXPECT_EQ(res["min"].to_int32(), 7);
+    EXPECT_EQ(res["nan_count"].to_index_t(), 0);
+
+    Node obj;
+    obj["a"] = 1;
+    obj["b"] = 2.0;
+    web::NodeViewerRequestHandler::value_summary(obj, res);
+    EXPECT_EQ(res["number_of_children"].to_index_t(), 2);
+    EXPECT_EQ(res["total_bytes_compact"].to_index_t(), 12);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_children_page)
+{
+    Node n;
+    for(int i = 0; i < 10; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        n[oss.str()].set(DataType::int64(i));
+    }
+
+    Node res;
+    web::NodeViewerRequestHandler::children_page(n, 8, 5, res);
+    EXPECT_EQ(res["number_of_children"].to_index_t(), 10);
+    EXPECT_EQ(res["count"].to_index_t(), 2);
+    EXPECT_EQ(res["children"].number_of_children(), 2);
+    EXPECT_EQ(res["children"][0]["name"].as_string(), "child_8");
+    EXPECT_EQ(res["children"][1]["number_of_elements"].to_index_t(), 9);
+
+    EXPECT_THROW(web::NodeViewerRequestHandler::children_page(n, 11, 1, res),
+                 conduit::Error);
+    EXPECT_THROW(web::NodeViewerRequestHandler::children_page(n["child_1"],
+                                                              0, 1, res),
+                 conduit::Error);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -9,7 +9,12 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay.hpp"
+#include "civetweb.h"
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -112,6 +117,432 @@ TEST(conduit_relay_web_websocket, websocket_test)
 }
 
 
+//-----------------------------------------------------------------------------
+// decodes a message, after splitting it into frames
+void
+decode_frames(const std::string &msg,
+              index_t max_frame_bytes,
+              web::BinaryMessageDecoder &decoder,
+              Node &res)
+{
+    index_t num_frames = web::BinaryMessageEncoder::number_of_frames(
+                                                            msg.size(),
+                                                            max_frame_bytes);
+    std::string frame;
+    for(index_t i = 0; i < num_frames; i++)
+    {
+        web::BinaryMessageEncoder::frame(msg, 7, i, max_frame_bytes, frame);
+        EXPECT_TRUE((index_t)frame.size() <= max_frame_bytes);
+        bool done = decoder.add_frame(frame.data(), frame.size());
+        EXPECT_EQ(done, i == num_frames - 1);
+    }
+    decoder.apply(res);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, binary_message_round_trip)
+{
+    Node n;
+    n["a"].set(DataType::int8(3));
+    n["b"].set(DataType::float64(1000));
+    n["c/d"] = "some text";
+    n["c/e"].set(DataType::uint32(10));
+    n["l"].append().set(1);
+    n["l"].append().set(2.5);
+
+    float64 *b_ptr = n["b"].value();
+    for(index_t i = 0; i < 1000; i++)
+    {
+        b_ptr[i] = i * 0.5;
+    }
+
+    web::BinaryMessageEncoder enc;
+    std::string msg;
+    enc.encode(n, msg);
+
+    // single frame
+    web::BinaryMessageDecoder dec;
+    Node res, info;
+    decode_frames(msg, msg.size() + 16, dec, res);
+    EXPECT_FALSE(n.diff(res, info));
+
+    // many small frames
+    Node res_frames;
+    decode_frames(msg, 100, dec, res_frames);
+    EXPECT_FALSE(n.diff(res_frames, info));
+
+    // leaf data is 8 byte aligned within the message
+    index_t header_bytes = *((uint32*)msg.data());
+    EXPECT_EQ(header_bytes % 8, 0);
+
+    // non compact and big endian input
+    Node n_be;
+    n.compact_to(n_be, Endianness::BIG_ID);
+    enc.encode(n_be, msg);
+    Node res_be;
+    web::BinaryMessageDecoder::apply_message(msg.data(), msg.size(), res_be);
+    EXPECT_FALSE(n.diff(res_be, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, binary_message_delta)
+{
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b"].set(DataType::int32(10));
+    n["c"] = "unchanged";
+    n["l"].append().set(1);
+    n["l"].append().set(2);
+
+    web::BinaryMessageEncoder enc;
+    web::BinaryMessageDecoder dec;
+    Node client;
+    std::string msg;
+
+    enc.encode(n, msg);
+    web::BinaryMessageDecoder::apply_message(msg.data(), msg.size(), client);
+    Node info;
+    EXPECT_FALSE(n.diff(client, info));
+
+    // nothing changed
+    EXPECT_FALSE(enc.encode_delta(n, msg));
+    EXPECT_TRUE(msg.empty());
+
+    // change one leaf
+    float64 *a_ptr = n["a"].value();
+    a_ptr[10] = 42.0;
+    EXPECT_TRUE(enc.encode_delta(n, msg));
+    std::string full_msg;
+    web::BinaryMessageEncoder full_enc;
+    full_enc.encode(n, full_msg);
+    // the delta only holds "a"
+    EXPECT_TRUE(msg.size() < full_msg.size());
+    web::BinaryMessageDecoder::apply_message(msg.data(), msg.size(), client);
+    EXPECT_FALSE(n.diff(client, info));
+
+    // change a list entry, add and remove leaves
+    n["l"].child(1).set(3.0);
+    n["d/e"] = 10;
+    n.remove("b");
+    EXPECT_TRUE(enc.encode_delta(n, msg));
+    web::BinaryMessageDecoder::apply_message(msg.data(), msg.size(), client);
+    EXPECT_FALSE(client.has_child("b"));
+    EXPECT_FALSE(n.diff(client, info));
+
+    // reset forces a full update
+    enc.reset();
+    EXPECT_TRUE(enc.encode_delta(n, msg));
+    Node fresh;
+    web::BinaryMessageDecoder::apply_message(msg.data(), msg.size(), fresh);
+    EXPECT_FALSE(n.diff(fresh, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, binary_message_errors)
+{
+    web::BinaryMessageDecoder dec;
+    std::string bad(32, 'x');
+    EXPECT_THROW(dec.add_frame(bad.data(), bad.size()), conduit::Error);
+    Node res;
+    EXPECT_THROW(dec.apply(res), conduit::Error);
+    EXPECT_THROW(web::BinaryMessageEncoder::number_of_frames(100, 16),
+                 conduit::Error);
+
+    // headers with offsets or strides outside of the message data
+    std::vector<std::string> bad_schemas;
+    bad_schemas.push_back("{\"dtype\":\"float64\", \"number_of_elements\": 4,"
+                          " \"offset\": 1000000}");
+    bad_schemas.push_back("{\"dtype\":\"float64\", \"number_of_elements\": 4,"
+                          " \"offset\": -64}");
+    bad_schemas.push_back("{\"dtype\":\"float64\", \"number_of_elements\": 4,"
+                          " \"stride\": 4611686018427387904}");
+    bad_schemas.push_back("{\"a\": {\"dtype\":\"int8\", \"number_of_elements\": 1},"
+                          " \"b\": {\"dtype\":\"float64\","
+                          " \"number_of_elements\": 1, \"offset\": 32}}");
+    for(size_t i = 0; i < bad_schemas.size(); i++)
+    {
+        std::string header = "{\"schema\": " + bad_schemas[i] + "}";
+        std::string msg(8, '\0');
+        uint32 header_bytes = (uint32)header.size();
+        for(int b = 0; b < 4; b++)
+        {
+            msg[b] = (char)((header_bytes >> (8 * b)) & 0xff);
+        }
+        msg += header;
+        // 32 bytes of data, the compact size of every schema above
+        msg += std::string(32, '\0');
+        EXPECT_THROW(web::BinaryMessageDecoder::apply_message(msg.data(),
+                                                              msg.size(),
+                                                              res),
+                     conduit::Error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// websocket client used to test publish / subscribe
+//-----------------------------------------------------------------------------
+struct PubSubClient
+{
+    std::mutex                mutex;
+    web::BinaryMessageDecoder decoder;
+    std::vector<std::string>  topics;
+    std::vector<Node>         messages;
+
+    index_t number_of_messages()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return (index_t)messages.size();
+    }
+
+    bool wait_for_messages(index_t num_messages)
+    {
+        for(int i = 0; i < 500 && number_of_messages() < num_messages; i++)
+        {
+            utils::sleep(10);
+        }
+        return number_of_messages() >= num_messages;
+    }
+};
+
+// the bundled civetweb does not pass user data to websocket client
+// handlers, so the client state is held here
+static PubSubClient *pubsub_client = NULL;
+
+//-----------------------------------------------------------------------------
+static int
+pubsub_client_data(struct mg_connection *, // conn -- unused
+                   int flags,
+                   char *data,
+                   size_t data_len,
+                   void *) // user_data -- unused
+{
+    PubSubClient *client = pubsub_client;
+    if((flags & 0xf) == WEBSOCKET_OPCODE_BINARY)
+    {
+        std::lock_guard<std::mutex> lock(client->mutex);
+        if(client->decoder.add_frame(data, data_len))
+        {
+            client->messages.push_back(Node());
+            client->decoder.apply(client->messages.back());
+            client->topics.push_back(client->decoder.topic());
+        }
+    }
+    return 1;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, publish_subscribe)
+{
+    web::WebServer svr;
+    svr.set_port(9127);
+    svr.set_document_root(web::web_client_root_directory());
+    svr.serve();
+
+    // publishing without subscribers is a no-op
+    Node data;
+    data["cycle"] = 0;
+    svr.publish("fields", data);
+
+    PubSubClient client;
+    pubsub_client = &client;
+    char err_buff[256];
+    struct mg_connection *conn = mg_connect_websocket_client("127.0.0.1",
+                                                             9127,
+                                                             0,
+                                                             err_buff,
+                                                             sizeof(err_buff),
+                                                             "/websocket",
+                                                             NULL,
+                                                             pubsub_client_data,
+                                                             NULL,
+                                                             NULL);
+    ASSERT_TRUE(conn != NULL);
+
+    web::WebSocket *wsock = svr.websocket(10, 5000);
+    ASSERT_TRUE(wsock != NULL);
+
+    std::string sub_msg = "{\"type\": \"subscribe\", \"topic\": \"fields\"}";
+    mg_websocket_client_write(conn,
+                              WEBSOCKET_OPCODE_TEXT,
+                              sub_msg.c_str(),
+                              sub_msg.size());
+
+    for(int i = 0; i < 500 && !wsock->is_subscribed("fields"); i++)
+    {
+        utils::sleep(10);
+    }
+    EXPECT_TRUE(wsock->is_subscribed("fields"));
+
+    // large enough to be sent as several frames
+    data["vals"].set(DataType::float64(300000));
+    float64 *vals_ptr = data["vals"].value();
+    for(index_t i = 0; i < 300000; i++)
+    {
+        vals_ptr[i] = (float64) i;
+    }
+
+    svr.publish("other", data);
+    svr.publish("fields", data);
+    EXPECT_TRUE(svr.wait_for_published());
+    ASSERT_TRUE(client.wait_for_messages(1));
+
+    Node info;
+    {
+        std::lock_guard<std::mutex> lock(client.mutex);
+        EXPECT_EQ(client.topics[0], "fields");
+        EXPECT_FALSE(data.diff(client.messages[0], info));
+    }
+
+    // broadcasts go to all connected websockets
+    Node bcast;
+    bcast["msg"] = "hello";
+    svr.broadcast(bcast);
+    EXPECT_TRUE(svr.wait_for_published());
+    ASSERT_TRUE(client.wait_for_messages(2));
+    {
+        std::lock_guard<std::mutex> lock(client.mutex);
+        EXPECT_EQ(client.topics[1], "");
+        EXPECT_FALSE(bcast.diff(client.messages[1], info));
+    }
+
+    // publishing faster than the client receives coalesces messages,
+    // the client always ends up with the last one
+    index_t num_pubs = 20;
+    for(index_t i = 1; i <= num_pubs; i++)
+    {
+        data["cycle"] = (int32) i;
+        svr.publish("fields", data);
+    }
+    EXPECT_TRUE(svr.wait_for_published());
+
+    index_t num_recv = num_pubs - svr.number_of_coalesced_messages();
+    EXPECT_TRUE(num_recv >= 1);
+    ASSERT_TRUE(client.wait_for_messages(num_recv + 2));
+    EXPECT_EQ(client.number_of_messages(), num_recv + 2);
+    {
+        std::lock_guard<std::mutex> lock(client.mutex);
+        EXPECT_EQ(client.messages.back()["cycle"].to_int32(), num_pubs);
+    }
+
+    // unsubscribe
+    wsock->unsubscribe("fields");
+    svr.publish("fields", data);
+    EXPECT_TRUE(svr.wait_for_published());
+    utils::sleep(100);
+    EXPECT_EQ(client.number_of_messages(), num_recv + 2);
+
+    mg_close_connection(conn);
+    svr.shutdown();
+    pubsub_client = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// a client that stops reading when it receives its first binary frame,
+// until it is released
+//-----------------------------------------------------------------------------
+struct StalledClient
+{
+    std::atomic<bool> stalled;
+    std::atomic<bool> released;
+};
+
+static StalledClient *stalled_client = NULL;
+
+//-----------------------------------------------------------------------------
+static int
+stalled_client_data(struct mg_connection *, // conn -- unused
+                    int flags,
+                    char *, // data -- unused
+                    size_t, // data_len -- unused
+                    void *) // user_data -- unused
+{
+    StalledClient *client = stalled_client;
+    if((flags & 0xf) == WEBSOCKET_OPCODE_BINARY)
+    {
+        client->stalled = true;
+        while(!client->released)
+        {
+            utils::sleep(10);
+        }
+    }
+    return 1;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, publish_stalled_client)
+{
+    web::WebServer svr;
+    svr.set_port(9128);
+    svr.set_document_root(web::web_client_root_directory());
+    svr.serve();
+
+    StalledClient client;
+    client.stalled  = false;
+    client.released = false;
+    stalled_client = &client;
+
+    char err_buff[256];
+    struct mg_connection *conn = mg_connect_websocket_client("127.0.0.1",
+                                                             9128,
+                                                             0,
+                                                             err_buff,
+                                                             sizeof(err_buff),
+                                                             "/websocket",
+                                                             NULL,
+                                                             stalled_client_data,
+                                                             NULL,
+                                                             NULL);
+    ASSERT_TRUE(conn != NULL);
+
+    web::WebSocket *wsock = svr.websocket(10, 5000);
+    ASSERT_TRUE(wsock != NULL);
+    wsock->subscribe("fields");
+
+    // releases the client if publish() blocks, so a failure can't hang
+    std::thread watchdog([&client]()
+    {
+        for(int i = 0; i < 1000 && !client.released; i++)
+        {
+            utils::sleep(10);
+        }
+        client.released = true;
+    });
+
+    // much larger than the socket buffers, so the send blocks while the
+    // client is stalled
+    Node data;
+    data["vals"].set(DataType::float64(8 * 1024 * 1024));
+    svr.publish("fields", data);
+
+    for(int i = 0; i < 500 && !client.stalled; i++)
+    {
+        utils::sleep(10);
+    }
+    EXPECT_TRUE(client.stalled);
+    EXPECT_FALSE(svr.wait_for_published(10, 200));
+
+    std::chrono::steady_clock::time_point start =
+                                    std::chrono::steady_clock::now();
+    Node small;
+    small["cycle"] = 1;
+    svr.publish("fields", small);
+    EXPECT_TRUE(wsock->is_connected());
+    EXPECT_TRUE(wsock->is_subscribed("fields"));
+    std::chrono::steady_clock::duration elapsed =
+                                std::chrono::steady_clock::now() - start;
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                        elapsed).count(),
+              1000);
+
+    client.released = true;
+    watchdog.join();
+    EXPECT_TRUE(svr.wait_for_published(10, 10000));
+
+    mg_close_connection(conn);
+    svr.shutdown();
+    stalled_client = NULL;
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {